@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -25,8 +27,24 @@ namespace Engine::Asset {
     using AssetError = Base::Error<AssetErrorCode>;
 
     class AssetCatalog final {
+    public:
+        // catalog 構築時の並列化設定
+        // - raw エントリを worker に分割し、path 解決 + id/type hash を並列に行う
+        // - 重複 id 検出とエラー報告は raw の順序で行う（結果はシングルスレッドと同一）
+        struct BuildOptions final {
+            // 0 = std::thread::hardware_concurrency()
+            std::uint32_t maxWorkers = 0;
+
+            // worker 1つあたりの最低エントリ数（小さい catalog はスレッド起動コストの方が高い）
+            std::size_t minEntriesPerWorker = 2048;
+        };
+
     public:
         AssetCatalog() = default;
+        explicit AssetCatalog(BuildOptions opt);
+
+        void SetBuildOptions(BuildOptions opt);
+        const BuildOptions& GetBuildOptions() const noexcept;
 
         void Clear();
 
@@ -47,6 +65,7 @@ namespace Engine::Asset {
                       const Resolver::AssetPathResolver& resolver);
 
     private:
+        BuildOptions buildOpt_{};
         std::unordered_map<AssetId, Catalog::CatalogEntry> map_;
     };
 
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <atomic>
+#include <coroutine>
 #include <cstdint>
 #include <deque>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
@@ -11,15 +16,18 @@
 #include "engine/asset/AssetId.hpp"
 #include "engine/asset/AssetRequest.hpp"
 #include "engine/asset/AssetState.hpp"
+#include "engine/asset/AssetTask.hpp"
 #include "engine/asset/AssetType.hpp"
 
 #include "engine/asset/core/AssetCachePolicy.hpp"
+#include "engine/asset/core/AssetDependencyGraph.hpp"
 #include "engine/asset/core/AssetLifetime.hpp"
 #include "engine/asset/core/AssetStatistics.hpp"
 #include "engine/asset/core/AssetStorage.hpp"
 
 #include "engine/base/Result.hpp"
 #include "engine/asset/loading/AssetPipeline.hpp"
+#include "engine/io/async/IoWorkerPool.hpp"
 #include "engine/asset/loading/LoadContext.hpp"
 
 #include "engine/asset/hot_reload/AssetWatcher.hpp"
@@ -42,9 +50,20 @@ namespace Engine::Asset {
             bool enableHotReload = false;
 
             // Reload するときは基本 KeepOldIfAny にする（開発中のUX優先）
+            // - reload トランザクションでは「1 件でも失敗したら何も差し替えない」になる
             bool reloadKeepOldIfAny = true;
         };
 
+        /// reload トランザクションの統計（テスト/デバッグ用）
+        struct ReloadStats final {
+            std::uint64_t transactions = 0; // 差し替えまで進んだトランザクション数
+            std::uint64_t swapped = 0;      // 差し替えた asset 数
+            std::uint64_t dependents = 0;   // うち、依存先が変わったために読み直したもの
+            std::uint64_t failed = 0;       // decode に失敗した asset 数
+            std::uint64_t rolledBack = 0;   // 失敗があって丸ごと差し替えなかったトランザクション数
+            std::uint64_t stale = 0;        // decode 中に evict / 読み直しされて差し替えなかった asset 数
+        };
+
         // 依存は参照で注入：Engine内の “組み立て” は EngineCore/Services の責務
         AssetManager(AssetCatalog& catalog,
                      Loading::AssetPipeline& pipeline,
@@ -53,6 +72,10 @@ namespace Engine::Asset {
                      Core::AssetCachePolicy& cachePolicy,
                      Core::AssetStatistics* stats = nullptr,
                      HotReload::AssetWatcher* watcher = nullptr);
+        ~AssetManager();
+
+        AssetManager(const AssetManager&) = delete;
+        AssetManager& operator=(const AssetManager&) = delete;
 
         void SetOptions(Options opt);
         const Options& GetOptions() const noexcept;
@@ -70,6 +93,41 @@ namespace Engine::Asset {
         // - Async: キューへ積み、すぐ Ok(handle) を返す（後で Ready になる）
         Base::Result<AssetHandle, AssetError> Load(const AssetId& id, const AssetRequest& request);
 
+        // ---- coroutine API ----
+        using LoadResult = Base::Result<AssetHandle, AssetError>;
+
+        // co_await manager.LoadAsync(id) の待ち受け
+        // - await 時に Load（Async）を発行し、record が Ready / Failed になったら再開する
+        // - 既に Ready（キャッシュヒット）なら suspend しない
+        // - 再開は executor が nullptr なら Update() の中、指定されていればその executor へ Post
+        // - 成功時の handle は Load と同じく参照カウント済み（不要になったら Release）
+        // - 待機中の coroutine（を持つ Task）を破棄しないこと / AssetManager より先に task を片付けること
+        class LoadAwaiter final {
+        public:
+            LoadAwaiter(AssetManager& mgr, AssetId id, AssetRequest req, IResumeExecutor* executor)
+                : mgr_(mgr), id_(id), req_(std::move(req)), executor_(executor) {}
+
+            bool await_ready();
+            void await_suspend(std::coroutine_handle<> h);
+            LoadResult await_resume() { return std::move(*result_); }
+
+        private:
+            friend class AssetManager;
+
+            AssetManager& mgr_;
+            AssetId id_;
+            AssetRequest req_;
+            IResumeExecutor* executor_ = nullptr;
+            std::optional<LoadResult> result_;
+        };
+
+        // request.sync は Async に上書きされる（Sync で待つなら Load を使う）
+        LoadAwaiter LoadAsync(const AssetId& id, AssetRequest request = AssetRequest::AsyncLoad(),
+                              IResumeExecutor* executor = nullptr);
+
+        // 待機中の coroutine 数（デバッグ/テスト用）
+        std::size_t PendingAwaiters() const noexcept { return waiters_.size(); }
+
         // 参照カウント（AssetStorage.refCount）操作
         // - Load() は内部で Acquire 相当（refCount++）する設計
         bool Acquire(const AssetHandle& h);
@@ -106,9 +164,36 @@ namespace Engine::Asset {
         bool EvictIfPossible(const AssetId& id);
 
         // HotReload 用：外部から watch 登録したい場合
-        void Watch(const AssetId& id, std::string resolvedPath);
+        void Watch(const AssetId& id, Core::InternedPath resolvedPath);
+        void Watch(const AssetId& id, std::string_view resolvedPath);
         void Unwatch(const AssetId& id);
 
+        // ---- reload トランザクション ----
+        // 変更のあった asset（RequestReload / watcher）は次の Update で 1 つのトランザクションにまとめる
+        // - 依存グラフを辿って、変わった asset に依存する asset も一緒に読み直す
+        // - 全部の decode が終わってから、同じ Update の中で全部を差し替えて generation を進める
+        //   （差し替えは asset 1 件につき AnyAsset の swap だけ。旧 asset の解放は差し替えの後）
+        // - 読み直すのは Ready の record だけ。Failed / Unloaded の record は通常の reload キューへ回す
+        // - decode 中に来た変更は次のトランザクションに入る
+
+        // id が deps を使って作られていることを登録する（前の登録は置き換え）
+        void SetDependencies(const AssetId& id, Base::ConstSpan<AssetId> deps);
+        const Core::AssetDependencyGraph& Dependencies() const noexcept { return deps_; }
+
+        void RequestReload(const AssetId& id);
+
+        // decode を共有 IoWorkerPool で行う pipeline を指定する（nullptr なら Update の中で decode する）
+        // - pipeline_ とは別のインスタンスを渡すこと（AssetPipeline は作業領域を持つのでスレッドをまたいで共有できない）
+        // - IAssetSource / IAssetLoader は pipeline_ と同時に呼ばれても良いものであること
+        // - decode 中は LoadContext::statistics を渡さない（AssetStatistics はスレッドセーフではない）
+        void SetReloadPipeline(Loading::AssetPipeline* pipeline);
+
+        // decode 中のトランザクションがあるか / decode が終わるまで待つ（差し替えは次の Update）
+        bool ReloadInFlight() const noexcept { return reloadTxn_ != nullptr; }
+        void WaitForReload();
+
+        const ReloadStats& GetReloadStats() const noexcept { return reloadStats_; }
+
     private:
         struct PendingLoad final {
             AssetId id;
@@ -119,7 +204,15 @@ namespace Engine::Asset {
         // ---- internal helpers ----
         struct ResolvedEntry final {
             AssetType type{};
-            std::string resolvedPath;
+            Core::InternedPath resolvedPath;
+        };
+
+        // ProcessQueue_ で 1 フレーム分をまとめてロードするときの 1 件
+        struct BatchJob final {
+            Core::AssetRecord* rec = nullptr; // AssetStorage の record は unique_ptr 管理なのでアドレスは安定
+            ResolvedEntry entry;
+            AssetRequest req;
+            bool wasReady = false;
         };
 
         // AssetCatalog から (type, resolvedPath) を引く
@@ -131,6 +224,12 @@ namespace Engine::Asset {
         // 実ロード（Sync）
         Base::Result<void, AssetError> DoLoadSync_(Core::AssetRecord& rec, const ResolvedEntry& e, const AssetRequest& req);
 
+        Loading::LoadContext MakeContext_(const Core::AssetRecord& rec, const ResolvedEntry& e, const AssetRequest& req) const;
+
+        // pipeline の結果を record に反映（fallback / generation / 統計）
+        Base::Result<void, AssetError> ApplyLoadResult_(Core::AssetRecord& rec, const ResolvedEntry& e, const AssetRequest& req,
+                                                        bool wasReady, Base::Result<Core::AnyAsset, AssetError>&& r);
+
         // Async キュー操作
         void EnqueueLoad_(const AssetId& id, const AssetRequest& req);
         void ProcessQueue_();
@@ -138,6 +237,14 @@ namespace Engine::Asset {
         // Hot reload
         void ProcessHotReload_();
 
+        // reload トランザクション：終わったものを差し替えて、溜まった要求で次を始める
+        void ProcessReload_();
+        void BeginReload_();
+        void CommitReload_();
+
+        // LoadAsync の待ち受けのうち、record が Ready / Failed になったものを再開する
+        void ResumeAwaiters_();
+
         // Record検索（staleチェックは呼び出し側）
         Core::AssetRecord* FindRecord_(const AssetHandle& h);
         const Core::AssetRecord* FindRecordConst_(const AssetHandle& h) const;
@@ -156,6 +263,44 @@ namespace Engine::Asset {
 
         std::deque<PendingLoad> queue_;
         std::unordered_set<AssetId> queued_; // 重複防止
+
+        // LoadAsync で suspend 中の待ち受け（awaiter は coroutine frame 内にあるので生存は保証される）
+        struct Waiter final {
+            LoadAwaiter* awaiter = nullptr;
+            std::coroutine_handle<> handle;
+        };
+        std::vector<Waiter> waiters_;
+
+        // ProcessQueue_ の作業領域（フレーム毎の確保を避ける）
+        std::vector<BatchJob> batchJobs_;
+        std::vector<Loading::LoadContext> batchContexts_;
+        std::vector<Base::Result<Core::AnyAsset, AssetError>> batchResults_;
+
+        // ---- reload トランザクション ----
+        struct ReloadJob final {
+            AssetId id;
+            std::uint32_t generation = 0; // BeginReload_ 時点の record の generation（変わっていたら差し替えない）
+            bool dependent = false;       // 自分は変わっていない（依存先が変わった）
+        };
+
+        // decode は共有 IoWorkerPool で行う。その間 pool と共有するのは contexts / results / decoded だけ
+        struct ReloadTxn final {
+            AssetRequest req;
+            std::vector<ReloadJob> jobs;
+            std::vector<Loading::LoadContext> contexts; // ctx.request は &req
+            std::vector<Base::Result<Core::AnyAsset, AssetError>> results;
+            std::atomic<bool> decoded{ false };
+            Engine::IO::Async::InFlightCounter inflight; // pool 上の decode（WaitForReload で待つ）
+        };
+
+        Core::AssetDependencyGraph deps_;
+        Loading::AssetPipeline* reloadPipeline_ = nullptr;
+
+        std::vector<AssetId> reloadRequests_;         // 次のトランザクションに入れる id（要求順）
+        std::unordered_set<AssetId> reloadRequested_; // 重複防止
+        std::unique_ptr<ReloadTxn> reloadTxn_;        // decode 中（または差し替え待ち）のトランザクション
+        std::vector<AssetId> reloadAffected_;         // BeginReload_ の作業領域
+        ReloadStats reloadStats_{};
     };
 
 } // namespace Engine::Asset
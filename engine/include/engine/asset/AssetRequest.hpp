@@ -50,6 +50,8 @@ struct AssetRequest final {
     // パス上書き（任意）
     // - 通常は Catalog を使う
     // - テスト/ツール/一時的なデバッグロードで直接指定したい場合用
+    // - catalog に無い id でも、type hint（useTypeHint + expectedType）と一緒なら読める
+    //   （type を決められないので、hint 無しなら CatalogNotFound）
     std::string overridePath;
 
     // cache/policy hint（任意）
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Engine::Asset {
+
+    // IResumeExecutor：co_await の再開先（スレッド / タイミング）を選ぶ
+    // - nullptr を渡した場合は AssetManager::Update の中（= メインスレッド）で再開する
+    class IResumeExecutor {
+    public:
+        virtual ~IResumeExecutor() = default;
+        virtual void Post(std::coroutine_handle<> h) = 0;
+    };
+
+    // ManualExecutor：積まれた coroutine を RunPending を呼んだスレッドで再開する
+    // - 「フレームの特定の位置で再開したい」「別スレッドのループで回したい」用
+    class ManualExecutor final : public IResumeExecutor {
+    public:
+        void Post(std::coroutine_handle<> h) override {
+            std::lock_guard<std::mutex> lk(mutex_);
+            pending_.push_back(h);
+        }
+
+        // 戻り値は再開した数（再開中に積まれた分は次回）
+        std::size_t RunPending() {
+            std::deque<std::coroutine_handle<>> run;
+            {
+                std::lock_guard<std::mutex> lk(mutex_);
+                run.swap(pending_);
+            }
+            for (auto h : run) h.resume();
+            return run.size();
+        }
+
+    private:
+        std::mutex mutex_;
+        std::deque<std::coroutine_handle<>> pending_;
+    };
+
+    template<class T>
+    class Task;
+
+    namespace detail {
+
+        // 終了時に continuation（co_await している側）へ制御を渡す
+        struct TaskFinalAwaiter final {
+            bool await_ready() const noexcept { return false; }
+
+            template<class Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) noexcept {
+                auto& p = h.promise();
+                if (p.continuation) return p.continuation;
+                if (p.detached) h.destroy(); // 投げっぱなし：自分で片付ける
+                return std::noop_coroutine();
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        struct TaskPromiseBase {
+            std::coroutine_handle<> continuation;
+            bool detached = false;
+
+            std::suspend_always initial_suspend() const noexcept { return {}; } // lazy：co_await / Start で開始
+            TaskFinalAwaiter final_suspend() const noexcept { return {}; }
+
+            // engine は例外を使わない（Result で返す）。漏れたら即終了
+            void unhandled_exception() const noexcept { std::terminate(); }
+        };
+
+        template<class T>
+        struct TaskPromise final : TaskPromiseBase {
+            std::optional<T> value;
+
+            Task<T> get_return_object() noexcept;
+
+            template<class U>
+            void return_value(U&& v) { value.emplace(std::forward<U>(v)); }
+
+            T Take() { return std::move(*value); }
+        };
+
+        template<>
+        struct TaskPromise<void> final : TaskPromiseBase {
+            Task<void> get_return_object() noexcept;
+            void return_void() const noexcept {}
+            void Take() const noexcept {}
+        };
+
+    } // namespace detail
+
+    // Task<T>：ロード処理を順に書くための coroutine 型
+    // - lazy：作っただけでは走らない。co_await されるか Start / Detach で開始する
+    // - co_await task で結果を受け取る（完了すると await 側をそのまま再開する）
+    // - Task を破棄すると coroutine も破棄される（Detach した場合は完了時に自分で破棄）
+    // - 1 スレッドから扱う前提（再開スレッドは IResumeExecutor で選ぶ）
+    template<class T>
+    class Task final {
+    public:
+        using promise_type = detail::TaskPromise<T>;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        Task() = default;
+        explicit Task(Handle h) noexcept : h_(h) {}
+        Task(Task&& o) noexcept : h_(std::exchange(o.h_, {})) {}
+        Task& operator=(Task&& o) noexcept {
+            if (this != &o) {
+                Reset_();
+                h_ = std::exchange(o.h_, {});
+            }
+            return *this;
+        }
+        ~Task() { Reset_(); }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        bool Valid() const noexcept { return static_cast<bool>(h_); }
+        bool IsDone() const noexcept { return h_ && h_.done(); }
+
+        // 最上位の task を開始する（最初の co_await まで呼び出し元で走る）
+        void Start() {
+            if (h_ && !h_.done()) h_.resume();
+        }
+
+        // 開始して所有権を手放す（完了時に coroutine が自分を破棄する。結果は捨てる）
+        void Detach() {
+            if (!h_) return;
+            Handle h = std::exchange(h_, {});
+            h.promise().detached = true;
+            if (h.done()) { h.destroy(); return; }
+            h.resume();
+        }
+
+        // 完了後に結果を取り出す（IsDone() が true のときのみ）
+        T Result() { return h_.promise().Take(); }
+
+        // ---- awaitable ----
+        bool await_ready() const noexcept { return !h_ || h_.done(); }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            h_.promise().continuation = awaiting;
+            return h_; // symmetric transfer で子を開始
+        }
+
+        T await_resume() { return h_.promise().Take(); }
+
+    private:
+        void Reset_() noexcept {
+            if (h_) h_.destroy();
+            h_ = {};
+        }
+
+    private:
+        Handle h_{};
+    };
+
+    namespace detail {
+        template<class T>
+        Task<T> TaskPromise<T>::get_return_object() noexcept {
+            return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+        }
+
+        inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+            return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+        }
+
+        // WhenAll の子：開始即実行、完了したら自分で消える
+        struct WhenAllChild final {
+            struct promise_type final {
+                WhenAllChild get_return_object() const noexcept { return {}; }
+                std::suspend_never initial_suspend() const noexcept { return {}; }
+                std::suspend_never final_suspend() const noexcept { return {}; }
+                void return_void() const noexcept {}
+                void unhandled_exception() const noexcept { std::terminate(); }
+            };
+        };
+
+        struct WhenAllState final {
+            std::atomic<std::size_t> remaining{ 0 };
+            std::coroutine_handle<> parent;
+
+            // 最後に終わった子（または全部が同期で終わった場合は親自身）が親を再開する
+            void Arrive() {
+                if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) parent.resume();
+            }
+        };
+
+        template<class T>
+        WhenAllChild RunWhenAllChild(Task<T>& task, std::optional<T>& slot, WhenAllState& state) {
+            slot.emplace(co_await task);
+            state.Arrive();
+        }
+
+        inline WhenAllChild RunWhenAllChild(Task<void>& task, WhenAllState& state) {
+            co_await task;
+            state.Arrive();
+        }
+
+        struct WhenAllAwaiter final {
+            WhenAllState& state;
+            std::size_t count;
+            void (*startAll)(void* ctx);
+            void* ctx;
+
+            bool await_ready() const noexcept { return count == 0; }
+
+            bool await_suspend(std::coroutine_handle<> parent) {
+                state.parent = parent;
+                // +1 は「全部を開始し終えるまで親を再開させない」ための自分の分
+                state.remaining.store(count + 1, std::memory_order_relaxed);
+                startAll(ctx);
+                // 自分の分を引く。0 になった（全部同期で終わった）なら suspend しない
+                return state.remaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+            }
+
+            void await_resume() const noexcept {}
+        };
+    } // namespace detail
+
+    // WhenAll：すべての task を同時に開始し、全部終わったら結果を入力順で返す
+    // - 各 task の co_await LoadAsync は同じフレームでキューに積まれるので、まとめて読み込まれる
+    template<class T>
+    Task<std::vector<T>> WhenAll(std::vector<Task<T>> tasks) {
+        detail::WhenAllState state;
+        std::vector<std::optional<T>> slots(tasks.size());
+
+        struct Ctx final {
+            std::vector<Task<T>>* tasks;
+            std::vector<std::optional<T>>* slots;
+            detail::WhenAllState* state;
+        } ctx{ &tasks, &slots, &state };
+
+        co_await detail::WhenAllAwaiter{
+            state, tasks.size(),
+            [](void* p) {
+                auto& c = *static_cast<Ctx*>(p);
+                for (std::size_t i = 0; i < c.tasks->size(); ++i) {
+                    detail::RunWhenAllChild((*c.tasks)[i], (*c.slots)[i], *c.state);
+                }
+            },
+            &ctx
+        };
+
+        std::vector<T> out;
+        out.reserve(slots.size());
+        for (auto& s : slots) out.push_back(std::move(*s));
+        co_return out;
+    }
+
+    inline Task<void> WhenAll(std::vector<Task<void>> tasks) {
+        detail::WhenAllState state;
+
+        struct Ctx final {
+            std::vector<Task<void>>* tasks;
+            detail::WhenAllState* state;
+        } ctx{ &tasks, &state };
+
+        co_await detail::WhenAllAwaiter{
+            state, tasks.size(),
+            [](void* p) {
+                auto& c = *static_cast<Ctx*>(p);
+                for (auto& t : *c.tasks) detail::RunWhenAllChild(t, *c.state);
+            },
+            &ctx
+        };
+    }
+
+} // namespace Engine::Asset
@@ -4,6 +4,7 @@
 
 #include "engine/asset/AssetId.hpp"
 #include "engine/asset/AssetType.hpp"
+#include "engine/asset/core/InternedPath.hpp"
 
 
 namespace Engine::Asset::Catalog {
@@ -12,7 +13,7 @@ namespace Engine::Asset::Catalog {
         AssetId id{};
         AssetType type{};
         std::string sourcePath;   // assets/ からの相対パスを想定（例: "textures/player.png"）
-        std::string resolvedPath; //
+        Core::InternedPath resolvedPath; // 解決済みパス（PathArena に intern 済み。record/watcher と共有）
 
         // 将来拡張用（必要になったら足す）
         // std::string variant;   // 例: "hd", "sd"
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "engine/asset/AssetId.hpp"
+#include "engine/base/Span.hpp"
+
+namespace Engine::Asset::Core {
+
+// AssetDependencyGraph:
+// - 「asset A は B を使って作られている（B が変われば A も作り直す）」の関係を持つ
+// - AssetManager が hot reload で「変わった asset + それに依存する asset」をまとめるのに使う
+// - 依存は asset 単位で丸ごと置き換える（SetDependencies は前の依存を消してから張る）
+//
+// 例：material -> texture なら SetDependencies(material, { texture })
+//     texture が変わると CollectAffected({ texture }) は texture, material の順に返す
+class AssetDependencyGraph final {
+public:
+    void Clear() {
+        deps_.clear();
+        dependents_.clear();
+    }
+
+    // id の依存を deps で置き換える（空なら依存なし）
+    void SetDependencies(const AssetId& id, Base::ConstSpan<AssetId> deps) {
+        RemoveDependencies_(id);
+        if (deps.empty()) return;
+
+        auto& out = deps_[id];
+        for (const AssetId& d : deps) {
+            if (d == id) continue; // 自己依存は無視
+            if (std::find(out.begin(), out.end(), d) != out.end()) continue;
+            out.push_back(d);
+            dependents_[d].push_back(id);
+        }
+        if (out.empty()) deps_.erase(id);
+    }
+
+    // id が依存している側としても、依存される側としても消える（evict 時など）
+    void Remove(const AssetId& id) {
+        RemoveDependencies_(id);
+        auto it = dependents_.find(id);
+        if (it == dependents_.end()) return;
+
+        // id に依存していた asset の依存リストから id を抜く
+        for (const AssetId& user : it->second) {
+            auto dit = deps_.find(user);
+            if (dit == deps_.end()) continue;
+            EraseValue_(dit->second, id);
+            if (dit->second.empty()) deps_.erase(dit);
+        }
+        dependents_.erase(it);
+    }
+
+    // id が直接依存している asset（無ければ空）
+    Base::ConstSpan<AssetId> DependenciesOf(const AssetId& id) const noexcept {
+        auto it = deps_.find(id);
+        if (it == deps_.end()) return {};
+        return Base::ConstSpan<AssetId>(it->second.data(), it->second.size());
+    }
+
+    // id に直接依存している asset（無ければ空）
+    Base::ConstSpan<AssetId> DependentsOf(const AssetId& id) const noexcept {
+        auto it = dependents_.find(id);
+        if (it == dependents_.end()) return {};
+        return Base::ConstSpan<AssetId>(it->second.data(), it->second.size());
+    }
+
+    // roots と、それに（推移的に）依存する asset を重複なしで out に返す
+    // - 順序は「依存される側が先」（roots の中で依存関係があればそれにも従う）
+    // - 循環があっても止まる（循環の中の順序は不定）
+    void CollectAffected(Base::ConstSpan<AssetId> roots, std::vector<AssetId>& out) const {
+        out.clear();
+
+        // 1) roots から dependents_ を辿って影響範囲を集める
+        std::unordered_set<AssetId> affected;
+        std::vector<AssetId> stack(roots.begin(), roots.end());
+        while (!stack.empty()) {
+            const AssetId id = stack.back();
+            stack.pop_back();
+            if (!affected.insert(id).second) continue;
+            auto it = dependents_.find(id);
+            if (it == dependents_.end()) continue;
+            for (const AssetId& user : it->second) stack.push_back(user);
+        }
+
+        // 2) 影響範囲の中だけで帰りがけ順に並べる（依存先を先に出す）
+        std::unordered_set<AssetId> visited;
+        visited.reserve(affected.size());
+        for (const AssetId& id : roots) {
+            VisitPostOrder_(id, affected, visited, out);
+        }
+        for (const AssetId& id : affected) {
+            VisitPostOrder_(id, affected, visited, out);
+        }
+    }
+
+    std::size_t NodeCount() const noexcept { return deps_.size(); }
+
+private:
+    static void EraseValue_(std::vector<AssetId>& v, const AssetId& value) {
+        v.erase(std::remove(v.begin(), v.end(), value), v.end());
+    }
+
+    void RemoveDependencies_(const AssetId& id) {
+        auto it = deps_.find(id);
+        if (it == deps_.end()) return;
+        for (const AssetId& d : it->second) {
+            auto dit = dependents_.find(d);
+            if (dit == dependents_.end()) continue;
+            EraseValue_(dit->second, id);
+            if (dit->second.empty()) dependents_.erase(dit);
+        }
+        deps_.erase(it);
+    }
+
+    // 反復版の帰りがけ順（依存の深い asset でもスタックを使い切らない）
+    void VisitPostOrder_(const AssetId& root,
+                         const std::unordered_set<AssetId>& affected,
+                         std::unordered_set<AssetId>& visited,
+                         std::vector<AssetId>& out) const {
+        if (!visited.insert(root).second) return;
+
+        struct Frame final {
+            AssetId id;
+            std::size_t next = 0;
+        };
+        std::vector<Frame> stack;
+        stack.push_back(Frame{ root, 0 });
+
+        while (!stack.empty()) {
+            Frame& f = stack.back();
+            const Base::ConstSpan<AssetId> deps = DependenciesOf(f.id);
+            if (f.next < deps.size()) {
+                const AssetId d = deps[f.next++];
+                if (affected.find(d) == affected.end()) continue; // 変わっていない依存先は出さない
+                if (!visited.insert(d).second) continue;
+                stack.push_back(Frame{ d, 0 });
+                continue;
+            }
+            out.push_back(f.id);
+            stack.pop_back();
+        }
+    }
+
+private:
+    std::unordered_map<AssetId, std::vector<AssetId>> deps_;       // id -> 依存先
+    std::unordered_map<AssetId, std::vector<AssetId>> dependents_; // id -> id に依存している asset
+};
+
+} // namespace Engine::Asset::Core
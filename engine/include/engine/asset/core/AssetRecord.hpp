@@ -10,6 +10,7 @@
 #include "engine/asset/AssetError.hpp"
 
 #include "engine/asset/core/AnyAsset.hpp"
+#include "engine/asset/core/InternedPath.hpp"
 #include "engine/base/Error.hpp"
 
 namespace Engine::Asset::Core {
@@ -24,7 +25,8 @@ namespace Engine::Asset::Core {
         AssetType type{};
 
         // - AssetCatalog が解決済みにする設計なら、LoadContext に渡しやすい
-        std::string resolvedPath;
+        // - catalog と同じ intern 済みハンドルを共有する（record ごとに文字列を複製しない）
+        InternedPath resolvedPath;
 
         AssetState state = AssetState::Unloaded;
 
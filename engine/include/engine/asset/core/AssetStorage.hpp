@@ -21,6 +21,7 @@ public:
     AssetStorage() = default;
 
     void Clear() {
+        for (const auto& [id, rec] : records_) Retire_(*rec);
         records_.clear();
     }
 
@@ -41,7 +42,7 @@ public:
     }
 
     // 無ければ作る。type/path は「初回作成時のみ」設定する（既存なら保持）
-    AssetRecord& GetOrCreate(const AssetId& id, const AssetType& type, std::string resolvedPath = {}) {
+    AssetRecord& GetOrCreate(const AssetId& id, const AssetType& type, InternedPath resolvedPath = {}) {
         auto it = records_.find(id);
         if (it != records_.end()) {
             return *it->second;
@@ -50,8 +51,9 @@ public:
         auto rec = std::make_unique<AssetRecord>();
         rec->id = id;
         rec->type = type;
-        rec->resolvedPath = std::move(resolvedPath);
+        rec->resolvedPath = resolvedPath;
         rec->state = AssetState::Unloaded;
+        rec->generation = nextGeneration_;
 
         auto* ptr = rec.get();
         records_.emplace(id, std::move(rec));
@@ -59,9 +61,9 @@ public:
     }
 
     // “pathだけ後から埋めたい” 用（Catalog構築→Storage作成の順序差に対応）
-    void SetResolvedPathIfEmpty(const AssetId& id, std::string resolvedPath) {
+    void SetResolvedPathIfEmpty(const AssetId& id, InternedPath resolvedPath) {
         if (auto* r = Find(id)) {
-            if (r->resolvedPath.empty()) r->resolvedPath = std::move(resolvedPath);
+            if (r->resolvedPath.empty()) r->resolvedPath = resolvedPath;
         }
     }
 
@@ -88,12 +90,21 @@ public:
         if (it == records_.end()) return;
 
         if (force || it->second->refCount == 0) {
+            Retire_(*it->second);
             records_.erase(it);
         }
     }
 
+private:
+    // 消した record の generation は作り直した record で使わない
+    // （evict -> 再 Load の前に取った handle / reload トランザクションを古いものとして弾けるように）
+    void Retire_(const AssetRecord& rec) noexcept {
+        if (rec.generation >= nextGeneration_) nextGeneration_ = rec.generation + 1;
+    }
+
 private:
     std::unordered_map<AssetId, std::unique_ptr<AssetRecord>> records_;
+    std::uint32_t nextGeneration_ = 1; // 新しい record の generation
 };
 
 } // namespace Engine::Asset::Core
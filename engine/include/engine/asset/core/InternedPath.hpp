@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine::Asset::Core {
+
+    class PathArena;
+
+    // InternedPath：PathArena に一度だけ格納された resolvedPath への軽量ハンドル
+    // - 中身は arena 内ノードへのポインタ 1つ（コピーは pointer copy）
+    // - 比較はノードのアドレスで行う。同じ文字列は必ず同じハンドルになる
+    // - View() は arena が生きている限り有効（arena は append-only で解放しない）
+    class InternedPath final {
+    public:
+        using IdType = std::uint32_t;
+
+        InternedPath() = default;
+
+        // グローバル arena に intern する（空文字は空ハンドル）
+        static InternedPath Intern(std::string_view s);
+
+        bool empty() const noexcept { return node_ == nullptr; }
+        explicit operator bool() const noexcept { return !empty(); }
+
+        // 0 = 空ハンドル。intern 順に 1,2,3... が振られる
+        IdType Id() const noexcept { return node_ ? node_->id : 0; }
+
+        std::string_view View() const noexcept {
+            return node_ ? std::string_view(node_->data, node_->size) : std::string_view{};
+        }
+
+        // NUL 終端済み（OS API にそのまま渡せる）
+        const char* CStr() const noexcept { return node_ ? node_->data : ""; }
+
+        // AssetError::detail など、所有文字列が必要な箇所用
+        std::string Str() const { return std::string(View()); }
+
+        friend bool operator==(InternedPath a, InternedPath b) noexcept { return a.node_ == b.node_; }
+        friend bool operator!=(InternedPath a, InternedPath b) noexcept { return a.node_ != b.node_; }
+
+    private:
+        friend class PathArena;
+
+        struct Node final {
+            const char* data = nullptr;
+            std::uint32_t size = 0;
+            IdType id = 0;
+        };
+
+        explicit InternedPath(const Node* n) noexcept : node_(n) {}
+
+        const Node* node_ = nullptr;
+    };
+
+    // PathArena：resolvedPath の intern 表
+    // - 文字列本体は大きなブロックに詰めて格納（1 path = 1 heap alloc にしない）
+    // - append-only：一度 intern した path は消えない（ハンドルの寿命管理を不要にするため）
+    // - スレッドセーフ（catalog の並列構築や worker からの intern を想定）
+    class PathArena final {
+    public:
+        PathArena() = default;
+        ~PathArena();
+
+        PathArena(const PathArena&) = delete;
+        PathArena& operator=(const PathArena&) = delete;
+
+        // catalog / record / watcher が共有するプロセス全体の arena
+        static PathArena& Global();
+
+        InternedPath Intern(std::string_view s);
+
+        // 既に intern 済みなら返す（無ければ空ハンドル。arena は増やさない）
+        InternedPath Find(std::string_view s) const;
+
+        std::size_t Count() const;
+        std::size_t BytesReserved() const;
+
+    private:
+        char* AllocChars_(std::size_t n);
+
+    private:
+        static constexpr std::size_t kBlockBytes = 64 * 1024;
+
+        mutable std::shared_mutex mtx_;
+        std::unordered_map<std::string_view, const InternedPath::Node*> index_;
+        std::vector<std::unique_ptr<InternedPath::Node[]>> nodeBlocks_;
+        std::size_t nodeUsed_ = 0; // 最後の node block の使用数
+        std::vector<std::unique_ptr<char[]>> charBlocks_;
+        char* charCur_ = nullptr;  // 現在の char block の空き先頭
+        std::size_t charLeft_ = 0; // 現在の char block の残りバイト
+        std::size_t bytesReserved_ = 0;
+        InternedPath::IdType nextId_ = 1;
+    };
+
+} // namespace Engine::Asset::Core
+
+namespace std {
+    template <>
+    struct hash<Engine::Asset::Core::InternedPath> {
+        size_t operator()(const Engine::Asset::Core::InternedPath& p) const noexcept {
+            return std::hash<std::uint32_t>{}(p.Id());
+        }
+    };
+} // namespace std
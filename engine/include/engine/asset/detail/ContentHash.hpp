@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "engine/asset/detail/Hash.hpp"
+
+namespace Engine::Asset::Detail {
+
+    /// ContentHasher：ファイル内容用の 64-bit ハッシュ（XXH64 と同じ値、少しずつ Update できる）
+    /// - 32 byte ずつ 4 レーンで回すので Fnv1a64（1 byte ずつ）よりずっと速い。数 GB/s 出る
+    /// - 暗号学的な強度は無い（hot reload の「中身が変わったか」の判定用）
+    /// - リトルエンディアン前提（読み込みは memcpy）
+    class ContentHasher final {
+    public:
+        explicit ContentHasher(Hash64 seed = 0) noexcept { Reset(seed); }
+
+        void Reset(Hash64 seed = 0) noexcept {
+            v_[0] = seed + kP1 + kP2;
+            v_[1] = seed + kP2;
+            v_[2] = seed;
+            v_[3] = seed - kP1;
+            seed_ = seed;
+            total_ = 0;
+            bufLen_ = 0;
+        }
+
+        void Update(const void* data, std::size_t size) noexcept {
+            const auto* p = static_cast<const unsigned char*>(data);
+            total_ += size;
+
+            if (bufLen_ != 0) {
+                const std::size_t take = (size < 32 - bufLen_) ? size : 32 - bufLen_;
+                std::memcpy(buf_ + bufLen_, p, take);
+                bufLen_ += take;
+                p += take;
+                size -= take;
+                if (bufLen_ < 32) return;
+                Stripe_(buf_);
+                bufLen_ = 0;
+            }
+
+            while (size >= 32) {
+                Stripe_(p);
+                p += 32;
+                size -= 32;
+            }
+
+            if (size != 0) {
+                std::memcpy(buf_, p, size);
+                bufLen_ = size;
+            }
+        }
+
+        Hash64 Digest() const noexcept {
+            Hash64 h;
+            if (total_ >= 32) {
+                h = Rotl_(v_[0], 1) + Rotl_(v_[1], 7) + Rotl_(v_[2], 12) + Rotl_(v_[3], 18);
+                for (Hash64 v : v_) h = MergeRound_(h, v);
+            } else {
+                h = seed_ + kP5;
+            }
+            h += total_;
+
+            const unsigned char* p = buf_;
+            std::size_t n = bufLen_;
+            while (n >= 8) {
+                h ^= Round_(0, Load64_(p));
+                h = Rotl_(h, 27) * kP1 + kP4;
+                p += 8;
+                n -= 8;
+            }
+            if (n >= 4) {
+                h ^= static_cast<Hash64>(Load32_(p)) * kP1;
+                h = Rotl_(h, 23) * kP2 + kP3;
+                p += 4;
+                n -= 4;
+            }
+            while (n-- > 0) {
+                h ^= static_cast<Hash64>(*p++) * kP5;
+                h = Rotl_(h, 11) * kP1;
+            }
+
+            h ^= h >> 33;
+            h *= kP2;
+            h ^= h >> 29;
+            h *= kP3;
+            h ^= h >> 32;
+            return h;
+        }
+
+        std::uint64_t TotalBytes() const noexcept { return total_; }
+
+    private:
+        static constexpr Hash64 kP1 = 11400714785074694791ull;
+        static constexpr Hash64 kP2 = 14029467366897019727ull;
+        static constexpr Hash64 kP3 = 1609587929392839161ull;
+        static constexpr Hash64 kP4 = 9650029242287828579ull;
+        static constexpr Hash64 kP5 = 2870177450012600261ull;
+
+        static constexpr Hash64 Rotl_(Hash64 x, int r) noexcept { return (x << r) | (x >> (64 - r)); }
+
+        static constexpr Hash64 Round_(Hash64 acc, Hash64 input) noexcept {
+            acc += input * kP2;
+            acc = Rotl_(acc, 31);
+            return acc * kP1;
+        }
+
+        static constexpr Hash64 MergeRound_(Hash64 acc, Hash64 v) noexcept {
+            acc ^= Round_(0, v);
+            return acc * kP1 + kP4;
+        }
+
+        static Hash64 Load64_(const unsigned char* p) noexcept {
+            Hash64 v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        static std::uint32_t Load32_(const unsigned char* p) noexcept {
+            std::uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        void Stripe_(const unsigned char* p) noexcept {
+            v_[0] = Round_(v_[0], Load64_(p + 0));
+            v_[1] = Round_(v_[1], Load64_(p + 8));
+            v_[2] = Round_(v_[2], Load64_(p + 16));
+            v_[3] = Round_(v_[3], Load64_(p + 24));
+        }
+
+    private:
+        Hash64 v_[4]{};
+        Hash64 seed_ = 0;
+        std::uint64_t total_ = 0;
+        unsigned char buf_[32]{};
+        std::size_t bufLen_ = 0;
+    };
+
+    inline Hash64 ContentHash64(const void* data, std::size_t size, Hash64 seed = 0) noexcept {
+        ContentHasher h(seed);
+        h.Update(data, size);
+        return h.Digest();
+    }
+
+} // namespace Engine::Asset::Detail
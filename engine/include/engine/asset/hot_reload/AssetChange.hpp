@@ -1,9 +1,8 @@
 #pragma once
 
 #include <cstdint>
-#include <string>
-
 #include "engine/asset/AssetId.hpp"
+#include "engine/asset/core/InternedPath.hpp"
 
 namespace Engine::Asset::HotReload {
 
@@ -29,7 +28,7 @@ struct AssetChange final {
     AssetId id{};
     AssetChangeKind kind = AssetChangeKind::Modified;
 
-    std::string resolvedPath;     // "assets/..."（AssetCatalog が解決済みのものを渡す想定）
+    Core::InternedPath resolvedPath; // "assets/..."（AssetCatalog が解決済みのものを渡す想定）
     std::uint64_t writeTimeNs = 0; // ファイルの最終更新時刻（ns, best-effort）
     std::uint64_t detectedNs  = 0; // 変更検出時刻（ns, system_clock）
 
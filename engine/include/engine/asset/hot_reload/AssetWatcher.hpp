@@ -1,18 +1,32 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "engine/asset/AssetId.hpp"
+#include "engine/asset/core/InternedPath.hpp"
 #include "engine/asset/hot_reload/AssetChange.hpp"
+#include "engine/io/fs/IFileSystem.hpp"
+#include "engine/io/fs/IFileWatcher.hpp"
 
 namespace Engine::Asset::HotReload {
 
     // AssetWatcher：
     // - “watch list” を保持
     // - Poll() を呼ぶと変更を検出して AssetChange を返す
+    // - IFileWatcher があればそのイベントを path -> AssetId の索引で引き、届いた分だけ stat し直す
+    //   （変化が無いフレームは watcher の Poll 1 回だけ。監視数に比例する stat をしない）
+    // - watcher に載せられなかったパス（AddWatch 失敗 / watcher 無し）は stat ポーリング
+    //   - pollBudgetFiles / pollBudgetUs で 1 回の Poll の stat を制限し、残りは次の Poll に回して周回する
+    //   - 直近に変化した / Watch された（ロードされた）ファイルは hot として別の周回で優先的に stat する
+    //   - 1 周にかかった時間（= 変更に気付くまでの最悪の遅れ）は GetPollStats で見られる
+    // - verifyContentHash：mtime が変わったら共有 IoWorkerPool 上で内容のハッシュを取り、前回と同じなら Modified を出さない
+    //   （touch / VCS の checkout で中身の変わらないファイルを reload しない）。内容は SetFileSystem の FS から読む
     class AssetWatcher final {
     public:
         struct Options final {
@@ -26,23 +40,76 @@ namespace Engine::Asset::HotReload {
 
             // AddWatch 時点でファイルが存在しない場合でも監視し続ける
             bool keepWatchingMissing = true;
+
+            // Options だけのコンストラクタで OS の watcher（Linux なら inotify）を作る。false なら常に stat ポーリング
+            // （構築時のみ参照）
+            bool useFileWatcher = true;
+
+            // stat ポーリングの 1 回の Poll あたりの予算（0 は無制限 = 毎回全部 stat する）
+            // - pollBudgetFiles は hot / cold で半分ずつ分ける（1 は 2 として扱う）
+            // - pollBudgetUs は超えた時点で打ち切る（最低 1 件は stat する）
+            std::size_t pollBudgetFiles = 0;
+            std::uint64_t pollBudgetUs = 0;
+
+            // 変化した / Watch された後、この間は hot として扱う
+            std::uint64_t hotWindowMs = 2000;
+
+            // Modified を内容のハッシュで確かめる（ハッシュが出た後の Poll で返すので 1 Poll 以上遅れる）
+            // - Watch / Added の時点の内容を基準にする（基準がまだ無ければ確かめずに出す）
+            bool verifyContentHash = false;
+            std::size_t hashChunkBytes = 256 * 1024;
+        };
+
+        // verifyContentHash の状況
+        struct HashStats final {
+            std::uint64_t hashedFiles = 0;
+            std::uint64_t hashedBytes = 0;
+            std::uint64_t suppressed = 0; // 内容が同じだったので出さなかった Modified
+            std::size_t pending = 0;      // 計算待ち / 結果の反映待ち
+        };
+
+        // stat ポーリングの状況（watcher に載っていない分）
+        struct PollStats final {
+            std::size_t polledFiles = 0;        // stat ポーリング中
+            std::size_t hotFiles = 0;
+            std::size_t lastProbes = 0;         // 直近の Poll で stat した数
+            std::uint64_t lastPollNs = 0;       // 直近の Poll の所要時間
+            std::uint64_t coldSweepNs = 0;      // 直近の cold 1 周の時間（cold なファイルの検出遅れの上限）
+            std::uint64_t worstColdSweepNs = 0; // これまでの最大
+            std::uint64_t hotSweepNs = 0;       // 直近の hot 1 周の時間
         };
 
         struct WatchedInfo final {
-            std::string resolvedPath;
+            Core::InternedPath resolvedPath;
             bool existed = false;
             std::uint64_t lastWriteTimeNs = 0;
             std::uint64_t lastEventNs = 0; // debounce 用
+
+            // verifyContentHash：最後に確かめた内容
+            std::uint64_t contentHash = 0;
+            bool hasContentHash = false;
         };
 
     public:
         explicit AssetWatcher(Options opt);
+        // fileWatcher は resolvedPath をそのまま（scheme 無しの Uri で）受け付けるもの。nullptr なら stat ポーリング
+        AssetWatcher(Options opt, std::unique_ptr<IO::FS::IFileWatcher> fileWatcher);
+        ~AssetWatcher();
+
+        AssetWatcher(const AssetWatcher&) = delete;
+        AssetWatcher& operator=(const AssetWatcher&) = delete;
+
         void SetOptions(Options opt);
         const Options& GetOptions() const noexcept;
 
+        // ハッシュ計算で内容を読む FS（resolvedPath を scheme 無しの Uri で受け付けるもの。既定は NativeFileSystem）
+        // - 以後に投入する計算から使う
+        void SetFileSystem(std::shared_ptr<IO::FS::IFileSystem> fileSystem);
+
         // 監視登録（resolvedPath は AssetCatalog が解決済みのパスを渡す想定）
         // 既に登録済みならパス更新する
-        void Watch(const AssetId& id, std::string resolvedPath);
+        void Watch(const AssetId& id, Core::InternedPath resolvedPath);
+        void Watch(const AssetId& id, std::string_view resolvedPath);
 
         void Unwatch(const AssetId& id);
         void Clear();
@@ -54,14 +121,99 @@ namespace Engine::Asset::HotReload {
         // ポーリングして変更を返す（呼び出し側が毎フレーム or 数フレーム毎に呼ぶ）
         std::vector<AssetChange> Poll();
 
+        // watcher を使っているか / 毎回 stat している監視の数（テスト/統計用）
+        bool UsesFileWatcher() const noexcept { return fileWatcher_ != nullptr; }
+        std::size_t PolledCount() const noexcept { return polled_.size(); }
+
+        PollStats GetPollStats() const;
+        HashStats GetHashStats() const;
+
+        // 投入済みのハッシュ計算が終わるまで待つ（結果は次の Poll で反映される。テスト/ツール用）
+        void WaitForHashing();
+
     private:
+        enum class Verdict : std::uint8_t { Keep, Erase, Retry };
+
+        struct PathWatch final {
+            IO::FS::WatchId watchId = 0;
+            std::vector<AssetId> ids; // 同じファイルを指す asset はまとめる
+        };
+
+        // stat ポーリングの周回
+        // - cold の周回には全員が居る（1 周 = 全員を 1 回ずつ見る）。hot の周回はそれに上乗せ
+        // - ring は (id, gen) を並べるだけ。外す時は polled_ 側を消す / hot を落とすだけで、古い slot は周回の終わりで詰める
+        //   （周回中に並びが変わらない）。gen は通し番号なので Unwatch -> Watch し直しても古い slot は生き返らない
+        struct PollState final {
+            std::uint32_t gen = 0;    // cold の slot
+            std::uint32_t hotGen = 0; // hot の slot
+            bool hot = false;
+            std::uint64_t hotUntilNs = 0; // steady clock
+        };
+
+        struct RingSlot final {
+            AssetId id;
+            std::uint32_t gen = 0;
+        };
+
+        struct PollRing final {
+            std::vector<RingSlot> slots;
+            std::size_t cursor = 0;
+            std::uint64_t sweepStartNs = 0;
+            std::uint64_t lastSweepNs = 0;
+            std::uint64_t worstSweepNs = 0;
+        };
+
+        // ハッシュ計算（共有 IoWorkerPool で回す。AssetWatcher.cpp）
+        struct Hasher;
+
+        struct HashPending final {
+            std::uint64_t ticket = 0;     // 新しい投入で古い結果を捨てる
+            bool verify = false;          // true: 保留中の Modified / false: 基準を取るだけ
+            std::uint64_t writeNs = 0;
+            std::uint64_t detectedNs = 0;
+        };
+
         static std::uint64_t NowNs();
-        static bool ProbeFile(const std::string& path, bool& existsOut, std::uint64_t& writeNsOut);
+        static std::uint64_t SteadyNs();
+        static bool ProbeFile(std::string_view path, bool& existsOut, std::uint64_t& writeNsOut);
+
+        void Attach_(const AssetId& id, Core::InternedPath path);
+        void Detach_(const AssetId& id, Core::InternedPath path);
+        void Rearm_(Core::InternedPath path);
+        void CollectEvents_(std::unordered_set<AssetId>& dirty);
+        void AddPolled_(const AssetId& id);
+        void MarkHot_(const AssetId& id, std::uint64_t steadyNs);
+        void EndSweep_(PollRing& ring, std::uint64_t steadyNs);
+        std::size_t ProbeRing_(PollRing& ring, bool hot, std::size_t maxProbes, std::uint64_t deadlineNs,
+                               std::uint64_t nowNs, std::uint64_t debounceNs,
+                               std::vector<AssetChange>& out, std::vector<AssetId>& erased);
+        void SubmitHash_(const AssetId& id, const WatchedInfo& w, bool verify, std::uint64_t writeNs,
+                         std::uint64_t detectedNs);
+        void CollectHashes_(std::vector<AssetChange>& out);
+        Verdict Evaluate_(const AssetId& id, WatchedInfo& w, std::uint64_t nowNs, std::uint64_t debounceNs,
+                          std::vector<AssetChange>& out);
 
     private:
         Options opt_{};
         std::unordered_map<AssetId, WatchedInfo> watched_{};
         std::uint64_t seq_ = 0;
+
+        std::unique_ptr<IO::FS::IFileWatcher> fileWatcher_;
+        std::unordered_map<Core::InternedPath, PathWatch> byPath_{}; // resolvedPath -> 監視
+        std::unordered_map<AssetId, PollState> polled_{};      // watcher に載っていない（stat ポーリング）
+        PollRing hotRing_{};
+        PollRing coldRing_{};
+        std::uint32_t pollGen_ = 0;                            // slot を無効にするための通し番号
+        std::size_t lastProbes_ = 0;
+        std::uint64_t lastPollNs_ = 0;
+        std::vector<AssetId> retry_{};                         // probe に失敗したので次の Poll で取り直す
+        std::vector<IO::FS::FileChangeEvent> events_{};        // Poll の作業領域
+
+        std::unique_ptr<Hasher> hasher_;                       // 初めて必要になった時に作る
+        std::shared_ptr<IO::FS::IFileSystem> fs_;              // ハッシュ計算で読む（未指定なら初回に NativeFileSystem）
+        std::unordered_map<AssetId, HashPending> hashPending_{};
+        std::uint64_t hashTicket_ = 0;
+        HashStats hashStats_{};
     };
 
 } // namespace Engine::Asset::HotReload
@@ -1,20 +1,20 @@
 #pragma once
 
 #include <memory>
-#include <vector>
 
 #include "engine/asset/AssetType.hpp"
 #include "engine/asset/core/AnyAsset.hpp"
 #include "engine/base/Result.hpp"
-#include "engine/base/Span.hpp"
+#include "engine/base/SharedBuffer.hpp"
 #include "engine/asset/loading/IAssetLoader.hpp"
 #include "engine/asset/loading/LoadContext.hpp"
 
 namespace Engine::Asset::Loaders {
     using AssetError = Base::Error<AssetErrorCode>;
 
+    // ソースのバッファをそのまま保持する（mmap 由来ならページキャッシュを直接参照）
     struct BinaryAsset final {
-        std::vector<std::byte> bytes;
+        Base::SharedBuffer bytes;
     };
 
     class BinaryLoader final : public Loading::IAssetLoader {
@@ -22,7 +22,7 @@ namespace Engine::Asset::Loaders {
         AssetType GetType() const noexcept override;
 
         Base::Result<Core::AnyAsset, AssetError>
-        Load(Base::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) override;
+        Load(const Base::SharedBuffer& bytes, const Loading::LoadContext& ctx) override;
     };
 
 } // namespace Engine::Asset::Loaders
@@ -2,12 +2,11 @@
 
 #include <cstdint>
 #include <memory>
-#include <vector>
 
 #include "engine/asset/AssetType.hpp"
 #include "engine/asset/core/AnyAsset.hpp"
 #include "engine/base/Result.hpp"
-#include "engine/base/Span.hpp"
+#include "engine/base/SharedBuffer.hpp"
 #include "engine/asset/loading/IAssetLoader.hpp"
 #include "engine/asset/loading/LoadContext.hpp"
 
@@ -17,7 +16,7 @@ namespace Engine::Asset::Loaders {
 
     // フォントは decode せず “Blob” として保持（後段の font rasterizer が使う）
     struct FontAsset final {
-        std::vector<std::byte> bytes; // TTF/OTF
+        Base::SharedBuffer bytes; // TTF/OTF（ソースのバッファを共有。コピーしない）
     };
 
     class FontLoader final : public Loading::IAssetLoader {
@@ -25,7 +24,7 @@ namespace Engine::Asset::Loaders {
         AssetType GetType() const noexcept override;
 
         Base::Result<Core::AnyAsset, AssetError>
-        Load(Base::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) override;
+        Load(const Base::SharedBuffer& bytes, const Loading::LoadContext& ctx) override;
     };
 
 } // namespace Engine::Asset::Loaders
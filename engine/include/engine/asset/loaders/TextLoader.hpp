@@ -1,12 +1,12 @@
 #pragma once
 
 #include <memory>
-#include <string>
+#include <string_view>
 
 #include "engine/asset/AssetType.hpp"
 #include "engine/asset/core/AnyAsset.hpp"
 #include "engine/base/Result.hpp"
-#include "engine/base/Span.hpp"
+#include "engine/base/SharedBuffer.hpp"
 #include "engine/asset/loading/IAssetLoader.hpp"
 #include "engine/asset/loading/LoadContext.hpp"
 
@@ -14,7 +14,8 @@ namespace Engine::Asset::Loaders {
     using AssetError = Base::Error<AssetErrorCode>;
 
     struct TextAsset final {
-        std::string text; // UTF-8 想定
+        std::string_view text;      // UTF-8 想定（BOM 除去済み。storage を指す）
+        Base::SharedBuffer storage; // text の実体（ソースのバッファを共有）
     };
 
     class TextLoader final : public Loading::IAssetLoader {
@@ -22,7 +23,7 @@ namespace Engine::Asset::Loaders {
         AssetType GetType() const noexcept override;
 
         Base::Result<Core::AnyAsset, AssetError>
-        Load(Base::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) override;
+        Load(const Base::SharedBuffer& bytes, const Loading::LoadContext& ctx) override;
     };
 
 } // namespace Engine::Asset::Loaders
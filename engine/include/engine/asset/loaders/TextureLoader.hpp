@@ -26,7 +26,16 @@ namespace Engine::Asset::Loaders {
         AssetType GetType() const noexcept override;
 
         Base::Result<Core::AnyAsset, AssetError>
-        Load(Base::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) override;
+        Load(const Base::SharedBuffer& bytes, const Loading::LoadContext& ctx) override;
+
+        // derived data："width(u32) height(u32) + RGBA8"（memcpy だけで戻る）
+        std::uint32_t DerivedDataVersion() const noexcept override { return 1; }
+
+        Base::Result<Base::SharedBuffer, AssetError>
+        SaveDerived(const Core::AnyAsset& asset, const Loading::LoadContext& ctx) override;
+
+        Base::Result<Core::AnyAsset, AssetError>
+        LoadDerived(const Base::SharedBuffer& data, const Loading::LoadContext& ctx) override;
     };
 
 } // namespace Engine::Asset::Loaders
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <string_view>
+#include <vector>
+
 #include "engine/asset/AssetError.hpp"
 #include "engine/asset/core/AnyAsset.hpp"
 #include "engine/base/Result.hpp"
+#include "engine/base/Span.hpp"
 #include "engine/asset/loading/IAssetSource.hpp"
 #include "engine/asset/loading/LoaderRegistry.hpp"
 #include "engine/asset/loading/LoadContext.hpp"
@@ -10,19 +14,51 @@
 namespace Engine::Asset::Loading {
     using AssetError = Base::Error<AssetErrorCode>;
 
+    class DerivedDataCache;
+
     // AssetPipeline：
     // - 読む（IAssetSource）
     // - 変換する（IAssetLoader）
     // - 成功/失敗を Result で返す
+    // - derived-data cache を持たせると、対応している loader（DerivedDataVersion != 0）は
+    //   decode の前に cache を引き、miss なら decode した結果を保存する
+    //   key は（読んだ bytes の ContentHash64, loader, version, 設定）なので、元ファイルが変われば自然に miss になる
     class AssetPipeline final {
     public:
         AssetPipeline(IAssetSource& source, LoaderRegistry& registry);
 
+        // nullptr で無効（既定）。cache は pipeline より長生きすること
+        void SetDerivedDataCache(DerivedDataCache* cache) noexcept { derived_ = cache; }
+
         Base::Result<Core::AnyAsset, AssetError> Load(const LoadContext& ctx);
 
+        // まとめてロードする（out[i] は ctxs[i] の結果。out は上書き）
+        // - 読み込みは IAssetSource::ReadAllBatch 1 回にまとめ、読めたものから順に decode する
+        void LoadBatch(Base::ConstSpan<LoadContext> ctxs,
+                       std::vector<Base::Result<Core::AnyAsset, AssetError>>& out);
+
+    private:
+        // 検証 + loader 取得（失敗時は統計も更新する）
+        Base::Result<IAssetLoader*, AssetError> Begin_(const LoadContext& ctx);
+
+        // 読めた bytes を decode する（統計も更新する）
+        Base::Result<Core::AnyAsset, AssetError>
+        Decode_(const LoadContext& ctx, IAssetLoader& loader, Base::Result<Base::SharedBuffer, AssetError>&& bytesR);
+
+        // derived-data cache を通した decode（cache 無し / 非対応の loader は loader.Load そのまま）
+        Base::Result<Core::AnyAsset, AssetError>
+        DecodeCached_(const LoadContext& ctx, IAssetLoader& loader, const Base::SharedBuffer& bytes);
+
     private:
         IAssetSource& source_;
         LoaderRegistry& registry_;
+        DerivedDataCache* derived_ = nullptr;
+
+        // LoadBatch の作業領域
+        std::vector<std::string_view> batchPaths_;
+        std::vector<std::size_t> batchIndex_;
+        std::vector<IAssetLoader*> batchLoaders_;
+        std::vector<Base::Result<Base::SharedBuffer, AssetError>> batchBytes_;
     };
 
 } // namespace Engine::Asset::Loading
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "engine/asset/AssetType.hpp"
+#include "engine/asset/detail/Hash.hpp"
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/io/async/AsyncWriteService.hpp"
+#include "engine/io/fs/IFileSystem.hpp"
+#include "engine/io/path/Uri.hpp"
+
+namespace Engine::Asset::Loading {
+
+    // derived-data の key
+    // - 元の bytes の中身 / loader / loader の version / decode 設定のどれかが変われば別の key になる
+    //   （invalidation は不要。古い entry は使われなくなり、容量上限で消える）
+    struct DerivedDataKey final {
+        Detail::Hash64 contentHash = 0; // 元の bytes の ContentHash64
+        AssetType loader{};             // loader の担当 type
+        std::uint32_t loaderVersion = 0;
+        std::uint64_t optionsHash = 0;
+
+        // "<contentHash>-<loader/version/options の hash>.ddc"
+        std::string FileName() const;
+    };
+
+    /// 統計（テスト/デバッグ用）
+    struct DerivedDataStats final {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t stores = 0;
+        std::uint64_t evictions = 0; // 容量上限で消した entry 数
+        std::uint64_t corrupt = 0;   // header / checksum が合わず捨てた entry 数
+        std::uint64_t entries = 0;
+        std::uint64_t bytes = 0;     // entry の合計サイズ（header 込み）
+    };
+
+    /// DerivedDataCache：decode 済みの asset を directory に保存して次の起動で使い回す
+    /// - 1 entry = 1 file："header(64 byte) + payload"。payload は loader の SaveDerived が作った bytes そのまま
+    ///   header に key / payload の長さ / payload の ContentHash64 を持ち、読むときに全部確かめる
+    ///   （途中で切れた / 別の key の file は miss 扱いで消す）
+    /// - 書き込みは AsyncWriteService で write-behind（atomic replace、fsync なし。消えても作り直すだけ）
+    /// - 容量上限（maxBytes）を超えたら最後に使ったのが古いものから消す（LRU）
+    ///   使った順は終了時に "lru.idx" に残し、次の起動で引き継ぐ（無ければ更新時刻の順）
+    /// - 索引はメモリに持つので、miss は file system に触らずに返る
+    /// - スレッドセーフ（AssetPipeline が複数スレッドにあっても 1 つを共有して良い）
+    class DerivedDataCache final {
+    public:
+        struct Options final {
+            std::uint64_t maxBytes = 512ull * 1024 * 1024;
+        };
+
+        DerivedDataCache(std::shared_ptr<Engine::IO::FS::IFileSystem> fs, Engine::IO::Path::Uri directory);
+        DerivedDataCache(std::shared_ptr<Engine::IO::FS::IFileSystem> fs, Engine::IO::Path::Uri directory, const Options& opt);
+        ~DerivedDataCache();
+
+        // hit なら payload（header を除いた部分。file の bytes を共有する）
+        std::optional<Base::SharedBuffer> Find(const DerivedDataKey& key);
+
+        // payload を保存する（write-behind。同じ key は上書き）
+        void Store(const DerivedDataKey& key, const Base::SharedBuffer& payload);
+
+        // ここまでの Store を書き終えるまで待つ
+        void Flush();
+
+        // 使った順を "lru.idx" に書く（破棄時にも呼ばれる）
+        void SaveIndex();
+
+        DerivedDataStats Stats() const;
+
+        DerivedDataCache(const DerivedDataCache&) = delete;
+        DerivedDataCache& operator=(const DerivedDataCache&) = delete;
+
+    private:
+        struct Entry final {
+            std::uint64_t bytes = 0;
+            std::uint64_t lastUse = 0; // useClock_ の値
+            bool written = false;      // write-behind が終わった（消して良い）
+        };
+
+        Engine::IO::Path::Uri EntryUri_(const std::string& name) const;
+
+        void LoadIndex_();
+        void Trim_(); // mutex_ 保持中に呼ぶ
+        void Drop_(const std::string& name); // mutex_ 保持中に呼ぶ
+
+    private:
+        std::shared_ptr<Engine::IO::FS::IFileSystem> fs_;
+        Engine::IO::Path::Uri dir_;
+        Options opt_;
+
+        mutable std::mutex mutex_;
+        std::unordered_map<std::string, Entry> entries_;
+        std::uint64_t useClock_ = 0;
+        DerivedDataStats stats_{};
+
+        // 完了通知が entries_ を触るので entries_ より先に止める（破棄時は明示的に reset）
+        std::unique_ptr<Engine::IO::Async::AsyncWriteService> writer_;
+    };
+
+} // namespace Engine::Asset::Loading
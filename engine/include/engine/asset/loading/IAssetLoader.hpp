@@ -1,13 +1,14 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 #include "engine/asset/AssetError.hpp"
 #include "engine/base/Error.hpp"
 #include "engine/asset/AssetType.hpp"
 #include "engine/asset/core/AnyAsset.hpp"
 #include "engine/base/Result.hpp"
-#include "engine/base/Span.hpp"
+#include "engine/base/SharedBuffer.hpp"
 #include "engine/asset/loading/LoadContext.hpp"
 
 
@@ -25,8 +26,38 @@ namespace Engine::Asset::Loading {
         virtual AssetType GetType() const noexcept = 0;
 
         // bytes を decode/parse して AnyAsset を返す
+        // - bytes は IAssetSource が返したバッファそのもの
+        // - passthrough な asset はコピーせず bytes（や Slice）を保持してよい
         virtual Base::Result<Core::AnyAsset, AssetError>
-        Load(Base::ConstSpan<std::byte> bytes, const LoadContext& ctx) = 0;
+        Load(const Base::SharedBuffer& bytes, const LoadContext& ctx) = 0;
+
+        // ---- derived-data cache（任意） ----
+        // decode 結果を「そのまま読める形」で保存できる loader だけ実装する
+        // - DerivedDataVersion が 0 なら cache しない（既定）
+        // - decode の仕様や保存形式を変えたら version を上げる（古い cache は key が変わって使われなくなる）
+        virtual std::uint32_t DerivedDataVersion() const noexcept { return 0; }
+
+        // decode の結果を左右する設定があれば hash にして返す（cache key に入る）
+        virtual std::uint64_t DerivedDataOptionsHash(const LoadContext& ctx) const noexcept {
+            (void)ctx;
+            return 0;
+        }
+
+        // decode 済みの asset -> 保存する bytes（Err なら保存しない）
+        virtual Base::Result<Base::SharedBuffer, AssetError>
+        SaveDerived(const Core::AnyAsset& asset, const LoadContext& ctx) {
+            (void)asset;
+            return Base::Result<Base::SharedBuffer, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::UnsupportedFormat, "IAssetLoader: derived data not supported", ctx.resolvedPath.Str()));
+        }
+
+        // SaveDerived で保存した bytes -> asset（decode より十分安いこと。Err なら通常の decode に戻る）
+        virtual Base::Result<Core::AnyAsset, AssetError>
+        LoadDerived(const Base::SharedBuffer& data, const LoadContext& ctx) {
+            (void)data;
+            return Base::Result<Core::AnyAsset, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::UnsupportedFormat, "IAssetLoader: derived data not supported", ctx.resolvedPath.Str()));
+        }
     };
 
 } // namespace Engine::Asset::Loading
@@ -8,11 +8,13 @@
 #include "engine/asset/AssetError.hpp"
 #include "engine/base/Error.hpp"
 #include "engine/base/Result.hpp"
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/base/Span.hpp"
 
 namespace Engine::Asset::Loading {
     using AssetError = Base::Error<AssetErrorCode>;
 
-    // バイト列の所有バッファ（I/O結果）
+    // 実装側で組み立てる可変バッファ（SharedBuffer::FromVector で所有権ごと渡す）
     using ByteBuffer = std::vector<std::byte>;
 
     // IAssetSource（アイ・アセット・ソース）
@@ -23,9 +25,24 @@ namespace Engine::Asset::Loading {
     public:
         virtual ~IAssetSource() = default;
 
-        virtual Base::Result<ByteBuffer, AssetError>
+        // 読み出し結果は参照カウント付きの不変バッファ
+        // - mmap / pak 等は実体をそのまま包んで返せる（コピー無し）
+        // - loader はこれを保持すればソースのバイト列を複製せずに使える
+        virtual Base::Result<Base::SharedBuffer, AssetError>
         ReadAll(std::string_view resolvedPath) = 0;
 
+        // まとめて読む（out[i] は resolvedPaths[i] の結果。out は上書き）
+        // - 既定は ReadAll の繰り返し
+        // - I/O をまとめて投げられるソース（io_uring / pak の先読み等）は override する
+        virtual void ReadAllBatch(Base::ConstSpan<std::string_view> resolvedPaths,
+                                  std::vector<Base::Result<Base::SharedBuffer, AssetError>>& out) {
+            out.clear();
+            out.reserve(resolvedPaths.size());
+            for (std::size_t i = 0; i < resolvedPaths.size(); ++i) {
+                out.push_back(ReadAll(resolvedPaths[i]));
+            }
+        }
+
         // 任意：将来使うなら
         virtual bool Exists(std::string_view /*resolvedPath*/) { return true; }
     };
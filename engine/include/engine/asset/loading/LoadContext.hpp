@@ -1,11 +1,11 @@
 #pragma once
 
 #include <cstdint>
-#include <string>
 
 #include "engine/asset/AssetId.hpp"
 #include "engine/asset/AssetType.hpp"
 #include "engine/asset/AssetRequest.hpp"
+#include "engine/asset/core/InternedPath.hpp"
 
 namespace Engine::Asset::Core { class AssetStatistics; }
 
@@ -18,7 +18,7 @@ namespace Engine::Asset::Loading {
     struct LoadContext final {
         AssetId id{};
         AssetType type{};
-        std::string resolvedPath;          // "assets/..." 形式（AssetCatalogで解決済み推奨）
+        Core::InternedPath resolvedPath;   // "assets/..." 形式（AssetCatalogで解決済み推奨）
 
         const AssetRequest* request = nullptr;
         Core::AssetStatistics* statistics = nullptr;
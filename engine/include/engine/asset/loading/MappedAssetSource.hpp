@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "engine/asset/loading/IAssetSource.hpp"
+#include "engine/io/async/AsyncReadService.hpp"
+#include "engine/io/fs/MappedFile.hpp"
+
+namespace Engine::Asset::Loading {
+
+    // MappedAssetSource：loose file を読む IAssetSource（POSIX）。mmap は opt-in
+    // - 既定は open + fstat + pread でヒープに読む（asset は読んだ時点の bytes を持つ）
+    // - mapFiles なら mapping をそのまま SharedBuffer で返す（page cache -> heap のコピーなし）
+    //   map した buffer は asset が生きている間ファイルを直接見る。外から上書きされると Ready の asset の
+    //   bytes が reload 無しで変わり、truncate されると触った時点で SIGBUS になる
+    //   -> 書き換えられない置き場（読み取り専用の install 先など）にだけ使う。hot reload で監視する
+    //      開発用の asset ディレクトリでは false のまま（pak は PakArchive 側で map する）
+    // - mapFiles でも小さいファイルは mmap/munmap のコストが勝つので pread で読む（minMapBytes）
+    // - batchReader があれば ReadAllBatch は open/stat/read/close をまとめて投げる
+    //   （小さいファイルが大量にある場合向け。バッチ経由のファイルは mmap せずヒープに読む）
+    class MappedAssetSource final : public IAssetSource {
+    public:
+        struct Options final {
+            // resolvedPath の前に付ける基準ディレクトリ（空なら resolvedPath をそのまま使う）
+            std::string rootDirectory;
+
+            // mmap するか（既定 false。上の注意を参照）
+            bool mapFiles = false;
+
+            // mapFiles のとき、これ未満のファイルは mmap せず読み込む。0 なら常に mmap
+            std::size_t minMapBytes = 16 * 1024;
+
+            IO::FS::MappedFile::Options map{};
+
+            // ReadAllBatch で使う一括読み込み（nullptr なら ReadAll の繰り返し）
+            std::shared_ptr<IO::Async::AsyncReadService> batchReader;
+        };
+
+    public:
+        MappedAssetSource();
+        explicit MappedAssetSource(Options opt);
+
+        void SetOptions(Options opt);
+        const Options& GetOptions() const noexcept;
+
+        Base::Result<Base::SharedBuffer, AssetError> ReadAll(std::string_view resolvedPath) override;
+        void ReadAllBatch(Base::ConstSpan<std::string_view> resolvedPaths,
+                          std::vector<Base::Result<Base::SharedBuffer, AssetError>>& out) override;
+        bool Exists(std::string_view resolvedPath) override;
+
+    private:
+        std::string NativePath_(std::string_view resolvedPath) const;
+
+    private:
+        Options opt_{};
+
+        // ReadAllBatch の作業領域（呼び出し毎の確保を避ける）
+        std::vector<std::string> batchPaths_;
+        std::vector<IO::Async::IoResult<Base::SharedBuffer>> batchResults_;
+    };
+
+} // namespace Engine::Asset::Loading
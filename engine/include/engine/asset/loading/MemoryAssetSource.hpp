@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "engine/asset/loading/IAssetSource.hpp"
+#include "engine/io/fs/MemoryFileSystem.hpp"
+
+namespace Engine::Asset::Loading {
+
+    // MemoryAssetSource：MemoryFileSystem の blob を返す IAssetSource
+    // - ReadAll は blob をそのまま共有する（コピー無し）
+    // - ベンチ / テストで disk を挟まずに pipeline 全体を回す用。RAM disk 層として本番でも使える
+    class MemoryAssetSource final : public IAssetSource {
+    public:
+        struct Options final {
+            // resolvedPath がこれで始まっていれば取り除いてから引く（例："assets/"）
+            std::string stripPrefix;
+        };
+
+    public:
+        explicit MemoryAssetSource(std::shared_ptr<const IO::FS::MemoryFileSystem> fs);
+        MemoryAssetSource(std::shared_ptr<const IO::FS::MemoryFileSystem> fs, Options opt);
+
+        void SetOptions(Options opt);
+        const Options& GetOptions() const noexcept;
+
+        const std::shared_ptr<const IO::FS::MemoryFileSystem>& FileSystem() const noexcept { return fs_; }
+
+        Base::Result<Base::SharedBuffer, AssetError> ReadAll(std::string_view resolvedPath) override;
+        bool Exists(std::string_view resolvedPath) override;
+
+    private:
+        std::string_view InnerPath_(std::string_view resolvedPath) const noexcept;
+
+    private:
+        std::shared_ptr<const IO::FS::MemoryFileSystem> fs_;
+        Options opt_{};
+    };
+
+} // namespace Engine::Asset::Loading
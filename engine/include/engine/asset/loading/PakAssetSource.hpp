@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "engine/asset/loading/IAssetSource.hpp"
+#include "engine/io/pak/PakArchive.hpp"
+
+namespace Engine::Asset::Loading {
+
+    // PakAssetSource：pak アーカイブから読む IAssetSource
+    // - 非圧縮 payload は pak イメージの Slice をそのまま返す（コピー無し）
+    // - ReadAllBatch はバッチ内の payload 範囲をまとめて先読み要求（WILLNEED）してから読む
+    //   （mmap した pak でページフォルトを 1 件ずつ待たないため）
+    class PakAssetSource final : public IAssetSource {
+    public:
+        struct Options final {
+            // resolvedPath がこれで始まっていれば取り除いてから pak 内パスとして引く（例："assets/"）
+            std::string stripPrefix;
+        };
+
+    public:
+        explicit PakAssetSource(std::shared_ptr<const IO::Pak::PakArchive> archive);
+        PakAssetSource(std::shared_ptr<const IO::Pak::PakArchive> archive, Options opt);
+
+        void SetOptions(Options opt);
+        const Options& GetOptions() const noexcept;
+
+        const std::shared_ptr<const IO::Pak::PakArchive>& Archive() const noexcept { return archive_; }
+
+        Base::Result<Base::SharedBuffer, AssetError> ReadAll(std::string_view resolvedPath) override;
+        void ReadAllBatch(Base::ConstSpan<std::string_view> resolvedPaths,
+                          std::vector<Base::Result<Base::SharedBuffer, AssetError>>& out) override;
+        bool Exists(std::string_view resolvedPath) override;
+
+    private:
+        std::string_view InnerPath_(std::string_view resolvedPath) const noexcept;
+        Base::Result<Base::SharedBuffer, AssetError> Read_(std::string_view resolvedPath, const IO::Pak::PakTocEntry* e) const;
+
+    private:
+        std::shared_ptr<const IO::Pak::PakArchive> archive_;
+        Options opt_{};
+
+        // ReadAllBatch の作業領域
+        struct Range final {
+            std::uint64_t begin = 0;
+            std::uint64_t end = 0;
+        };
+        std::vector<std::optional<IO::Pak::PakTocEntry>> batchEntries_;
+        std::vector<Range> batchRanges_;
+    };
+
+} // namespace Engine::Asset::Loading
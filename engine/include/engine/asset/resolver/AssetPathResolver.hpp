@@ -9,6 +9,7 @@
 
 #include "engine/io/path/PathUtils.hpp"
 #include "engine/io/path/Uri.hpp"
+#include "engine/io/path/UriView.hpp"
 
 namespace Engine::Asset::Resolver {
 
@@ -35,11 +36,18 @@ namespace Engine::Asset::Resolver {
         // TODO: std::string -> Path
         Base::Result<std::string, AssetError> Resolve(std::string_view catalogPath) const;
 
+        // パース済みの URI から（scheme は剥がす。allowSchemes=false で scheme 付きなら InvalidPath）
+        Base::Result<std::string, AssetError> Resolve(Engine::IO::Path::UriView uri) const;
+
         // 便利：正規化のみ（単体テストにも使える）
         static std::string NormalizePath(std::string_view path,
                                          bool normalizeSeparators = true,
                                          bool squashSlashes = true);
 
+    private:
+        // scheme を剥がした後の論理パスを解決する（original はエラー表示用）
+        Base::Result<std::string, AssetError> ResolveLogical_(std::string_view logical, std::string_view original) const;
+
     private:
         Options opt_{};
     };
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "engine/base/Span.hpp"
+
+namespace Engine::Base {
+
+    // SharedBuffer：参照カウント付きの不変バイト列
+    // - owner（shared_ptr）が実体を生かし、data/size はその一部を指す
+    // - 実体は vector / mmap / pak の一部など何でもよい（owner の型は消去する）
+    // - コピー・Slice は shared_ptr のコピーのみ（中身は複製しない）
+    class SharedBuffer final {
+    public:
+        SharedBuffer() = default;
+
+        // owner が bytes を生かしている前提で包む
+        SharedBuffer(std::shared_ptr<const void> owner, ConstSpan<std::byte> bytes) noexcept
+            : owner_(std::move(owner)), data_(bytes.data()), size_(bytes.size()) {}
+
+        // vector の所有権を受け取る（中身はコピーしない）
+        static SharedBuffer FromVector(std::vector<std::byte> v) {
+            if (v.empty()) return SharedBuffer{};
+            auto sp = std::make_shared<const std::vector<std::byte>>(std::move(v));
+            const ConstSpan<std::byte> bytes{ sp->data(), sp->size() };
+            return SharedBuffer(std::move(sp), bytes);
+        }
+
+        // 所有していないバイト列をコピーして持つ
+        static SharedBuffer Copy(ConstSpan<std::byte> bytes) {
+            if (bytes.empty()) return SharedBuffer{};
+            std::vector<std::byte> v(bytes.size());
+            std::memcpy(v.data(), bytes.data(), bytes.size());
+            return FromVector(std::move(v));
+        }
+
+        const std::byte* data() const noexcept { return data_; }
+        std::size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+
+        const std::byte* begin() const noexcept { return data_; }
+        const std::byte* end() const noexcept { return data_ + size_; }
+
+        const std::byte& operator[](std::size_t i) const noexcept { return data_[i]; }
+
+        ConstSpan<std::byte> Bytes() const noexcept { return { data_, size_ }; }
+
+        std::string_view AsStringView() const noexcept {
+            return std::string_view(reinterpret_cast<const char*>(data_), size_);
+        }
+
+        // 部分範囲を同じ owner のまま切り出す（範囲外は切り詰め）
+        SharedBuffer Slice(std::size_t offset, std::size_t count = static_cast<std::size_t>(-1)) const noexcept {
+            if (offset > size_) offset = size_;
+            const std::size_t remain = size_ - offset;
+            if (count > remain) count = remain;
+
+            SharedBuffer out;
+            out.owner_ = owner_;
+            out.data_ = data_ + offset;
+            out.size_ = count;
+            return out;
+        }
+
+        // 実体の生存を延ばしたい場合用（デバッグ/統計など）
+        const std::shared_ptr<const void>& Owner() const noexcept { return owner_; }
+
+    private:
+        std::shared_ptr<const void> owner_;
+        const std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+} // namespace Engine::Base
@@ -5,6 +5,7 @@ namespace Engine::IO {
     namespace Path {
         class Path;
         struct Uri;
+        struct UriView;
     } // namespace Path
 
     namespace Stream {
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/base/Error.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/base/Span.hpp"
+#include "engine/io/IoError.hpp"
+
+namespace Engine::IO::Async {
+
+    using IoError = Engine::Base::Error<Engine::IO::IoErrorCode>;
+    template<class T>
+    using IoResult = Engine::Base::Result<T, IoError>;
+
+    /// 開いている fd からの範囲読み 1 件
+    struct ReadAtRequest final {
+        int fd = -1;
+        std::uint64_t offset = 0;
+        std::byte* dst = nullptr;
+        std::size_t bytes = 0;
+    };
+
+    /// 統計（テスト/ベンチ用）
+    struct AsyncReadStats final {
+        std::uint64_t batches = 0;       // ReadFiles / ReadAt の呼び出し回数
+        std::uint64_t requests = 0;      // 要求件数（ファイル数 + 範囲読み数）
+        std::uint64_t kernelSubmits = 0; // カーネルへの一括投入回数（io_uring_enter。thread pool では 0）
+    };
+
+    /// AsyncReadService：大量の読み込みをまとめて投げる（POSIX）
+    /// - ReadFiles は open/stat/read/close をまとめて投入し、全件終わってから戻る
+    ///   （1 件ずつ blocking syscall を待つのではなく、まとめて待つ）
+    /// - Linux では io_uring、使えなければ pread の thread pool で実行する
+    /// - 1 インスタンスを複数スレッドから同時に呼ばないこと（呼び出し側で直列化する）
+    class AsyncReadService {
+    public:
+        enum class Backend : std::uint8_t {
+            Auto,       // io_uring を試し、駄目なら ThreadPool
+            IoUring,
+            ThreadPool,
+        };
+
+        struct Options final {
+            Backend backend = Backend::Auto;
+
+            // io_uring: 1 回の投入で扱うファイル数（SQ はこの数倍で確保する）
+            std::uint32_t queueDepth = 256;
+
+            // thread pool: worker 数（0 = hardware_concurrency。最低 2）
+            std::size_t threads = 0;
+        };
+
+        static std::unique_ptr<AsyncReadService> Create();
+        static std::unique_ptr<AsyncReadService> Create(const Options& opt);
+
+        virtual ~AsyncReadService() = default;
+
+        virtual const char* Name() const noexcept = 0;
+
+        // ファイル全体を読む。out[i] は paths[i] の結果（out は上書きされる）
+        virtual void ReadFiles(Base::ConstSpan<std::string> nativePaths,
+                               std::vector<IoResult<Base::SharedBuffer>>& out) = 0;
+
+        // 範囲読み。out[i] は読めたバイト数（EOF で短くなる）
+        virtual void ReadAt(Base::ConstSpan<ReadAtRequest> requests,
+                            std::vector<IoResult<std::size_t>>& out) = 0;
+
+        const AsyncReadStats& Stats() const noexcept { return stats_; }
+
+        AsyncReadService(const AsyncReadService&) = delete;
+        AsyncReadService& operator=(const AsyncReadService&) = delete;
+
+    protected:
+        AsyncReadService() = default;
+
+        AsyncReadStats stats_{};
+    };
+
+    namespace detail {
+        // 1 ファイルを blocking で読む（open + fstat + pread + close）。fallback / 巨大ファイル用
+        IoResult<Base::SharedBuffer> ReadWholeFileBlocking(const std::string& nativePath);
+
+        // pread をバイト数が揃うか EOF まで繰り返す
+        IoResult<std::size_t> PreadFully(int fd, std::uint64_t offset, std::byte* dst, std::size_t bytes,
+                                         const std::string& pathForError);
+
+        // 0 初期化しない確保（全体を上書きする読み込み先用）
+        struct UninitBuffer final {
+            std::shared_ptr<std::byte[]> storage;
+            std::size_t size = 0;
+
+            static UninitBuffer Allocate(std::size_t bytes) {
+                UninitBuffer b;
+                b.size = bytes;
+                if (bytes > 0) b.storage.reset(new std::byte[bytes]);
+                return b;
+            }
+            std::byte* data() const noexcept { return storage.get(); }
+
+            // 先頭 used バイトを SharedBuffer として渡す
+            Base::SharedBuffer Share(std::size_t used) const {
+                if (used == 0) return Base::SharedBuffer{};
+                return Base::SharedBuffer(std::shared_ptr<const void>(storage, storage.get()),
+                                          Base::ConstSpan<std::byte>{ storage.get(), used });
+            }
+        };
+    } // namespace detail
+
+} // namespace Engine::IO::Async
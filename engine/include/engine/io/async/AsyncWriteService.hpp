@@ -0,0 +1,99 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/base/Error.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/io/IoError.hpp"
+#include "engine/io/fs/IFileSystem.hpp"
+#include "engine/io/path/Uri.hpp"
+
+namespace Engine::IO::Async {
+
+    using IoError = Engine::Base::Error<Engine::IO::IoErrorCode>;
+    using IoResultVoid = Engine::Base::Result<void, IoError>;
+
+    // 書き込み 1 件の完了通知（writer thread から呼ばれる）
+    using WriteCompletion = std::function<void(IoResultVoid)>;
+
+    /// 統計（テスト/ベンチ用）
+    struct AsyncWriteStats final {
+        std::uint64_t submitted = 0; // Submit の回数
+        std::uint64_t coalesced = 0; // 書く前に同じファイルへの新しい Submit で置き換えられた数
+        std::uint64_t files = 0;     // 実際に書いたファイル数
+        std::uint64_t batches = 0;   // writer がまとめて処理した回数
+        std::uint64_t fileSyncs = 0; // IStream::Sync の回数
+        std::uint64_t dirSyncs = 0;  // IFileSystem::SyncDirectory の回数（batch 内で同じディレクトリは 1 回）
+        std::uint64_t failures = 0;
+    };
+
+    /// AsyncWriteService：write-behind の書き込み（呼び出し側は待たない）
+    /// - Submit はキューに積んで戻る。書き込みは専用の writer thread が行う
+    /// - まだ書き始めていない同じファイルへの Submit は新しい内容で置き換える（完了通知は両方に最終結果を返す）
+    /// - atomicReplace："<name>.tmp~" に書いて Sync してから Move で置き換える
+    ///   （途中で落ちても元のファイルか新しいファイルのどちらかが残る。書きかけは見えない）
+    /// - batch 単位で「全部書く → 全部 Sync → 全部 Move → 親ディレクトリを 1 回ずつ SyncDirectory」の順に進める
+    ///   （fdatasync をまとめて出し、ディレクトリの fsync は batch 内で重複させない）
+    /// - 破棄時は積まれている分を書き終えてから止まる
+    class AsyncWriteService final {
+    public:
+        struct Options final {
+            bool atomicReplace = true;
+            bool sync = true;             // false なら Sync / SyncDirectory を省く（cache など消えても良いもの）
+            std::size_t maxBatchFiles = 64;
+        };
+
+        explicit AsyncWriteService(std::shared_ptr<Engine::IO::FS::IFileSystem> fs);
+        AsyncWriteService(std::shared_ptr<Engine::IO::FS::IFileSystem> fs, const Options& opt);
+        ~AsyncWriteService();
+
+        // data は共有するだけ（コピーしない）。completion は省略可
+        void Submit(const Engine::IO::Path::Uri& uri, Base::SharedBuffer data, WriteCompletion completion = {});
+
+        // ここまでに Submit した分が全部終わるまで待つ
+        void Flush();
+
+        AsyncWriteStats Stats() const;
+
+        AsyncWriteService(const AsyncWriteService&) = delete;
+        AsyncWriteService& operator=(const AsyncWriteService&) = delete;
+
+    private:
+        struct Pending final {
+            Engine::IO::Path::Uri uri;
+            Base::SharedBuffer data;
+            std::vector<WriteCompletion> completions;
+        };
+
+        void WriterLoop_();
+        void WriteBatch_(std::vector<Pending>& batch);
+
+    private:
+        std::shared_ptr<Engine::IO::FS::IFileSystem> fs_;
+        Options opt_;
+
+        mutable std::mutex mutex_;
+        std::condition_variable cv_;     // writer 起床
+        std::condition_variable idleCv_; // Flush 待ち
+        std::deque<std::string> order_;  // 投入順（key）
+        std::unordered_map<std::string, Pending> pending_;
+        std::size_t inFlight_ = 0;       // writer が処理中の件数
+        bool stop_ = false;
+        AsyncWriteStats stats_{};
+
+        std::thread writer_;
+    };
+
+} // namespace Engine::IO::Async
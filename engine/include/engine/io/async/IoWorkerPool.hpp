@@ -0,0 +1,72 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine::IO::Async {
+
+    /// IoWorkerPool：blocking I/O（pread / 展開）を流すための常駐 worker
+    /// - stream 毎に thread を持たず、ReadAtAsync の要求を全 stream で共有する
+    /// - 仕事は投入順（FIFO）に取り出す
+    /// - worker の上で pool の仕事の完了を待つときは RunOne で積まれた分を自分で流す（全 worker が待って詰まらないように）
+    class IoWorkerPool final {
+    public:
+        // 既定の共有 pool（初回呼び出しで作る。worker は hardware_concurrency、2〜8 に丸める）
+        static const std::shared_ptr<IoWorkerPool>& Shared();
+
+        explicit IoWorkerPool(std::size_t threads);
+        ~IoWorkerPool();
+
+        void Submit(std::function<void()> job);
+
+        // 積まれている仕事を 1 つ呼び出しスレッドで実行する（無ければ false）
+        bool RunOne();
+
+        std::size_t ThreadCount() const noexcept { return workers_.size(); }
+
+        // 呼び出しスレッドが worker ならその pool（違えば nullptr）
+        static IoWorkerPool* Current() noexcept;
+
+        IoWorkerPool(const IoWorkerPool&) = delete;
+        IoWorkerPool& operator=(const IoWorkerPool&) = delete;
+
+    private:
+        void WorkerLoop_();
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::deque<std::function<void()>> jobs_;
+        bool stop_ = false;
+        std::vector<std::thread> workers_;
+    };
+
+    /// InFlightCounter：stream の実行中要求数（Close / 破棄で 0 になるまで待つ）
+    class InFlightCounter final {
+    public:
+        void Begin() {
+            std::lock_guard<std::mutex> lk(mutex_);
+            ++count_;
+        }
+        void End() {
+            std::lock_guard<std::mutex> lk(mutex_);
+            if (--count_ == 0) cv_.notify_all();
+        }
+        void WaitIdle() {
+            std::unique_lock<std::mutex> lk(mutex_);
+            cv_.wait(lk, [&] { return count_ == 0; });
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::size_t count_ = 0;
+    };
+
+} // namespace Engine::IO::Async
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "engine/io/async/AsyncReadService.hpp"
+
+namespace Engine::IO::Async {
+
+    /// ThreadPoolReadService：blocking pread を worker に並べる fallback
+    /// - worker は常駐（バッチ毎に thread を作らない）
+    /// - バッチ内の要求は atomic な index で取り合う。呼び出しスレッドも参加する
+    class ThreadPoolReadService final : public AsyncReadService {
+    public:
+        explicit ThreadPoolReadService(std::size_t threads);
+        ~ThreadPoolReadService() override;
+
+        const char* Name() const noexcept override { return "ThreadPool"; }
+
+        void ReadFiles(Base::ConstSpan<std::string> nativePaths,
+                       std::vector<IoResult<Base::SharedBuffer>>& out) override;
+
+        void ReadAt(Base::ConstSpan<ReadAtRequest> requests,
+                    std::vector<IoResult<std::size_t>>& out) override;
+
+        std::size_t ThreadCount() const noexcept { return workers_.size(); }
+
+    private:
+        // count 件の仕事 fn(i) を worker + 呼び出しスレッドで消化して戻る
+        void RunBatch_(std::size_t count, const std::function<void(std::size_t)>& fn);
+        void WorkerMain_();
+        void Drain_(const std::function<void(std::size_t)>& fn, std::size_t count);
+
+    private:
+        std::vector<std::thread> workers_;
+
+        std::mutex mtx_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+        bool stop_ = false;
+
+        // 現在のバッチ（RunBatch_ 中のみ有効）
+        std::uint64_t batchId_ = 0;
+        const std::function<void(std::size_t)>* job_ = nullptr;
+        std::size_t jobCount_ = 0;
+        std::atomic<std::size_t> next_{ 0 };
+        std::size_t finished_ = 0;
+        std::size_t active_ = 0;
+    };
+
+} // namespace Engine::IO::Async
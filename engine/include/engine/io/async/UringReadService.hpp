@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "engine/io/async/AsyncReadService.hpp"
+
+namespace Engine::IO::Async {
+
+    /// UringReadService：io_uring で open/stat/read/close をまとめて投入する（Linux）
+    /// - ReadFiles は queueDepth 件ずつ
+    ///     1 往復目：OPENAT + STATX（パス指定）
+    ///     2 往復目：READ（サイズ確定後のバッファへ。short read は再投入）
+    ///   で処理し、CLOSE は次の投入に相乗りさせる。1 ファイル 4 syscall が 1 チャンク数回の enter になる
+    /// - liburing には依存しない（必要な分だけ raw syscall で持つ）
+    /// - 必要な opcode を probe し、1 つでも無ければ TryCreate は nullptr（呼び出し側で fallback）
+    class UringReadService final : public AsyncReadService {
+    public:
+        // io_uring が使えない環境（非 Linux / 古いカーネル / seccomp）では nullptr
+        static std::unique_ptr<UringReadService> TryCreate(std::uint32_t queueDepth);
+
+        ~UringReadService() override;
+
+        const char* Name() const noexcept override { return "IoUring"; }
+
+        void ReadFiles(Base::ConstSpan<std::string> nativePaths,
+                       std::vector<IoResult<Base::SharedBuffer>>& out) override;
+
+        void ReadAt(Base::ConstSpan<ReadAtRequest> requests,
+                    std::vector<IoResult<std::size_t>>& out) override;
+
+    public:
+        struct Ring;
+
+        UringReadService(std::unique_ptr<Ring> ring, std::uint32_t queueDepth);
+
+    private:
+        std::unique_ptr<Ring> ring_;
+        std::uint32_t queueDepth_ = 0;
+    };
+
+} // namespace Engine::IO::Async
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Engine::IO::Compression {
+
+    // LZ ブロック codec（LZ4 系のバイト指向フォーマット。外部依存なし）
+    //
+    //   sequence = [token][literal len ext...][literals][offset u16 LE][match len ext...]
+    //   token    = (literalLen:4 << 4) | (matchLen - kMinMatch):4   （15 は 255 区切りの拡張バイトが続く）
+    //
+    // - 最後の sequence は literal のみ（offset を持たない）
+    // - 1 ブロックは単独で展開できる（前のブロックを辞書として参照しない）
+    // - offset は 1..65535（64KB window）
+
+    inline constexpr std::size_t kMinMatch = 4;
+
+    // 最悪ケース（まったく縮まない入力）の圧縮後サイズ
+    constexpr std::size_t LzCompressBound(std::size_t srcBytes) noexcept {
+        return srcBytes + srcBytes / 255 + 16;
+    }
+
+    // src を圧縮して dst に書く。戻り値は書いたバイト数（dstCapacity に収まらなければ 0）
+    std::size_t LzCompressBlock(const std::byte* src, std::size_t srcBytes,
+                                std::byte* dst, std::size_t dstCapacity);
+
+    // 展開結果がちょうど dstBytes になったときだけ true（壊れた入力でも範囲外を読み書きしない）
+    bool LzDecompressBlock(const std::byte* src, std::size_t srcBytes,
+                           std::byte* dst, std::size_t dstBytes);
+
+} // namespace Engine::IO::Compression
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "engine/io/async/IoWorkerPool.hpp"
+#include "engine/io/compression/LzFrame.hpp"
+#include "engine/io/stream/IStream.hpp"
+
+namespace Engine::IO::Compression {
+
+    /// LzDecodeStream：LZ フレームを展開しながら読む読み取り専用 stream
+    /// - workers > 0 のとき、読み位置より先のブロックを共有 IoWorkerPool で並列に展開しておく
+    ///   （最大 readAheadBlocks ブロック分。Read は展開済みブロックから memcpy するだけになる）
+    ///   stream 毎に thread は持たない。同時に走る展開は workers と pool の thread 数の小さい方まで
+    ///   まだ誰も展開していないブロックを読むときは、Read を呼んだスレッドがその場で展開する
+    /// - workers == 0 またはブロックが 1 つだけなら、Read を呼んだスレッドでその場で展開する
+    /// - Seek は可能（先読み中のブロックは捨てて、新しい位置から展開し直す）
+    /// - ReadAtAsync は要求範囲のブロックを共有 IoWorkerPool でブロック毎に並列展開する
+    ///   （Read 用の先読み状態とは独立。frame は不変なので同時に走らせてよい）
+    class LzDecodeStream final : public Engine::IO::Stream::IStream {
+    public:
+        struct Options final {
+            // 同時に走らせる展開の最大数（0 = 同期展開）。既定は hardware_concurrency - 1（最低 1）
+            // 実際には共有 IoWorkerPool の thread 数でも頭打ちになる
+            std::size_t workers = DefaultWorkers();
+            // 読み位置から何ブロック先まで展開しておくか
+            std::size_t readAheadBlocks = 4;
+        };
+
+        static std::size_t DefaultWorkers() noexcept {
+            const unsigned hw = std::thread::hardware_concurrency();
+            return hw > 1 ? static_cast<std::size_t>(hw - 1) : 1;
+        }
+
+    public:
+        explicit LzDecodeStream(LzFrame frame);
+        LzDecodeStream(LzFrame frame, Options opt);
+        ~LzDecodeStream() override;
+
+        Engine::IO::Stream::StreamCaps Caps() const noexcept override;
+
+        bool IsOpen() const noexcept override { return open_; }
+        bool IsEof() const noexcept override { return eof_; }
+
+        Base::Result<std::size_t, IoError> Read(void* dst, std::size_t bytes) override;
+        Base::Result<std::size_t, IoError> Write(const void* src, std::size_t bytes) override;
+
+        void ReadAtAsync(std::uint64_t offset, Base::Span<std::byte> dst,
+                         Engine::IO::Stream::ReadCompletion completion) override;
+
+        Base::Result<std::uint64_t, IoError> Tell() const override;
+        Base::Result<std::uint64_t, IoError> Seek(std::int64_t offset, Engine::IO::Stream::SeekWhence whence) override;
+        Base::Result<std::uint64_t, IoError> Size() const override;
+
+        Base::Result<void, IoError> Flush() override;
+        Base::Result<void, IoError> Close() override;
+
+    private:
+        struct Slot final {
+            std::vector<std::byte> bytes;
+            std::size_t block = kNoBlock;
+            bool failed = false;
+        };
+
+        static constexpr std::size_t kNoBlock = static_cast<std::size_t>(-1);
+
+        // 先読みできるブロックがあれば pool に展開の仕事を積む（mutex_ 保持中に呼ぶ）
+        void Pump_();
+        // pool 上で動く展開の仕事：取れるブロックが無くなるまで展開して戻る
+        void RunDecode_();
+        void StopWorkers_();
+
+        // block を読める状態にして、その中身を返す（失敗時は nullptr）
+        const std::vector<std::byte>* AcquireBlock_(std::size_t block);
+
+    private:
+        LzFrame frame_;
+        Options opt_{};
+
+        std::uint64_t pos_ = 0;
+        bool open_ = true;
+        bool eof_ = false;
+
+        // 同期展開用
+        std::vector<std::byte> syncBytes_;
+        std::size_t syncBlock_ = kNoBlock;
+
+        // 並列展開用（slots_[block % window]）
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::vector<Slot> slots_;
+        std::size_t readBlock_ = 0;   // reader がまだ必要とする最小ブロック
+        std::size_t nextDecode_ = 0;  // 次に展開を始めるブロック（これより前は誰かが取った）
+        std::uint64_t generation_ = 0; // Seek で先読みを捨てたら進める
+        bool stop_ = false;
+        std::size_t maxActive_ = 0;   // 同時に走らせる RunDecode_ の上限
+        std::size_t active_ = 0;      // pool に積んだ（走っている / 待っている）RunDecode_ の数
+
+        // ReadAtAsync の実行中要求（Close / 破棄で待つ）
+        Engine::IO::Async::InFlightCounter inflight_;
+    };
+
+} // namespace Engine::IO::Compression
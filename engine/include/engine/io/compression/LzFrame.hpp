@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "engine/base/Error.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/base/Span.hpp"
+#include "engine/io/IoError.hpp"
+
+namespace Engine::IO::Compression {
+
+    using IoError = Engine::Base::Error<Engine::IO::IoErrorCode>;
+    template<class T>
+    using IoResult = Engine::Base::Result<T, IoError>;
+    using IoResultVoid = Engine::Base::Result<void, IoError>;
+
+    // LZ フレーム（データ全体を固定長ブロックに分けて LzBlock で圧縮したもの）
+    //
+    //   [magic "GLZ1"][u32 blockSize][u64 originalSize][u32 blockCount][u32 reserved]   24 バイト
+    //   [u32 x blockCount]   各ブロックの格納サイズ（最上位 bit=1 は無圧縮で格納）
+    //   [block 0][block 1]...
+    //
+    // - ブロックは互いに独立しているので、任意の順序・並列で展開できる
+    // - 縮まなかったブロックは raw で持つ（展開は memcpy だけ）
+
+    inline constexpr std::uint32_t kLzDefaultBlockSize = 128 * 1024;
+    inline constexpr std::uint32_t kLzMinBlockSize = 4 * 1024;
+    inline constexpr std::uint32_t kLzMaxBlockSize = 4 * 1024 * 1024;
+
+    class LzFrame final {
+    public:
+        struct Options final {
+            // 64KB〜256KB 程度を推奨（小さいと圧縮率、大きいと並列度・先読みの粒度が落ちる）
+            std::uint32_t blockSize = kLzDefaultBlockSize;
+        };
+
+    public:
+        LzFrame() = default;
+
+        static std::vector<std::byte> Encode(Base::ConstSpan<std::byte> src);
+        static std::vector<std::byte> Encode(Base::ConstSpan<std::byte> src, const Options& opt);
+
+        // フレームを検証してブロック表を作る（中身は展開しない）
+        static IoResult<LzFrame> Parse(Base::SharedBuffer frame);
+
+        std::uint64_t OriginalSize() const noexcept { return originalSize_; }
+        std::uint32_t BlockSize() const noexcept { return blockSize_; }
+        std::size_t BlockCount() const noexcept { return blockCount_; }
+
+        // ブロック i の展開後サイズ（最後のブロックだけ短い）
+        std::size_t BlockOriginalSize(std::size_t i) const noexcept;
+
+        // dst は BlockOriginalSize(i) バイト以上
+        IoResultVoid DecodeBlock(std::size_t i, std::byte* dst) const;
+
+        // 全体を展開する（workers > 1 なら呼び出しスレッドと共有 IoWorkerPool でブロックを分担して展開。
+        // 同時に動くのは pool の thread 数 + 1 まで）
+        IoResult<Base::SharedBuffer> DecodeAll(std::size_t workers = 1) const;
+
+    private:
+        Base::SharedBuffer frame_;
+        std::uint64_t originalSize_ = 0;
+        std::uint32_t blockSize_ = 0;
+        std::size_t blockCount_ = 0;
+        std::vector<std::uint64_t> offsets_; // blockCount+1（frame_ 先頭から）
+    };
+
+} // namespace Engine::IO::Compression
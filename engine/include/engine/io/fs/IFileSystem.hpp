@@ -78,6 +78,13 @@ namespace Engine::IO::FS {
 
         virtual IoResult<std::unique_ptr<IFileWatcher>> CreateWatcher() = 0;
 
+        /// SyncDirectory：ディレクトリの entry（作成 / rename の結果）を永続化する（fsync(dir) 相当）
+        /// - 永続化の概念が無い backend は何もしない（既定）
+        virtual IoResultVoid SyncDirectory(const Engine::IO::Path::Uri& uri) {
+            (void)uri;
+            return IoResultVoid::Ok();
+        }
+
     protected:
         IFileSystem() = default;
     };
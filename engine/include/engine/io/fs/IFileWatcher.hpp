@@ -9,7 +9,8 @@
 #include "engine/base/Error.hpp"
 #include "engine/base/Result.hpp"
 #include "engine/io/IoError.hpp"
-#include "engine/io/IoFwd.hpp" // Path::Uri forward
+#include "engine/io/IoFwd.hpp"
+#include "engine/io/path/Uri.hpp" // FileChangeEvent が Uri を値で持つので完全型が必要
 
 namespace Engine::IO::FS {
 
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/io/fs/IFileWatcher.hpp"
+#include "engine/io/path/Uri.hpp"
+
+namespace Engine::IO::FS {
+
+    /// InotifyFileWatcher：inotify で変更を受け取る IFileWatcher（Linux）
+    /// - Poll は non-blocking の read(2) でカーネルのキューを吸うだけ（変化が無ければ syscall 1 回で戻る）
+    /// - ファイルの監視は親ディレクトリに watch を張って名前で振り分ける（同じディレクトリの watch は共有）
+    ///   → 無いファイルも監視でき、エディタの「別名で書いて rename」も Created として届く
+    /// - ディレクトリの監視は recursive なら配下の全ディレクトリに watch を張り、後から出来たディレクトリにも張る
+    ///   途中で張れなければ（上限 ENOSPC / 権限なし等）AddWatch はエラーを返し、張った分は外す（ポーリング等に回す用）
+    ///   後から出来たディレクトリに張れなかったときはその監視に Unknown を出す
+    /// - イベントの対応：
+    ///     IN_CREATE / IN_MOVED_TO                 -> Created
+    ///     IN_MODIFY / IN_CLOSE_WRITE / IN_ATTRIB  -> Modified
+    ///     IN_DELETE / IN_MOVED_FROM               -> Removed
+    ///     同じ Poll 内で対になった MOVED_FROM / MOVED_TO（ディレクトリ監視の中）は Renamed
+    ///     キューの溢れ / 親ディレクトリごと消えた                -> Unknown（呼び出し側で取り直す）
+    /// - coalesce=true の監視では 1 回の Poll 内で同じ (kind, path) を 1 つにまとめる
+    /// - maxEvents を超えた分は内部に残して次の Poll で返す
+    /// - URI の解決は NativeFileSystem と同じ（scheme 無しは rootDirectory 基準、file:// は絶対パス）
+    class InotifyFileWatcher final : public IFileWatcher {
+    public:
+        // inotify が使えない環境（非 Linux / 上限超過）では nullptr
+        static std::unique_ptr<InotifyFileWatcher> TryCreate(std::string rootDirectory = {});
+
+        ~InotifyFileWatcher() override;
+
+        const char* Name() const noexcept override { return "InotifyFileWatcher"; }
+        bool IsOpen() const noexcept override;
+
+        IoResult<WatchId> AddWatch(const Engine::IO::Path::Uri& uri, const WatchOptions& opt = {}) override;
+        IoResultVoid RemoveWatch(WatchId id) override;
+
+        IoResult<std::size_t> Poll(std::vector<FileChangeEvent>& outEvents, std::size_t maxEvents = 256) override;
+
+        IoResultVoid Close() override;
+
+        // 張っている inotify watch（ディレクトリ）の数（テスト/統計用）
+        std::size_t DirectoryWatchCount() const noexcept;
+
+        // 張る watch（ディレクトリ）の数の上限。超えた分は ENOSPC と同じ失敗になる（0 = カーネルの上限のみ）
+        void SetWatchLimit(std::size_t maxDirectories) noexcept;
+
+    public:
+        struct State;
+
+        explicit InotifyFileWatcher(std::unique_ptr<State> state);
+
+    private:
+        std::unique_ptr<State> state_;
+    };
+
+} // namespace Engine::IO::FS
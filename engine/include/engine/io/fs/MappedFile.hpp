@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "engine/base/Error.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/base/Span.hpp"
+#include "engine/io/IoError.hpp"
+
+namespace Engine::IO::FS {
+
+    using IoError = Engine::Base::Error<Engine::IO::IoErrorCode>;
+    template<class T>
+    using IoResult = Engine::Base::Result<T, IoError>;
+
+    /// MappedFile：読み取り専用の mmap（POSIX）
+    /// - shared_ptr で共有し、最後の参照が消えたときに munmap する
+    /// - 中身はページキャッシュそのもの（heap へのコピーなし）
+    /// - 空ファイルは mmap せず Bytes() が空になる
+    /// - MAP_PRIVATE でもまだ触っていないページには外からの上書きが見え、truncate されると
+    ///   切られた範囲に触った時点で SIGBUS になる。map 中に書き換えられないファイル（pak 等）にだけ使う
+    class MappedFile final {
+    public:
+        struct Options final {
+            bool sequential = true; // MADV_SEQUENTIAL（先頭から読む asset 向け）
+            bool willNeed   = true; // MADV_WILLNEED（map 直後に先読み開始）
+            bool populate   = false; // MAP_POPULATE（map 時に全ページを fault させる。小さい/必ず全部読むファイル向け）
+        };
+
+    public:
+        static IoResult<std::shared_ptr<const MappedFile>> Open(const std::string& nativePath);
+        static IoResult<std::shared_ptr<const MappedFile>> Open(const std::string& nativePath, const Options& opt);
+
+        // 開いて fstat 済みの fd を map する（size はその fstat の値。fd は閉じない＝呼び出し側のもの）
+        // nativePath はエラーと NativePath() 用
+        static IoResult<std::shared_ptr<const MappedFile>> Map(int fd, std::size_t size, const std::string& nativePath,
+                                                               const Options& opt);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const std::byte* Data() const noexcept { return data_; }
+        std::size_t Size() const noexcept { return size_; }
+        Base::ConstSpan<std::byte> Bytes() const noexcept { return { data_, size_ }; }
+
+        const std::string& NativePath() const noexcept { return path_; }
+
+    private:
+        MappedFile(const std::byte* data, std::size_t size, std::string path) noexcept
+            : data_(data), size_(size), path_(std::move(path)) {}
+
+    private:
+        const std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+        std::string path_;
+    };
+
+} // namespace Engine::IO::FS
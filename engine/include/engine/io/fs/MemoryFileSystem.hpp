@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/io/fs/IFileSystem.hpp"
+#include "engine/io/path/Uri.hpp"
+
+namespace Engine::IO::FS {
+
+    /// MemoryFileSystem：メモリ上の不変 blob を持つ backend（RAM disk / テスト / ベンチ用）
+    /// - ファイルの中身は SharedBuffer（参照カウント付き・不変）。Open(Read) はそれを共有した SpanStream を返す（コピー無し）
+    /// - 書き込み open は作業用バッファに書き、Flush / Close で新しい blob に差し替える
+    ///   （既に開いている読み取り stream は古い blob を持ち続けるので影響を受けない）
+    /// - Copy は blob を共有するだけ（中身は複製しない）
+    /// - 受け付ける URI：scheme 無し / memory://（"memory://a/b" も loose parse の "a/b" も同じパス）
+    ///   Vfs には rootUri="memory://assets" のように mount する
+    /// - CreateWatcher は変更時に直接積まれるイベントを返す watcher（ポーリング無し・recursive 対応）
+    /// - スレッドセーフ（内部 mutex）
+    class MemoryFileSystem final : public IFileSystem {
+    public:
+        MemoryFileSystem();
+        ~MemoryFileSystem() override;
+
+        const char* Name() const noexcept override { return "MemoryFS"; }
+
+        // ---- blob を直接扱う（stream を経由しない） ----
+        // path に blob を置く（親ディレクトリは自動で作る）
+        IoResultVoid Put(std::string_view path, Base::SharedBuffer blob);
+        IoResultVoid Put(std::string_view path, std::vector<std::byte> bytes);
+
+        IoResult<Base::SharedBuffer> ReadShared(const Engine::IO::Path::Uri& uri) const;
+        // memory 内パスで直接引く（IAssetSource 用。Uri を組み立てない）
+        IoResult<Base::SharedBuffer> ReadShared(std::string_view path) const;
+
+        std::size_t FileCount() const;
+        std::uint64_t TotalBytes() const; // 共有されている blob も参照毎に数える
+
+        // ---- IFileSystem ----
+        IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>
+        Open(const Engine::IO::Path::Uri& uri, Engine::IO::Stream::FileOpenMode mode) override;
+
+        IoResult<bool> Exists(const Engine::IO::Path::Uri& uri) override;
+        IoResult<FileInfo> Stat(const Engine::IO::Path::Uri& uri) override;
+
+        IoResultVoid CreateDirectories(const Engine::IO::Path::Uri& uri) override;
+        IoResultVoid Remove(const Engine::IO::Path::Uri& uri, const RemoveOptions& opt = {}) override;
+        IoResultVoid Move(const Engine::IO::Path::Uri& from, const Engine::IO::Path::Uri& to) override;
+        IoResultVoid Copy(const Engine::IO::Path::Uri& from, const Engine::IO::Path::Uri& to) override;
+
+        IoResult<std::vector<DirectoryEntry>>
+        List(const Engine::IO::Path::Uri& uri, const ListOptions& opt = {}) override;
+
+        IoResult<std::string> ToNativePathString(const Engine::IO::Path::Uri& uri) override;
+
+        FileSystemCapabilities Capabilities() const noexcept override;
+
+        IoResult<std::unique_ptr<DirectoryIterator>>
+        Iterate(const Engine::IO::Path::Uri& uri, const ListOptions& opt = {}) override;
+
+        IoResult<std::unique_ptr<IFileWatcher>> CreateWatcher() override;
+
+    public:
+        // 中身（書き込み stream / watcher と共有するので shared_ptr で持つ）
+        struct State;
+
+    private:
+        std::shared_ptr<State> state_;
+    };
+
+} // namespace Engine::IO::FS
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <iterator>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -16,6 +18,7 @@
 #include "engine/io/fs/IFileSystem.hpp"
 #include "engine/io/stream/FileOpenMode.hpp"
 #include "engine/io/fs/MountPoint.hpp"
+#include "engine/io/path/UriView.hpp"
 
 namespace Engine::IO::FS {
 
@@ -27,41 +30,46 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
 namespace detail {
 
     // ---- Uri adapter（ここだけ合わせればOK）----
-    inline std::string UriText(const Engine::IO::Path::Uri& u) {
+    inline std::string UriText(Engine::IO::Path::UriView u) {
         return u.ToString();
     }
     inline Engine::IO::Path::Uri UriParse(std::string_view s) {
         return Engine::IO::Path::ParseUriLoose(s);
     }
 
-    // "scheme://rest" の scheme を抽出（見つからなければ空）
-    inline std::string_view ExtractScheme(std::string_view uri) {
-        const auto pos = uri.find("://");
-        if (pos == std::string_view::npos) return {};
-        return uri.substr(0, pos);
+    // Uri の scheme 名（既知 scheme は固定文字列、Unknown は schemeText、None は空）
+    inline std::string_view SchemeName(Engine::IO::Path::UriView u) noexcept {
+        return u.SchemeName();
     }
 
-    // "scheme://rest" の rest（先頭スラッシュは除去）を抽出
-    inline std::string_view ExtractAfterScheme(std::string_view uri) {
-        const auto pos = uri.find("://");
-        if (pos == std::string_view::npos) {
-            return std::move(uri);
+    // UriText(u) の "scheme://" より後ろ（先頭スラッシュは除去）を out に追記する
+    inline void AppendRelText(std::string& out, Engine::IO::Path::UriView u) {
+        const std::size_t start = out.size();
+        const std::string_view p = u.path;
+        if (u.HasScheme()) {
+            out += u.authority;
+            if (!u.authority.empty() && !p.empty() && p.front() != '/') out.push_back('/');
         }
-        std::string_view rest = uri.substr(pos + 3);
-        while (!rest.empty() && (rest.front() == '/' || rest.front() == '\\')) {
-            rest.remove_prefix(1);
+        out += p;
+        if (!u.query.empty()) {
+            out.push_back('?');
+            out += u.query;
         }
-        return std::move(rest);
+        if (!u.fragment.empty()) {
+            out.push_back('#');
+            out += u.fragment;
+        }
+
+        std::size_t lead = start;
+        while (lead < out.size() && (out[lead] == '/' || out[lead] == '\\')) ++lead;
+        out.erase(start, lead - start);
     }
 
-    // rootUri + "/" + rel を string で合成（スキーム等は root 側に従う）
-    inline Engine::IO::Path::Uri JoinRootAndRel(const Engine::IO::Path::Uri& root, std::string_view rel) {
+    // rootUri を "root/" の形で描画しておく（rel をそのまま後ろに足せる）
+    inline std::string RenderRootPrefix(const Engine::IO::Path::Uri& root) {
         std::string r = UriText(root);
         if (!r.empty() && r.back() != '/') r.push_back('/');
-        // rel 先頭スラッシュを除去
-        while (!rel.empty() && (rel.front() == '/' || rel.front() == '\\')) rel.remove_prefix(1);
-        r.append(rel.data(), rel.size());
-        return UriParse(r);
+        return r;
     }
 
     inline bool IsNotFound(const IoError& e) noexcept {
@@ -87,9 +95,23 @@ namespace detail {
 
     /// mount 管理
     /// - 追加/削除
-    /// - scheme で候補を取り出し、priority 降順で並べる
+    /// - mount/unmount の度に scheme 別の索引（priority 降順）と root の文字列を作り直す
+    ///   Candidates / Resolve は呼ぶ度に Uri を文字列化しない
     class MountTable final {
     public:
+        MountTable() = default;
+        // 索引は mounts_ の要素を指すので、コピーしたら作り直す（move は要素のアドレスが変わらない）
+        MountTable(const MountTable& o) : mounts_(o.mounts_) { Reindex(); }
+        MountTable& operator=(const MountTable& o) {
+            if (this != &o) {
+                mounts_ = o.mounts_;
+                Reindex();
+            }
+            return *this;
+        }
+        MountTable(MountTable&&) noexcept = default;
+        MountTable& operator=(MountTable&&) noexcept = default;
+
         IoResultVoid Mount(MountPoint mp) {
             if (!mp.fs) {
                 return IoResultVoid::Err(IoError::Make(
@@ -103,6 +125,7 @@ namespace detail {
             }
             mounts_.push_back(std::move(mp));
             SortByPriority();
+            Reindex();
             return IoResultVoid::Ok();
         }
 
@@ -111,43 +134,74 @@ namespace detail {
                 [&](const MountPoint& m) { return m.name == name; });
             const bool removed = (it != mounts_.end());
             mounts_.erase(it, mounts_.end());
+            if (removed) Reindex();
             return removed;
         }
 
-        void Clear() { mounts_.clear(); }
+        void Clear() {
+            mounts_.clear();
+            Reindex();
+        }
+
+        /// mount の追加/削除の度に進む（解決結果のキャッシュを捨てる判定用）
+        std::uint64_t Generation() const noexcept { return generation_; }
 
         const std::vector<MountPoint>& All() const noexcept { return mounts_; }
 
-        /// scheme に一致する mount を priority 降順で返す
-        std::vector<const MountPoint*> Candidates(const Engine::IO::Path::Uri& vfsUri) const {
-            const std::string u = detail::UriText(vfsUri);
-            const std::string_view scheme = detail::ExtractScheme(u);
+        /// scheme に一致する mount を priority 降順で返す（確保なし。次の mount/unmount まで有効）
+        const std::vector<const MountPoint*>& Candidates(Engine::IO::Path::UriView vfsUri) const noexcept {
+            return CandidatesForScheme(detail::SchemeName(vfsUri));
+        }
 
-            std::vector<const MountPoint*> out;
-            out.reserve(mounts_.size());
+        const std::vector<const MountPoint*>& CandidatesForScheme(std::string_view scheme) const noexcept {
+            static const std::vector<const MountPoint*> kNone;
+            if (scheme.empty()) return kNone;
 
-            for (const auto& m : mounts_) {
-                const std::string mu = detail::UriText(m.mountUri);
-                const std::string_view ms = detail::ExtractScheme(mu);
-                if (!scheme.empty() && ms == scheme) {
-                    out.push_back(&m);
-                }
+            // scheme の種類は少ないので線形で十分
+            for (const auto& b : index_) {
+                if (b.scheme == scheme) return b.mounts;
             }
-            // mounts_ 自体が priority 降順なので out もその順
-            return out;
+            return kNone;
         }
 
         /// 読み取り向け解決：存在する（または open/stat できる） mount を上から探すのは Vfs 側で行う
-        IoResult<ResolvedMount> Resolve(const MountPoint& mp, const Engine::IO::Path::Uri& vfsUri) const {
-            const std::string u = detail::UriText(vfsUri);
-            const std::string_view rel = detail::ExtractAfterScheme(u);
-            ResolvedMount r;
-            r.mp = &mp;
-            r.nativeUri = detail::JoinRootAndRel(mp.rootUri, rel);
-            return IoResult<ResolvedMount>::Ok(std::move(r));
+        IoResult<ResolvedMount> Resolve(const MountPoint& mp, Engine::IO::Path::UriView vfsUri) const {
+            std::string r = RootPrefixOf(mp);
+            detail::AppendRelText(r, vfsUri);
+
+            ResolvedMount out;
+            out.mp = &mp;
+            out.nativeUri = detail::UriParse(r);
+            return IoResult<ResolvedMount>::Ok(std::move(out));
+        }
+
+        /// mount 内の相対パス（"textures/a.png"、空なら root）を下位 FS の URI にする
+        Engine::IO::Path::Uri ResolveRel(const MountPoint& mp, std::string_view rel) const {
+            std::string r = RootPrefixOf(mp);
+            if (rel.empty()) {
+                // root 自体は末尾の "/" を付けない（"scheme://" だけは残す）
+                if (r.size() > 3 && r.back() == '/' && r.compare(r.size() - 3, 3, "://") != 0) r.pop_back();
+            } else {
+                r.append(rel.data(), rel.size());
+            }
+            return detail::UriParse(r);
         }
 
     private:
+        struct SchemeBucket final {
+            std::string scheme;
+            std::vector<const MountPoint*> mounts; // priority 降順
+        };
+
+        std::string RootPrefixOf(const MountPoint& mp) const {
+            const std::less<const MountPoint*> before;
+            if (!mounts_.empty() && !before(&mp, mounts_.data()) && before(&mp, mounts_.data() + mounts_.size())) {
+                return rootPrefixes_[static_cast<std::size_t>(&mp - mounts_.data())];
+            }
+            // table 外の MountPoint（呼び出し側が自前で持っているもの）
+            return detail::RenderRootPrefix(mp.rootUri);
+        }
+
         void SortByPriority() {
             std::stable_sort(mounts_.begin(), mounts_.end(),
                 [](const MountPoint& a, const MountPoint& b) {
@@ -158,8 +212,35 @@ namespace detail {
                 });
         }
 
+        // mounts_ の並び（= priority 降順）のまま scheme 別に振り分ける
+        // mounts_ を触ったら必ず呼ぶ（index_ は mounts_ の要素を指している）
+        void Reindex() {
+            index_.clear();
+            rootPrefixes_.clear();
+            rootPrefixes_.reserve(mounts_.size());
+
+            for (const auto& m : mounts_) {
+                rootPrefixes_.push_back(detail::RenderRootPrefix(m.rootUri));
+
+                const std::string_view ms = detail::SchemeName(m.mountUri);
+                if (ms.empty()) continue; // scheme 無しの mount はどの URI にも当たらない
+
+                auto it = std::find_if(index_.begin(), index_.end(),
+                    [&](const SchemeBucket& b) { return b.scheme == ms; });
+                if (it == index_.end()) {
+                    index_.push_back(SchemeBucket{ std::string(ms), {} });
+                    it = std::prev(index_.end());
+                }
+                it->mounts.push_back(&m);
+            }
+            ++generation_;
+        }
+
     private:
         std::vector<MountPoint> mounts_;
+        std::vector<SchemeBucket> index_;
+        std::vector<std::string> rootPrefixes_; // mounts_ と同じ添字
+        std::uint64_t generation_ = 0;
     };
 
 } // namespace Engine::IO::VFS
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "engine/base/Error.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/io/IoError.hpp"
+#include "engine/io/async/IoWorkerPool.hpp"
+#include "engine/io/stream/FileOpenMode.hpp"
+#include "engine/io/stream/IStream.hpp"
+#include "engine/io/stream/Seek.hpp"
+
+namespace Engine::IO::FS {
+
+    using IoError = Engine::Base::Error<Engine::IO::IoErrorCode>;
+    template<class T>
+    using IoResult = Engine::Base::Result<T, IoError>;
+    using IoResultVoid = Engine::Base::Result<void, IoError>;
+
+    namespace detail {
+        // errno -> IoError（ENOENT=NotFound / EACCES=PermissionDenied など）
+        // - fallback は分類できない errno のときに使うコード
+        IoError IoErrorFromErrno(int err, Engine::IO::IoErrorCode fallback,
+                                 const char* msg, const std::string& path);
+    } // namespace detail
+
+    /// OS のアクセスパターンヒント（posix_fadvise に渡す）
+    enum class AccessHint : std::uint8_t {
+        Normal = 0,
+        Sequential, // 先頭から順に読む（asset のロード）
+        Random      // pak の TOC 参照など
+    };
+
+    /// NativeFileStream：ファイルディスクリプタ直持ちの IStream（POSIX）
+    /// - Read/Write は pread/pwrite（位置は stream 側で保持。lseek を挟まない）
+    /// - Size は fstat（毎回問い合わせる。書き込み中のサイズ変化にも追従）
+    /// - ReadAt は位置を動かさない（複数箇所の読み出し用）
+    /// - ReadAtAsync は WILLNEED を出してから共有 IoWorkerPool 上で pread する（stream 毎の thread は持たない）
+    class NativeFileStream final : public Engine::IO::Stream::IStream {
+    public:
+        // fd の所有権を受け取る（Close/デストラクタで close する）
+        NativeFileStream(int fd, Engine::IO::Stream::FileOpenMode mode, std::string nativePath);
+        ~NativeFileStream() override;
+
+        // path を開く（失敗時は errno を IoError に変換）
+        static IoResult<std::unique_ptr<NativeFileStream>>
+        Open(const std::string& nativePath, Engine::IO::Stream::FileOpenMode mode,
+             AccessHint hint = AccessHint::Sequential);
+
+        Engine::IO::Stream::StreamCaps Caps() const noexcept override;
+        bool IsOpen() const noexcept override { return fd_ >= 0; }
+        bool IsEof() const noexcept override { return eof_; }
+
+        IoResult<std::size_t> Read(void* dst, std::size_t bytes) override;
+        IoResult<std::size_t> Write(const void* src, std::size_t bytes) override;
+
+        void ReadAtAsync(std::uint64_t offset, Engine::Base::Span<std::byte> dst,
+                         Engine::IO::Stream::ReadCompletion completion) override;
+
+        IoResult<std::uint64_t> Tell() const override;
+        IoResult<std::uint64_t> Seek(std::int64_t offset, Engine::IO::Stream::SeekWhence whence) override;
+        IoResult<std::uint64_t> Size() const override;
+
+        IoResultVoid Flush() override;
+        IoResultVoid Sync() override; // fdatasync
+        IoResultVoid Close() override;
+
+        // 位置を変えずに offset から読む（EOF で短く返る。EINTR/部分読みは内部で詰める）
+        IoResult<std::size_t> ReadAt(std::uint64_t offset, void* dst, std::size_t bytes) const;
+
+        // 範囲のヒントを OS に渡す（best-effort。未対応なら何もしない）
+        void Advise(AccessHint hint, std::uint64_t offset = 0, std::uint64_t length = 0) const noexcept;
+        void WillNeed(std::uint64_t offset, std::uint64_t length) const noexcept;
+
+        int NativeHandle() const noexcept { return fd_; }
+        const std::string& NativePath() const noexcept { return path_; }
+
+    private:
+        int fd_ = -1;
+        Engine::IO::Stream::FileOpenMode mode_ = Engine::IO::Stream::FileOpenMode::None;
+        std::string path_;
+        std::uint64_t pos_ = 0;
+        bool eof_ = false;
+
+        // ReadAtAsync の実行中要求（Close は 0 になるまで待ってから fd を閉じる）
+        Engine::IO::Async::InFlightCounter inflight_;
+    };
+
+} // namespace Engine::IO::FS
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/io/fs/IFileSystem.hpp"
+#include "engine/io/fs/NativeFileStream.hpp"
+#include "engine/io/path/Uri.hpp"
+
+namespace Engine::IO::FS {
+
+    namespace detail {
+        // Uri -> OS パス（NativeFileSystem と同じ規則。watcher など FS の外で native path が要る所向け）
+        IoResult<std::string> ToNativePath(const std::string& rootDirectory, const Engine::IO::Path::Uri& uri);
+    } // namespace detail
+
+    /// NativeFileSystem：OS のファイルシステムを直接叩く backend（POSIX）
+    /// - Open は fd + pread の NativeFileStream を返す（ifstream を経由しない）
+    /// - 受け付ける URI：
+    ///   - scheme 無し  : rootDirectory からの相対パス（root が空なら cwd 基準）
+    ///   - file://      : 絶対パス（"file:///a/b" / "file://a/b" はどちらも "/a/b"）
+    ///   - それ以外は NotSupported（assets:// 等は Vfs/MountTable で file:// に解決してから渡す）
+    /// - CreateWatcher は Linux なら InotifyFileWatcher、使えなければ stat ポーリングの watcher を返す
+    class NativeFileSystem final : public IFileSystem {
+    public:
+        struct Options final {
+            // scheme 無し URI の基準ディレクトリ（空なら cwd）
+            std::string rootDirectory;
+
+            // 読み取り open 時に渡すアクセスヒント
+            AccessHint readHint = AccessHint::Sequential;
+
+            // このサイズ以下のファイルは open 時に全体を WILLNEED（先読み開始）にする。0 で無効
+            std::uint64_t willNeedMaxBytes = 1024 * 1024;
+
+            // Copy の転送バッファ
+            std::size_t copyBufferBytes = 256 * 1024;
+        };
+
+    public:
+        NativeFileSystem();
+        explicit NativeFileSystem(Options opt);
+        ~NativeFileSystem() override;
+
+        void SetOptions(Options opt);
+        const Options& GetOptions() const noexcept;
+
+        const char* Name() const noexcept override { return "NativeFS"; }
+
+        IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>
+        Open(const Engine::IO::Path::Uri& uri, Engine::IO::Stream::FileOpenMode mode) override;
+
+        // 具象型で開く（ReadAt / Advise を使いたい呼び出し側向け）
+        IoResult<std::unique_ptr<NativeFileStream>>
+        OpenFile(const Engine::IO::Path::Uri& uri, Engine::IO::Stream::FileOpenMode mode);
+
+        IoResult<bool> Exists(const Engine::IO::Path::Uri& uri) override;
+        IoResult<FileInfo> Stat(const Engine::IO::Path::Uri& uri) override;
+
+        IoResultVoid CreateDirectories(const Engine::IO::Path::Uri& uri) override;
+        IoResultVoid Remove(const Engine::IO::Path::Uri& uri, const RemoveOptions& opt = {}) override;
+        IoResultVoid Move(const Engine::IO::Path::Uri& from, const Engine::IO::Path::Uri& to) override;
+        // 隣の "<to>.tmp~" に書いて rename する（失敗しても to は元のまま）
+        IoResultVoid Copy(const Engine::IO::Path::Uri& from, const Engine::IO::Path::Uri& to) override;
+
+        IoResult<std::vector<DirectoryEntry>>
+        List(const Engine::IO::Path::Uri& uri, const ListOptions& opt = {}) override;
+
+        IoResult<std::string> ToNativePathString(const Engine::IO::Path::Uri& uri) override;
+
+        FileSystemCapabilities Capabilities() const noexcept override;
+
+        IoResult<std::unique_ptr<DirectoryIterator>>
+        Iterate(const Engine::IO::Path::Uri& uri, const ListOptions& opt = {}) override;
+
+        IoResult<std::unique_ptr<IFileWatcher>> CreateWatcher() override;
+
+        // open(O_DIRECTORY) + fsync
+        IoResultVoid SyncDirectory(const Engine::IO::Path::Uri& uri) override;
+
+    private:
+        Options opt_{};
+    };
+
+} // namespace Engine::IO::FS
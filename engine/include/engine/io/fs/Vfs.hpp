@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -18,8 +19,12 @@
 #include "engine/io/fs/DirectoryEntry.hpp"
 #include "engine/io/fs/DirectoryIterator.hpp"
 #include "engine/io/stream/FileOpenMode.hpp"
+#include "engine/io/stream/IStream.hpp"
 #include "engine/io/fs/MountTable.hpp"
 #include "engine/io/fs/MountPoint.hpp"
+#include "engine/io/fs/VfsDirectoryIndex.hpp"
+#include "engine/io/fs/VfsLookupCache.hpp"
+#include "engine/io/path/UriView.hpp"
 
 namespace Engine::IO::FS {
 
@@ -28,22 +33,133 @@ template<class T>
 using IoResult = Engine::Base::Result<T, IoError>;
 using IoResultVoid = Engine::Base::Result<void, IoError>;
 
+    namespace detail {
+
+        // 書き込み stream を包み、Close（または破棄）の後に 1 回だけ onClosed を呼ぶ
+        // - Vfs の directory index / lookup cache は書き終わった後の size で取り直す
+        // - onClosed は Vfs を指すので、stream は Vfs より先に Close / 破棄すること
+        class VfsWriteStream final : public Engine::IO::Stream::IStream {
+        public:
+            VfsWriteStream(std::unique_ptr<Engine::IO::Stream::IStream> inner, std::function<void()> onClosed)
+                : inner_(std::move(inner)), onClosed_(std::move(onClosed)) {}
+
+            ~VfsWriteStream() override {
+                inner_.reset(); // 下位 stream の破棄で中身が確定する（MemoryFileSystem 等）
+                Notify_();
+            }
+
+            Engine::IO::Stream::StreamCaps Caps() const noexcept override { return inner_->Caps(); }
+            bool IsOpen() const noexcept override { return inner_->IsOpen(); }
+            bool IsEof() const noexcept override { return inner_->IsEof(); }
+
+            IoResult<std::size_t> Read(void* dst, std::size_t bytes) override { return inner_->Read(dst, bytes); }
+            IoResult<std::size_t> Write(const void* src, std::size_t bytes) override { return inner_->Write(src, bytes); }
+            void ReadAtAsync(std::uint64_t offset, Engine::Base::Span<std::byte> dst,
+                             Engine::IO::Stream::ReadCompletion completion) override {
+                inner_->ReadAtAsync(offset, dst, std::move(completion));
+            }
+
+            IoResult<std::uint64_t> Tell() const override { return inner_->Tell(); }
+            IoResult<std::uint64_t> Seek(std::int64_t offset, Engine::IO::Stream::SeekWhence whence) override {
+                return inner_->Seek(offset, whence);
+            }
+            IoResult<std::uint64_t> Size() const override { return inner_->Size(); }
+
+            IoResultVoid Flush() override { return inner_->Flush(); }
+            IoResultVoid Sync() override { return inner_->Sync(); }
+
+            IoResultVoid Close() override {
+                auto r = inner_->Close();
+                Notify_();
+                return r;
+            }
+
+        private:
+            void Notify_() {
+                if (!onClosed_) return;
+                auto f = std::move(onClosed_);
+                onClosed_ = nullptr;
+                f();
+            }
+
+            std::unique_ptr<Engine::IO::Stream::IStream> inner_;
+            std::function<void()> onClosed_;
+        };
+
+    } // namespace detail
+
     /// VFS 本体
     /// - scheme（assets:// 等）で MountTable を検索
+    /// - パスは UriView で受ける（Uri からは暗黙変換。ParseUriView の結果なら文字列から確保なしで渡せる）
     /// - 読み取りは overlay（priority 降順で “見つかったら勝ち”）
     /// - 書き込みは最初に見つかった writable mount に集約
+    /// - Open(読み) / Exists / Stat の解決結果（勝った mount / 見つからなかった）は VfsLookupCache に覚える
+    ///   2 回目以降は候補 mount を順に試さず、キャッシュした mount だけを見る
+    ///   Vfs を通さない変更は ApplyChanges（watcher のイベント）か InvalidateLookupCache で知らせること
+    /// - EnableDirectoryIndex 後は全 mount を合成したディレクトリ木（VfsDirectoryIndex）を持ち、
+    ///   List / Iterate / Exists は木だけで答える。Mount / Unmount / Vfs 経由の変更 / ApplyChanges で差分更新する
+    ///   書き込みで開いた stream は Close（または破棄）した時点で木に反映する（書き込み中の size は覚えない）
+    ///   （Mounts() から直接 mount を触った場合は EnableDirectoryIndex で作り直すこと）
     class Vfs final {
     public:
         MountTable& Mounts() noexcept { return mounts_; }
         const MountTable& Mounts() const noexcept { return mounts_; }
 
-        IoResultVoid Mount(MountPoint mp) { return mounts_.Mount(std::move(mp)); }
-        bool Unmount(std::string_view name) { return mounts_.Unmount(name); }
+        IoResultVoid Mount(MountPoint mp) {
+            const std::string name = mp.name;
+            auto r = mounts_.Mount(std::move(mp));
+            if (r && indexEnabled_) {
+                // 索引に失敗しても mount 自体は有効（その scheme は下位 FS への問い合わせに戻る）
+                for (const auto& m : mounts_.All()) {
+                    if (m.name == name) (void)index_.AddMount(mounts_, m);
+                }
+            }
+            return r;
+        }
+
+        bool Unmount(std::string_view name) {
+            std::vector<std::string> schemes;
+            for (const auto& m : mounts_.All()) {
+                if (m.name == name) schemes.emplace_back(detail::SchemeName(m.mountUri));
+            }
+            const bool removed = mounts_.Unmount(name);
+            if (removed && indexEnabled_) {
+                for (const auto& s : schemes) (void)index_.RebuildScheme(mounts_, s);
+            }
+            return removed;
+        }
+
+        // ---- directory index ----
+        // 今の mount から木を作る（以後は差分で保つ）
+        IoResultVoid EnableDirectoryIndex() {
+            indexEnabled_ = true;
+            return index_.Rebuild(mounts_);
+        }
+
+        void DisableDirectoryIndex() {
+            indexEnabled_ = false;
+            index_.Clear();
+        }
+
+        bool IsDirectoryIndexEnabled() const noexcept { return indexEnabled_; }
+        const VfsDirectoryIndex& DirectoryIndex() const noexcept { return index_; }
+
+        // ---- lookup cache ----
+        VfsLookupCache& LookupCache() noexcept { return cache_; }
+        const VfsLookupCache& LookupCache() const noexcept { return cache_; }
+
+        void InvalidateLookupCache() { cache_.Clear(); }
+
+        // mount した FS の watcher から回収したイベントを渡す
+        void ApplyChanges(const std::vector<Engine::IO::FS::FileChangeEvent>& events) {
+            cache_.ApplyChanges(events);
+            if (indexEnabled_) index_.ApplyChanges(mounts_, events);
+        }
 
         // ---- IFileSystem 互換の操作群（VFS ルーティング付き） ----
 
         IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>
-        Open(const Engine::IO::Path::Uri& uri, Engine::IO::Stream::FileOpenMode mode) {
+        Open(Engine::IO::Path::UriView uri, Engine::IO::Stream::FileOpenMode mode) {
             if (!Engine::IO::Stream::IsValid(mode)) {
                 return IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>::Err(
                     IoError::Make(Engine::IO::IoErrorCode::InvalidPath,
@@ -51,7 +167,23 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
             }
 
             const bool writeReq = detail::WantsWrite(mode);
-            const auto cands = mounts_.Candidates(uri);
+
+            // 読みはキャッシュに勝者があればそこだけ開く（消えていたら全候補を見直す）
+            std::string key = detail::UriText(uri);
+            const std::uint64_t gen = mounts_.Generation();
+            if (!writeReq) {
+                if (auto hit = cache_.Find(key, gen)) {
+                    if (!hit->Found()) {
+                        return IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>::Err(
+                            IoError::Make(Engine::IO::IoErrorCode::NotFound, "Vfs: not found (cached)", key));
+                    }
+                    auto openr = hit->mp->fs->Open(hit->nativeUri, mode);
+                    if (openr || !detail::IsNotFound(openr.error())) return openr;
+                    cache_.Erase(key);
+                }
+            }
+
+            const auto& cands = mounts_.Candidates(uri);
             if (cands.empty()) {
                 return IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>::Err(
                     IoError::Make(Engine::IO::IoErrorCode::NotFound, "Vfs: no mount for scheme"));
@@ -67,7 +199,20 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
                     if (!rr) continue;
 
                     auto openr = mp->fs->Open(rr.value().nativeUri, mode);
-                    if (openr) return openr;
+                    if (openr) {
+                        // 作成で overlay の勝ち負け / negative entry が変わる
+                        cache_.Erase(key);
+                        if (!indexEnabled_) return openr;
+
+                        // 木は書き終わってから取り直す（ここで取ると size 0 のまま残る）
+                        auto onClosed = [this, key = std::move(key), target = uri.ToUri()]() {
+                            cache_.Erase(key);
+                            RefreshIndex_(target);
+                        };
+                        std::unique_ptr<Engine::IO::Stream::IStream> s =
+                            std::make_unique<detail::VfsWriteStream>(std::move(openr.value()), std::move(onClosed));
+                        return IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>::Ok(std::move(s));
+                    }
 
                     // NotFound でも “書き込み” は次候補へ（overlay write の想定）
                     // ただし PermissionDenied 等は即返す
@@ -88,7 +233,10 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
                     if (!rr) continue;
 
                     auto openr = mp->fs->Open(rr.value().nativeUri, mode);
-                    if (openr) return openr;
+                    if (openr) {
+                        cache_.StoreFound(std::move(key), gen, *mp, std::move(rr.value().nativeUri));
+                        return openr;
+                    }
 
                     if (detail::IsNotFound(openr.error())) {
                         lastNotFound = openr.error();
@@ -96,12 +244,20 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
                     }
                     return IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>::Err(openr.error());
                 }
+                cache_.StoreMissing(std::move(key), gen);
                 return IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>::Err(lastNotFound);
             }
         }
 
-        IoResult<bool> Exists(const Engine::IO::Path::Uri& uri) {
-            const auto cands = mounts_.Candidates(uri);
+        IoResult<bool> Exists(Engine::IO::Path::UriView uri) {
+            if (indexEnabled_ && index_.IsIndexed(uri)) return IoResult<bool>::Ok(index_.Find(uri).has_value());
+
+            // キャッシュにあれば下位 FS に問い合わせない
+            std::string key = detail::UriText(uri);
+            const std::uint64_t gen = mounts_.Generation();
+            if (auto hit = cache_.Find(key, gen)) return IoResult<bool>::Ok(hit->Found());
+
+            const auto& cands = mounts_.Candidates(uri);
             if (cands.empty()) return IoResult<bool>::Ok(false);
 
             for (const auto* mp : cands) {
@@ -111,17 +267,34 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
 
                 auto er = mp->fs->Exists(rr.value().nativeUri);
                 if (er) {
-                    if (er.value()) return IoResult<bool>::Ok(true);
+                    if (er.value()) {
+                        cache_.StoreFound(std::move(key), gen, *mp, std::move(rr.value().nativeUri));
+                        return IoResult<bool>::Ok(true);
+                    }
                     continue;
                 }
                 if (detail::IsNotFound(er.error())) continue;
                 return IoResult<bool>::Err(er.error());
             }
+            cache_.StoreMissing(std::move(key), gen);
             return IoResult<bool>::Ok(false);
         }
 
-        IoResult<Engine::IO::FS::FileInfo> Stat(const Engine::IO::Path::Uri& uri) {
-            const auto cands = mounts_.Candidates(uri);
+        IoResult<Engine::IO::FS::FileInfo> Stat(Engine::IO::Path::UriView uri) {
+            // 中身（size / mtime）は変わるので、覚えるのは勝った mount だけ
+            std::string key = detail::UriText(uri);
+            const std::uint64_t gen = mounts_.Generation();
+            if (auto hit = cache_.Find(key, gen)) {
+                if (!hit->Found()) {
+                    return IoResult<Engine::IO::FS::FileInfo>::Err(
+                        IoError::Make(Engine::IO::IoErrorCode::NotFound, "Vfs: not found (cached)", key));
+                }
+                auto sr = hit->mp->fs->Stat(hit->nativeUri);
+                if (sr || !detail::IsNotFound(sr.error())) return sr;
+                cache_.Erase(key);
+            }
+
+            const auto& cands = mounts_.Candidates(uri);
             if (cands.empty()) {
                 return IoResult<Engine::IO::FS::FileInfo>::Err(
                     IoError::Make(Engine::IO::IoErrorCode::NotFound, "Vfs: no mount for scheme"));
@@ -135,7 +308,10 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
                 if (!rr) continue;
 
                 auto sr = mp->fs->Stat(rr.value().nativeUri);
-                if (sr) return sr;
+                if (sr) {
+                    cache_.StoreFound(std::move(key), gen, *mp, std::move(rr.value().nativeUri));
+                    return sr;
+                }
 
                 if (detail::IsNotFound(sr.error())) {
                     lastNotFound = sr.error();
@@ -143,12 +319,13 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
                 }
                 return IoResult<Engine::IO::FS::FileInfo>::Err(sr.error());
             }
+            cache_.StoreMissing(std::move(key), gen);
             return IoResult<Engine::IO::FS::FileInfo>::Err(lastNotFound);
         }
 
-        IoResultVoid CreateDirectories(const Engine::IO::Path::Uri& uri) {
+        IoResultVoid CreateDirectories(Engine::IO::Path::UriView uri) {
             // 書き込み先 mount を選ぶ（preferWrite / priority 順）
-            const auto cands = mounts_.Candidates(uri);
+            const auto& cands = mounts_.Candidates(uri);
             if (cands.empty()) {
                 return IoResultVoid::Err(IoError::Make(
                     Engine::IO::IoErrorCode::NotFound, "Vfs: no mount for scheme"));
@@ -162,7 +339,12 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
                 if (!rr) continue;
 
                 auto cr = mp->fs->CreateDirectories(rr.value().nativeUri);
-                if (cr) return cr;
+                if (cr) {
+                    // 途中のディレクトリも出来るので丸ごと捨てる
+                    cache_.Clear();
+                    RefreshIndex_(uri);
+                    return cr;
+                }
 
                 if (detail::IsNotFound(cr.error())) continue;
                 return IoResultVoid::Err(cr.error());
@@ -172,8 +354,8 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
                 Engine::IO::IoErrorCode::PermissionDenied, "Vfs: no writable mount found"));
         }
 
-        IoResultVoid Remove(const Engine::IO::Path::Uri& uri, const Engine::IO::FS::RemoveOptions& opt = {}) {
-            const auto cands = mounts_.Candidates(uri);
+        IoResultVoid Remove(Engine::IO::Path::UriView uri, const Engine::IO::FS::RemoveOptions& opt = {}) {
+            const auto& cands = mounts_.Candidates(uri);
             if (cands.empty()) {
                 return IoResultVoid::Err(IoError::Make(
                     Engine::IO::IoErrorCode::NotFound, "Vfs: no mount for scheme"));
@@ -190,7 +372,13 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
 
                 auto sr = mp->fs->Stat(rr.value().nativeUri);
                 if (sr) {
-                    return mp->fs->Remove(rr.value().nativeUri, opt);
+                    // ディレクトリなら配下も消えるので丸ごと捨てる
+                    auto rmr = mp->fs->Remove(rr.value().nativeUri, opt);
+                    if (rmr) {
+                        cache_.Clear();
+                        RefreshIndex_(uri);
+                    }
+                    return rmr;
                 }
                 if (detail::IsNotFound(sr.error())) {
                     lastNotFound = sr.error();
@@ -201,10 +389,10 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
             return IoResultVoid::Err(lastNotFound);
         }
 
-        IoResultVoid Move(const Engine::IO::Path::Uri& from, const Engine::IO::Path::Uri& to) {
+        IoResultVoid Move(Engine::IO::Path::UriView from, Engine::IO::Path::UriView to) {
             // 原則：同じ mount（同じ下位 FS）内での Move を想定
             // まず “from が存在する mount” を決め、to も同じ mount に解決して実行する
-            const auto cands = mounts_.Candidates(from);
+            const auto& cands = mounts_.Candidates(from);
             if (cands.empty()) {
                 return IoResultVoid::Err(IoError::Make(
                     Engine::IO::IoErrorCode::NotFound, "Vfs: no mount for scheme"));
@@ -224,16 +412,22 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
                     return IoResultVoid::Err(sr.error());
                 }
 
-                return mp->fs->Move(rfrom.value().nativeUri, rto.value().nativeUri);
+                auto mr = mp->fs->Move(rfrom.value().nativeUri, rto.value().nativeUri);
+                if (mr) {
+                    cache_.Clear();
+                    RefreshIndex_(from);
+                    RefreshIndex_(to);
+                }
+                return mr;
             }
 
             return IoResultVoid::Err(IoError::Make(
                 Engine::IO::IoErrorCode::NotFound, "Vfs: source not found or no writable mount"));
         }
 
-        IoResultVoid Copy(const Engine::IO::Path::Uri& from, const Engine::IO::Path::Uri& to) {
+        IoResultVoid Copy(Engine::IO::Path::UriView from, Engine::IO::Path::UriView to) {
             // Copy も Move と同様に “from の存在 mount” を決める
-            const auto cands = mounts_.Candidates(from);
+            const auto& cands = mounts_.Candidates(from);
             if (cands.empty()) {
                 return IoResultVoid::Err(IoError::Make(
                     Engine::IO::IoErrorCode::NotFound, "Vfs: no mount for scheme"));
@@ -253,26 +447,71 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
                     return IoResultVoid::Err(sr.error());
                 }
 
-                return mp->fs->Copy(rfrom.value().nativeUri, rto.value().nativeUri);
+                auto cr = mp->fs->Copy(rfrom.value().nativeUri, rto.value().nativeUri);
+                if (cr) {
+                    cache_.Erase(detail::UriText(to));
+                    RefreshIndex_(to);
+                }
+                return cr;
             }
 
             return IoResultVoid::Err(IoError::Make(
                 Engine::IO::IoErrorCode::NotFound, "Vfs: source not found or no writable mount"));
         }
 
-        /// List：複数 mount を **マージ**（同名は priority 高い方が勝つ）
+        /// SyncDirectory：ディレクトリの entry（作成 / rename の結果）を永続化する
+        /// - そのディレクトリがある writable mount（priority 順で最初）の下位 FS に渡す
+        IoResultVoid SyncDirectory(Engine::IO::Path::UriView uri) {
+            const auto& cands = mounts_.Candidates(uri);
+            if (cands.empty()) {
+                return IoResultVoid::Err(IoError::Make(
+                    Engine::IO::IoErrorCode::NotFound, "Vfs: no mount for scheme"));
+            }
+
+            IoError lastNotFound = IoError::Make(Engine::IO::IoErrorCode::NotFound, "Vfs: not found");
+            for (const auto* mp : cands) {
+                if (!mp || !mp->fs) continue;
+                if (mp->readOnly) continue;
+
+                auto rr = mounts_.Resolve(*mp, uri);
+                if (!rr) continue;
+
+                auto sr = mp->fs->Stat(rr.value().nativeUri);
+                if (sr) return mp->fs->SyncDirectory(rr.value().nativeUri);
+                if (detail::IsNotFound(sr.error())) {
+                    lastNotFound = sr.error();
+                    continue;
+                }
+                return IoResultVoid::Err(sr.error());
+            }
+            return IoResultVoid::Err(lastNotFound);
+        }
+
+        /// List：複数 mount を **マージ**（同じパスは priority 高い方が勝つ）
+        /// - path は木の有無によらず VFS 側の URI（"assets://textures/a.png"）。下位 FS の path は返さない
+        /// - directory index があれば木から返す
         IoResult<std::vector<Engine::IO::FS::DirectoryEntry>>
-        List(const Engine::IO::Path::Uri& uri, const Engine::IO::FS::ListOptions& opt = {}) {
-            const auto cands = mounts_.Candidates(uri);
+        List(Engine::IO::Path::UriView uri, const Engine::IO::FS::ListOptions& opt = {}) {
+            if (indexEnabled_ && index_.IsIndexed(uri)) return index_.List(uri, opt);
+
+            const auto& cands = mounts_.Candidates(uri);
             if (cands.empty()) {
                 return IoResult<std::vector<Engine::IO::FS::DirectoryEntry>>::Err(
                     IoError::Make(Engine::IO::IoErrorCode::NotFound, "Vfs: no mount for scheme"));
             }
 
             std::vector<Engine::IO::FS::DirectoryEntry> out;
-            std::unordered_set<std::string> seenNames;
+            std::unordered_set<std::string> seen; // VFS 側の path
             out.reserve(64);
 
+            // 木と同じ "scheme://rel" の形で組み立てる
+            std::string vfsBase(detail::SchemeName(uri));
+            vfsBase += "://";
+            const std::size_t relStart = vfsBase.size();
+            detail::AppendRelText(vfsBase, uri);
+            while (vfsBase.size() > relStart && vfsBase.back() == '/') vfsBase.pop_back();
+            if (vfsBase.size() > relStart) vfsBase.push_back('/');
+
             bool anyOk = false;
             IoError lastErr = IoError::Make(Engine::IO::IoErrorCode::NotFound, "Vfs: list failed");
 
@@ -292,11 +531,29 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
                 }
 
                 anyOk = true;
+
+                // 下位 FS は「列挙した URI + "/" + 相対パス」を返す。相対パスを取り出して VFS 側に付け替える
+                // （mount が描画した native URI と FS が返す path で scheme の綴りが違うことがあるので "://" より後ろで比べる）
+                auto afterScheme = [](std::string_view t) {
+                    const auto pos = t.find("://");
+                    return pos == std::string_view::npos ? t : t.substr(pos + 3);
+                };
+                std::string nativeBase(afterScheme(detail::UriText(rr.value().nativeUri)));
+                if (!nativeBase.empty() && nativeBase.back() != '/') nativeBase.push_back('/');
+
                 for (auto& e : lr.value()) {
+                    std::string_view rel = afterScheme(e.path);
+                    if (rel.size() > nativeBase.size() && rel.compare(0, nativeBase.size(), nativeBase) == 0) {
+                        rel.remove_prefix(nativeBase.size());
+                    } else {
+                        rel = e.name; // 形の違う path を返す FS：非 recursive の名前として扱う
+                    }
+
+                    std::string path = vfsBase;
+                    path.append(rel.data(), rel.size());
                     // priority 高い mount のエントリを優先（先に入ったものを残す）
-                    if (seenNames.insert(e.name).second) {
-                        // 返す path は “VFS 側の path” に揃えるのが理想だが、
-                        // ここでは下位FSの返す path をそのまま許容（必要なら後で変換）
+                    if (seen.insert(path).second) {
+                        e.path = std::move(path);
                         out.push_back(std::move(e));
                     }
                 }
@@ -313,7 +570,7 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
 
         /// Iterate：簡易に List を VectorDirectoryIterator に変換（巨大ディレクトリでは platform 実装が欲しい）
         IoResult<std::unique_ptr<Engine::IO::FS::DirectoryIterator>>
-        Iterate(const Engine::IO::Path::Uri& uri, const Engine::IO::FS::ListOptions& opt = {}) {
+        Iterate(Engine::IO::Path::UriView uri, const Engine::IO::FS::ListOptions& opt = {}) {
             auto lr = List(uri, opt);
             if (!lr) {
                 return IoResult<std::unique_ptr<Engine::IO::FS::DirectoryIterator>>::Err(lr.error());
@@ -322,9 +579,9 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
             return IoResult<std::unique_ptr<Engine::IO::FS::DirectoryIterator>>::Ok(std::move(it));
         }
 
-        IoResult<std::string> ToNativePathString(const Engine::IO::Path::Uri& uri) {
+        IoResult<std::string> ToNativePathString(Engine::IO::Path::UriView uri) {
             // “存在する mount” のものを返す（read overlay）
-            const auto cands = mounts_.Candidates(uri);
+            const auto& cands = mounts_.Candidates(uri);
             if (cands.empty()) {
                 return IoResult<std::string>::Err(IoError::Make(
                     Engine::IO::IoErrorCode::NotFound, "Vfs: no mount for scheme"));
@@ -349,8 +606,16 @@ using IoResultVoid = Engine::Base::Result<void, IoError>;
             return IoResult<std::string>::Err(lastNotFound);
         }
 
+    private:
+        void RefreshIndex_(Engine::IO::Path::UriView uri) {
+            if (indexEnabled_) (void)index_.Refresh(mounts_, uri);
+        }
+
     private:
         MountTable mounts_;
+        VfsLookupCache cache_;
+        VfsDirectoryIndex index_;
+        bool indexEnabled_ = false;
     };
 
 } // namespace Engine::IO::VFS
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "engine/io/fs/DirectoryEntry.hpp"
+#include "engine/io/fs/FileInfo.hpp"
+#include "engine/io/fs/IFileWatcher.hpp"
+#include "engine/io/fs/MountPoint.hpp"
+#include "engine/io/fs/MountTable.hpp"
+#include "engine/io/path/Uri.hpp"
+#include "engine/io/path/UriView.hpp"
+
+namespace Engine::IO::FS {
+
+    /// VfsDirectoryIndex：overlay を合成したディレクトリ木をメモリに持つ
+    /// - scheme ごとに 1 本の木。ファイルは勝った mount（priority 最上位）と size / mtime を持つ
+    ///   ディレクトリは全 mount の中身を合成する（同名は priority 高い方が勝つ。Vfs::List と同じ規則）
+    /// - AddMount は新しい mount だけを列挙して既存の木にマージする
+    /// - Refresh は 1 パス分（ディレクトリなら配下ごと）を全候補 mount から取り直す（watcher のイベント用）
+    /// - List / Find は木をたどるだけで下位 FS に触らない
+    /// - 下位 FS の列挙は lock の外で行い、出来た部分木を差し替える（読みは shared lock で並行）
+    class VfsDirectoryIndex final {
+    public:
+        struct FileRecord final {
+            FileType type = FileType::None;
+            std::uint64_t sizeBytes = 0; // 列挙時点の値（Modified イベントで取り直す）
+            TimeNs mtimeNs = 0;
+            std::string mount;           // 勝った mount 名（ディレクトリは空）
+        };
+
+        struct Stats final {
+            std::size_t schemes = 0;
+            std::size_t files = 0;
+            std::size_t directories = 0;
+            std::uint64_t refreshes = 0;
+        };
+
+    public:
+        VfsDirectoryIndex();
+        ~VfsDirectoryIndex();
+
+        VfsDirectoryIndex(const VfsDirectoryIndex&) = delete;
+        VfsDirectoryIndex& operator=(const VfsDirectoryIndex&) = delete;
+
+        // mounts の全 scheme を作り直す
+        IoResultVoid Rebuild(const MountTable& mounts);
+        // scheme 1 つ分を作り直す（mount が無くなった scheme は木ごと捨てる）
+        IoResultVoid RebuildScheme(const MountTable& mounts, std::string_view scheme);
+
+        // mounts に追加済みの mp の中身をマージする（scheme が未索引なら作り直し）
+        // 失敗したらその scheme の索引は捨てる（Vfs は下位 FS への問い合わせに戻る）
+        IoResultVoid AddMount(const MountTable& mounts, const MountPoint& mp);
+
+        // vfsUri の 1 パス分を取り直す（消えていれば木から外す）
+        IoResultVoid Refresh(const MountTable& mounts, Engine::IO::Path::UriView vfsUri);
+
+        // mount した FS の watcher のイベント（下位 FS 側の path）を mount の root から VFS パスに戻して Refresh する
+        void ApplyChanges(const MountTable& mounts, const std::vector<FileChangeEvent>& events);
+
+        void Clear();
+
+        // vfsUri の scheme が索引済みか（false なら Find / List の結果は使えない）
+        bool IsIndexed(Engine::IO::Path::UriView vfsUri) const;
+
+        // 見えているファイル / ディレクトリ（無ければ nullopt）
+        std::optional<FileRecord> Find(Engine::IO::Path::UriView vfsUri) const;
+
+        // DirectoryEntry::path は VFS 側の URI（"assets://textures/a.png"）
+        IoResult<std::vector<DirectoryEntry>>
+        List(Engine::IO::Path::UriView vfsUri, const ListOptions& opt = {}) const;
+
+        // files / directories は木をたどって数える
+        Stats GetStats() const;
+
+    public:
+        struct Node;
+
+    private:
+        struct SchemeTree;
+
+        bool HasScheme_(std::string_view scheme) const;
+        IoResultVoid RefreshRel_(const MountTable& mounts, const std::string& scheme, const std::string& rel);
+        std::uint32_t Intern_(const std::string& mountName);
+
+    private:
+        mutable std::shared_mutex mutex_;
+        std::vector<std::unique_ptr<SchemeTree>> trees_;
+        std::vector<std::string> owners_; // Node::owner -> mount 名
+        std::uint64_t refreshes_ = 0;
+    };
+
+} // namespace Engine::IO::FS
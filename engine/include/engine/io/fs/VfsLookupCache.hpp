@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/io/fs/IFileWatcher.hpp"
+#include "engine/io/fs/MountPoint.hpp"
+#include "engine/io/path/Uri.hpp"
+
+namespace Engine::IO::FS {
+
+    /// VfsLookupCache：VFS パス -> 読み取りで勝つ mount と下位 FS 用 URI の解決結果を覚える
+    /// - どの mount にも無かったパスも negative entry として覚える
+    /// - MountTable::Generation が変わったら（mount の追加/削除）丸ごと捨てる
+    /// - Vfs 経由の書き込み / ApplyChanges（watcher のイベント）で該当分を捨てる
+    /// - スレッドセーフ（内部 mutex）
+    class VfsLookupCache final {
+    public:
+        struct Options final {
+            bool enabled = true;
+            bool cacheNegative = true;
+
+            // 超えたら丸ごと捨てる（0 で無制限）
+            std::size_t maxEntries = 64 * 1024;
+        };
+
+        struct Entry final {
+            const MountPoint* mp = nullptr; // nullptr = negative（どの mount にも無い）
+            Engine::IO::Path::Uri nativeUri;
+
+            bool Found() const noexcept { return mp != nullptr; }
+        };
+
+        struct Stats final {
+            std::uint64_t hits = 0;
+            std::uint64_t negativeHits = 0;
+            std::uint64_t misses = 0;
+            std::uint64_t invalidations = 0; // Clear（generation 変化を含む）の回数
+        };
+
+    public:
+        VfsLookupCache() = default;
+        explicit VfsLookupCache(Options opt) : opt_(opt) {}
+
+        void SetOptions(Options opt);
+        const Options& GetOptions() const noexcept { return opt_; }
+
+        // generation が記録と違えば捨ててから引く
+        std::optional<Entry> Find(const std::string& key, std::uint64_t generation);
+
+        void StoreFound(std::string key, std::uint64_t generation, const MountPoint& mp, Engine::IO::Path::Uri nativeUri);
+        void StoreMissing(std::string key, std::uint64_t generation);
+
+        void Erase(const std::string& key);
+        void Clear();
+
+        // watcher のイベントを反映する
+        // - Modified は解決結果を変えないので無視
+        // - Created / Removed / Renamed は overlay の勝ち負けや negative entry が変わり得るので丸ごと捨てる
+        //   （イベントの path は下位 FS 側のものなので VFS パスへは逆引きしない）
+        void ApplyChanges(const std::vector<FileChangeEvent>& events);
+
+        std::size_t Size() const;
+        Stats GetStats() const;
+
+    private:
+        // mutex 保持中に呼ぶ
+        void SyncGeneration_(std::uint64_t generation);
+        void Insert_(std::string key, Entry e);
+
+    private:
+        mutable std::mutex mutex_;
+        Options opt_{};
+        std::uint64_t generation_ = 0;
+        std::unordered_map<std::string, Entry> map_;
+        Stats stats_{};
+    };
+
+} // namespace Engine::IO::FS
@@ -18,6 +18,7 @@
 #include "engine/io/fs/Vfs.hpp"              // Vfs（使わないなら外してOK）
 #include "engine/io/stream/FileOpenMode.hpp"  // FileOpenMode, Has/IsValid
 #include "engine/io/stream/IStream.hpp"
+#include "engine/io/stream/ReadToEnd.hpp"
 
 namespace Engine::IO::Helpers {
 
@@ -27,13 +28,16 @@ namespace Engine::IO::Helpers {
     using IoResultVoid = Engine::Base::Result<void, IoError>;
 
     struct ReadAllOptions final {
-        std::size_t maxBytes = 64u * 1024u * 1024u; // 安全上限（64MB）
-        std::size_t chunkBytes = 64u * 1024u;       // 64KB
+        std::size_t maxBytes = 64u * 1024u * 1024u; // 安全上限（64MB）。0=無制限
+        std::size_t chunkBytes = 64u * 1024u;       // 64KB（サイズ不明時の初期確保 / ReadAllChunks の単位）
         bool tryUseSizeHint = true;                 // stream.Size() を試す
     };
 
     struct WriteAllOptions final {
         bool flush = true;
+        // "<name>.tmp~" に書いて Sync してから Move で置き換える（書きかけのファイルを見せない）
+        // - 待てない呼び出し側は Async::AsyncWriteService を使う
+        bool atomicReplace = false;
     };
 
     inline IoError MakeErr(Engine::IO::IoErrorCode code, const char* msg, std::string detail = {}) {
@@ -68,45 +72,32 @@ namespace Engine::IO::Helpers {
         return vfs.Open(uri, mode);
     }
 
+    inline Engine::IO::Stream::ReadToEndOptions ToReadToEndOptions(const ReadAllOptions& opt) noexcept {
+        Engine::IO::Stream::ReadToEndOptions r;
+        r.maxBytes = opt.maxBytes;
+        r.chunkBytes = opt.chunkBytes;
+        r.tryUseSizeHint = opt.tryUseSizeHint;
+        return r;
+    }
+
+    // 残りサイズが分かれば out へ直接読む（Stream::ReadToEnd）
     inline IoResult<std::vector<std::byte>>
     ReadAllFromStream(Engine::IO::Stream::IStream& s, const ReadAllOptions& opt) {
         std::vector<std::byte> out;
-
-        // size hint（取れれば reserve）
-        if (opt.tryUseSizeHint) {
-            auto szr = s.Size();
-            if (szr) {
-                const auto sz = static_cast<std::size_t>(szr.value());
-                if (sz > opt.maxBytes) {
-                    return IoResult<std::vector<std::byte>>::Err(
-                        MakeErr(Engine::IO::IoErrorCode::ReadFailed, "ReadAllBytes: exceeds maxBytes"));
-                }
-                out.reserve(sz);
-            }
-        }
-
-        std::vector<std::byte> buf(opt.chunkBytes);
-
-        while (true) {
-            auto rr = s.Read(buf.data(), buf.size());
-            if (!rr) return IoResult<std::vector<std::byte>>::Err(rr.error());
-
-            const std::size_t n = rr.value();
-            if (n == 0) break;
-
-            if (out.size() + n > opt.maxBytes) {
-                return IoResult<std::vector<std::byte>>::Err(
-                    MakeErr(Engine::IO::IoErrorCode::ReadFailed, "ReadAllBytes: exceeds maxBytes"));
-            }
-
-            const std::size_t old = out.size();
-            out.resize(old + n);
-            std::memcpy(out.data() + old, buf.data(), n);
-        }
-
+        auto rr = Engine::IO::Stream::ReadToEnd(s, out, ToReadToEndOptions(opt));
+        if (!rr) return IoResult<std::vector<std::byte>>::Err(rr.error());
         return IoResult<std::vector<std::byte>>::Ok(std::move(out));
     }
 
+    // std::string へ直接（bytes -> string のコピーをしない）
+    inline IoResult<std::string>
+    ReadAllTextFromStream(Engine::IO::Stream::IStream& s, const ReadAllOptions& opt) {
+        std::string out;
+        auto rr = Engine::IO::Stream::ReadToEnd(s, out, ToReadToEndOptions(opt));
+        if (!rr) return IoResult<std::string>::Err(rr.error());
+        return IoResult<std::string>::Ok(std::move(out));
+    }
+
     inline IoResultVoid
     WriteAllToStream(Engine::IO::Stream::IStream& s, Engine::Base::ConstSpan<std::byte> data) {
         std::size_t offset = 0;
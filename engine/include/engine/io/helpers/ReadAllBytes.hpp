@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include <utility>
+
 #include "engine/io/helpers/FileAllCommon.hpp"
 #include "engine/io/stream/IStream.hpp"
 
@@ -36,4 +39,32 @@ namespace Engine::IO::Helpers {
         return IoResult<std::vector<std::byte>>::Ok(std::move(br.value()));
     }
 
+    // chunk ごとに fn(Base::ConstSpan<std::byte>) へ渡す（全体をメモリに持たない。maxBytes は見ない）
+    // - fn が false を返したらそこで止める。戻り値は渡した合計バイト数
+    template<class Fn>
+    IoResult<std::uint64_t>
+    ReadAllChunks(Engine::IO::FS::IFileSystem& fs, const Engine::IO::Path::Uri& uri, Fn&& fn,
+                  const ReadAllOptions& opt = {}) {
+        auto orr = OpenRead(fs, uri);
+        if (!orr) return IoResult<std::uint64_t>::Err(orr.error());
+
+        auto& s = *orr.value();
+        auto cr = Engine::IO::Stream::ReadChunks(s, opt.chunkBytes, std::forward<Fn>(fn));
+        (void)s.Close();
+        return cr;
+    }
+
+    template<class Fn>
+    IoResult<std::uint64_t>
+    ReadAllChunks(Engine::IO::FS::Vfs& vfs, const Engine::IO::Path::Uri& uri, Fn&& fn,
+                  const ReadAllOptions& opt = {}) {
+        auto orr = OpenRead(vfs, uri);
+        if (!orr) return IoResult<std::uint64_t>::Err(orr.error());
+
+        auto& s = *orr.value();
+        auto cr = Engine::IO::Stream::ReadChunks(s, opt.chunkBytes, std::forward<Fn>(fn));
+        (void)s.Close();
+        return cr;
+    }
+
 } // namespace Engine::IO::Helpers
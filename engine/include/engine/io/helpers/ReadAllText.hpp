@@ -13,33 +13,31 @@ namespace Engine::IO::Helpers {
     inline IoResult<std::string>
     ReadAllTextUtf8(Engine::IO::FS::IFileSystem& fs, const Engine::IO::Path::Uri& uri,
                     const ReadAllOptions& opt = {}) {
-        auto br = ReadAllBytes(fs, uri, opt);
-        if (!br) return IoResult<std::string>::Err(br.error());
-
-        const auto& bytes = br.value();
-        std::string s;
-        s.resize(bytes.size());
-        if (!bytes.empty()) {
-            std::memcpy(s.data(), bytes.data(), bytes.size());
-        }
-        StripUtf8Bom(s);
-        return IoResult<std::string>::Ok(std::move(s));
+        auto orr = OpenRead(fs, uri);
+        if (!orr) return IoResult<std::string>::Err(orr.error());
+
+        auto& st = *orr.value();
+        auto tr = ReadAllTextFromStream(st, opt);
+        if (!tr) return IoResult<std::string>::Err(tr.error());
+
+        (void)st.Close();
+        StripUtf8Bom(tr.value());
+        return IoResult<std::string>::Ok(std::move(tr.value()));
     }
 
     inline IoResult<std::string>
     ReadAllTextUtf8(Engine::IO::FS::Vfs& vfs, const Engine::IO::Path::Uri& uri,
                     const ReadAllOptions& opt = {}) {
-        auto br = ReadAllBytes(vfs, uri, opt);
-        if (!br) return IoResult<std::string>::Err(br.error());
-
-        const auto& bytes = br.value();
-        std::string s;
-        s.resize(bytes.size());
-        if (!bytes.empty()) {
-            std::memcpy(s.data(), bytes.data(), bytes.size());
-        }
-        StripUtf8Bom(s);
-        return IoResult<std::string>::Ok(std::move(s));
+        auto orr = OpenRead(vfs, uri);
+        if (!orr) return IoResult<std::string>::Err(orr.error());
+
+        auto& st = *orr.value();
+        auto tr = ReadAllTextFromStream(st, opt);
+        if (!tr) return IoResult<std::string>::Err(tr.error());
+
+        (void)st.Close();
+        StripUtf8Bom(tr.value());
+        return IoResult<std::string>::Ok(std::move(tr.value()));
     }
 
 } // namespace Engine::IO::Helpers
@@ -4,44 +4,49 @@
 
 namespace Engine::IO::Helpers {
 
+    namespace detail {
+
+        template<class Fs>
+        IoResultVoid WriteAllBytesTo(Fs& fs, const Engine::IO::Path::Uri& uri,
+                                     Engine::Base::ConstSpan<std::byte> data,
+                                     const WriteAllOptions& opt) {
+            const Engine::IO::Path::Uri target = opt.atomicReplace ? Engine::IO::Path::SiblingUri(uri, ".tmp~") : uri;
+
+            auto orw = OpenWriteTruncate(fs, target);
+            if (!orw) return IoResultVoid::Err(orw.error());
+
+            auto& s = *orw.value();
+            auto wr = WriteAllToStream(s, data);
+            if (wr && opt.atomicReplace) wr = s.Sync();
+            else if (wr && opt.flush) wr = s.Flush();
+            // close の失敗（遅延した書き込みエラー等）も書けていない扱い。置き換えずに返す
+            auto cr = s.Close();
+            if (wr && !cr) wr = IoResultVoid::Err(cr.error());
+
+            if (!opt.atomicReplace) return wr;
+            if (wr) wr = fs.Move(target, uri);
+            if (!wr) {
+                (void)fs.Remove(target);
+                return wr;
+            }
+            // rename の結果も永続化（永続化の概念が無い backend では何もしない）
+            return fs.SyncDirectory(Engine::IO::Path::ParentUri(uri));
+        }
+
+    } // namespace detail
+
     inline IoResultVoid
     WriteAllBytes(Engine::IO::FS::IFileSystem& fs, const Engine::IO::Path::Uri& uri,
                   Engine::Base::ConstSpan<std::byte> data,
                   const WriteAllOptions& opt = {}) {
-        auto orw = OpenWriteTruncate(fs, uri);
-        if (!orw) return IoResultVoid::Err(orw.error());
-
-        auto& s = *orw.value();
-        auto wr = WriteAllToStream(s, data);
-        if (!wr) return IoResultVoid::Err(wr.error());
-
-        if (opt.flush) {
-            auto fr = s.Flush();
-            if (!fr) return IoResultVoid::Err(fr.error());
-        }
-
-        (void)s.Close();
-        return IoResultVoid::Ok();
+        return detail::WriteAllBytesTo(fs, uri, data, opt);
     }
 
     inline IoResultVoid
     WriteAllBytes(Engine::IO::FS::Vfs& vfs, const Engine::IO::Path::Uri& uri,
                   Engine::Base::ConstSpan<std::byte> data,
                   const WriteAllOptions& opt = {}) {
-        auto orw = OpenWriteTruncate(vfs, uri);
-        if (!orw) return IoResultVoid::Err(orw.error());
-
-        auto& s = *orw.value();
-        auto wr = WriteAllToStream(s, data);
-        if (!wr) return IoResultVoid::Err(wr.error());
-
-        if (opt.flush) {
-            auto fr = s.Flush();
-            if (!fr) return IoResultVoid::Err(fr.error());
-        }
-
-        (void)s.Close();
-        return IoResultVoid::Ok();
+        return detail::WriteAllBytesTo(vfs, uri, data, opt);
     }
 
 } // namespace Engine::IO::Helpers
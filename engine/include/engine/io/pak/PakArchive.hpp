@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "engine/base/Error.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/io/IoError.hpp"
+#include "engine/io/compression/LzDecodeStream.hpp"
+#include "engine/io/pak/PakFormat.hpp"
+#include "engine/io/stream/IStream.hpp"
+
+namespace Engine::IO::Pak {
+
+    using IoError = Engine::Base::Error<Engine::IO::IoErrorCode>;
+    template<class T>
+    using IoResult = Engine::Base::Result<T, IoError>;
+
+    /// PakArchive：pak イメージ（mmap / メモリ上のバッファ）の読み取りビュー
+    /// - open 時は header の検証だけ行い、TOC は展開しない（20万エントリでも O(1)）
+    /// - Find は TOC（hash 昇順）を直接二分探索する
+    /// - 非圧縮 payload の Read はバッファの Slice を返す（コピー無し）
+    /// - Lz payload は Read で全体を展開、OpenStream ならブロック単位で並列に先読み展開する
+    class PakArchive final {
+    public:
+        static IoResult<std::shared_ptr<const PakArchive>> FromBuffer(Base::SharedBuffer image);
+
+        // ファイルを mmap して開く（POSIX。payload は mapping の Slice になる）
+        static IoResult<std::shared_ptr<const PakArchive>> OpenMapped(const std::string& nativePath);
+
+        const PakHeader& Header() const noexcept { return header_; }
+        std::size_t Count() const noexcept { return header_.entryCount; }
+
+        PakTocEntry EntryAt(std::size_t index) const noexcept;
+        std::string_view PathOf(const PakTocEntry& e) const noexcept;
+
+        // pak 内パス（"textures/a.png"）で引く
+        std::optional<PakTocEntry> Find(std::string_view path) const;
+
+        // payload を取り出す（非圧縮は Slice、圧縮は展開したバッファ）
+        IoResult<Base::SharedBuffer> Read(const PakTocEntry& e) const;
+        IoResult<Base::SharedBuffer> ReadFile(std::string_view path) const;
+
+        // payload を stream として開く（非圧縮は SpanStream、Lz は LzDecodeStream）
+        IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>
+        OpenStream(const PakTocEntry& e, const Engine::IO::Compression::LzDecodeStream::Options& decode = {}) const;
+
+        // path 昇順の index（ディレクトリ列挙用。初回呼び出し時に構築）
+        const std::vector<std::uint32_t>& PathOrder() const;
+
+        // "dir" 配下にエントリが 1 つでもあればディレクトリとみなす（"" は root）
+        bool HasDirectory(std::string_view dir) const;
+
+        const Base::SharedBuffer& Image() const noexcept { return image_; }
+
+    private:
+        PakArchive() = default;
+
+        IoResult<Base::SharedBuffer> Stored_(const PakTocEntry& e) const;
+        IoResult<Engine::IO::Compression::LzFrame> Frame_(const PakTocEntry& e) const;
+
+    private:
+        Base::SharedBuffer image_;
+        PakHeader header_{};
+        const std::byte* toc_ = nullptr;
+        const char* strings_ = nullptr;
+
+        mutable std::once_flag pathOrderOnce_;
+        mutable std::vector<std::uint32_t> pathOrder_;
+    };
+
+} // namespace Engine::IO::Pak
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/io/fs/IFileSystem.hpp"
+#include "engine/io/pak/PakArchive.hpp"
+#include "engine/io/path/Uri.hpp"
+
+namespace Engine::IO::Pak {
+
+    using IoResultVoid = Engine::Base::Result<void, IoError>;
+
+    /// PakFileSystem：PakArchive を IFileSystem として見せる読み取り専用 backend
+    /// - Vfs には rootUri="pak://base.pak#assets" のように mount する
+    ///   （下位に渡る URI の '#' 以降 / fragment を pak 内パスとして扱う。'#' が無ければ path 全体）
+    /// - Open は非圧縮なら payload を共有した SpanStream（コピー無し）、Lz なら先読み展開する LzDecodeStream を返す
+    /// - ディレクトリは格納パスから暗黙に導出する（pak 自体はディレクトリを持たない）
+    class PakFileSystem final : public Engine::IO::FS::IFileSystem {
+    public:
+        struct Options final {
+            // pak 内パスの前に付ける prefix（"assets" なら "a.png" -> "assets/a.png"）
+            std::string rootPrefix;
+
+            // Lz payload を Open したときの展開設定（worker 数・先読みブロック数）
+            Engine::IO::Compression::LzDecodeStream::Options decode;
+        };
+
+    public:
+        explicit PakFileSystem(std::shared_ptr<const PakArchive> archive);
+        PakFileSystem(std::shared_ptr<const PakArchive> archive, Options opt);
+        ~PakFileSystem() override;
+
+        void SetOptions(Options opt);
+        const Options& GetOptions() const noexcept;
+
+        const std::shared_ptr<const PakArchive>& Archive() const noexcept { return archive_; }
+
+        const char* Name() const noexcept override { return "PakFS"; }
+
+        IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>
+        Open(const Engine::IO::Path::Uri& uri, Engine::IO::Stream::FileOpenMode mode) override;
+
+        // payload をそのまま取り出す（stream を経由しない）
+        IoResult<Base::SharedBuffer> ReadShared(const Engine::IO::Path::Uri& uri) const;
+
+        IoResult<bool> Exists(const Engine::IO::Path::Uri& uri) override;
+        IoResult<Engine::IO::FS::FileInfo> Stat(const Engine::IO::Path::Uri& uri) override;
+
+        IoResultVoid CreateDirectories(const Engine::IO::Path::Uri& uri) override;
+        IoResultVoid Remove(const Engine::IO::Path::Uri& uri, const Engine::IO::FS::RemoveOptions& opt = {}) override;
+        IoResultVoid Move(const Engine::IO::Path::Uri& from, const Engine::IO::Path::Uri& to) override;
+        IoResultVoid Copy(const Engine::IO::Path::Uri& from, const Engine::IO::Path::Uri& to) override;
+
+        IoResult<std::vector<Engine::IO::FS::DirectoryEntry>>
+        List(const Engine::IO::Path::Uri& uri, const Engine::IO::FS::ListOptions& opt = {}) override;
+
+        IoResult<std::string> ToNativePathString(const Engine::IO::Path::Uri& uri) override;
+
+        Engine::IO::FS::FileSystemCapabilities Capabilities() const noexcept override;
+
+        IoResult<std::unique_ptr<Engine::IO::FS::DirectoryIterator>>
+        Iterate(const Engine::IO::Path::Uri& uri, const Engine::IO::FS::ListOptions& opt = {}) override;
+
+        IoResult<std::unique_ptr<Engine::IO::FS::IFileWatcher>> CreateWatcher() override;
+
+    private:
+        // uri -> pak 内パス（先頭/末尾の '/' は除去済み）
+        IoResult<std::string> InnerPath_(const Engine::IO::Path::Uri& uri) const;
+
+    private:
+        std::shared_ptr<const PakArchive> archive_;
+        Options opt_{};
+    };
+
+} // namespace Engine::IO::Pak
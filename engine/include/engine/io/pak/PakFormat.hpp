@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace Engine::IO::Pak {
+
+    // pak ファイルレイアウト（すべて little-endian）
+    //
+    //   [PakHeader]                     kHeaderSize バイト
+    //   [payload 0][pad][payload 1]...  各 payload は header.alignment 境界に揃える
+    //   [PakTocEntry x entryCount]      pathHash 昇順（同 hash は path 昇順）
+    //   [string table]                  path 文字列を連結（NUL 無し）
+    //
+    // - TOC は hash でソート済みなので二分探索で引ける（open 時にハッシュ表を作らない）
+    // - payload を後ろにまとめない理由：builder がファイルを 1 つずつ流し込めるようにするため
+    //   （TOC は最後に書き、header を書き戻す）
+
+    inline constexpr char          kMagic[4]   = { 'G', 'P', 'A', 'K' };
+    inline constexpr std::uint16_t kVersion    = 1;
+    inline constexpr std::size_t   kHeaderSize = 64;
+    inline constexpr std::size_t   kTocEntrySize = 48;
+    inline constexpr std::uint32_t kDefaultAlignment = 16;
+
+    enum class PakCompression : std::uint32_t {
+        None = 0,
+        Lz   = 1, // ブロック LZ（engine/io/compression）
+    };
+
+    struct PakHeader final {
+        std::uint16_t version = kVersion;
+        std::uint16_t flags = 0;
+        std::uint32_t entryCount = 0;
+        std::uint32_t alignment = kDefaultAlignment;
+        std::uint64_t tocOffset = 0;
+        std::uint64_t stringsOffset = 0;
+        std::uint64_t stringsSize = 0;
+    };
+
+    struct PakTocEntry final {
+        std::uint64_t pathHash = 0;
+        std::uint32_t pathOffset = 0;   // string table 内
+        std::uint32_t pathLength = 0;
+        std::uint64_t dataOffset = 0;   // ファイル先頭から
+        std::uint64_t storedSize = 0;   // pak 内のサイズ（圧縮後）
+        std::uint64_t originalSize = 0; // 展開後のサイズ
+        PakCompression compression = PakCompression::None;
+    };
+
+    // pak 内パスのハッシュ（FNV-1a 64bit）
+    inline constexpr std::uint64_t HashPath(std::string_view path) noexcept {
+        std::uint64_t h = 14695981039346656037ull;
+        for (char c : path) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
+
+    // ---- little-endian 読み書き（ホストのエンディアンに依存しない） ----
+    namespace detail {
+        inline std::uint16_t LoadU16(const std::byte* p) noexcept {
+            return static_cast<std::uint16_t>(
+                std::to_integer<std::uint16_t>(p[0]) | (std::to_integer<std::uint16_t>(p[1]) << 8));
+        }
+        inline std::uint32_t LoadU32(const std::byte* p) noexcept {
+            std::uint32_t v = 0;
+            for (int i = 3; i >= 0; --i) v = (v << 8) | std::to_integer<std::uint32_t>(p[i]);
+            return v;
+        }
+        inline std::uint64_t LoadU64(const std::byte* p) noexcept {
+            std::uint64_t v = 0;
+            for (int i = 7; i >= 0; --i) v = (v << 8) | std::to_integer<std::uint64_t>(p[i]);
+            return v;
+        }
+        inline void StoreU16(std::byte* p, std::uint16_t v) noexcept {
+            p[0] = static_cast<std::byte>(v & 0xFF);
+            p[1] = static_cast<std::byte>((v >> 8) & 0xFF);
+        }
+        inline void StoreU32(std::byte* p, std::uint32_t v) noexcept {
+            for (int i = 0; i < 4; ++i) p[i] = static_cast<std::byte>((v >> (8 * i)) & 0xFF);
+        }
+        inline void StoreU64(std::byte* p, std::uint64_t v) noexcept {
+            for (int i = 0; i < 8; ++i) p[i] = static_cast<std::byte>((v >> (8 * i)) & 0xFF);
+        }
+    } // namespace detail
+
+    // header / TOC entry のエンコード（サイズは kHeaderSize / kTocEntrySize 固定）
+    inline void EncodeHeader(const PakHeader& h, std::byte* out) noexcept {
+        std::memset(out, 0, kHeaderSize);
+        std::memcpy(out, kMagic, 4);
+        detail::StoreU16(out + 4, h.version);
+        detail::StoreU16(out + 6, h.flags);
+        detail::StoreU32(out + 8, h.entryCount);
+        detail::StoreU32(out + 12, h.alignment);
+        detail::StoreU64(out + 16, h.tocOffset);
+        detail::StoreU64(out + 24, h.stringsOffset);
+        detail::StoreU64(out + 32, h.stringsSize);
+        // 40..63 は予約（0）
+    }
+
+    inline bool DecodeHeader(const std::byte* in, std::size_t size, PakHeader& out) noexcept {
+        if (size < kHeaderSize) return false;
+        if (std::memcmp(in, kMagic, 4) != 0) return false;
+        out.version = detail::LoadU16(in + 4);
+        out.flags = detail::LoadU16(in + 6);
+        out.entryCount = detail::LoadU32(in + 8);
+        out.alignment = detail::LoadU32(in + 12);
+        out.tocOffset = detail::LoadU64(in + 16);
+        out.stringsOffset = detail::LoadU64(in + 24);
+        out.stringsSize = detail::LoadU64(in + 32);
+        return true;
+    }
+
+    inline void EncodeTocEntry(const PakTocEntry& e, std::byte* out) noexcept {
+        std::memset(out, 0, kTocEntrySize);
+        detail::StoreU64(out + 0, e.pathHash);
+        detail::StoreU32(out + 8, e.pathOffset);
+        detail::StoreU32(out + 12, e.pathLength);
+        detail::StoreU64(out + 16, e.dataOffset);
+        detail::StoreU64(out + 24, e.storedSize);
+        detail::StoreU64(out + 32, e.originalSize);
+        detail::StoreU32(out + 40, static_cast<std::uint32_t>(e.compression));
+        // 44..47 は予約（0）
+    }
+
+    inline PakTocEntry DecodeTocEntry(const std::byte* in) noexcept {
+        PakTocEntry e;
+        e.pathHash = detail::LoadU64(in + 0);
+        e.pathOffset = detail::LoadU32(in + 8);
+        e.pathLength = detail::LoadU32(in + 12);
+        e.dataOffset = detail::LoadU64(in + 16);
+        e.storedSize = detail::LoadU64(in + 24);
+        e.originalSize = detail::LoadU64(in + 32);
+        e.compression = static_cast<PakCompression>(detail::LoadU32(in + 40));
+        return e;
+    }
+
+} // namespace Engine::IO::Pak
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "engine/base/Error.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/io/IoError.hpp"
+#include "engine/io/compression/LzFrame.hpp"
+#include "engine/io/pak/PakFormat.hpp"
+#include "engine/io/stream/IStream.hpp"
+
+namespace Engine::IO::Pak {
+
+    using IoError = Engine::Base::Error<Engine::IO::IoErrorCode>;
+    template<class T>
+    using IoResult = Engine::Base::Result<T, IoError>;
+    using IoResultVoid = Engine::Base::Result<void, IoError>;
+
+    /// PakWriter：pak を組み立てて stream に書き出す（ツール/テスト用）
+    /// - payload は WriteTo の中で 1 件ずつ provider から取り出す（全ファイルを同時にメモリに持たない）
+    /// - 出力 stream は seekable であること（最後に header を書き戻す）
+    /// - Lz を指定しても縮まなかった payload は None で格納する
+    class PakWriter final {
+    public:
+        using PayloadProvider = std::function<IoResult<Base::SharedBuffer>()>;
+
+        struct Options final {
+            // payload の境界（2 の冪）。mmap したまま SIMD ロード等をしたい場合は大きめにする
+            std::uint32_t alignment = kDefaultAlignment;
+
+            // Lz で格納するときのブロックサイズ（ブロック単位で独立に展開できる）
+            std::uint32_t lzBlockSize = Engine::IO::Compression::kLzDefaultBlockSize;
+        };
+
+    public:
+        PakWriter() = default;
+        explicit PakWriter(Options opt) : opt_(opt) {}
+
+        void SetOptions(Options opt) { opt_ = opt; }
+        const Options& GetOptions() const noexcept { return opt_; }
+
+        // path は pak 内パス（"\\" は "/" に、先頭の "./" "/" は除去して格納する）
+        IoResultVoid Add(std::string_view path, PayloadProvider provider,
+                         PakCompression compression = PakCompression::None);
+        IoResultVoid AddBuffer(std::string_view path, Base::SharedBuffer bytes,
+                               PakCompression compression = PakCompression::None);
+
+        std::size_t Count() const noexcept { return pending_.size(); }
+
+        IoResultVoid WriteTo(Engine::IO::Stream::IStream& out);
+
+    private:
+        struct Pending final {
+            std::string path;
+            PayloadProvider provider;
+            PakCompression compression = PakCompression::None;
+        };
+
+        static std::string NormalizePath_(std::string_view path);
+
+    private:
+        Options opt_{};
+        std::vector<Pending> pending_;
+        std::unordered_set<std::string> paths_;
+    };
+
+} // namespace Engine::IO::Pak
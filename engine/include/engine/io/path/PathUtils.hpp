@@ -58,5 +58,23 @@ namespace Engine::IO::Path {
     // - drive/UNC/unix absolute の prefix は維持（現行実装を踏襲）
     std::string RemoveDotSegments(std::string_view path, bool& escapedAboveRoot);
 
+    // ---- 1 パス版（AssetPathResolver の load path 用）----
+    // 上の関数を順に通した結果と同じものを、中間の文字列を作らずに out へ書く（out は上書き・容量は使い回す）
+    // - 区切りの検索は SSE2 が使えれば 16 byte ずつ
+    // - 戻り値は escapedAboveRoot
+
+    // IsAbsolutePathLike(NormalizeSlashes(path, normalizeSeparators, *)) と同じ判定（コピーしない）
+    bool IsAbsolutePathLikeRaw(std::string_view path, bool normalizeSeparators = true) noexcept;
+
+    // RemoveDotSegments(NormalizeSlashes(path, normalizeSeparators, squashSlashes)) と同じ
+    bool NormalizeInto(std::string& out, std::string_view path,
+                       bool normalizeSeparators = true,
+                       bool squashSlashes = true);
+
+    // RemoveDotSegments(NormalizeSlashes(JoinRootAndRelative(root, NormalizeSlashes(rel, ...)), ...)) と同じ
+    bool NormalizeJoinInto(std::string& out, std::string_view root, std::string_view rel,
+                           bool normalizeSeparators = true,
+                           bool squashSlashes = true);
+
 
 } // namespace Engine::IO::Path
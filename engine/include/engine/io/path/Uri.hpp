@@ -33,6 +33,9 @@ namespace Engine::IO::Path {
         std::string ToString() const;
     };
 
+    // scheme 名から enum へ（大文字小文字は区別しない・確保しない）
+    UriScheme SchemeFromText(std::string_view text) noexcept;
+
     // 失敗時は Engine::Error（IoErrorCode::InvalidPath / NotSupported 等）
     Base::Result<Uri, IoError>  ParseUri(std::string_view s);
 
@@ -41,4 +44,10 @@ namespace Engine::IO::Path {
     // - scheme が無ければ scheme=""、path=入力
     Uri ParseUriLoose(std::string_view s);
 
+    // 同じディレクトリで名前の後ろに suffix を付けた Uri（一時ファイル用。"a/b.bin" -> "a/b.bin.tmp~"）
+    // - ParseUri は先頭セグメントを authority に置くので、path が空なら authority 側に付ける
+    Uri SiblingUri(const Uri& uri, std::string_view suffix);
+    // 親ディレクトリの Uri（query / fragment は落とす）
+    Uri ParentUri(const Uri& uri);
+
 } // namespace Engine::IO::Path
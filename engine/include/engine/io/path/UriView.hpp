@@ -0,0 +1,46 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+#include "engine/base/Result.hpp"
+#include "engine/io/IoError.hpp"
+#include "engine/io/path/Uri.hpp"
+
+namespace Engine::IO::Path {
+
+    /// UriView：Uri の非所有版（参照先の文字列 / Uri より長生きさせないこと）
+    /// - 各部分は元の文字列への string_view。パースは 1 パスで確保しない
+    /// - path は正規化しない。ParseUriView は正規化済みの形（"a/b.png"）だけを受け付ける
+    /// - Uri からは暗黙に作れる（std::string -> std::string_view と同じ感覚で Vfs / MountTable に渡せる）
+    struct UriView final {
+        UriScheme scheme = UriScheme::None;
+        std::string_view schemeText; // 入力の綴りのまま（既知 scheme でも入る）
+        std::string_view authority;
+        std::string_view path;
+        std::string_view query;
+        std::string_view fragment;
+
+        constexpr UriView() noexcept = default;
+        UriView(const Uri& u) noexcept; // NOLINT(google-explicit-constructor)
+
+        bool HasScheme() const noexcept { return scheme != UriScheme::None; }
+        bool IsKnownScheme() const noexcept { return scheme != UriScheme::Unknown; }
+
+        // mount の照合に使う名前（既知 scheme は小文字の固定名、Unknown は schemeText、None は空）
+        std::string_view SchemeName() const noexcept;
+
+        // Uri::ToString と同じ形
+        std::string ToString() const;
+        // 所有版へ（path はそのまま Path::FromNormalized に渡す）
+        Uri ToUri() const;
+    };
+
+    // 失敗時は IoErrorCode::InvalidPath（空 / null byte / 絶対パス風 / ".." / 正規化されていない path）
+    // - 分割規則は ParseUri と同じ（"scheme://authority/path?query#fragment"）
+    Base::Result<UriView, IoError> ParseUriView(std::string_view s);
+
+    // 失敗しない。ParseUriLoose と同じく "://" の後ろを丸ごと path にする（先頭スラッシュは剥がす）
+    // - ParseUriLoose と違い、未知 scheme でも schemeText を保持する
+    UriView ParseUriViewLoose(std::string_view s) noexcept;
+
+} // namespace Engine::IO::Path
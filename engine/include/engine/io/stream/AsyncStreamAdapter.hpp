@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "engine/base/Error.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/io/IoError.hpp"
+#include "engine/io/async/IoWorkerPool.hpp"
+#include "engine/io/stream/IStream.hpp"
+#include "engine/io/stream/Seek.hpp"
+
+namespace Engine::IO::Stream {
+
+    using IoError  = Base::Error<Engine::IO::IoErrorCode>;
+    template<class T>
+    using IoResult = Base::Result<T, IoError>;
+    using IoResultVoid = Base::Result<void, IoError>;
+
+    /// AsyncStreamAdapter：同期 API しか持たない stream に ReadAtAsync を足す
+    /// - 要求は IoWorkerPool 上で Seek -> Read -> 元の位置へ Seek で処理する
+    /// - 内側の stream は mutex で直列化する（同期 API もこの adapter 経由で呼ぶこと）
+    /// - 内側が seekable でなければ ReadAtAsync は NotSupported
+    class AsyncStreamAdapter final : public IStream {
+    public:
+        struct Options final {
+            // nullptr なら IoWorkerPool::Shared()
+            std::shared_ptr<Engine::IO::Async::IoWorkerPool> pool;
+        };
+
+        // 既に asyncRead を持つ stream はそのまま返し、持たないものだけ包む
+        static std::unique_ptr<IStream> Wrap(std::unique_ptr<IStream> inner);
+
+        explicit AsyncStreamAdapter(std::unique_ptr<IStream> inner);
+        AsyncStreamAdapter(std::unique_ptr<IStream> inner, Options opt);
+        ~AsyncStreamAdapter() override;
+
+        IStream& Inner() noexcept { return *inner_; }
+
+        StreamCaps Caps() const noexcept override;
+        bool IsOpen() const noexcept override;
+        bool IsEof() const noexcept override;
+
+        IoResult<std::size_t> Read(void* dst, std::size_t bytes) override;
+        IoResult<std::size_t> Write(const void* src, std::size_t bytes) override;
+
+        void ReadAtAsync(std::uint64_t offset, Base::Span<std::byte> dst, ReadCompletion completion) override;
+
+        IoResult<std::uint64_t> Tell() const override;
+        IoResult<std::uint64_t> Seek(std::int64_t offset, SeekWhence whence) override;
+        IoResult<std::uint64_t> Size() const override;
+
+        IoResultVoid Flush() override;
+        IoResultVoid Close() override;
+
+    private:
+        IoResult<std::size_t> ReadAtLocked_(std::uint64_t offset, Base::Span<std::byte> dst);
+
+    private:
+        std::unique_ptr<IStream> inner_;
+        std::shared_ptr<Engine::IO::Async::IoWorkerPool> pool_;
+        mutable std::mutex mutex_;
+        Engine::IO::Async::InFlightCounter inflight_;
+    };
+
+} // namespace Engine::IO::Stream
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -24,6 +27,16 @@ namespace Engine::IO::Stream {
         std::size_t writeBufferSize = 64 * 1024;
         bool enableRead  = true;
         bool enableWrite = true;
+
+        // 順次読みを検出したら read-ahead を readBufferSize から倍々で maxReadAheadSize まで広げる
+        // （Seek / write 切替で readBufferSize に戻る）
+        bool adaptiveReadAhead = true;
+        std::size_t maxReadAheadSize = 4 * 1024 * 1024;
+
+        // 順次読み中は次の chunk を inner の ReadAtAsync で裏読みする（double buffer）
+        // - inner が asyncRead + seekable のときだけ有効。それ以外は同期 refill のまま
+        // - IoWorkerPool の worker 上で読むときは発行しない（待つ側が worker を塞いで詰まらないように）
+        bool backgroundPrefetch = true;
     };
 
     class BufferedStream final : public IStream {
@@ -52,6 +65,18 @@ namespace Engine::IO::Stream {
         IoResultVoid FlushWriteBuffer();
         IoResult<std::size_t> FillReadBuffer();
 
+        // ---- read-ahead ----
+        // 順次読みの継続回数から次の read-ahead 幅を決める
+        void GrowReadAhead_() noexcept;
+        void ResetReadAhead_() noexcept;
+
+        // 次の chunk の裏読みを発行する（条件を満たさなければ何もしない）
+        void StartPrefetch_();
+        // 裏読みの完了を待って結果を取り出す（発行していなければ nullopt）
+        std::optional<IoResult<std::size_t>> WaitPrefetch_();
+        // 裏読み中 / 済みのデータを捨てる（Seek / write 切替 / Close 用）
+        void DropPrefetch_();
+
         // read -> write の切替で「未消費 read buffer」を元に戻す
         IoResultVoid SyncForWrite();
 
@@ -67,6 +92,18 @@ namespace Engine::IO::Stream {
         std::size_t rpos_ = 0; // 次に読む位置
         std::size_t rlen_ = 0; // 有効データ長
 
+        // adaptive read-ahead
+        std::size_t readAhead_ = 0;   // 次の refill の幅
+        std::size_t seqRefills_ = 0;  // Seek 無しで続いた refill 回数
+
+        // background prefetch（pbuf_ を worker が埋め、揃ったら rbuf_ と入れ替える）
+        std::vector<std::byte> pbuf_;
+        std::size_t pfSize_ = 0; // 発行した要求の長さ
+        bool pfIssued_ = false;  // 発行済み（完了を待つ必要がある）
+        std::mutex pfMutex_;
+        std::condition_variable pfCv_;
+        std::optional<IoResult<std::size_t>> pfResult_; // 完了したら入る
+
         // write buffer
         std::vector<std::byte> wbuf_;
         std::size_t wlen_ = 0; // バッファ済みデータ長
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "engine/base/Span.hpp"
+
+namespace Engine::IO::Stream {
+
+    // 1 値の byte swap（2/4/8 byte の整数 / 浮動小数）
+    template<class T>
+    T ByteSwap(T v) noexcept {
+        static_assert(std::is_trivially_copyable_v<T>, "ByteSwap: trivially copyable required");
+        static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "ByteSwap: 1/2/4/8 bytes");
+        if constexpr (sizeof(T) == 1) {
+            return v;
+        } else {
+            unsigned char b[sizeof(T)];
+            std::memcpy(b, &v, sizeof(T));
+            for (std::size_t i = 0; i < sizeof(T) / 2; ++i) {
+                const unsigned char t = b[i];
+                b[i] = b[sizeof(T) - 1 - i];
+                b[sizeof(T) - 1 - i] = t;
+            }
+            T out;
+            std::memcpy(&out, b, sizeof(T));
+            return out;
+        }
+    }
+
+    // p から fileOrder で T を取り出す（境界は気にしない）
+    template<class T>
+    T LoadAs(const void* p, std::endian fileOrder) noexcept {
+        T v;
+        std::memcpy(&v, p, sizeof(T));
+        return (fileOrder == std::endian::native) ? v : ByteSwap(v);
+    }
+
+    // elemBytes（2/4/8）幅の値 count 個をその場で byte swap（SSE2 があれば 16 byte ずつ）
+    void ByteSwapInPlace(void* data, std::size_t count, std::size_t elemBytes) noexcept;
+
+    // stride byte の構造体 count 個について、fieldBytes の順に並んだ各フィールドを byte swap
+    // - 1 byte のフィールドはそのまま。フィールド間のパディングは無い前提
+    void ByteSwapFields(void* data, std::size_t count, std::size_t stride,
+                        Base::ConstSpan<std::uint8_t> fieldBytes) noexcept;
+
+} // namespace Engine::IO::Stream
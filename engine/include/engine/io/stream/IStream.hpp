@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <cstddef>
+#include <functional>
 #include <span>
 
 #include "engine/base/Result.hpp"   // Engine::Result<T>
@@ -17,8 +18,13 @@ namespace Engine::IO::Stream {
         bool readable = false;
         bool writable = false;
         bool seekable = false;
+        bool asyncRead = false; // ReadAtAsync を自前で実装している（false なら AsyncStreamAdapter で包む）
     };
 
+    // ReadAtAsync の完了通知（読めたバイト数。EOF を跨ぐと要求より短い）
+    // - どのスレッドから呼ばれるかは実装次第（呼び出し元スレッドでその場で呼ばれることもある）
+    using ReadCompletion = std::function<void(Base::Result<std::size_t, IoError>)>;
+
     /// IStream：読み書き/seek の最小抽象
     /// - Open/Close は IFileSystem が責務を持つことが多いが、Close を持たせると取り回しが良い
     /// - Read/Write は「実際に処理できたバイト数」を返す（部分読み書きがあり得る）
@@ -47,6 +53,19 @@ namespace Engine::IO::Stream {
             return Write(src.data(), src.size());
         }
 
+        // ---- 非同期読み込み（任意） ----
+        // offset から dst.size() バイト読み、完了したら completion を 1 回だけ呼ぶ
+        // - 読み位置（Tell）は動かさない。同じ stream に複数の要求を同時に出してよい
+        // - dst は completion が呼ばれるまで生かしておくこと
+        // - Close / 破棄は実行中の要求の完了を待つ（completion の中から同じ stream を Close しないこと）
+        // - Caps().asyncRead が false の実装は NotSupported で即完了する
+        virtual void ReadAtAsync(std::uint64_t offset, Base::Span<std::byte> dst, ReadCompletion completion) {
+            (void)offset;
+            (void)dst;
+            completion(Base::Result<std::size_t, IoError>::Err(
+                IoError::Make(IoErrorCode::NotSupported, "IStream: ReadAtAsync not supported")));
+        }
+
         // ---- Seek / Tell / Size ----
         // seekable でない場合は NotSupported を返す
         virtual Base::Result<std::uint64_t, IoError> Tell() const = 0;
@@ -61,6 +80,10 @@ namespace Engine::IO::Stream {
         // writable でない場合 Flush は NotSupported でもOK
         virtual Base::Result<void, IoError> Flush() = 0;
 
+        // 書いた内容をストレージまで永続化する（fdatasync 相当）
+        // - 永続化の概念が無い実装（memory 等）は Flush と同じで良い
+        virtual Base::Result<void, IoError> Sync() { return Flush(); }
+
         // Close を持たせると stream 単体で寿命管理しやすい（unique_ptr で扱いやすい）
         virtual Base::Result<void, IoError> Close() = 0;
 
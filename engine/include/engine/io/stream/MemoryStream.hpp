@@ -46,6 +46,7 @@ namespace Engine::IO::Stream {
             c.readable = opt_.readable;
             c.writable = opt_.writable;
             c.seekable = true;
+            c.asyncRead = opt_.readable; // メモリ上なのでその場で完了する
             return c;
         }
 
@@ -55,6 +56,9 @@ namespace Engine::IO::Stream {
         IoResult<std::size_t> Read(void* dst, std::size_t bytes) override;
         IoResult<std::size_t> Write(const void* src, std::size_t bytes) override;
 
+        // メモリコピーだけなので呼び出し元スレッドでその場で completion を呼ぶ
+        void ReadAtAsync(std::uint64_t offset, Base::Span<std::byte> dst, ReadCompletion completion) override;
+
         IoResult<std::uint64_t> Tell() const override;
         IoResult<std::uint64_t> Seek(std::int64_t offset, SeekWhence whence) override;
         IoResult<std::uint64_t> Size() const override;
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "engine/base/Result.hpp"
+#include "engine/base/Span.hpp"
+#include "engine/io/IoError.hpp"
+#include "engine/io/stream/IStream.hpp"
+
+namespace Engine::IO::Stream {
+
+    struct ReadToEndOptions final {
+        std::size_t maxBytes = 0;             // 0=無制限。超えたら ReadFailed
+        std::size_t chunkBytes = 64u * 1024u; // サイズ不明時の初期確保 / 伸ばす最小単位
+        bool tryUseSizeHint = true;           // Size() - Tell() を試す
+    };
+
+    /// ReadToEnd：stream の残りを out へ直接読む（一時バッファを挟まないので 1 byte あたりのコピーは 1 回）
+    /// - out は上書き。Container は 1 byte 要素の連続コンテナ（std::vector<std::byte> / std::string）
+    /// - 残りサイズが分かれば 1 回だけ確保してそこへ読む（末尾の確認は小さな局所バッファで行う）
+    /// - 分からなければ倍々で伸ばす（確保し直しは log2(size / chunkBytes) 回程度）
+    template<class Container>
+    Base::Result<void, IoError> ReadToEnd(IStream& s, Container& out, const ReadToEndOptions& opt = {}) {
+        static_assert(sizeof(typename Container::value_type) == 1, "ReadToEnd: byte-sized element required");
+        using R = Base::Result<void, IoError>;
+
+        auto exceeds = [&](std::size_t n) { return opt.maxBytes != 0 && n > opt.maxBytes; };
+        auto tooLarge = [&]() {
+            out.clear();
+            return R::Err(IoError::Make(IoErrorCode::ReadFailed, "ReadToEnd: exceeds maxBytes"));
+        };
+        // maxBytes を 1 byte 超えた所まで読めれば超過が判る
+        auto clampCap = [&](std::size_t n) {
+            return (opt.maxBytes != 0) ? std::min(n, opt.maxBytes + 1) : n;
+        };
+
+        const std::size_t chunk = std::max<std::size_t>(opt.chunkBytes, 1);
+        std::size_t cap = clampCap(chunk);
+        bool sized = false;
+
+        if (opt.tryUseSizeHint) {
+            auto szr = s.Size();
+            if (szr) {
+                std::uint64_t remain = szr.value();
+                if (auto tr = s.Tell(); tr) remain -= std::min(tr.value(), remain);
+                if (exceeds(static_cast<std::size_t>(remain))) return tooLarge();
+                cap = static_cast<std::size_t>(remain);
+                sized = true;
+            }
+        }
+
+        out.clear();
+        out.resize(cap);
+        std::size_t used = 0;
+
+        for (;;) {
+            if (used == cap) {
+                std::size_t pending = 0;
+                std::byte probe[256];
+
+                if (sized) {
+                    // 予定どおりなら次は 0（EOF）。ここで out を伸ばさない
+                    auto pr = s.Read(probe, sizeof(probe));
+                    if (!pr) {
+                        out.clear();
+                        return R::Err(pr.error());
+                    }
+                    if (pr.value() == 0) break;
+                    // 読んでいる間に伸びた：以降はサイズ不明として扱う
+                    pending = pr.value();
+                    sized = false;
+                    if (exceeds(used + pending)) return tooLarge();
+                }
+
+                const std::size_t next = clampCap(std::max(cap * 2, cap + std::max(chunk, pending)));
+                if (next <= cap) return tooLarge();
+                out.resize(next);
+                cap = next;
+
+                if (pending != 0) {
+                    std::memcpy(reinterpret_cast<std::byte*>(out.data()) + used, probe, pending);
+                    used += pending;
+                    continue;
+                }
+            }
+
+            auto rr = s.Read(reinterpret_cast<std::byte*>(out.data()) + used, cap - used);
+            if (!rr) {
+                out.clear();
+                return R::Err(rr.error());
+            }
+
+            const std::size_t n = rr.value();
+            if (n == 0) break;
+
+            used += n;
+            if (exceeds(used)) return tooLarge();
+        }
+
+        out.resize(used);
+        return R::Ok();
+    }
+
+    /// ReadChunks：chunkBytes ずつ読んで fn(Base::ConstSpan<std::byte>) に渡す（全体をメモリに持たない）
+    /// - fn が false を返したらそこで止める（エラーではない）
+    /// - 戻り値は fn に渡した合計バイト数
+    template<class Fn>
+    Base::Result<std::uint64_t, IoError> ReadChunks(IStream& s, std::size_t chunkBytes, Fn&& fn) {
+        using R = Base::Result<std::uint64_t, IoError>;
+
+        std::vector<std::byte> buf(std::max<std::size_t>(chunkBytes, 1));
+        std::uint64_t total = 0;
+
+        for (;;) {
+            auto rr = s.Read(buf.data(), buf.size());
+            if (!rr) return R::Err(rr.error());
+
+            const std::size_t n = rr.value();
+            if (n == 0) break;
+
+            total += n;
+            if (!fn(Base::ConstSpan<std::byte>(buf.data(), n))) break;
+        }
+        return R::Ok(total);
+    }
+
+} // namespace Engine::IO::Stream
@@ -8,6 +8,7 @@
 
 #include "engine/base/Error.hpp"
 #include "engine/base/Result.hpp"
+#include "engine/base/SharedBuffer.hpp"
 #include "engine/base/Span.hpp"
 #include "engine/io/IoError.hpp"
 #include "engine/io/stream/IStream.hpp"
@@ -29,6 +30,11 @@ namespace Engine::IO::Stream {
             : ro_(ro.data()), rw_(nullptr), size_(static_cast<std::uint64_t>(ro.size())),
               writable_(false) {}
 
+        // ReadOnly（バッファを共有して保持する。mmap / pak の payload をコピー無しで流す用）
+        explicit SpanStream(Base::SharedBuffer shared)
+            : ro_(shared.data()), rw_(nullptr), size_(static_cast<std::uint64_t>(shared.size())),
+              writable_(false), shared_(std::move(shared)) {}
+
         // ReadWrite
         explicit SpanStream(Base::Span<std::byte> rw)
             : ro_(rw.data()), rw_(rw.data()), size_(static_cast<std::uint64_t>(rw.size())),
@@ -39,6 +45,7 @@ namespace Engine::IO::Stream {
             c.readable = true;
             c.writable = writable_;
             c.seekable = true;
+            c.asyncRead = true; // メモリ上なのでその場で完了する
             return c;
         }
 
@@ -48,6 +55,9 @@ namespace Engine::IO::Stream {
         IoResult<std::size_t> Read(void* dst, std::size_t bytes) override;
         IoResult<std::size_t> Write(const void* src, std::size_t bytes) override;
 
+        // メモリコピーだけなので呼び出し元スレッドでその場で completion を呼ぶ
+        void ReadAtAsync(std::uint64_t offset, Base::Span<std::byte> dst, ReadCompletion completion) override;
+
         IoResult<std::uint64_t> Tell() const override;
         IoResult<std::uint64_t> Seek(std::int64_t offset, SeekWhence whence) override;
         IoResult<std::uint64_t> Size() const override;
@@ -61,6 +71,7 @@ namespace Engine::IO::Stream {
         std::uint64_t size_ = 0;
         std::uint64_t pos_  = 0;
         bool writable_ = false;
+        Base::SharedBuffer shared_; // 共有バッファ版のみ（ro_ の寿命を保証する）
         bool open_ = true;
         bool eof_ = false;
     };
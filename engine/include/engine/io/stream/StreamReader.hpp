@@ -1,14 +1,21 @@
 #pragma once
 
+#include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "engine/base/Error.hpp"
 #include "engine/base/Result.hpp"
+#include "engine/base/Span.hpp"
 #include "engine/io/IoError.hpp"
+#include "engine/io/stream/ByteOrder.hpp"
 #include "engine/io/stream/IStream.hpp"
+#include "engine/io/stream/ReadToEnd.hpp"
 
 namespace Engine::IO::Stream {
 
@@ -25,28 +32,100 @@ namespace Engine::IO::Stream {
         std::size_t maxBytes = 64 * 1024 * 1024; // 0=無制限
     };
 
+    // ReadStructs 用：T のフィールド幅（byte）を宣言順に並べて特殊化する
+    // - パディングの無い trivially copyable な T に限る（幅の合計 == sizeof(T) を static_assert）
+    //   template<> struct StructLayout<PakHeader> { static constexpr std::array<std::uint8_t, 4> kFieldBytes{ 4, 2, 2, 8 }; };
+    template<class T>
+    struct StructLayout;
+
+    /// StreamReader：stream からの型付き読み
+    /// - 内部バッファに先読みする（stream の位置は読んだ分より先に進む。混ぜて直接 Read しないこと）
+    /// - ReadU16LE などはバッファから直接取り出す（フィールド毎に virtual Read しない）
+    /// - ReadArray* / ReadStructs は 1 回で読み、ファイルと host の byte order が違う時だけまとめて swap
     class StreamReader final {
     public:
         explicit StreamReader(IStream& s);
 
+        // 残りサイズが分かれば 1 回だけ確保して直接読む（ReadToEnd）
         IoResult<std::vector<std::byte>> ReadAllBytes(std::size_t maxBytes = 0);
+        // chunkBytes ずつ fn(Base::ConstSpan<std::byte>) へ（全体を持たない。false で打ち切り）
+        template<class Fn>
+        IoResult<std::uint64_t> ReadChunks(Fn&& fn, std::size_t chunkBytes = 64 * 1024) {
+            return Stream::ReadChunks(s_, chunkBytes, std::forward<Fn>(fn));
+        }
         IoResult<std::size_t> ReadExactly(void* dst, std::size_t bytes);
 
         IoResult<std::uint8_t>  ReadU8();
         IoResult<std::uint16_t> ReadU16LE();
         IoResult<std::uint32_t> ReadU32LE();
         IoResult<std::uint64_t> ReadU64LE();
+        IoResult<std::uint16_t> ReadU16BE();
+        IoResult<std::uint32_t> ReadU32BE();
+        IoResult<std::uint64_t> ReadU64BE();
+
+        // dst.size() 個をまとめて読む（T は 1/2/4/8 byte の算術型）
+        template<class T>
+        IoResultVoid ReadArrayLE(Base::Span<T> dst) { return ReadArray_(dst, std::endian::little); }
+        template<class T>
+        IoResultVoid ReadArrayBE(Base::Span<T> dst) { return ReadArray_(dst, std::endian::big); }
+
+        // StructLayout<T> を特殊化した T を dst.size() 個まとめて読む
+        template<class T>
+        IoResultVoid ReadStructs(Base::Span<T> dst, std::endian fileOrder = std::endian::little) {
+            static_assert(std::is_trivially_copyable_v<T>, "ReadStructs: trivially copyable required");
+            constexpr auto& fields = StructLayout<T>::kFieldBytes;
+            static_assert(LayoutBytes(fields) == sizeof(T), "ReadStructs: StructLayout does not cover T (padding?)");
+
+            auto r = ReadExactly(dst.data(), dst.size() * sizeof(T));
+            if (!r) return IoResultVoid::Err(r.error());
+            if (fileOrder != std::endian::native) {
+                ByteSwapFields(dst.data(), dst.size(), sizeof(T),
+                               Base::ConstSpan<std::uint8_t>(fields.data(), fields.size()));
+            }
+            return IoResultVoid::Ok();
+        }
+        template<class T>
+        IoResultVoid ReadStruct(T& out, std::endian fileOrder = std::endian::little) {
+            return ReadStructs(Base::Span<T>(&out, 1), fileOrder);
+        }
 
         IoResult<std::string> ReadAllText(const TextReadOptions& opt = {});
         IoResult<bool> ReadLine(std::string& outLine, std::size_t maxLineBytes = 4096);
 
     private:
         IoResult<std::size_t> FillLineBuffer();
+        // バッファに n byte 以上（n <= バッファ長）あるようにする。足りなければ EndOfStream
+        IoResultVoid Ensure_(std::size_t n);
+
+        template<class T>
+        IoResult<T> ReadScalar_(std::endian fileOrder) {
+            auto e = Ensure_(sizeof(T));
+            if (!e) return IoResult<T>::Err(e.error());
+            const T v = LoadAs<T>(lbuf_.data() + lpos_, fileOrder);
+            lpos_ += sizeof(T);
+            return IoResult<T>::Ok(v);
+        }
+
+        template<class T>
+        IoResultVoid ReadArray_(Base::Span<T> dst, std::endian fileOrder) {
+            static_assert(std::is_arithmetic_v<T>, "ReadArray: arithmetic type required");
+            auto r = ReadExactly(dst.data(), dst.size() * sizeof(T));
+            if (!r) return IoResultVoid::Err(r.error());
+            if (sizeof(T) > 1 && fileOrder != std::endian::native) ByteSwapInPlace(dst.data(), dst.size(), sizeof(T));
+            return IoResultVoid::Ok();
+        }
+
+        template<std::size_t N>
+        static constexpr std::size_t LayoutBytes(const std::array<std::uint8_t, N>& fields) noexcept {
+            std::size_t sum = 0;
+            for (const auto w : fields) sum += w;
+            return sum;
+        }
 
     private:
         IStream& s_;
 
-        // ReadLine 用の内部バッファ（過剰に複雑化しない範囲で高速化）
+        // ReadLine / 数値読み共用の内部バッファ（過剰に複雑化しない範囲で高速化）
         std::vector<std::byte> lbuf_;
         std::size_t lpos_ = 0;
         std::size_t llen_ = 0;
@@ -1,7 +1,11 @@
 #include "engine/asset/AssetCatalog.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <limits>
 #include <sstream>
+#include <thread>
 
 #include "engine/asset/AssetType.hpp"
 #include "engine/asset/catalog/CatalogParser.hpp"
@@ -9,6 +13,11 @@
 
 namespace Engine::Asset {
 
+    AssetCatalog::AssetCatalog(BuildOptions opt) : buildOpt_(opt) {}
+
+    void AssetCatalog::SetBuildOptions(BuildOptions opt) { buildOpt_ = opt; }
+    const AssetCatalog::BuildOptions& AssetCatalog::GetBuildOptions() const noexcept { return buildOpt_; }
+
     void AssetCatalog::Clear() {
         map_.clear();
     }
@@ -52,36 +61,104 @@ namespace Engine::Asset {
         return BuildFromRaw_(rawR.value(), resolver);
     }
 
+    namespace {
+
+        // worker が埋める1エントリ分の結果（raw と同じ index に置く）
+        struct PreparedEntry final {
+            AssetId id{};
+            AssetType type{};
+            std::string resolvedPath;
+            AssetError error{}; // ok() なら解決成功
+        };
+
+        constexpr std::size_t kNoError = (std::numeric_limits<std::size_t>::max)();
+
+        std::size_t WorkerCountFor(std::size_t entries, const AssetCatalog::BuildOptions& opt) {
+            std::size_t hw = opt.maxWorkers != 0 ? opt.maxWorkers : std::thread::hardware_concurrency();
+            if (hw == 0) hw = 1;
+
+            const std::size_t per = (std::max<std::size_t>)(opt.minEntriesPerWorker, 1);
+            const std::size_t byWork = (entries + per - 1) / per;
+            return (std::max<std::size_t>)(1, (std::min)(hw, byWork));
+        }
+
+        // [begin, end) を解決する。firstError より後ろは merge で使われないので打ち切る
+        void PrepareRange(const std::vector<Catalog::RawCatalogEntry>& raw,
+                          const Resolver::AssetPathResolver& resolver,
+                          std::vector<PreparedEntry>& out,
+                          std::size_t begin, std::size_t end,
+                          std::atomic<std::size_t>& firstError) {
+            for (std::size_t i = begin; i < end; ++i) {
+                if (i > firstError.load(std::memory_order_relaxed)) return;
+
+                const auto& r = raw[i];
+                auto& p = out[i];
+                p.id = AssetId::FromString(r.id);
+                p.type = AssetType::FromString(r.type);
+
+                // ★ここで resolvedPath を確定させる（root脱出などもここで弾く）
+                auto rp = resolver.Resolve(r.path);
+                if (!rp) {
+                    // resolver が InvalidPath / PathEscapesRoot を返す
+                    p.error = AssetError::Make(AssetErrorCode::InvalidPath, rp.error().message, r.id);
+
+                    std::size_t cur = firstError.load(std::memory_order_relaxed);
+                    while (i < cur && !firstError.compare_exchange_weak(cur, i, std::memory_order_relaxed)) {}
+                    continue;
+                }
+                p.resolvedPath = std::move(rp.value());
+            }
+        }
+
+    } // namespace
+
     Base::Result<void, AssetError>
     AssetCatalog::BuildFromRaw_(const std::vector<Catalog::RawCatalogEntry>& raw,
                                 const Resolver::AssetPathResolver& resolver) {
-        for (const auto& r : raw) {
-            // ここは AssetId/AssetType 実装に合わせる
-            // （FromString が無いなら、ここだけ差し替え）
-            const AssetId id = AssetId::FromString(r.id);
-            const AssetType type = AssetType::FromString(r.type);
+        // 1) 並列フェーズ：path 解決 + id/type の hash（エントリ間で独立）
+        std::vector<PreparedEntry> prepared(raw.size());
+        std::atomic<std::size_t> firstError{ kNoError };
+
+        const std::size_t workers = WorkerCountFor(raw.size(), buildOpt_);
+        if (workers <= 1) {
+            PrepareRange(raw, resolver, prepared, 0, raw.size(), firstError);
+        } else {
+            const std::size_t chunk = (raw.size() + workers - 1) / workers;
+
+            std::vector<std::thread> threads;
+            threads.reserve(workers - 1);
+            for (std::size_t w = 1; w < workers; ++w) {
+                const std::size_t b = (std::min)(raw.size(), w * chunk);
+                const std::size_t e = (std::min)(raw.size(), b + chunk);
+                threads.emplace_back([&, b, e] { PrepareRange(raw, resolver, prepared, b, e, firstError); });
+            }
+            // 先頭チャンクは呼び出しスレッドで処理
+            PrepareRange(raw, resolver, prepared, 0, (std::min)(raw.size(), chunk), firstError);
+
+            for (auto& t : threads) t.join();
+        }
+
+        // 2) merge フェーズ：raw の順序で検査するので、エラー内容はシングルスレッド版と同じ
+        map_.reserve(map_.size() + raw.size());
+        for (std::size_t i = 0; i < raw.size(); ++i) {
+            auto& p = prepared[i];
 
             // 重複IDはエラー（Catalogの一意性保証）
-            if (map_.find(id) != map_.end()) {
+            if (map_.find(p.id) != map_.end()) {
                 return Base::Result<void, AssetError>::Err(
-                    AssetError::Make(AssetErrorCode::InvalidCatalogEntry, "AssetCatalog: duplicated id", r.id));
+                    AssetError::Make(AssetErrorCode::InvalidCatalogEntry, "AssetCatalog: duplicated id", raw[i].id));
             }
 
-            // ★ここで resolvedPath を確定させる（root脱出などもここで弾く）
-            auto rp = resolver.Resolve(r.path);
-            if (!rp) {
-                // resolver が InvalidPath / PathEscapesRoot を返す
-                return Base::Result<void, AssetError>::Err(AssetError::Make(
-                    AssetErrorCode::InvalidPath,
-                    rp.error().message,
-                    r.id));
+            if (p.error) {
+                return Base::Result<void, AssetError>::Err(std::move(p.error));
             }
 
             Catalog::CatalogEntry e;
-            e.id = id;
-            e.type = type;
-            e.sourcePath = r.path;
-            e.resolvedPath = std::move(rp.value());
+            e.id = std::move(p.id);
+            e.type = std::move(p.type);
+            e.sourcePath = raw[i].path;
+            // intern は merge で 1 回だけ（同じ解決パスは record/watcher と同じハンドルになる）
+            e.resolvedPath = Core::InternedPath::Intern(p.resolvedPath);
 
             map_.emplace(e.id, std::move(e));
         }
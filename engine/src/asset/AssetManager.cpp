@@ -19,6 +19,11 @@ namespace Engine::Asset {
         , stats_(stats)
         , watcher_(watcher) {}
 
+    AssetManager::~AssetManager() {
+        // pool 上の decode は ReloadTxn（と pipeline）を触っているので先に終わらせる
+        WaitForReload();
+    }
+
     void AssetManager::SetOptions(Options opt) { opt_ = opt; }
     const AssetManager::Options& AssetManager::GetOptions() const noexcept { return opt_; }
 
@@ -30,7 +35,75 @@ namespace Engine::Asset {
         if (opt_.enableHotReload && watcher_) {
             ProcessHotReload_();
         }
+        ProcessReload_();
         ProcessQueue_();
+        ResumeAwaiters_();
+    }
+
+    // ---------------- coroutine API ----------------
+
+    AssetManager::LoadAwaiter
+    AssetManager::LoadAsync(const AssetId& id, AssetRequest request, IResumeExecutor* executor) {
+        request.sync = AssetRequest::SyncWith::Async;
+        return LoadAwaiter(*this, id, std::move(request), executor);
+    }
+
+    bool AssetManager::LoadAwaiter::await_ready() {
+        auto r = mgr_.Load(id_, req_);
+        if (!r) {
+            result_.emplace(LoadResult::Err(std::move(r.error())));
+            return true;
+        }
+
+        // キャッシュヒット（Async でも Ready のまま返る）ならその場で続行
+        const Core::AssetRecord* rec = mgr_.storage_.Find(id_);
+        if (rec && rec->IsReady()) {
+            result_.emplace(LoadResult::Ok(AssetHandle::Make(id_, rec->generation)));
+            return true;
+        }
+
+        return false;
+    }
+
+    void AssetManager::LoadAwaiter::await_suspend(std::coroutine_handle<> h) {
+        mgr_.waiters_.push_back(Waiter{ this, h });
+    }
+
+    void AssetManager::ResumeAwaiters_() {
+        if (waiters_.empty()) return;
+
+        // 先に「今回再開するもの」を抜き出してから再開する
+        // （再開した coroutine が続けて LoadAsync すると waiters_ に積まれるため）
+        std::vector<Waiter> run;
+        std::size_t keep = 0;
+        for (std::size_t i = 0; i < waiters_.size(); ++i) {
+            Waiter& w = waiters_[i];
+            LoadAwaiter& a = *w.awaiter;
+
+            Core::AssetRecord* rec = storage_.Find(a.id_);
+            if (!rec) {
+                a.result_.emplace(LoadResult::Err(
+                    AssetError::Make(AssetErrorCode::InternalError, "AssetManager: record evicted while awaiting")));
+            } else if (rec->IsReady()) {
+                // reload で generation が進んでいることがあるので最新を渡す
+                a.result_.emplace(LoadResult::Ok(AssetHandle::Make(a.id_, rec->generation)));
+            } else if (rec->IsFailed()) {
+                // await_ready の Load が取った参照は handle を返さないのでここで返す
+                if (rec->refCount > 0) --rec->refCount;
+                a.result_.emplace(LoadResult::Err(rec->error));
+            } else {
+                waiters_[keep++] = w;
+                continue;
+            }
+            run.push_back(w);
+        }
+        waiters_.resize(keep);
+
+        // executor_ は再開前に読む（再開すると awaiter を含む frame が消えることがある）
+        for (const Waiter& w : run) {
+            if (IResumeExecutor* ex = w.awaiter->executor_) ex->Post(w.handle);
+            else                                              w.handle.resume();
+        }
     }
 
     // ---------------- public API ----------------
@@ -166,9 +239,13 @@ namespace Engine::Asset {
         return true;
     }
 
-    void AssetManager::Watch(const AssetId& id, std::string resolvedPath) {
+    void AssetManager::Watch(const AssetId& id, Core::InternedPath resolvedPath) {
         if (!watcher_) return;
-        watcher_->Watch(id, std::move(resolvedPath));
+        watcher_->Watch(id, resolvedPath);
+    }
+
+    void AssetManager::Watch(const AssetId& id, std::string_view resolvedPath) {
+        Watch(id, Core::InternedPath::Intern(resolvedPath));
     }
 
     void AssetManager::Unwatch(const AssetId& id) {
@@ -182,10 +259,19 @@ namespace Engine::Asset {
     AssetManager::ResolveEntry_(const AssetId& id, const AssetRequest& req) {
         if (stats_) stats_->OnCatalogLookup();
 
-        // CatalogEntry { AssetType type; std::string resolvedPath; } が引ける
+        // CatalogEntry { AssetType type; InternedPath resolvedPath; } が引ける
         const auto* entry = catalog_.Find(id); //
         if (!entry) {
             if (stats_) stats_->OnCatalogMiss();
+
+            // catalog に無くても override path + type hint があればそれで読む（ツール/テスト用途）
+            if (!req.overridePath.empty() && req.useTypeHint && req.expectedType.value != 0) {
+                ResolvedEntry out;
+                out.type = req.expectedType;
+                out.resolvedPath = Core::InternedPath::Intern(req.overridePath);
+                return Base::Result<ResolvedEntry, AssetError>::Ok(std::move(out));
+            }
+
             return Base::Result<ResolvedEntry, AssetError>::Err(
                 AssetError::Make(AssetErrorCode::CatalogNotFound, "AssetCatalog: id not found")
             );
@@ -205,7 +291,7 @@ namespace Engine::Asset {
 
         // override path がある場合：ここでは “resolvedPath として扱う”
         // 必要ならここで AssetPathResolver を通して正規化してOK（設計上はCatalog側が担当）
-        out.resolvedPath = req.overridePath.empty() ? entry->resolvedPath : req.overridePath;
+        out.resolvedPath = req.overridePath.empty() ? entry->resolvedPath : Core::InternedPath::Intern(req.overridePath);
 
         if (out.resolvedPath.empty()) {
             return Base::Result<ResolvedEntry, AssetError>::Err(
@@ -221,13 +307,7 @@ namespace Engine::Asset {
         return storage_.GetOrCreate(id, e.type, e.resolvedPath);
     }
 
-    Base::Result<void, AssetError>
-    AssetManager::DoLoadSync_(Core::AssetRecord& rec, const ResolvedEntry& e, const AssetRequest& req) {
-        const bool wasReady = rec.IsReady();
-
-        // ForceReload のときは “読み込み前に Loading へ”
-        rec.MarkLoading();
-
+    Loading::LoadContext AssetManager::MakeContext_(const Core::AssetRecord& rec, const ResolvedEntry& e, const AssetRequest& req) const {
         Loading::LoadContext ctx;
         ctx.id = rec.id;
         ctx.type = e.type;
@@ -235,8 +315,12 @@ namespace Engine::Asset {
         ctx.request = &req;
         ctx.statistics = stats_;
         ctx.nowFrame = frame_;
+        return ctx;
+    }
 
-        auto r = pipeline_.Load(ctx);
+    Base::Result<void, AssetError>
+    AssetManager::ApplyLoadResult_(Core::AssetRecord& rec, const ResolvedEntry& e, const AssetRequest& req,
+                                   bool wasReady, Base::Result<Core::AnyAsset, AssetError>&& r) {
         if (!r) {
             // Reload + KeepOldIfAny + 旧データあり => 旧キャッシュ維持
             if (req.fallback == AssetRequest::Fallback::KeepOldIfAny && wasReady) {
@@ -266,6 +350,17 @@ namespace Engine::Asset {
         return Base::Result<void, AssetError>::Ok();
     }
 
+    Base::Result<void, AssetError>
+    AssetManager::DoLoadSync_(Core::AssetRecord& rec, const ResolvedEntry& e, const AssetRequest& req) {
+        const bool wasReady = rec.IsReady();
+
+        // ForceReload のときは “読み込み前に Loading へ”
+        rec.MarkLoading();
+
+        const Loading::LoadContext ctx = MakeContext_(rec, e, req);
+        return ApplyLoadResult_(rec, e, req, wasReady, pipeline_.Load(ctx));
+    }
+
     void AssetManager::EnqueueLoad_(const AssetId& id, const AssetRequest& req) {
         // 重複投入を防ぐ（同じIDがキューにいるならスキップ）
         if (queued_.find(id) != queued_.end()) return;
@@ -277,11 +372,14 @@ namespace Engine::Asset {
     void AssetManager::ProcessQueue_() {
         if (queue_.empty()) return;
 
+        // 1) budget 分を取り出して解決する（読み込みはまだしない）
+        batchJobs_.clear();
         std::uint32_t budget = opt_.maxLoadsPerFrame;
         while (budget > 0 && !queue_.empty()) {
             PendingLoad job = std::move(queue_.front());
             queue_.pop_front();
             queued_.erase(job.id);
+            --budget;
 
             // catalog resolve
             auto entryR = ResolveEntry_(job.id, job.req);
@@ -290,21 +388,41 @@ namespace Engine::Asset {
                 if (auto* rec = storage_.Find(job.id)) {
                     rec->SetFailed(std::move(entryR.error()));
                 }
-                --budget;
                 continue;
             }
 
-            const ResolvedEntry e = std::move(entryR.value());
-            Core::AssetRecord& rec = GetOrCreateRecord_(job.id, e);
+            BatchJob b;
+            b.entry = std::move(entryR.value());
+            b.rec = &GetOrCreateRecord_(job.id, b.entry);
+            b.wasReady = b.rec->IsReady();
+            b.req = std::move(job.req);
+            batchJobs_.push_back(std::move(b));
+        }
+        if (batchJobs_.empty()) return;
+
+        // 2) 実ロード：読み込みを 1 回にまとめる（ソースが対応していれば I/O を一括投入）
+        // ctx.request は batchJobs_ の要素を指すので、ここから先で batchJobs_ を伸ばさないこと
+        batchContexts_.clear();
+        batchContexts_.reserve(batchJobs_.size());
+        for (auto& b : batchJobs_) {
+            b.rec->MarkLoading();
+            batchContexts_.push_back(MakeContext_(*b.rec, b.entry, b.req));
+        }
 
-            // 実ロード（sync実行）
-            (void)DoLoadSync_(rec, e, job.req);
+        pipeline_.LoadBatch(batchContexts_, batchResults_);
 
-            // 成功なら寿命更新
-            if (rec.IsReady()) lifetime_.OnLoaded(rec.id, frame_);
+        // 3) 結果を record に反映
+        for (std::size_t i = 0; i < batchJobs_.size(); ++i) {
+            BatchJob& b = batchJobs_[i];
+            (void)ApplyLoadResult_(*b.rec, b.entry, b.req, b.wasReady, std::move(batchResults_[i]));
 
-            --budget;
+            // 成功なら寿命更新
+            if (b.rec->IsReady()) lifetime_.OnLoaded(b.rec->id, frame_);
         }
+
+        batchResults_.clear();
+        batchContexts_.clear();
+        batchJobs_.clear();
     }
 
     void AssetManager::ProcessHotReload_() {
@@ -314,12 +432,156 @@ namespace Engine::Asset {
         if (changes.empty()) return;
 
         for (auto& c : changes) {
-            AssetRequest r = AssetRequest::Reload();
-            r.sync = AssetRequest::SyncWith::Async;
-            r.fallback = opt_.reloadKeepOldIfAny ? AssetRequest::Fallback::KeepOldIfAny
-                                                : AssetRequest::Fallback::None;
-            EnqueueLoad_(c.id, r);
+            RequestReload(c.id);
+        }
+    }
+
+    // ---------------- reload transaction ----------------
+
+    void AssetManager::SetDependencies(const AssetId& id, Base::ConstSpan<AssetId> deps) {
+        deps_.SetDependencies(id, deps);
+    }
+
+    void AssetManager::RequestReload(const AssetId& id) {
+        if (!reloadRequested_.insert(id).second) return;
+        reloadRequests_.push_back(id);
+    }
+
+    void AssetManager::SetReloadPipeline(Loading::AssetPipeline* pipeline) {
+        // decode 中の仕事が古い pipeline を使っているので、終わってから替える
+        WaitForReload();
+        reloadPipeline_ = pipeline;
+    }
+
+    void AssetManager::WaitForReload() {
+        if (reloadTxn_) reloadTxn_->inflight.WaitIdle();
+    }
+
+    void AssetManager::ProcessReload_() {
+        if (reloadTxn_) {
+            // decode 中：何も差し替えずに次のフレームを待つ（要求は次のトランザクションへ溜める）
+            if (!reloadTxn_->decoded.load(std::memory_order_acquire)) return;
+            CommitReload_();
+        }
+        if (!reloadRequests_.empty()) BeginReload_();
+    }
+
+    void AssetManager::BeginReload_() {
+        // 1) 変わった asset + それに依存する asset（依存される側が先）
+        deps_.CollectAffected(reloadRequests_, reloadAffected_);
+
+        auto txn = std::make_unique<ReloadTxn>();
+        txn->req = AssetRequest::Reload();
+        txn->req.fallback = opt_.reloadKeepOldIfAny ? AssetRequest::Fallback::KeepOldIfAny
+                                                    : AssetRequest::Fallback::None;
+
+        for (const AssetId& id : reloadAffected_) {
+            Core::AssetRecord* rec = storage_.Find(id);
+            if (!rec) continue;           // 読まれていない asset は次に Load されたときに新しい内容になる
+            if (rec->IsLoading()) continue; // 通常のキューで読み直し中
+
+            const bool dependent = reloadRequested_.find(id) == reloadRequested_.end();
+            if (!rec->IsReady()) {
+                // 差し替える旧データが無いので、従来どおり通常のキューで読み直す
+                if (dependent) continue;
+                AssetRequest r = txn->req;
+                r.sync = AssetRequest::SyncWith::Async;
+                EnqueueLoad_(id, r);
+                continue;
+            }
+
+            txn->jobs.push_back(ReloadJob{ id, rec->generation, dependent });
+        }
+        reloadRequests_.clear();
+        reloadRequested_.clear();
+        reloadAffected_.clear();
+        if (txn->jobs.empty()) return;
+
+        // 2) decode（record は Ready のまま旧データを見せ続ける）
+        // ctx はここで record から作る（pool 側は storage_ に触らない）
+        const bool offThread = reloadPipeline_ != nullptr;
+        txn->contexts.reserve(txn->jobs.size());
+        for (const ReloadJob& j : txn->jobs) {
+            const Core::AssetRecord& rec = *storage_.Find(j.id);
+            ResolvedEntry e;
+            e.type = rec.type;
+            e.resolvedPath = rec.resolvedPath;
+            Loading::LoadContext ctx = MakeContext_(rec, e, txn->req);
+            if (offThread) ctx.statistics = nullptr;
+            txn->contexts.push_back(std::move(ctx));
+        }
+
+        if (!offThread) {
+            pipeline_.LoadBatch(txn->contexts, txn->results);
+            txn->decoded.store(true, std::memory_order_release);
+            reloadTxn_ = std::move(txn);
+            CommitReload_();
+            return;
+        }
+
+        ReloadTxn* t = txn.get();
+        Loading::AssetPipeline* p = reloadPipeline_;
+        reloadTxn_ = std::move(txn);
+        // 変わったファイルが多くても thread は増やさない（1 トランザクション = pool の仕事 1 つ）
+        t->inflight.Begin();
+        Engine::IO::Async::IoWorkerPool::Shared()->Submit([t, p] {
+            p->LoadBatch(t->contexts, t->results);
+            t->decoded.store(true, std::memory_order_release);
+            t->inflight.End();
+        });
+    }
+
+    void AssetManager::CommitReload_() {
+        WaitForReload(); // decoded は立っているのですぐ戻る
+        std::unique_ptr<ReloadTxn> txn = std::move(reloadTxn_);
+
+        // 1) 失敗を数える（KeepOldIfAny なら 1 件でも失敗したら全部旧データのまま）
+        std::uint64_t failed = 0;
+        for (const auto& r : txn->results) {
+            if (!r) ++failed;
+        }
+        reloadStats_.failed += failed;
+
+        const bool keepOld = txn->req.fallback == AssetRequest::Fallback::KeepOldIfAny;
+        if (failed != 0 && keepOld) {
+            for (std::size_t i = 0; i < txn->jobs.size(); ++i) {
+                if (txn->results[i]) continue;
+                // 失敗理由は record に残す（state は Ready のまま。ApplyLoadResult_ と同じ扱い）
+                if (Core::AssetRecord* rec = storage_.Find(txn->jobs[i].id)) rec->error = std::move(txn->results[i].error());
+            }
+            ++reloadStats_.rolledBack;
+            return;
         }
+
+        // 2) 差し替え：全部同じフレームで、asset は swap だけ
+        // decode 中に evict / 通常の reload が走った record は触らない
+        // （evict -> 再 Load で Ready に戻っていても generation が変わっているので分かる）
+        for (std::size_t i = 0; i < txn->jobs.size(); ++i) {
+            const ReloadJob& j = txn->jobs[i];
+            Core::AssetRecord* rec = storage_.Find(j.id);
+            if (!rec || !rec->IsReady() || rec->generation != j.generation) {
+                ++reloadStats_.stale;
+                continue;
+            }
+
+            auto& r = txn->results[i];
+            if (!r) {
+                rec->SetFailed(std::move(r.error()));
+                continue;
+            }
+
+            std::swap(rec->asset, r.value());
+            rec->error = AssetError{};
+            ++rec->generation;
+
+            ++reloadStats_.swapped;
+            if (j.dependent) ++reloadStats_.dependents;
+            if (stats_) stats_->OnReload(rec->id);
+            lifetime_.OnLoaded(rec->id, frame_);
+        }
+        ++reloadStats_.transactions;
+
+        // 3) 旧 asset は results 側に入っているので txn と一緒にここで解放される
     }
 
     Core::AssetRecord* AssetManager::FindRecord_(const AssetHandle& h) {
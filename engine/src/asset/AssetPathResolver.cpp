@@ -24,20 +24,49 @@ namespace Engine::Asset::Resolver {
             );
         }
 
-        // 1) scheme 剥がし（res://, assets:// など）
-        std::string p;
+        // 1) scheme 剥がし（res://, assets:// など。view なので確保しない）
         if (opt_.allowSchemes) {
-            auto u = Engine::IO::Path::ParseUriLoose(catalogPath);
-            p = u.path.Str();
-        } else {
-            p = std::string(catalogPath);
+            return ResolveLogical_(Engine::IO::Path::ParseUriViewLoose(catalogPath).path, catalogPath);
         }
+        return ResolveLogical_(catalogPath, catalogPath);
+    }
 
-        // 2) 正規化（区切り/連続スラッシュ）
-        p = Engine::IO::Path::NormalizeSlashes(p, opt_.normalizeSeparators, opt_.squashSlashes);
+    Base::Result<std::string, AssetError> AssetPathResolver::Resolve(Engine::IO::Path::UriView uri) const {
+        if (uri.HasScheme() && !opt_.allowSchemes) {
+            return Base::Result<std::string, AssetError>::Err(
+                AssetError::Make(
+                    AssetErrorCode::InvalidPath,
+                    "AssetPathResolver: scheme is not allowed",
+                    uri.ToString())
+            );
+        }
 
-        // 3) 絶対パス判定
-        if (Engine::IO::Path::IsAbsolutePathLike(p)) {
+        // ParseUri 系は先頭セグメントを authority に分けるので戻す
+        if (!uri.authority.empty()) {
+            std::string logical;
+            logical.reserve(uri.authority.size() + 1 + uri.path.size());
+            logical += uri.authority;
+            if (!uri.path.empty()) {
+                logical += '/';
+                logical += uri.path;
+            }
+            return ResolveLogical_(logical, logical);
+        }
+        if (uri.path.empty()) {
+            return Base::Result<std::string, AssetError>::Err(
+                AssetError::Make(
+                    AssetErrorCode::InvalidPath,
+                    "AssetPathResolver: empty path",
+                    uri.ToString())
+            );
+        }
+        return ResolveLogical_(uri.path, uri.path);
+    }
+
+    Base::Result<std::string, AssetError> AssetPathResolver::ResolveLogical_(std::string_view logical,
+                                                                            std::string_view catalogPath) const {
+        // 2) 絶対パス判定（NormalizeSlashes 後の形で見る。コピーはしない）
+        if (Engine::IO::Path::IsAbsolutePathLikeRaw(logical, opt_.normalizeSeparators)) {
             if (!opt_.allowAbsolutePath) {
                 return Base::Result<std::string, AssetError>::Err(
                     AssetError::Make(
@@ -48,18 +77,15 @@ namespace Engine::Asset::Resolver {
             }
 
             // 絶対パス許可の場合：dot segments だけ解決（root制約なし）
-            bool escaped = false;
-            std::string cleaned = Engine::IO::Path::RemoveDotSegments(p, escaped);
+            std::string cleaned;
+            (void)Engine::IO::Path::NormalizeInto(cleaned, logical, opt_.normalizeSeparators, opt_.squashSlashes);
             return Base::Result<std::string, AssetError>::Ok(std::move(cleaned));
         }
 
-        // 4) assetsRoot と結合
-        std::string joined = Engine::IO::Path::JoinRootAndRelative(opt_.assetsRoot, p);
-        joined = Engine::IO::Path::NormalizeSlashes(joined, opt_.normalizeSeparators, opt_.squashSlashes);
-
-        // 5) dot segments 解決（assetsRoot の外へ出るか検出）
-        bool escapedAboveRoot = false;
-        std::string cleaned = Engine::IO::Path::RemoveDotSegments(joined, escapedAboveRoot);
+        // 3) 正規化 + assetsRoot と結合 + dot segments 解決を 1 パスで（assetsRoot の外へ出るか検出）
+        std::string cleaned;
+        const bool escapedAboveRoot = Engine::IO::Path::NormalizeJoinInto(
+            cleaned, opt_.assetsRoot, logical, opt_.normalizeSeparators, opt_.squashSlashes);
 
         if (escapedAboveRoot && !opt_.allowEscapeAssetsRoot) {
             return Base::Result<std::string, AssetError>::Err(
@@ -1,17 +1,19 @@
 #include "engine/asset/loading/AssetPipeline.hpp"
 
 #include "engine/asset/core/AssetStatistics.hpp" // optional（nullptrなら使わない）
+#include "engine/asset/detail/ContentHash.hpp"
+#include "engine/asset/loading/DerivedDataCache.hpp"
 
 namespace Engine::Asset::Loading {
 
     AssetPipeline::AssetPipeline(IAssetSource& source, LoaderRegistry& registry)
         : source_(source), registry_(registry) {}
 
-    Base::Result<Core::AnyAsset, AssetError>
-    AssetPipeline::Load(const LoadContext& ctx) {
+    Base::Result<IAssetLoader*, AssetError>
+    AssetPipeline::Begin_(const LoadContext& ctx) {
         // 0) 基本検証
         if (!ctx.HasPath()) {
-            return Base::Result<Core::AnyAsset, AssetError>::Err(
+            return Base::Result<IAssetLoader*, AssetError>::Err(
                 AssetError::Make(AssetErrorCode::InvalidPath, "AssetPipeline: resolvedPath is empty"));
         }
 
@@ -25,12 +27,15 @@ namespace Engine::Asset::Loading {
             if (ctx.statistics) {
                 ctx.statistics->OnLoadFailure(ctx.id, ctx.type, ctx.nowFrame);
             }
-            return Base::Result<Core::AnyAsset, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::UnsupportedType, "AssetPipeline: no loader for type", ctx.resolvedPath));
+            return Base::Result<IAssetLoader*, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::UnsupportedType, "AssetPipeline: no loader for type", ctx.resolvedPath.Str()));
         }
+        return Base::Result<IAssetLoader*, AssetError>::Ok(loader);
+    }
 
-        // 2) bytes を読む
-        auto bytesR = source_.ReadAll(ctx.resolvedPath);
+    Base::Result<Core::AnyAsset, AssetError>
+    AssetPipeline::Decode_(const LoadContext& ctx, IAssetLoader& loader,
+                           Base::Result<Base::SharedBuffer, AssetError>&& bytesR) {
         if (!bytesR) {
             if (ctx.statistics) {
                 ctx.statistics->OnLoadFailure(ctx.id, ctx.type, ctx.nowFrame);
@@ -38,11 +43,11 @@ namespace Engine::Asset::Loading {
             return Base::Result<Core::AnyAsset, AssetError>::Err(std::move(bytesR.error()));
         }
 
-        auto& buf = bytesR.value();
-        Base::ConstSpan<std::byte> bytes{ buf.data(), buf.size() };
+        // loader は必要ならこのバッファ（の一部）をそのまま保持する
+        const Base::SharedBuffer& bytes = bytesR.value();
 
-        // 3) decode/parse
-        auto assetR = loader->Load(bytes, ctx);
+        // 3) decode/parse（cache に decode 済みがあればそれを使う）
+        auto assetR = DecodeCached_(ctx, loader, bytes);
         if (!assetR) {
             if (ctx.statistics) {
                 ctx.statistics->OnLoadFailure(ctx.id, ctx.type, ctx.nowFrame);
@@ -52,11 +57,83 @@ namespace Engine::Asset::Loading {
 
         if (ctx.statistics) {
             ctx.statistics->OnLoadSuccess(ctx.id, ctx.type, ctx.nowFrame,
-                                          static_cast<std::uint64_t>(buf.size()),
+                                          static_cast<std::uint64_t>(bytes.size()),
                                           0 /*decodedBytes: 分かるなら loader で埋める*/);
         }
 
         return Base::Result<Core::AnyAsset, AssetError>::Ok(std::move(assetR.value()));
     }
 
+    Base::Result<Core::AnyAsset, AssetError>
+    AssetPipeline::DecodeCached_(const LoadContext& ctx, IAssetLoader& loader, const Base::SharedBuffer& bytes) {
+        const std::uint32_t version = derived_ ? loader.DerivedDataVersion() : 0;
+        if (version == 0) return loader.Load(bytes, ctx);
+
+        DerivedDataKey key;
+        key.contentHash = Detail::ContentHash64(bytes.data(), bytes.size());
+        key.loader = loader.GetType();
+        key.loaderVersion = version;
+        key.optionsHash = loader.DerivedDataOptionsHash(ctx);
+
+        if (auto hit = derived_->Find(key)) {
+            auto cachedR = loader.LoadDerived(*hit, ctx);
+            if (cachedR) return cachedR;
+            // 読めない payload（loader の不具合など）は decode し直して上書きする
+        }
+
+        auto assetR = loader.Load(bytes, ctx);
+        if (assetR) {
+            if (auto savedR = loader.SaveDerived(assetR.value(), ctx)) derived_->Store(key, savedR.value());
+        }
+        return assetR;
+    }
+
+    Base::Result<Core::AnyAsset, AssetError>
+    AssetPipeline::Load(const LoadContext& ctx) {
+        auto loaderR = Begin_(ctx);
+        if (!loaderR) return Base::Result<Core::AnyAsset, AssetError>::Err(std::move(loaderR.error()));
+
+        // 2) bytes を読む（mmap 等のソースはコピー無しのバッファが返る）
+        return Decode_(ctx, *loaderR.value(), source_.ReadAll(ctx.resolvedPath.View()));
+    }
+
+    void AssetPipeline::LoadBatch(Base::ConstSpan<LoadContext> ctxs,
+                                  std::vector<Base::Result<Core::AnyAsset, AssetError>>& out) {
+        using R = Base::Result<Core::AnyAsset, AssetError>;
+
+        out.clear();
+        out.reserve(ctxs.size());
+
+        // 検証/loader 解決に通ったものだけ読みに行く
+        batchPaths_.clear();
+        batchIndex_.clear();
+        batchLoaders_.clear();
+        for (std::size_t i = 0; i < ctxs.size(); ++i) {
+            auto loaderR = Begin_(ctxs[i]);
+            if (!loaderR) {
+                out.push_back(R::Err(std::move(loaderR.error())));
+                continue;
+            }
+            out.push_back(R::Ok(Core::AnyAsset{}));
+            batchPaths_.push_back(ctxs[i].resolvedPath.View());
+            batchIndex_.push_back(i);
+            batchLoaders_.push_back(loaderR.value());
+        }
+        if (batchPaths_.empty()) return;
+
+        // 2) bytes をまとめて読む
+        source_.ReadAllBatch(batchPaths_, batchBytes_);
+
+        for (std::size_t k = 0; k < batchIndex_.size(); ++k) {
+            const std::size_t i = batchIndex_[k];
+            auto bytesR = k < batchBytes_.size()
+                ? std::move(batchBytes_[k])
+                : Base::Result<Base::SharedBuffer, AssetError>::Err(
+                    AssetError::Make(AssetErrorCode::SourceReadFailed, "AssetPipeline: source returned too few results",
+                                     ctxs[i].resolvedPath.Str()));
+            out[i] = Decode_(ctxs[i], *batchLoaders_[k], std::move(bytesR));
+        }
+        batchBytes_.clear();
+    }
+
 } // namespace Engine::Asset::Loading
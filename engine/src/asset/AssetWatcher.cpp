@@ -1,8 +1,19 @@
 #include "engine/asset/hot_reload/AssetWatcher.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
+#include <mutex>
 #include <system_error>
+#include <utility>
+
+#include "engine/asset/detail/ContentHash.hpp"
+
+#include "engine/io/async/IoWorkerPool.hpp"
+#include "engine/io/fs/InotifyFileWatcher.hpp"
+#include "engine/io/fs/NativeFileSystem.hpp"
+#include "engine/io/path/Uri.hpp"
+#include "engine/io/stream/FileOpenMode.hpp"
 
 namespace Engine::Asset::HotReload {
 
@@ -10,46 +21,101 @@ namespace fs = std::filesystem;
 
 static std::uint64_t MsToNs(std::uint64_t ms) noexcept { return ms * 1'000'000ull; }
 
-// file_time_type -> system_clock ns（C++17 best-effort）
+// file_time_type -> system_clock ns
+// - 変換は決定的でないといけない（同じ mtime が毎回同じ値にならないと Modified が出続ける）
 static std::uint64_t FileTimeToSystemNs(const fs::file_time_type& ft) {
-    // file_clock と system_clock の差分で変換する（よくある手法）
     using namespace std::chrono;
+#if defined(__cpp_lib_chrono) && __cpp_lib_chrono >= 201907L
+    const auto sysTp = clock_cast<system_clock>(ft);
+#elif defined(__GLIBCXX__)
+    const auto sysTp = file_clock::to_sys(ft);
+#else
+    // file_clock と system_clock の差分で変換する（now() 2 回の間隔ぶん揺れるので us に丸める）
     const auto nowFile = fs::file_time_type::clock::now();
     const auto nowSys  = system_clock::now();
-
-    const auto sysTp = time_point_cast<system_clock::duration>(ft - nowFile + nowSys);
+    const auto sysTp = time_point_cast<microseconds>(ft - nowFile + nowSys);
+#endif
     return static_cast<std::uint64_t>(
         duration_cast<nanoseconds>(sysTp.time_since_epoch()).count()
     );
 }
 
-AssetWatcher::AssetWatcher(Options opt) : opt_(opt) {}
+// 既定の watcher（使えなければ nullptr = stat ポーリング）
+static std::unique_ptr<IO::FS::IFileWatcher> CreateDefaultFileWatcher() {
+#if defined(__linux__)
+    return IO::FS::InotifyFileWatcher::TryCreate();
+#else
+    return nullptr;
+#endif
+}
+
+// resolvedPath -> watcher に渡す Uri（scheme 無し。ToString / path.Str() は元のパスのまま）
+static IO::Path::Uri ToWatchUri(std::string_view path) {
+    IO::Path::Uri uri;
+    uri.path = IO::Path::Path::FromNormalized(std::string(path));
+    return uri;
+}
+
+AssetWatcher::AssetWatcher(Options opt)
+    : AssetWatcher(opt, opt.useFileWatcher ? CreateDefaultFileWatcher() : nullptr) {}
+
+AssetWatcher::AssetWatcher(Options opt, std::unique_ptr<IO::FS::IFileWatcher> fileWatcher)
+    : opt_(opt), fileWatcher_(std::move(fileWatcher)) {}
+
+AssetWatcher::~AssetWatcher() = default;
 
 void AssetWatcher::SetOptions(Options opt) { opt_ = opt; }
 const AssetWatcher::Options& AssetWatcher::GetOptions() const noexcept { return opt_; }
 
-void AssetWatcher::Watch(const AssetId& id, std::string resolvedPath) {
+void AssetWatcher::Watch(const AssetId& id, std::string_view resolvedPath) {
+    Watch(id, Core::InternedPath::Intern(resolvedPath));
+}
+
+void AssetWatcher::Watch(const AssetId& id, Core::InternedPath resolvedPath) {
+    auto it = watched_.find(id);
+    if (it != watched_.end()) Detach_(id, it->second.resolvedPath);
+
     auto& w = watched_[id];
-    w.resolvedPath = std::move(resolvedPath);
+    w.resolvedPath = resolvedPath;
+
+    // 索引に載せてからスナップショットを取る（間の変更はイベントで拾える）
+    Attach_(id, w.resolvedPath);
 
     // 初回登録時点の状態をスナップショット
     bool exists = false;
     std::uint64_t writeNs = 0;
-    if (ProbeFile(w.resolvedPath, exists, writeNs)) {
+    w.hasContentHash = false;
+    hashPending_.erase(id);
+    if (ProbeFile(w.resolvedPath.View(), exists, writeNs)) {
         w.existed = exists;
         w.lastWriteTimeNs = exists ? writeNs : 0;
+        if (exists && opt_.verifyContentHash) SubmitHash_(id, w, false, writeNs, 0);
     } else {
         // エラーは黙殺（次回 Poll で再試行）
         w.existed = false;
         w.lastWriteTimeNs = 0;
+        retry_.push_back(id);
     }
 }
 
 void AssetWatcher::Unwatch(const AssetId& id) {
-    watched_.erase(id);
+    auto it = watched_.find(id);
+    if (it == watched_.end()) return;
+    Detach_(id, it->second.resolvedPath);
+    hashPending_.erase(id);
+    watched_.erase(it);
 }
 
 void AssetWatcher::Clear() {
+    if (fileWatcher_) {
+        for (const auto& [path, pw] : byPath_) (void)fileWatcher_->RemoveWatch(pw.watchId);
+    }
+    byPath_.clear();
+    polled_.clear();
+    hashPending_.clear();
+    hotRing_ = PollRing{};
+    coldRing_ = PollRing{};
+    retry_.clear();
     watched_.clear();
 }
 
@@ -62,6 +128,98 @@ const AssetWatcher::WatchedInfo* AssetWatcher::FindWatched(const AssetId& id) co
     return (it == watched_.end()) ? nullptr : &it->second;
 }
 
+void AssetWatcher::Attach_(const AssetId& id, Core::InternedPath path) {
+    if (!fileWatcher_) {
+        AddPolled_(id);
+        return;
+    }
+
+    auto [it, inserted] = byPath_.try_emplace(path);
+    if (inserted) {
+        IO::FS::WatchOptions wopt;
+        wopt.recursive = false;
+        auto r = fileWatcher_->AddWatch(ToWatchUri(path.View()), wopt);
+        if (!r) {
+            // 監視できないパス（親ディレクトリが無い等）は stat ポーリングに回す
+            byPath_.erase(it);
+            AddPolled_(id);
+            return;
+        }
+        it->second.watchId = r.value();
+    }
+    it->second.ids.push_back(id);
+}
+
+void AssetWatcher::Detach_(const AssetId& id, Core::InternedPath path) {
+    if (polled_.erase(id) != 0 || !fileWatcher_) return;
+
+    auto it = byPath_.find(path);
+    if (it == byPath_.end()) return;
+
+    auto& ids = it->second.ids;
+    ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+    if (ids.empty()) {
+        (void)fileWatcher_->RemoveWatch(it->second.watchId);
+        byPath_.erase(it);
+    }
+}
+
+// watcher がこのパスを見失った（Unknown）：張り直す。張れなければ stat ポーリングに回す
+void AssetWatcher::Rearm_(Core::InternedPath path) {
+    auto it = byPath_.find(path);
+    if (it == byPath_.end()) return;
+
+    (void)fileWatcher_->RemoveWatch(it->second.watchId);
+    IO::FS::WatchOptions wopt;
+    wopt.recursive = false;
+    auto r = fileWatcher_->AddWatch(ToWatchUri(path.View()), wopt);
+    if (r) {
+        it->second.watchId = r.value();
+        return;
+    }
+    for (const auto& id : it->second.ids) AddPolled_(id);
+    byPath_.erase(it);
+}
+
+void AssetWatcher::CollectEvents_(std::unordered_set<AssetId>& dirty) {
+    if (!fileWatcher_ || byPath_.empty()) return;
+
+    auto markAll = [&]() {
+        for (const auto& [path, pw] : byPath_) dirty.insert(pw.ids.begin(), pw.ids.end());
+    };
+
+    events_.clear();
+    for (;;) {
+        const std::size_t before = events_.size();
+        auto r = fileWatcher_->Poll(events_, 1024);
+        if (!r) {
+            // watcher が壊れた：このフレームは全部取り直す
+            markAll();
+            return;
+        }
+        if (events_.size() == before) break;
+    }
+
+    // イベントの path は intern 済みのものだけ引く（監視外のパスで arena を増やさない）
+    const Core::PathArena& arena = Core::PathArena::Global();
+    std::vector<Core::InternedPath> rearm;
+    auto mark = [&](const IO::Path::Uri& uri) {
+        const Core::InternedPath key = arena.Find(uri.path.Str());
+        if (!key) return Core::InternedPath{};
+        auto it = byPath_.find(key);
+        if (it == byPath_.end()) return Core::InternedPath{};
+        dirty.insert(it->second.ids.begin(), it->second.ids.end());
+        return key;
+    };
+
+    for (const auto& ev : events_) {
+        const Core::InternedPath hit = mark(ev.path);
+        if (ev.hasOldPath) mark(ev.oldPath);
+        if (hit && ev.kind == IO::FS::FileChangeKind::Unknown) rearm.push_back(hit);
+    }
+    for (const auto& path : rearm) Rearm_(path);
+}
+
 std::vector<AssetChange> AssetWatcher::Poll() {
     std::vector<AssetChange> out;
     if (watched_.empty()) return out;
@@ -69,74 +227,392 @@ std::vector<AssetChange> AssetWatcher::Poll() {
     const std::uint64_t nowNs = NowNs();
     const std::uint64_t debounceNs = MsToNs(opt_.debounceMs);
 
-    for (auto it = watched_.begin(); it != watched_.end(); ) {
-        const AssetId id = it->first;
-        WatchedInfo& w = it->second;
+    const std::uint64_t startNs = SteadyNs();
 
-        bool exists = false;
-        std::uint64_t writeNs = 0;
+    // ハッシュで確かめ終わった Modified
+    CollectHashes_(out);
 
-        const bool probedOk = ProbeFile(w.resolvedPath, exists, writeNs);
-        if (!probedOk) {
-            // probe 失敗は「何もしない」：OSエラーや一時的ロックを想定
-            ++it;
-            continue;
+    // 今回 stat し直す対象：イベントが来た分 + 前回 probe に失敗した分
+    std::unordered_set<AssetId> dirty;
+    CollectEvents_(dirty);
+    dirty.insert(retry_.begin(), retry_.end());
+    retry_.clear();
+
+    std::vector<AssetId> erased;
+    for (const AssetId& id : dirty) {
+        auto it = watched_.find(id);
+        if (it == watched_.end()) continue;
+
+        switch (Evaluate_(id, it->second, nowNs, debounceNs, out)) {
+        case Verdict::Keep:  break;
+        case Verdict::Retry: retry_.push_back(id); break;
+        case Verdict::Erase: erased.push_back(id); break;
         }
+    }
 
-        // --- removed ---
-        if (w.existed && !exists) {
-            if (opt_.emitRemoved) {
-                AssetChange c;
-                c.id = id;
-                c.kind = AssetChangeKind::Removed;
-                c.resolvedPath = w.resolvedPath;
-                c.writeTimeNs = 0;
-                c.detectedNs = nowNs;
-                c.seq = ++seq_;
-                out.push_back(std::move(c));
-            }
-            w.existed = false;
-            w.lastWriteTimeNs = 0;
-            w.lastEventNs = nowNs;
+    // watcher に載っていない分：hot を先に、残りの予算で cold を周回する
+    lastProbes_ = 0;
+    if (!polled_.empty()) {
+        const std::uint64_t deadlineNs = opt_.pollBudgetUs ? startNs + opt_.pollBudgetUs * 1000ull : 0;
+
+        if (opt_.pollBudgetFiles == 0) {
+            lastProbes_ += ProbeRing_(hotRing_, true, SIZE_MAX, deadlineNs, nowNs, debounceNs, out, erased);
+            lastProbes_ += ProbeRing_(coldRing_, false, SIZE_MAX, deadlineNs, nowNs, debounceNs, out, erased);
+        } else {
+            const std::size_t budget = std::max<std::size_t>(opt_.pollBudgetFiles, 2);
+            const std::size_t hot = ProbeRing_(hotRing_, true, budget / 2, deadlineNs, nowNs, debounceNs, out, erased);
+            lastProbes_ = hot + ProbeRing_(coldRing_, false, budget - hot, deadlineNs, nowNs, debounceNs, out, erased);
+        }
+    }
+
+    for (const AssetId& id : erased) Unwatch(id);
+
+    lastPollNs_ = SteadyNs() - startNs;
+    return out;
+}
+
+// stat ポーリングに載せる（cold の周回には常に居る。Watch 直後 = ロードされたばかりなので hot にもする）
+void AssetWatcher::AddPolled_(const AssetId& id) {
+    auto [it, inserted] = polled_.try_emplace(id);
+    if (!inserted) return;
+    it->second.gen = ++pollGen_;
+    coldRing_.slots.push_back(RingSlot{ id, it->second.gen });
+    MarkHot_(id, SteadyNs());
+}
 
-            // keepWatchingMissing=false なら削除
-            if (!opt_.keepWatchingMissing) {
-                it = watched_.erase(it);
+void AssetWatcher::MarkHot_(const AssetId& id, std::uint64_t steadyNs) {
+    auto it = polled_.find(id);
+    if (it == polled_.end()) return;
+
+    PollState& st = it->second;
+    st.hotUntilNs = steadyNs + MsToNs(opt_.hotWindowMs);
+    if (st.hot) return;
+
+    st.hot = true;
+    st.hotGen = ++pollGen_;
+    hotRing_.slots.push_back(RingSlot{ id, st.hotGen });
+}
+
+// 1 周終わり：無効になった slot を詰めて、周回時間を記録する
+void AssetWatcher::EndSweep_(PollRing& ring, std::uint64_t steadyNs) {
+    const bool hot = &ring == &hotRing_;
+    auto stale = [&](const RingSlot& s) {
+        auto it = polled_.find(s.id);
+        if (it == polled_.end()) return true;
+        return hot ? (!it->second.hot || it->second.hotGen != s.gen) : it->second.gen != s.gen;
+    };
+    ring.slots.erase(std::remove_if(ring.slots.begin(), ring.slots.end(), stale), ring.slots.end());
+    ring.cursor = 0;
+
+    if (ring.sweepStartNs != 0) {
+        ring.lastSweepNs = steadyNs - ring.sweepStartNs;
+        ring.worstSweepNs = std::max(ring.worstSweepNs, ring.lastSweepNs);
+    }
+    ring.sweepStartNs = ring.slots.empty() ? 0 : steadyNs;
+}
+
+std::size_t AssetWatcher::ProbeRing_(PollRing& ring, bool hot, std::size_t maxProbes, std::uint64_t deadlineNs,
+                                     std::uint64_t nowNs, std::uint64_t debounceNs,
+                                     std::vector<AssetChange>& out, std::vector<AssetId>& erased) {
+    std::size_t probes = 0;
+    if (maxProbes == 0) return 0;
+
+    std::uint64_t steadyNs = SteadyNs();
+    if (ring.sweepStartNs == 0 && !ring.slots.empty()) ring.sweepStartNs = steadyNs;
+
+    // 1 回の Poll で見るのは最大 1 周分（途中で hot -> cold に移った分を同じ Poll で二重に見ない）
+    std::size_t visits = ring.slots.size();
+    while (visits-- > 0) {
+        if (ring.cursor >= ring.slots.size()) {
+            EndSweep_(ring, steadyNs);
+            if (ring.slots.empty()) break;
+        }
+
+        const RingSlot slot = ring.slots[ring.cursor++];
+        auto pit = polled_.find(slot.id);
+        if (pit == polled_.end()) continue;
+        if (hot) {
+            if (!pit->second.hot || pit->second.hotGen != slot.gen) continue;
+            if (steadyNs >= pit->second.hotUntilNs) {
+                // hot 期間が終わった：cold の周回だけに戻る
+                pit->second.hot = false;
                 continue;
             }
-
-            ++it;
+        } else if (pit->second.gen != slot.gen) {
             continue;
         }
 
-        // --- added ---
-        if (!w.existed && exists) {
-            if (opt_.emitAdded) {
-                AssetChange c;
-                c.id = id;
-                c.kind = AssetChangeKind::Added;
-                c.resolvedPath = w.resolvedPath;
-                c.writeTimeNs = writeNs;
-                c.detectedNs = nowNs;
-                c.seq = ++seq_;
-                out.push_back(std::move(c));
+        auto wit = watched_.find(slot.id);
+        if (wit == watched_.end()) continue;
+
+        const std::size_t before = out.size();
+        if (Evaluate_(slot.id, wit->second, nowNs, debounceNs, out) == Verdict::Erase) {
+            erased.push_back(slot.id);
+        } else if (out.size() != before) {
+            MarkHot_(slot.id, steadyNs);
+        }
+
+        ++probes;
+        if (probes >= maxProbes) break;
+        if (deadlineNs != 0) {
+            steadyNs = SteadyNs();
+            if (steadyNs >= deadlineNs) break;
+        }
+    }
+
+    // 周回の最後まで来ていたらここで締める（全部見た Poll の所要時間が周回時間に含まれる）
+    if (ring.cursor >= ring.slots.size() && !ring.slots.empty()) EndSweep_(ring, SteadyNs());
+    return probes;
+}
+
+// ---------------- content hash ----------------
+
+struct AssetWatcher::Hasher final {
+    struct Job final {
+        AssetId id;
+        std::uint64_t ticket = 0;
+        std::string path;
+    };
+
+    struct Done final {
+        AssetId id;
+        std::uint64_t ticket = 0;
+        bool ok = false; // false: 読めなかった / 読んでいる間に書き換わった
+        Detail::Hash64 hash = 0;
+        std::uint64_t bytes = 0;
+        std::uint64_t writeNs = 0;
+    };
+
+    // pool の仕事と共有する分（仕事は this を触らないので、AssetWatcher が先に消えても待たなくてよい）
+    struct Shared final {
+        std::mutex mutex;
+        std::vector<Done> done;
+        IO::Async::InFlightCounter inflight;
+    };
+
+    explicit Hasher(std::size_t chunkBytes)
+        : chunk(std::max<std::size_t>(chunkBytes, 4096)), shared(std::make_shared<Shared>()) {}
+
+    void Submit(std::shared_ptr<IO::FS::IFileSystem> fs, Job job) {
+        shared->inflight.Begin();
+        IO::Async::IoWorkerPool::Shared()->Submit(
+            [st = shared, fs = std::move(fs), job = std::move(job), chunkBytes = chunk]() {
+                Done d = HashFile(*fs, job, chunkBytes);
+                {
+                    std::lock_guard<std::mutex> lk(st->mutex);
+                    st->done.push_back(std::move(d));
+                }
+                st->inflight.End();
+            });
+    }
+
+    void Take(std::vector<Done>& out) {
+        out.clear();
+        std::lock_guard<std::mutex> lk(shared->mutex);
+        out.swap(shared->done);
+    }
+
+    void WaitIdle() {
+        // pool の worker から呼ばれたら、積まれている分は自分で流す（worker を塞いで詰まらないように）
+        if (auto* pool = IO::Async::IoWorkerPool::Current()) {
+            while (pool->RunOne()) {}
+        }
+        shared->inflight.WaitIdle();
+    }
+
+    static Done HashFile(IO::FS::IFileSystem& fs, const Job& job, std::size_t chunkBytes) {
+        Done d;
+        d.id = job.id;
+        d.ticket = job.ticket;
+
+        bool exists = false;
+        std::uint64_t before = 0;
+        if (!ProbeFile(job.path, exists, before) || !exists) return d;
+
+        auto opened = fs.Open(ToWatchUri(job.path), IO::Stream::OpenReadBinary());
+        if (!opened) return d;
+        IO::Stream::IStream& in = *opened.value();
+
+        std::vector<std::byte> buf(chunkBytes);
+        Detail::ContentHasher h;
+        for (;;) {
+            auto r = in.Read(buf.data(), buf.size());
+            if (!r) return d;
+            if (r.value() == 0) break;
+            h.Update(buf.data(), r.value());
+        }
+        (void)in.Close();
+
+        std::uint64_t after = 0;
+        if (!ProbeFile(job.path, exists, after) || !exists || after != before) return d;
+
+        d.ok = true;
+        d.hash = h.Digest();
+        d.bytes = h.TotalBytes();
+        d.writeNs = before;
+        return d;
+    }
+
+    const std::size_t chunk;
+    std::shared_ptr<Shared> shared;
+};
+
+void AssetWatcher::SetFileSystem(std::shared_ptr<IO::FS::IFileSystem> fileSystem) {
+    fs_ = std::move(fileSystem);
+}
+
+void AssetWatcher::SubmitHash_(const AssetId& id, const WatchedInfo& w, bool verify, std::uint64_t writeNs,
+                               std::uint64_t detectedNs) {
+    if (!hasher_) hasher_ = std::make_unique<Hasher>(opt_.hashChunkBytes);
+    if (!fs_) fs_ = std::make_shared<IO::FS::NativeFileSystem>();
+
+    HashPending& p = hashPending_[id];
+    // 確かめ待ちの Modified を基準取りで上書きしない（新しい確認が来たらそちらに畳む）
+    const bool wasVerify = p.ticket != 0 && p.verify;
+    p.verify = verify || wasVerify;
+    p.ticket = ++hashTicket_;
+    p.writeNs = writeNs;
+    if (verify && !wasVerify) p.detectedNs = detectedNs;
+
+    hasher_->Submit(fs_, Hasher::Job{ id, p.ticket, std::string(w.resolvedPath.View()) });
+}
+
+void AssetWatcher::CollectHashes_(std::vector<AssetChange>& out) {
+    if (!hasher_ || hashPending_.empty()) return;
+
+    std::vector<Hasher::Done> done;
+    hasher_->Take(done);
+
+    for (const auto& d : done) {
+        auto pit = hashPending_.find(d.id);
+        if (pit == hashPending_.end() || pit->second.ticket != d.ticket) continue; // 新しい投入 / Unwatch 済み
+        const HashPending pending = pit->second;
+        hashPending_.erase(pit);
+
+        auto wit = watched_.find(d.id);
+        if (wit == watched_.end()) continue;
+        WatchedInfo& w = wit->second;
+
+        if (d.ok) {
+            ++hashStats_.hashedFiles;
+            hashStats_.hashedBytes += d.bytes;
+        }
+
+        if (!pending.verify) {
+            // 基準：計算中に変更を検出していなければ採用（していれば次の変更は確かめずに出す）
+            if (d.ok && d.writeNs == w.lastWriteTimeNs) {
+                w.contentHash = d.hash;
+                w.hasContentHash = true;
             }
-            w.existed = true;
-            w.lastWriteTimeNs = writeNs;
-            w.lastEventNs = nowNs;
-            ++it;
             continue;
         }
 
-        // --- modified ---
-        if (w.existed && exists) {
-            const bool changed = (writeNs != 0 && writeNs != w.lastWriteTimeNs);
+        if (d.ok && w.hasContentHash && d.hash == w.contentHash) {
+            ++hashStats_.suppressed;
+            continue;
+        }
 
-            if (changed) {
-                const bool passDebounce =
-                    (debounceNs == 0) || (nowNs >= w.lastEventNs + debounceNs);
+        AssetChange c;
+        c.id = d.id;
+        c.kind = AssetChangeKind::Modified;
+        c.resolvedPath = w.resolvedPath;
+        c.writeTimeNs = d.ok ? d.writeNs : pending.writeNs;
+        c.detectedNs = pending.detectedNs;
+        c.seq = ++seq_;
+        out.push_back(std::move(c));
+
+        w.contentHash = d.hash;
+        w.hasContentHash = d.ok;
+    }
+}
+
+AssetWatcher::HashStats AssetWatcher::GetHashStats() const {
+    HashStats st = hashStats_;
+    st.pending = hashPending_.size();
+    return st;
+}
+
+void AssetWatcher::WaitForHashing() {
+    if (hasher_) hasher_->WaitIdle();
+}
+
+AssetWatcher::PollStats AssetWatcher::GetPollStats() const {
+    PollStats st;
+    st.polledFiles = polled_.size();
+    for (const auto& [id, p] : polled_) st.hotFiles += p.hot ? 1 : 0;
+    st.lastProbes = lastProbes_;
+    st.lastPollNs = lastPollNs_;
+    st.coldSweepNs = coldRing_.lastSweepNs;
+    st.worstColdSweepNs = coldRing_.worstSweepNs;
+    st.hotSweepNs = hotRing_.lastSweepNs;
+    return st;
+}
+
+AssetWatcher::Verdict AssetWatcher::Evaluate_(const AssetId& id, WatchedInfo& w, std::uint64_t nowNs,
+                                              std::uint64_t debounceNs, std::vector<AssetChange>& out) {
+    bool exists = false;
+    std::uint64_t writeNs = 0;
+
+    const bool probedOk = ProbeFile(w.resolvedPath.View(), exists, writeNs);
+    if (!probedOk) {
+        // probe 失敗は「何もしない」：OSエラーや一時的ロックを想定（次の Poll で取り直す）
+        return Verdict::Retry;
+    }
+
+    // --- removed ---
+    if (w.existed && !exists) {
+        if (opt_.emitRemoved) {
+            AssetChange c;
+            c.id = id;
+            c.kind = AssetChangeKind::Removed;
+            c.resolvedPath = w.resolvedPath;
+            c.writeTimeNs = 0;
+            c.detectedNs = nowNs;
+            c.seq = ++seq_;
+            out.push_back(std::move(c));
+        }
+        w.existed = false;
+        w.lastWriteTimeNs = 0;
+        w.lastEventNs = nowNs;
+        w.hasContentHash = false;
+        hashPending_.erase(id);
 
-                if (passDebounce && opt_.emitModified) {
+        // keepWatchingMissing=false なら削除
+        return opt_.keepWatchingMissing ? Verdict::Keep : Verdict::Erase;
+    }
+
+    // --- added ---
+    if (!w.existed && exists) {
+        if (opt_.emitAdded) {
+            AssetChange c;
+            c.id = id;
+            c.kind = AssetChangeKind::Added;
+            c.resolvedPath = w.resolvedPath;
+            c.writeTimeNs = writeNs;
+            c.detectedNs = nowNs;
+            c.seq = ++seq_;
+            out.push_back(std::move(c));
+        }
+        w.existed = true;
+        w.lastWriteTimeNs = writeNs;
+        w.lastEventNs = nowNs;
+        if (opt_.verifyContentHash) SubmitHash_(id, w, false, writeNs, nowNs);
+        return Verdict::Keep;
+    }
+
+    // --- modified ---
+    if (w.existed && exists) {
+        const bool changed = (writeNs != 0 && writeNs != w.lastWriteTimeNs);
+
+        if (changed) {
+            const bool passDebounce =
+                (debounceNs == 0) || (nowNs >= w.lastEventNs + debounceNs);
+
+            if (passDebounce && opt_.emitModified) {
+                if (opt_.verifyContentHash && w.hasContentHash) {
+                    // 内容を確かめてから出す（CollectHashes_）
+                    SubmitHash_(id, w, true, writeNs, nowNs);
+                } else {
                     AssetChange c;
                     c.id = id;
                     c.kind = AssetChangeKind::Modified;
@@ -145,18 +621,24 @@ std::vector<AssetChange> AssetWatcher::Poll() {
                     c.detectedNs = nowNs;
                     c.seq = ++seq_;
                     out.push_back(std::move(c));
-                    w.lastEventNs = nowNs;
-                }
 
-                // debounce で抑制しても “最新 writeTime” は追従させる
-                w.lastWriteTimeNs = writeNs;
+                    // 次回の比較用に今の内容を基準にする
+                    if (opt_.verifyContentHash) SubmitHash_(id, w, false, writeNs, nowNs);
+                }
+                w.lastEventNs = nowNs;
             }
-        }
 
-        ++it;
+            // debounce で抑制しても “最新 writeTime” は追従させる
+            w.lastWriteTimeNs = writeNs;
+        }
     }
 
-    return out;
+    return Verdict::Keep;
+}
+
+std::uint64_t AssetWatcher::SteadyNs() {
+    using namespace std::chrono;
+    return static_cast<std::uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
 }
 
 std::uint64_t AssetWatcher::NowNs() {
@@ -165,8 +647,9 @@ std::uint64_t AssetWatcher::NowNs() {
     return static_cast<std::uint64_t>(duration_cast<nanoseconds>(now.time_since_epoch()).count());
 }
 
-bool AssetWatcher::ProbeFile(const std::string& path, bool& existsOut, std::uint64_t& writeNsOut) {
+bool AssetWatcher::ProbeFile(std::string_view pathView, bool& existsOut, std::uint64_t& writeNsOut) {
     std::error_code ec;
+    const fs::path path(pathView);
 
     existsOut = fs::exists(path, ec);
     if (ec) return false;
@@ -0,0 +1,309 @@
+#include "engine/asset/loading/DerivedDataCache.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "engine/asset/detail/ContentHash.hpp"
+#include "engine/io/helpers/ReadAllBytes.hpp"
+#include "engine/io/helpers/WriteAllBytes.hpp"
+
+namespace Engine::Asset::Loading {
+
+    namespace {
+        constexpr std::uint32_t kMagic = 0x31434444u; // "DDC1"（little endian）
+        constexpr std::uint32_t kFormatVersion = 1;
+        constexpr std::string_view kEntrySuffix = ".ddc";
+        constexpr std::string_view kTempSuffix = ".tmp~";
+        constexpr std::string_view kIndexName = "lru.idx";
+
+        // file 先頭の header（payload をそのまま読めるよう 64 byte に揃える）
+        struct EntryHeader final {
+            std::uint32_t magic = kMagic;
+            std::uint32_t formatVersion = kFormatVersion;
+            std::uint64_t contentHash = 0;
+            std::uint64_t loader = 0;
+            std::uint32_t loaderVersion = 0;
+            std::uint32_t reserved0 = 0;
+            std::uint64_t optionsHash = 0;
+            std::uint64_t payloadSize = 0;
+            std::uint64_t payloadHash = 0;
+            std::uint64_t reserved1 = 0;
+        };
+        static_assert(sizeof(EntryHeader) == 64, "EntryHeader must stay 64 bytes");
+
+        EntryHeader MakeHeader(const DerivedDataKey& key) {
+            EntryHeader h;
+            h.contentHash = key.contentHash;
+            h.loader = key.loader.value;
+            h.loaderVersion = key.loaderVersion;
+            h.optionsHash = key.optionsHash;
+            return h;
+        }
+
+        bool EndsWith(std::string_view s, std::string_view suffix) {
+            return s.size() >= suffix.size() && s.substr(s.size() - suffix.size()) == suffix;
+        }
+
+        void AppendHex(std::string& out, std::uint64_t v) {
+            static constexpr char kDigits[] = "0123456789abcdef";
+            for (int shift = 60; shift >= 0; shift -= 4) out.push_back(kDigits[(v >> shift) & 0xF]);
+        }
+    } // namespace
+
+    std::string DerivedDataKey::FileName() const {
+        const Detail::Hash64 variant =
+            Detail::HashCombine(Detail::HashCombine(loader.value, loaderVersion), optionsHash);
+        std::string name;
+        name.reserve(16 + 1 + 16 + kEntrySuffix.size());
+        AppendHex(name, contentHash);
+        name.push_back('-');
+        AppendHex(name, variant);
+        name.append(kEntrySuffix);
+        return name;
+    }
+
+    DerivedDataCache::DerivedDataCache(std::shared_ptr<IO::FS::IFileSystem> fs, IO::Path::Uri directory)
+        : DerivedDataCache(std::move(fs), std::move(directory), Options{}) {}
+
+    DerivedDataCache::DerivedDataCache(std::shared_ptr<IO::FS::IFileSystem> fs, IO::Path::Uri directory, const Options& opt)
+        : fs_(std::move(fs)), dir_(std::move(directory)), opt_(opt) {
+        // cache は消えても作り直すだけなので fsync しない
+        IO::Async::AsyncWriteService::Options wopt;
+        wopt.atomicReplace = true;
+        wopt.sync = false;
+        writer_ = std::make_unique<IO::Async::AsyncWriteService>(fs_, wopt);
+
+        (void)fs_->CreateDirectories(dir_);
+        LoadIndex_();
+    }
+
+    DerivedDataCache::~DerivedDataCache() {
+        writer_->Flush();
+        SaveIndex();
+        writer_.reset();
+    }
+
+    IO::Path::Uri DerivedDataCache::EntryUri_(const std::string& name) const {
+        IO::Path::Uri u = dir_;
+        u.path = dir_.path / IO::Path::Path::FromNormalized(name);
+        return u;
+    }
+
+    void DerivedDataCache::LoadIndex_() {
+        IO::FS::ListOptions lopt;
+        lopt.includeDirectories = false;
+        lopt.includeInfo = true;
+        auto listR = fs_->List(dir_, lopt);
+        if (!listR) return;
+
+        struct Found final {
+            std::string name;
+            std::uint64_t bytes = 0;
+            std::int64_t mtimeNs = 0;
+        };
+        std::vector<Found> found;
+        for (const auto& e : listR.value()) {
+            if (EndsWith(e.name, kTempSuffix)) {
+                (void)fs_->Remove(EntryUri_(e.name)); // 書きかけで落ちた残り
+                continue;
+            }
+            if (!EndsWith(e.name, kEntrySuffix)) continue;
+            found.push_back(Found{ e.name, e.hasInfo ? e.info.sizeBytes : 0, e.hasInfo ? e.info.mtimeNs : 0 });
+        }
+
+        // 前回の使った順（古い順に 1 行 1 名前）
+        std::unordered_map<std::string, std::uint64_t> order;
+        IO::Helpers::ReadAllOptions ropt;
+        ropt.maxBytes = 0;
+        if (auto idxR = IO::Helpers::ReadAllBytes(*fs_, EntryUri_(std::string(kIndexName)), ropt)) {
+            const auto& bytes = idxR.value();
+            std::string_view text(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+            while (!text.empty()) {
+                const std::size_t nl = text.find('\n');
+                const std::string_view line = text.substr(0, nl);
+                if (!line.empty()) order.emplace(std::string(line), order.size() + 1);
+                if (nl == std::string_view::npos) break;
+                text.remove_prefix(nl + 1);
+            }
+        }
+
+        // 索引にあるものは前回の順、無いもの（索引を書く前に落ちた回の分）はその後に更新時刻の順
+        std::sort(found.begin(), found.end(), [&](const Found& a, const Found& b) {
+            const auto ia = order.find(a.name);
+            const auto ib = order.find(b.name);
+            const bool ha = ia != order.end();
+            const bool hb = ib != order.end();
+            if (ha != hb) return ha;
+            if (ha) return ia->second < ib->second;
+            return a.mtimeNs < b.mtimeNs;
+        });
+
+        std::lock_guard<std::mutex> lk(mutex_);
+        for (const Found& f : found) {
+            Entry e;
+            e.bytes = f.bytes;
+            e.lastUse = ++useClock_;
+            e.written = true;
+            stats_.bytes += f.bytes;
+            entries_.emplace(f.name, e);
+        }
+        Trim_();
+    }
+
+    void DerivedDataCache::SaveIndex() {
+        std::vector<std::pair<std::uint64_t, std::string>> used;
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            used.reserve(entries_.size());
+            for (const auto& [name, e] : entries_) {
+                if (e.written) used.emplace_back(e.lastUse, name);
+            }
+        }
+        std::sort(used.begin(), used.end());
+
+        std::string text;
+        text.reserve(used.size() * (16 + 1 + 16 + kEntrySuffix.size() + 1));
+        for (const auto& u : used) {
+            text.append(u.second);
+            text.push_back('\n');
+        }
+
+        IO::Helpers::WriteAllOptions wopt;
+        wopt.atomicReplace = true;
+        (void)IO::Helpers::WriteAllBytes(*fs_, EntryUri_(std::string(kIndexName)),
+                                         { reinterpret_cast<const std::byte*>(text.data()), text.size() }, wopt);
+    }
+
+    std::optional<Base::SharedBuffer> DerivedDataCache::Find(const DerivedDataKey& key) {
+        const std::string name = key.FileName();
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            auto it = entries_.find(name);
+            // 書き終わっていないものは読まない（その間の読み込みは普通に decode する）
+            if (it == entries_.end() || !it->second.written) {
+                ++stats_.misses;
+                return std::nullopt;
+            }
+        }
+
+        // 読み込みと検証は lock の外で
+        IO::Helpers::ReadAllOptions ropt;
+        ropt.maxBytes = 0;
+        auto bytesR = IO::Helpers::ReadAllBytes(*fs_, EntryUri_(name), ropt);
+
+        bool valid = false;
+        Base::SharedBuffer file;
+        if (bytesR && bytesR.value().size() >= sizeof(EntryHeader)) {
+            file = Base::SharedBuffer::FromVector(std::move(bytesR.value()));
+
+            EntryHeader h;
+            std::memcpy(&h, file.data(), sizeof(h));
+            const EntryHeader want = MakeHeader(key);
+            valid = h.magic == want.magic && h.formatVersion == want.formatVersion &&
+                    h.contentHash == want.contentHash && h.loader == want.loader &&
+                    h.loaderVersion == want.loaderVersion && h.optionsHash == want.optionsHash &&
+                    h.payloadSize == file.size() - sizeof(EntryHeader) &&
+                    h.payloadHash == Detail::ContentHash64(file.data() + sizeof(EntryHeader), h.payloadSize);
+        }
+
+        std::lock_guard<std::mutex> lk(mutex_);
+        auto it = entries_.find(name);
+        if (!valid) {
+            // 壊れている / 別の中身：消して作り直させる
+            if (it != entries_.end() && it->second.written) Drop_(name);
+            ++stats_.corrupt;
+            ++stats_.misses;
+            return std::nullopt;
+        }
+        if (it != entries_.end()) it->second.lastUse = ++useClock_;
+        ++stats_.hits;
+        return file.Slice(sizeof(EntryHeader));
+    }
+
+    void DerivedDataCache::Store(const DerivedDataKey& key, const Base::SharedBuffer& payload) {
+        const std::uint64_t total = sizeof(EntryHeader) + payload.size();
+        if (total > opt_.maxBytes) return; // 入りきらないものは持たない
+
+        EntryHeader h = MakeHeader(key);
+        h.payloadSize = payload.size();
+        h.payloadHash = Detail::ContentHash64(payload.data(), payload.size());
+
+        std::vector<std::byte> file(static_cast<std::size_t>(total));
+        std::memcpy(file.data(), &h, sizeof(h));
+        if (payload.size() != 0) std::memcpy(file.data() + sizeof(h), payload.data(), payload.size());
+
+        const std::string name = key.FileName();
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            Entry& e = entries_[name];
+            stats_.bytes -= e.bytes;
+            e.bytes = total;
+            e.lastUse = ++useClock_;
+            e.written = false;
+            stats_.bytes += total;
+            ++stats_.stores;
+            Trim_();
+        }
+
+        // 完了通知は writer thread から来る。Submit は lock の外で呼ぶ（writer の lock と交差させない）
+        writer_->Submit(EntryUri_(name), Base::SharedBuffer::FromVector(std::move(file)),
+                        [this, name](IO::Async::IoResultVoid r) {
+                            std::lock_guard<std::mutex> lk(mutex_);
+                            auto it = entries_.find(name);
+                            if (it == entries_.end()) return;
+                            if (r) {
+                                it->second.written = true;
+                                return;
+                            }
+                            stats_.bytes -= it->second.bytes;
+                            entries_.erase(it);
+                        });
+    }
+
+    void DerivedDataCache::Flush() {
+        writer_->Flush();
+    }
+
+    DerivedDataStats DerivedDataCache::Stats() const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        DerivedDataStats s = stats_;
+        s.entries = entries_.size();
+        return s;
+    }
+
+    void DerivedDataCache::Trim_() {
+        if (stats_.bytes <= opt_.maxBytes) return;
+
+        // 書き終わっているものを古い順に消す（書き込み中のものは file がまだ無いので残す）
+        std::vector<std::pair<std::uint64_t, const std::string*>> victims;
+        victims.reserve(entries_.size());
+        for (const auto& [name, e] : entries_) {
+            if (e.written) victims.emplace_back(e.lastUse, &name);
+        }
+        std::sort(victims.begin(), victims.end());
+
+        std::vector<std::string> drop;
+        std::uint64_t bytes = stats_.bytes;
+        for (const auto& v : victims) {
+            if (bytes <= opt_.maxBytes) break;
+            bytes -= entries_.find(*v.second)->second.bytes;
+            drop.push_back(*v.second);
+        }
+        for (const std::string& name : drop) {
+            Drop_(name);
+            ++stats_.evictions;
+        }
+    }
+
+    void DerivedDataCache::Drop_(const std::string& name) {
+        auto it = entries_.find(name);
+        if (it == entries_.end()) return;
+        stats_.bytes -= it->second.bytes;
+        entries_.erase(it);
+        (void)fs_->Remove(EntryUri_(name));
+    }
+
+} // namespace Engine::Asset::Loading
@@ -0,0 +1,94 @@
+#include "engine/asset/core/InternedPath.hpp"
+
+#include <cstring>
+#include <mutex>
+
+namespace Engine::Asset::Core {
+
+    namespace {
+        constexpr std::size_t kNodesPerBlock = 1024;
+    }
+
+    InternedPath InternedPath::Intern(std::string_view s) {
+        return PathArena::Global().Intern(s);
+    }
+
+    PathArena::~PathArena() = default;
+
+    PathArena& PathArena::Global() {
+        // 破棄順の問題を避けるため意図的にリークさせる（static 破棄後もハンドルが読める）
+        static PathArena* arena = new PathArena();
+        return *arena;
+    }
+
+    char* PathArena::AllocChars_(std::size_t n) {
+        // 巨大な path は専用ブロック（通常ブロックの残りを無駄にしない）
+        if (n > kBlockBytes / 4) {
+            charBlocks_.push_back(std::make_unique<char[]>(n));
+            bytesReserved_ += n;
+            return charBlocks_.back().get();
+        }
+
+        if (charLeft_ < n) {
+            charBlocks_.push_back(std::make_unique<char[]>(kBlockBytes));
+            charCur_ = charBlocks_.back().get();
+            charLeft_ = kBlockBytes;
+            bytesReserved_ += kBlockBytes;
+        }
+        char* p = charCur_;
+        charCur_ += n;
+        charLeft_ -= n;
+        return p;
+    }
+
+    InternedPath PathArena::Intern(std::string_view s) {
+        if (s.empty()) return InternedPath{};
+
+        {
+            std::shared_lock lock(mtx_);
+            auto it = index_.find(s);
+            if (it != index_.end()) return InternedPath(it->second);
+        }
+
+        std::unique_lock lock(mtx_);
+        // 別スレッドが先に入れたかもしれない
+        auto it = index_.find(s);
+        if (it != index_.end()) return InternedPath(it->second);
+
+        char* chars = AllocChars_(s.size() + 1);
+        std::memcpy(chars, s.data(), s.size());
+        chars[s.size()] = '\0';
+
+        if (nodeBlocks_.empty() || nodeUsed_ == kNodesPerBlock) {
+            nodeBlocks_.push_back(std::make_unique<InternedPath::Node[]>(kNodesPerBlock));
+            nodeUsed_ = 0;
+            bytesReserved_ += kNodesPerBlock * sizeof(InternedPath::Node);
+        }
+        InternedPath::Node* node = &nodeBlocks_.back()[nodeUsed_++];
+        node->data = chars;
+        node->size = static_cast<std::uint32_t>(s.size());
+        node->id = nextId_++;
+
+        index_.emplace(std::string_view(chars, s.size()), node);
+        return InternedPath(node);
+    }
+
+    InternedPath PathArena::Find(std::string_view s) const {
+        if (s.empty()) return InternedPath{};
+
+        std::shared_lock lock(mtx_);
+        auto it = index_.find(s);
+        return it == index_.end() ? InternedPath{} : InternedPath(it->second);
+    }
+
+    std::size_t PathArena::Count() const {
+        std::shared_lock lock(mtx_);
+        return index_.size();
+    }
+
+    std::size_t PathArena::BytesReserved() const {
+        std::shared_lock lock(mtx_);
+        return bytesReserved_;
+    }
+
+} // namespace Engine::Asset::Core
@@ -0,0 +1,135 @@
+#include "engine/asset/loading/MappedAssetSource.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Engine::Asset::Loading {
+
+    namespace {
+        AssetError FromIoError(const IO::FS::IoError& e, std::string_view path) {
+            const AssetErrorCode code = (e.code == IO::IoErrorCode::NotFound)
+                ? AssetErrorCode::SourceNotFound
+                : AssetErrorCode::SourceReadFailed;
+            return AssetError::Make(code, "MappedAssetSource: " + e.message,
+                                    e.detail.empty() ? std::string(path) : e.detail);
+        }
+
+        AssetError FromErrno(int err, const char* msg, const std::string& path) {
+            const AssetErrorCode code = (err == ENOENT || err == ENOTDIR)
+                ? AssetErrorCode::SourceNotFound
+                : AssetErrorCode::SourceReadFailed;
+            return AssetError::Make(code, msg, path + ": " + std::strerror(err));
+        }
+
+        // 小さいファイル用：open + fstat + pread（サイズが分かっているので 1 回の確保で済む）
+        Base::Result<ByteBuffer, AssetError> PreadAll(int fd, std::size_t size, const std::string& path) {
+            ByteBuffer buf(size);
+            std::size_t done = 0;
+            while (done < size) {
+                const ssize_t n = ::pread(fd, buf.data() + done, size - done, static_cast<off_t>(done));
+                if (n < 0) {
+                    if (errno == EINTR) continue;
+                    return Base::Result<ByteBuffer, AssetError>::Err(FromErrno(errno, "MappedAssetSource: pread failed", path));
+                }
+                if (n == 0) break; // 読んでいる間に縮んだ
+                done += static_cast<std::size_t>(n);
+            }
+            buf.resize(done);
+            return Base::Result<ByteBuffer, AssetError>::Ok(std::move(buf));
+        }
+    } // namespace
+
+    MappedAssetSource::MappedAssetSource() = default;
+    MappedAssetSource::MappedAssetSource(Options opt) : opt_(std::move(opt)) {}
+
+    void MappedAssetSource::SetOptions(Options opt) { opt_ = std::move(opt); }
+    const MappedAssetSource::Options& MappedAssetSource::GetOptions() const noexcept { return opt_; }
+
+    std::string MappedAssetSource::NativePath_(std::string_view resolvedPath) const {
+        if (opt_.rootDirectory.empty()) return std::string(resolvedPath);
+
+        std::string out;
+        out.reserve(opt_.rootDirectory.size() + 1 + resolvedPath.size());
+        out = opt_.rootDirectory;
+        if (out.back() != '/') out.push_back('/');
+        out.append(resolvedPath.data(), resolvedPath.size());
+        return out;
+    }
+
+    Base::Result<Base::SharedBuffer, AssetError> MappedAssetSource::ReadAll(std::string_view resolvedPath) {
+        using R = Base::Result<Base::SharedBuffer, AssetError>;
+        const std::string path = NativePath_(resolvedPath);
+
+        // open + fstat は 1 回だけ。map するならこの fd をそのまま渡す
+        int fd = -1;
+        do {
+            fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        } while (fd < 0 && errno == EINTR);
+        if (fd < 0) return R::Err(FromErrno(errno, "MappedAssetSource: open failed", path));
+
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            const int err = errno;
+            ::close(fd);
+            return R::Err(FromErrno(err, "MappedAssetSource: fstat failed", path));
+        }
+        if (!S_ISREG(st.st_mode)) {
+            ::close(fd);
+            return R::Err(AssetError::Make(AssetErrorCode::SourceReadFailed, "MappedAssetSource: not a regular file", path));
+        }
+
+        const auto size = static_cast<std::size_t>(st.st_size);
+        if (!opt_.mapFiles || size < opt_.minMapBytes) {
+            auto r = PreadAll(fd, size, path);
+            ::close(fd);
+            if (!r) return R::Err(std::move(r.error()));
+            return R::Ok(Base::SharedBuffer::FromVector(std::move(r.value())));
+        }
+
+        auto mr = IO::FS::MappedFile::Map(fd, size, path, opt_.map);
+        ::close(fd); // mapping は fd を閉じても残る
+        if (!mr) return R::Err(FromIoError(mr.error(), path));
+
+        std::shared_ptr<const IO::FS::MappedFile> mapped = std::move(mr.value());
+        const auto bytes = mapped->Bytes();
+        return R::Ok(Base::SharedBuffer(std::move(mapped), bytes));
+    }
+
+    void MappedAssetSource::ReadAllBatch(Base::ConstSpan<std::string_view> resolvedPaths,
+                                         std::vector<Base::Result<Base::SharedBuffer, AssetError>>& out) {
+        using R = Base::Result<Base::SharedBuffer, AssetError>;
+        if (!opt_.batchReader) {
+            IAssetSource::ReadAllBatch(resolvedPaths, out);
+            return;
+        }
+
+        batchPaths_.clear();
+        batchPaths_.reserve(resolvedPaths.size());
+        for (std::size_t i = 0; i < resolvedPaths.size(); ++i) {
+            batchPaths_.push_back(NativePath_(resolvedPaths[i]));
+        }
+
+        opt_.batchReader->ReadFiles(batchPaths_, batchResults_);
+
+        out.clear();
+        out.reserve(batchResults_.size());
+        for (std::size_t i = 0; i < batchResults_.size(); ++i) {
+            auto& r = batchResults_[i];
+            if (r) out.push_back(R::Ok(std::move(r.value())));
+            else   out.push_back(R::Err(FromIoError(r.error(), batchPaths_[i])));
+        }
+        batchResults_.clear();
+    }
+
+    bool MappedAssetSource::Exists(std::string_view resolvedPath) {
+        const std::string path = NativePath_(resolvedPath);
+        struct stat st {};
+        return ::stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode);
+    }
+
+} // namespace Engine::Asset::Loading
@@ -0,0 +1,42 @@
+#include "engine/asset/loading/MemoryAssetSource.hpp"
+
+namespace Engine::Asset::Loading {
+
+    MemoryAssetSource::MemoryAssetSource(std::shared_ptr<const IO::FS::MemoryFileSystem> fs)
+        : fs_(std::move(fs)) {}
+
+    MemoryAssetSource::MemoryAssetSource(std::shared_ptr<const IO::FS::MemoryFileSystem> fs, Options opt)
+        : fs_(std::move(fs)), opt_(std::move(opt)) {}
+
+    void MemoryAssetSource::SetOptions(Options opt) { opt_ = std::move(opt); }
+    const MemoryAssetSource::Options& MemoryAssetSource::GetOptions() const noexcept { return opt_; }
+
+    std::string_view MemoryAssetSource::InnerPath_(std::string_view resolvedPath) const noexcept {
+        if (!opt_.stripPrefix.empty() && resolvedPath.substr(0, opt_.stripPrefix.size()) == opt_.stripPrefix) {
+            resolvedPath.remove_prefix(opt_.stripPrefix.size());
+        }
+        return resolvedPath;
+    }
+
+    Base::Result<Base::SharedBuffer, AssetError> MemoryAssetSource::ReadAll(std::string_view resolvedPath) {
+        using R = Base::Result<Base::SharedBuffer, AssetError>;
+        if (!fs_) {
+            return R::Err(AssetError::Make(AssetErrorCode::SourceNotFound, "MemoryAssetSource: no file system",
+                                           std::string(resolvedPath)));
+        }
+
+        auto r = fs_->ReadShared(InnerPath_(resolvedPath));
+        if (!r) {
+            const AssetErrorCode code = (r.error().code == IO::IoErrorCode::NotFound)
+                ? AssetErrorCode::SourceNotFound
+                : AssetErrorCode::SourceReadFailed;
+            return R::Err(AssetError::Make(code, "MemoryAssetSource: " + r.error().message, std::string(resolvedPath)));
+        }
+        return R::Ok(std::move(r.value()));
+    }
+
+    bool MemoryAssetSource::Exists(std::string_view resolvedPath) {
+        return fs_ && static_cast<bool>(fs_->ReadShared(InnerPath_(resolvedPath)));
+    }
+
+} // namespace Engine::Asset::Loading
@@ -0,0 +1,116 @@
+#include "engine/asset/loading/PakAssetSource.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace Engine::Asset::Loading {
+
+    namespace {
+        AssetError FromIoError(const IO::Pak::IoError& e, std::string_view path) {
+            const AssetErrorCode code = (e.code == IO::IoErrorCode::NotFound)
+                ? AssetErrorCode::SourceNotFound
+                : AssetErrorCode::SourceReadFailed;
+            return AssetError::Make(code, "PakAssetSource: " + e.message,
+                                    e.detail.empty() ? std::string(path) : e.detail);
+        }
+
+        // 隣接（このバイト数以内の隙間）する範囲は 1 回の madvise にまとめる
+        constexpr std::uint64_t kMergeGapBytes = 64 * 1024;
+    } // namespace
+
+    PakAssetSource::PakAssetSource(std::shared_ptr<const IO::Pak::PakArchive> archive)
+        : archive_(std::move(archive)) {}
+
+    PakAssetSource::PakAssetSource(std::shared_ptr<const IO::Pak::PakArchive> archive, Options opt)
+        : archive_(std::move(archive)), opt_(std::move(opt)) {}
+
+    void PakAssetSource::SetOptions(Options opt) { opt_ = std::move(opt); }
+    const PakAssetSource::Options& PakAssetSource::GetOptions() const noexcept { return opt_; }
+
+    std::string_view PakAssetSource::InnerPath_(std::string_view resolvedPath) const noexcept {
+        if (!opt_.stripPrefix.empty() && resolvedPath.substr(0, opt_.stripPrefix.size()) == opt_.stripPrefix) {
+            resolvedPath.remove_prefix(opt_.stripPrefix.size());
+        }
+        while (!resolvedPath.empty() && resolvedPath.front() == '/') resolvedPath.remove_prefix(1);
+        return resolvedPath;
+    }
+
+    Base::Result<Base::SharedBuffer, AssetError>
+    PakAssetSource::Read_(std::string_view resolvedPath, const IO::Pak::PakTocEntry* e) const {
+        using R = Base::Result<Base::SharedBuffer, AssetError>;
+        if (!e) {
+            return R::Err(AssetError::Make(AssetErrorCode::SourceNotFound, "PakAssetSource: not found in pak",
+                                           std::string(resolvedPath)));
+        }
+        auto r = archive_->Read(*e);
+        if (!r) return R::Err(FromIoError(r.error(), resolvedPath));
+        return R::Ok(std::move(r.value()));
+    }
+
+    Base::Result<Base::SharedBuffer, AssetError> PakAssetSource::ReadAll(std::string_view resolvedPath) {
+        const auto e = archive_ ? archive_->Find(InnerPath_(resolvedPath)) : std::nullopt;
+        return Read_(resolvedPath, e ? &*e : nullptr);
+    }
+
+    void PakAssetSource::ReadAllBatch(Base::ConstSpan<std::string_view> resolvedPaths,
+                                      std::vector<Base::Result<Base::SharedBuffer, AssetError>>& out) {
+        out.clear();
+        out.reserve(resolvedPaths.size());
+
+        // 1) TOC を引いて payload 範囲を集める
+        batchEntries_.clear();
+        batchRanges_.clear();
+        for (std::size_t i = 0; i < resolvedPaths.size(); ++i) {
+            auto e = archive_ ? archive_->Find(InnerPath_(resolvedPaths[i])) : std::nullopt;
+            if (e && e->storedSize > 0) {
+                batchRanges_.push_back(Range{ e->dataOffset, e->dataOffset + e->storedSize });
+            }
+            batchEntries_.push_back(std::move(e));
+        }
+
+        // 2) まとめて先読み要求する（mmap でない pak イメージでも害は無い）
+        if (!batchRanges_.empty()) {
+            std::sort(batchRanges_.begin(), batchRanges_.end(),
+                      [](const Range& a, const Range& b) { return a.begin < b.begin; });
+
+            const Base::SharedBuffer& image = archive_->Image();
+            const auto base = reinterpret_cast<std::uintptr_t>(image.data());
+            const auto page = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+
+            const auto advise = [&](const Range& r) {
+                const std::uint64_t end = std::min<std::uint64_t>(r.end, image.size());
+                if (r.begin >= end) return;
+                const std::uintptr_t lo = (base + r.begin) & ~(page - 1);
+                const std::uintptr_t hi = base + end;
+                (void)::posix_madvise(reinterpret_cast<void*>(lo), hi - lo, POSIX_MADV_WILLNEED);
+            };
+
+            Range cur = batchRanges_.front();
+            for (std::size_t i = 1; i < batchRanges_.size(); ++i) {
+                const Range& r = batchRanges_[i];
+                if (r.begin <= cur.end + kMergeGapBytes) {
+                    cur.end = std::max(cur.end, r.end);
+                    continue;
+                }
+                advise(cur);
+                cur = r;
+            }
+            advise(cur);
+        }
+
+        // 3) 読む（非圧縮は Slice、Lz は展開）
+        for (std::size_t i = 0; i < resolvedPaths.size(); ++i) {
+            const auto& e = batchEntries_[i];
+            out.push_back(Read_(resolvedPaths[i], e ? &*e : nullptr));
+        }
+        batchEntries_.clear();
+    }
+
+    bool PakAssetSource::Exists(std::string_view resolvedPath) {
+        return archive_ && archive_->Find(InnerPath_(resolvedPath)).has_value();
+    }
+
+} // namespace Engine::Asset::Loading
@@ -9,9 +9,9 @@ namespace Engine::Asset::Loaders {
     }
 
     Base::Result<Core::AnyAsset, AssetError>
-    BinaryLoader::Load(Base::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) {
+    BinaryLoader::Load(const Base::SharedBuffer& bytes, const Loading::LoadContext& ctx) {
         auto bin = std::make_shared<BinaryAsset>();
-        bin->bytes.assign(bytes.begin(), bytes.end());
+        bin->bytes = bytes;
 
         (void)ctx;
         return Base::Result<Core::AnyAsset, AssetError>::Ok(
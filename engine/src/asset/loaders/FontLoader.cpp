@@ -9,14 +9,14 @@ namespace Engine::Asset::Loaders {
     }
 
     Base::Result<Core::AnyAsset, AssetError>
-    FontLoader::Load(Base::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) {
+    FontLoader::Load(const Base::SharedBuffer& bytes, const Loading::LoadContext& ctx) {
         if (bytes.empty()) {
             return Base::Result<Core::AnyAsset, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::DecodeFailed, "Font: empty file", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::DecodeFailed, "Font: empty file", ctx.resolvedPath.Str()));
         }
 
         auto font = std::make_shared<FontAsset>();
-        font->bytes.assign(bytes.begin(), bytes.end());
+        font->bytes = bytes;
 
         return Base::Result<Core::AnyAsset, AssetError>::Ok(
             Core::AnyAsset::FromShared<FontAsset>(std::move(font))
@@ -18,18 +18,18 @@ namespace Engine::Asset::Loaders {
     }
 
     Base::Result<Core::AnyAsset, AssetError>
-    SoundLoader::Load(Base::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) {
+    SoundLoader::Load(const Base::SharedBuffer& bytes, const Loading::LoadContext& ctx) {
         const auto* p = reinterpret_cast<const unsigned char*>(bytes.data());
         const std::size_t n = bytes.size();
 
         if (n < 12) {
             return Base::Result<Core::AnyAsset, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::DecodeFailed, "WAV: file too small", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::DecodeFailed, "WAV: file too small", ctx.resolvedPath.Str()));
         }
 
         if (std::memcmp(p, "RIFF", 4) != 0 || std::memcmp(p + 8, "WAVE", 4) != 0) {
             return Base::Result<Core::AnyAsset, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::UnsupportedFormat, "Sound: only WAV(RIFF/WAVE) supported (PCM16)", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::UnsupportedFormat, "Sound: only WAV(RIFF/WAVE) supported (PCM16)", ctx.resolvedPath.Str()));
         }
 
         std::uint16_t audioFormat = 0;
@@ -51,7 +51,7 @@ namespace Engine::Asset::Loaders {
             if (std::memcmp(ck, "fmt ", 4) == 0) {
                 if (ckSize < 16) {
                     return Base::Result<Core::AnyAsset, AssetError>::Err(
-                        AssetError::Make(AssetErrorCode::DecodeFailed, "WAV: invalid fmt chunk", ctx.resolvedPath));
+                        AssetError::Make(AssetErrorCode::DecodeFailed, "WAV: invalid fmt chunk", ctx.resolvedPath.Str()));
                 }
                 audioFormat   = ReadU16LE(p + off + 0);
                 channels      = ReadU16LE(p + off + 2);
@@ -68,23 +68,23 @@ namespace Engine::Asset::Loaders {
 
         if (audioFormat != 1) {
             return Base::Result<Core::AnyAsset, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::UnsupportedFormat, "WAV: only PCM supported", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::UnsupportedFormat, "WAV: only PCM supported", ctx.resolvedPath.Str()));
         }
         if (channels == 0 || (channels != 1 && channels != 2)) {
             return Base::Result<Core::AnyAsset, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::UnsupportedFormat, "WAV: only mono/stereo supported", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::UnsupportedFormat, "WAV: only mono/stereo supported", ctx.resolvedPath.Str()));
         }
         if (bitsPerSample != 16) {
             return Base::Result<Core::AnyAsset, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::UnsupportedFormat, "WAV: only 16-bit supported", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::UnsupportedFormat, "WAV: only 16-bit supported", ctx.resolvedPath.Str()));
         }
         if (!dataPtr || dataSize == 0) {
             return Base::Result<Core::AnyAsset, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::DecodeFailed, "WAV: missing data chunk", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::DecodeFailed, "WAV: missing data chunk", ctx.resolvedPath.Str()));
         }
         if ((dataSize % 2) != 0) {
             return Base::Result<Core::AnyAsset, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::DecodeFailed, "WAV: data size not aligned", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::DecodeFailed, "WAV: data size not aligned", ctx.resolvedPath.Str()));
         }
 
         const std::size_t sampleCount = dataSize / 2;
@@ -105,4 +105,40 @@ namespace Engine::Asset::Loaders {
         );
     }
 
+    // derived data："sampleRate(u32) channels(u16) pad(u16)" + pcm16（little endian）
+    static constexpr std::size_t kDerivedHeader = 8;
+
+    Base::Result<Base::SharedBuffer, AssetError>
+    SoundLoader::SaveDerived(const Core::AnyAsset& asset, const Loading::LoadContext& ctx) {
+        const SoundAsset* snd = asset.As<SoundAsset>();
+        if (!snd) {
+            return Base::Result<Base::SharedBuffer, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::InternalError, "Sound: derived data expects SoundAsset", ctx.resolvedPath.Str()));
+        }
+
+        const std::size_t pcmBytes = snd->pcm16.size() * sizeof(std::int16_t);
+        std::vector<std::byte> out(kDerivedHeader + pcmBytes);
+        std::memcpy(out.data() + 0, &snd->sampleRate, 4);
+        std::memcpy(out.data() + 4, &snd->channels, 2);
+        if (pcmBytes != 0) std::memcpy(out.data() + kDerivedHeader, snd->pcm16.data(), pcmBytes);
+        return Base::Result<Base::SharedBuffer, AssetError>::Ok(Base::SharedBuffer::FromVector(std::move(out)));
+    }
+
+    Base::Result<Core::AnyAsset, AssetError>
+    SoundLoader::LoadDerived(const Base::SharedBuffer& data, const Loading::LoadContext& ctx) {
+        if (data.size() < kDerivedHeader || ((data.size() - kDerivedHeader) % sizeof(std::int16_t)) != 0) {
+            return Base::Result<Core::AnyAsset, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::DecodeFailed, "Sound: derived data size mismatch", ctx.resolvedPath.Str()));
+        }
+
+        auto snd = std::make_shared<SoundAsset>();
+        std::memcpy(&snd->sampleRate, data.data() + 0, 4);
+        std::memcpy(&snd->channels, data.data() + 4, 2);
+
+        const std::size_t pcmBytes = data.size() - kDerivedHeader;
+        snd->pcm16.resize(pcmBytes / sizeof(std::int16_t));
+        if (pcmBytes != 0) std::memcpy(snd->pcm16.data(), data.data() + kDerivedHeader, pcmBytes);
+        return Base::Result<Core::AnyAsset, AssetError>::Ok(Core::AnyAsset::FromShared<SoundAsset>(std::move(snd)));
+    }
+
 } // namespace Engine::Asset::Loaders
@@ -9,24 +9,25 @@ namespace Engine::Asset::Loaders {
     }
 
     Base::Result<Core::AnyAsset, AssetError>
-    TextLoader::Load(Base::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) {
+    TextLoader::Load(const Base::SharedBuffer& bytes, const Loading::LoadContext& ctx) {
         // 空でもテキストとしてはOKだが、運用によってはエラーにしても良い
         auto txt = std::make_shared<TextAsset>();
 
         if (!bytes.empty()) {
             const char* p = reinterpret_cast<const char*>(bytes.data());
-            std::size_t n = bytes.size();
+            const std::size_t n = bytes.size();
 
-            // UTF-8 BOM を除去
+            // UTF-8 BOM を除去（コピーせず先頭をずらすだけ）
+            std::size_t skip = 0;
             if (n >= 3 &&
                 static_cast<unsigned char>(p[0]) == 0xEF &&
                 static_cast<unsigned char>(p[1]) == 0xBB &&
                 static_cast<unsigned char>(p[2]) == 0xBF) {
-                p += 3;
-                n -= 3;
-                }
+                skip = 3;
+            }
 
-            txt->text.assign(p, p + n);
+            txt->storage = bytes.Slice(skip);
+            txt->text = txt->storage.AsStringView();
         }
 
         (void)ctx;
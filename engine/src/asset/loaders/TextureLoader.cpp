@@ -54,36 +54,36 @@ namespace Engine::Asset::Loaders {
 
         if (end - p < 2) {
             return Base::Result<std::shared_ptr<TextureAsset>, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::DecodeFailed, "PPM: file too small", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::DecodeFailed, "PPM: file too small", ctx.resolvedPath.Str()));
         }
 
         const bool isP6 = (p[0] == 'P' && p[1] == '6');
         const bool isP3 = (p[0] == 'P' && p[1] == '3');
         if (!isP6 && !isP3) {
             return Base::Result<std::shared_ptr<TextureAsset>, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::UnsupportedFormat, "Texture: only PPM(P6/P3) supported (no external decoder)", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::UnsupportedFormat, "Texture: only PPM(P6/P3) supported (no external decoder)", ctx.resolvedPath.Str()));
         }
         p += 2;
 
         int w = 0, h = 0, maxv = 0;
         if (!ReadInt(p, end, w) || !ReadInt(p, end, h) || !ReadInt(p, end, maxv)) {
             return Base::Result<std::shared_ptr<TextureAsset>, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::DecodeFailed, "PPM: header parse failed", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::DecodeFailed, "PPM: header parse failed", ctx.resolvedPath.Str()));
         }
         if (w <= 0 || h <= 0) {
             return Base::Result<std::shared_ptr<TextureAsset>, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::DecodeFailed, "PPM: invalid width/height", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::DecodeFailed, "PPM: invalid width/height", ctx.resolvedPath.Str()));
         }
         if (maxv != 255) {
             return Base::Result<std::shared_ptr<TextureAsset>, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::UnsupportedFormat, "PPM: only maxval=255 supported", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::UnsupportedFormat, "PPM: only maxval=255 supported", ctx.resolvedPath.Str()));
         }
 
         // ヘッダ後の1文字分の空白をスキップ（P6はここからバイナリ）
         p = SkipCommentsAndSpaces(p, end);
         if (p >= end) {
             return Base::Result<std::shared_ptr<TextureAsset>, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::DecodeFailed, "PPM: missing body", ctx.resolvedPath));
+                AssetError::Make(AssetErrorCode::DecodeFailed, "PPM: missing body", ctx.resolvedPath.Str()));
         }
 
         auto tex = std::make_shared<TextureAsset>();
@@ -96,7 +96,7 @@ namespace Engine::Asset::Loaders {
             const std::size_t remain = static_cast<std::size_t>(end - p);
             if (remain < need) {
                 return Base::Result<std::shared_ptr<TextureAsset>, AssetError>::Err(
-                    AssetError::Make(AssetErrorCode::DecodeFailed, "PPM(P6): body too small", ctx.resolvedPath));
+                    AssetError::Make(AssetErrorCode::DecodeFailed, "PPM(P6): body too small", ctx.resolvedPath.Str()));
             }
 
             const unsigned char* src = reinterpret_cast<const unsigned char*>(p);
@@ -118,11 +118,11 @@ namespace Engine::Asset::Loaders {
             int r = 0, g = 0, b = 0;
             if (!ReadInt(p, end, r) || !ReadInt(p, end, g) || !ReadInt(p, end, b)) {
                 return Base::Result<std::shared_ptr<TextureAsset>, AssetError>::Err(
-                    AssetError::Make(AssetErrorCode::DecodeFailed, "PPM(P3): body parse failed", ctx.resolvedPath));
+                    AssetError::Make(AssetErrorCode::DecodeFailed, "PPM(P3): body parse failed", ctx.resolvedPath.Str()));
             }
             if ((unsigned)r > 255 || (unsigned)g > 255 || (unsigned)b > 255) {
                 return Base::Result<std::shared_ptr<TextureAsset>, AssetError>::Err(
-                    AssetError::Make(AssetErrorCode::DecodeFailed, "PPM(P3): color out of range", ctx.resolvedPath));
+                    AssetError::Make(AssetErrorCode::DecodeFailed, "PPM(P3): color out of range", ctx.resolvedPath.Str()));
             }
             tex->rgba[di + 0] = static_cast<std::uint8_t>(r);
             tex->rgba[di + 1] = static_cast<std::uint8_t>(g);
@@ -140,8 +140,8 @@ namespace Engine::Asset::Loaders {
     }
 
     Base::Result<Core::AnyAsset, AssetError>
-    TextureLoader::Load(Base::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) {
-        auto decoded = DecodePPM(bytes, ctx);
+    TextureLoader::Load(const Base::SharedBuffer& bytes, const Loading::LoadContext& ctx) {
+        auto decoded = DecodePPM(bytes.Bytes(), ctx);
         if (!decoded) {
             return Base::Result<Core::AnyAsset, AssetError>::Err(std::move(decoded.error()));
         }
@@ -151,4 +151,43 @@ namespace Engine::Asset::Loaders {
         );
     }
 
+    // derived data："width(u32) height(u32)" + rgba（little endian）
+    static constexpr std::size_t kDerivedHeader = 8;
+
+    Base::Result<Base::SharedBuffer, AssetError>
+    TextureLoader::SaveDerived(const Core::AnyAsset& asset, const Loading::LoadContext& ctx) {
+        const TextureAsset* tex = asset.As<TextureAsset>();
+        if (!tex) {
+            return Base::Result<Base::SharedBuffer, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::InternalError, "Texture: derived data expects TextureAsset", ctx.resolvedPath.Str()));
+        }
+
+        std::vector<std::byte> out(kDerivedHeader + tex->rgba.size());
+        std::memcpy(out.data() + 0, &tex->width, 4);
+        std::memcpy(out.data() + 4, &tex->height, 4);
+        if (!tex->rgba.empty()) std::memcpy(out.data() + kDerivedHeader, tex->rgba.data(), tex->rgba.size());
+        return Base::Result<Base::SharedBuffer, AssetError>::Ok(Base::SharedBuffer::FromVector(std::move(out)));
+    }
+
+    Base::Result<Core::AnyAsset, AssetError>
+    TextureLoader::LoadDerived(const Base::SharedBuffer& data, const Loading::LoadContext& ctx) {
+        if (data.size() < kDerivedHeader) {
+            return Base::Result<Core::AnyAsset, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::DecodeFailed, "Texture: derived data too small", ctx.resolvedPath.Str()));
+        }
+
+        auto tex = std::make_shared<TextureAsset>();
+        std::memcpy(&tex->width, data.data() + 0, 4);
+        std::memcpy(&tex->height, data.data() + 4, 4);
+        const std::size_t need = static_cast<std::size_t>(tex->width) * static_cast<std::size_t>(tex->height) * 4;
+        if (data.size() - kDerivedHeader != need) {
+            return Base::Result<Core::AnyAsset, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::DecodeFailed, "Texture: derived data size mismatch", ctx.resolvedPath.Str()));
+        }
+
+        tex->rgba.resize(need);
+        if (need != 0) std::memcpy(tex->rgba.data(), data.data() + kDerivedHeader, need);
+        return Base::Result<Core::AnyAsset, AssetError>::Ok(Core::AnyAsset::FromShared<TextureAsset>(std::move(tex)));
+    }
+
 } // namespace Engine::Asset::Loaders
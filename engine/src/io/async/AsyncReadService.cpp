@@ -0,0 +1,91 @@
+#include "engine/io/async/AsyncReadService.hpp"
+
+#include <cerrno>
+#include <limits>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "engine/io/async/ThreadPoolReadService.hpp"
+#include "engine/io/async/UringReadService.hpp"
+#include "engine/io/fs/NativeFileStream.hpp"
+
+namespace Engine::IO::Async {
+
+    using Engine::IO::IoErrorCode;
+
+    namespace detail {
+
+        IoResult<std::size_t> PreadFully(int fd, std::uint64_t offset, std::byte* dst, std::size_t bytes,
+                                         const std::string& pathForError) {
+            std::size_t done = 0;
+            while (done < bytes) {
+                const ssize_t n = ::pread(fd, dst + done, bytes - done, static_cast<off_t>(offset + done));
+                if (n < 0) {
+                    if (errno == EINTR) continue;
+                    return IoResult<std::size_t>::Err(FS::detail::IoErrorFromErrno(
+                        errno, IoErrorCode::ReadFailed, "AsyncReadService: pread failed", pathForError));
+                }
+                if (n == 0) break; // EOF
+                done += static_cast<std::size_t>(n);
+            }
+            return IoResult<std::size_t>::Ok(done);
+        }
+
+        IoResult<Base::SharedBuffer> ReadWholeFileBlocking(const std::string& nativePath) {
+            using R = IoResult<Base::SharedBuffer>;
+
+            int fd = -1;
+            do {
+                fd = ::open(nativePath.c_str(), O_RDONLY | O_CLOEXEC);
+            } while (fd < 0 && errno == EINTR);
+            if (fd < 0) {
+                return R::Err(FS::detail::IoErrorFromErrno(
+                    errno, IoErrorCode::OpenFailed, "AsyncReadService: open failed", nativePath));
+            }
+
+            struct stat st {};
+            if (::fstat(fd, &st) != 0) {
+                const int err = errno;
+                ::close(fd);
+                return R::Err(FS::detail::IoErrorFromErrno(
+                    err, IoErrorCode::ReadFailed, "AsyncReadService: fstat failed", nativePath));
+            }
+            if (S_ISDIR(st.st_mode)) {
+                ::close(fd);
+                return R::Err(IoError::Make(IoErrorCode::OpenFailed, "AsyncReadService: path is a directory", nativePath));
+            }
+
+            const auto size = static_cast<std::uint64_t>(st.st_size);
+            if (size > std::numeric_limits<std::size_t>::max()) {
+                ::close(fd);
+                return R::Err(IoError::Make(IoErrorCode::ReadFailed, "AsyncReadService: file too large", nativePath));
+            }
+
+            auto buf = UninitBuffer::Allocate(static_cast<std::size_t>(size));
+            auto n = PreadFully(fd, 0, buf.data(), buf.size, nativePath);
+            ::close(fd);
+            if (!n) return R::Err(std::move(n.error()));
+
+            // stat 後に縮んだ場合は読めた分だけ返す
+            return R::Ok(buf.Share(n.value()));
+        }
+
+    } // namespace detail
+
+    std::unique_ptr<AsyncReadService> AsyncReadService::Create() {
+        return Create(Options{});
+    }
+
+    std::unique_ptr<AsyncReadService> AsyncReadService::Create(const Options& opt) {
+        if (opt.backend != Backend::ThreadPool) {
+            if (auto ring = UringReadService::TryCreate(opt.queueDepth)) {
+                return ring;
+            }
+            // IoUring 指定でも使えなければ fallback（seccomp / 古いカーネル等で普通に起きる）
+        }
+        return std::make_unique<ThreadPoolReadService>(opt.threads);
+    }
+
+} // namespace Engine::IO::Async
@@ -0,0 +1,196 @@
+#include "engine/io/async/AsyncWriteService.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+#include <utility>
+
+#include "engine/io/stream/FileOpenMode.hpp"
+#include "engine/io/stream/IStream.hpp"
+
+namespace Engine::IO::Async {
+
+    using Engine::IO::Path::Uri;
+
+    namespace {
+
+        constexpr std::string_view kTempSuffix = ".tmp~";
+
+        IoResultVoid WriteAll(Engine::IO::Stream::IStream& s, const Base::SharedBuffer& data) {
+            std::size_t offset = 0;
+            while (offset < data.size()) {
+                auto wr = s.Write(data.data() + offset, data.size() - offset);
+                if (!wr) return IoResultVoid::Err(wr.error());
+                if (wr.value() == 0) {
+                    return IoResultVoid::Err(IoError::Make(IoErrorCode::WriteFailed, "AsyncWriteService: zero write"));
+                }
+                offset += wr.value();
+            }
+            return IoResultVoid::Ok();
+        }
+
+    } // namespace
+
+    AsyncWriteService::AsyncWriteService(std::shared_ptr<Engine::IO::FS::IFileSystem> fs)
+        : AsyncWriteService(std::move(fs), Options{}) {}
+
+    AsyncWriteService::AsyncWriteService(std::shared_ptr<Engine::IO::FS::IFileSystem> fs, const Options& opt)
+        : fs_(std::move(fs)), opt_(opt) {
+        if (opt_.maxBatchFiles == 0) opt_.maxBatchFiles = 1;
+        writer_ = std::thread([this] { WriterLoop_(); });
+    }
+
+    AsyncWriteService::~AsyncWriteService() {
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        if (writer_.joinable()) writer_.join();
+    }
+
+    void AsyncWriteService::Submit(const Uri& uri, Base::SharedBuffer data, WriteCompletion completion) {
+        std::string key = uri.ToString();
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            ++stats_.submitted;
+
+            auto it = pending_.find(key);
+            if (it != pending_.end()) {
+                // まだ書いていない：中身だけ差し替える（書くのは最後の 1 回）
+                it->second.data = std::move(data);
+                if (completion) it->second.completions.push_back(std::move(completion));
+                ++stats_.coalesced;
+                return;
+            }
+
+            Pending p;
+            p.uri = uri;
+            p.data = std::move(data);
+            if (completion) p.completions.push_back(std::move(completion));
+            order_.push_back(key);
+            pending_.emplace(std::move(key), std::move(p));
+        }
+        cv_.notify_one();
+    }
+
+    void AsyncWriteService::Flush() {
+        std::unique_lock<std::mutex> lk(mutex_);
+        idleCv_.wait(lk, [&] { return pending_.empty() && inFlight_ == 0; });
+    }
+
+    AsyncWriteStats AsyncWriteService::Stats() const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return stats_;
+    }
+
+    void AsyncWriteService::WriterLoop_() {
+        std::vector<Pending> batch;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lk(mutex_);
+                cv_.wait(lk, [&] { return stop_ || !order_.empty(); });
+                // stop でも積まれている分は書き切る
+                if (order_.empty()) return;
+
+                batch.clear();
+                while (!order_.empty() && batch.size() < opt_.maxBatchFiles) {
+                    auto it = pending_.find(order_.front());
+                    order_.pop_front();
+                    batch.push_back(std::move(it->second));
+                    pending_.erase(it);
+                }
+                inFlight_ = batch.size();
+                ++stats_.batches;
+            }
+
+            WriteBatch_(batch);
+
+            {
+                std::lock_guard<std::mutex> lk(mutex_);
+                inFlight_ = 0;
+            }
+            idleCv_.notify_all();
+        }
+    }
+
+    void AsyncWriteService::WriteBatch_(std::vector<Pending>& batch) {
+        using Engine::IO::Stream::FileOpenMode;
+        const FileOpenMode mode = FileOpenMode::Write | FileOpenMode::Binary |
+                                  FileOpenMode::Truncate | FileOpenMode::CreateIfMissing;
+
+        struct Slot final {
+            Uri target;
+            Uri written; // atomicReplace なら一時ファイル
+            std::unique_ptr<Engine::IO::Stream::IStream> stream;
+            IoResultVoid result = IoResultVoid::Ok();
+        };
+        std::vector<Slot> slots(batch.size());
+        std::uint64_t fileSyncs = 0;
+        std::uint64_t dirSyncs = 0;
+
+        // 1) 全部書く（Sync はまだ）
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            Slot& s = slots[i];
+            s.target = batch[i].uri;
+            s.written = opt_.atomicReplace ? Engine::IO::Path::SiblingUri(s.target, kTempSuffix) : s.target;
+
+            auto orr = fs_->Open(s.written, mode);
+            if (!orr) {
+                s.result = IoResultVoid::Err(orr.error());
+                continue;
+            }
+            s.stream = std::move(orr.value());
+            s.result = WriteAll(*s.stream, batch[i].data);
+        }
+
+        // 2) まとめて Sync してから閉じる（fdatasync を続けて出す）
+        for (Slot& s : slots) {
+            if (!s.stream) continue;
+            if (s.result && opt_.sync) {
+                s.result = s.stream->Sync();
+                ++fileSyncs;
+            }
+            auto cr = s.stream->Close();
+            if (s.result && !cr) s.result = IoResultVoid::Err(cr.error());
+            s.stream.reset();
+        }
+
+        // 3) 置き換え（失敗した一時ファイルは消す）
+        if (opt_.atomicReplace) {
+            for (Slot& s : slots) {
+                if (s.result) {
+                    s.result = fs_->Move(s.written, s.target);
+                }
+                if (!s.result) (void)fs_->Remove(s.written);
+            }
+        }
+
+        // 4) 親ディレクトリの entry を永続化（batch 内で 1 回ずつ）
+        if (opt_.sync) {
+            std::unordered_set<std::string> dirs;
+            for (Slot& s : slots) {
+                if (!s.result) continue;
+                const Uri parent = Engine::IO::Path::ParentUri(s.target);
+                if (!dirs.insert(parent.ToString()).second) continue;
+                ++dirSyncs;
+                auto dr = fs_->SyncDirectory(parent);
+                if (!dr) s.result = IoResultVoid::Err(dr.error());
+            }
+        }
+
+        std::uint64_t failures = 0;
+        for (const Slot& s : slots) failures += s.result ? 0 : 1;
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            stats_.files += slots.size();
+            stats_.fileSyncs += fileSyncs;
+            stats_.dirSyncs += dirSyncs;
+            stats_.failures += failures;
+        }
+
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            for (auto& c : batch[i].completions) c(slots[i].result);
+        }
+    }
+
+} // namespace Engine::IO::Async
@@ -0,0 +1,76 @@
+#include "engine/io/async/IoWorkerPool.hpp"
+
+#include <algorithm>
+
+namespace Engine::IO::Async {
+
+    namespace {
+        thread_local IoWorkerPool* tlsCurrent = nullptr;
+    } // namespace
+
+    const std::shared_ptr<IoWorkerPool>& IoWorkerPool::Shared() {
+        static const std::shared_ptr<IoWorkerPool> pool = [] {
+            const std::size_t hw = std::thread::hardware_concurrency();
+            return std::make_shared<IoWorkerPool>(std::clamp<std::size_t>(hw, 2, 8));
+        }();
+        return pool;
+    }
+
+    IoWorkerPool::IoWorkerPool(std::size_t threads) {
+        threads = std::max<std::size_t>(threads, 1);
+        workers_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers_.emplace_back([this] { WorkerLoop_(); });
+        }
+    }
+
+    IoWorkerPool::~IoWorkerPool() {
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& t : workers_) {
+            if (t.joinable()) t.join();
+        }
+    }
+
+    void IoWorkerPool::Submit(std::function<void()> job) {
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            jobs_.push_back(std::move(job));
+        }
+        cv_.notify_one();
+    }
+
+    bool IoWorkerPool::RunOne() {
+        std::function<void()> job;
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            if (jobs_.empty()) return false;
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+        job();
+        return true;
+    }
+
+    IoWorkerPool* IoWorkerPool::Current() noexcept { return tlsCurrent; }
+
+    void IoWorkerPool::WorkerLoop_() {
+        tlsCurrent = this;
+        for (;;) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lk(mutex_);
+                cv_.wait(lk, [&] { return stop_ || !jobs_.empty(); });
+                // stop 時も積まれている仕事は流し切る（completion を呼ばずに捨てない）
+                if (jobs_.empty()) return;
+                job = std::move(jobs_.front());
+                jobs_.pop_front();
+            }
+            job();
+        }
+    }
+
+} // namespace Engine::IO::Async
@@ -0,0 +1,126 @@
+#include "engine/io/async/ThreadPoolReadService.hpp"
+
+#include <algorithm>
+
+namespace Engine::IO::Async {
+
+    ThreadPoolReadService::ThreadPoolReadService(std::size_t threads) {
+        if (threads == 0) threads = std::thread::hardware_concurrency();
+        // I/O 待ちが主なので CPU 数より多くてよい。最低 2
+        threads = std::max<std::size_t>(threads, 2);
+
+        workers_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers_.emplace_back([this] { WorkerMain_(); });
+        }
+    }
+
+    ThreadPoolReadService::~ThreadPoolReadService() {
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& t : workers_) {
+            if (t.joinable()) t.join();
+        }
+    }
+
+    void ThreadPoolReadService::Drain_(const std::function<void(std::size_t)>& fn, std::size_t count) {
+        std::size_t local = 0;
+        for (;;) {
+            const std::size_t i = next_.fetch_add(1, std::memory_order_relaxed);
+            if (i >= count) break;
+            fn(i);
+            ++local;
+        }
+        if (local == 0) return;
+
+        std::lock_guard<std::mutex> lk(mtx_);
+        finished_ += local;
+        if (finished_ == count) done_.notify_all();
+    }
+
+    void ThreadPoolReadService::WorkerMain_() {
+        std::uint64_t seen = 0;
+        for (;;) {
+            const std::function<void(std::size_t)>* job = nullptr;
+            std::size_t count = 0;
+            {
+                std::unique_lock<std::mutex> lk(mtx_);
+                wake_.wait(lk, [&] { return stop_ || batchId_ != seen; });
+                if (stop_) return;
+                seen = batchId_;
+                // 起きるのが遅れてバッチが終わっていたら触らない（next_ は次のバッチのもの）
+                if (job_ == nullptr) continue;
+                job = job_;
+                count = jobCount_;
+                ++active_;
+            }
+            Drain_(*job, count);
+            {
+                std::lock_guard<std::mutex> lk(mtx_);
+                if (--active_ == 0) done_.notify_all();
+            }
+        }
+    }
+
+    void ThreadPoolReadService::RunBatch_(std::size_t count, const std::function<void(std::size_t)>& fn) {
+        if (count == 0) return;
+
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            job_ = &fn;
+            jobCount_ = count;
+            finished_ = 0;
+            next_.store(0, std::memory_order_relaxed);
+            ++batchId_;
+        }
+        if (count > 1) wake_.notify_all();
+
+        Drain_(fn, count);
+
+        // 全件の完了に加え、起きた worker が job_ を触り終えるまで待つ
+        std::unique_lock<std::mutex> lk(mtx_);
+        done_.wait(lk, [&] { return finished_ == jobCount_ && active_ == 0; });
+        job_ = nullptr;
+        jobCount_ = 0;
+    }
+
+    void ThreadPoolReadService::ReadFiles(Base::ConstSpan<std::string> nativePaths,
+                                          std::vector<IoResult<Base::SharedBuffer>>& out) {
+        out.clear();
+        out.reserve(nativePaths.size());
+        for (std::size_t i = 0; i < nativePaths.size(); ++i) {
+            out.push_back(IoResult<Base::SharedBuffer>::Ok(Base::SharedBuffer{}));
+        }
+
+        const std::function<void(std::size_t)> fn = [&](std::size_t i) {
+            out[i] = detail::ReadWholeFileBlocking(nativePaths[i]);
+        };
+        RunBatch_(nativePaths.size(), fn);
+
+        stats_.batches += 1;
+        stats_.requests += nativePaths.size();
+    }
+
+    void ThreadPoolReadService::ReadAt(Base::ConstSpan<ReadAtRequest> requests,
+                                       std::vector<IoResult<std::size_t>>& out) {
+        out.clear();
+        out.reserve(requests.size());
+        for (std::size_t i = 0; i < requests.size(); ++i) {
+            out.push_back(IoResult<std::size_t>::Ok(0));
+        }
+
+        static const std::string kNoPath = "<fd>";
+        const std::function<void(std::size_t)> fn = [&](std::size_t i) {
+            const ReadAtRequest& r = requests[i];
+            out[i] = detail::PreadFully(r.fd, r.offset, r.dst, r.bytes, kNoPath);
+        };
+        RunBatch_(requests.size(), fn);
+
+        stats_.batches += 1;
+        stats_.requests += requests.size();
+    }
+
+} // namespace Engine::IO::Async
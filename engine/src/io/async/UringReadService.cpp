@@ -0,0 +1,556 @@
+#include "engine/io/async/UringReadService.hpp"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define ENGINE_IO_HAS_URING 1
+#else
+#define ENGINE_IO_HAS_URING 0
+#endif
+
+#if ENGINE_IO_HAS_URING
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "engine/io/fs/NativeFileStream.hpp"
+#endif
+
+namespace Engine::IO::Async {
+
+#if ENGINE_IO_HAS_URING
+
+    using Engine::IO::IoErrorCode;
+
+    namespace {
+        int SysSetup(unsigned entries, io_uring_params* p) noexcept {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+        }
+        int SysEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) noexcept {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+        }
+        int SysRegister(int fd, unsigned op, void* arg, unsigned nr) noexcept {
+            return static_cast<int>(::syscall(__NR_io_uring_register, fd, op, arg, nr));
+        }
+
+        // user_data の上位 8bit が種別、下位が要求 index
+        enum class OpKind : std::uint64_t { Open = 1, Stat = 2, Read = 3, Close = 4 };
+
+        constexpr std::uint64_t MakeTag(OpKind k, std::size_t index) noexcept {
+            return (static_cast<std::uint64_t>(k) << 56) | static_cast<std::uint64_t>(index);
+        }
+        constexpr OpKind TagKind(std::uint64_t tag) noexcept { return static_cast<OpKind>(tag >> 56); }
+        constexpr std::size_t TagIndex(std::uint64_t tag) noexcept {
+            return static_cast<std::size_t>(tag & ((std::uint64_t(1) << 56) - 1));
+        }
+
+        // 1 回の READ の上限（sqe->len は 32bit。これを超えるファイルは blocking で読む）
+        constexpr std::uint64_t kMaxRingFileBytes = std::uint64_t(1) << 30;
+
+        // 1 ファイルにつき同時に積む SQE 数の上限（OPENAT + STATX + 前チャンクの CLOSE）
+        constexpr std::uint32_t kSqePerFile = 4;
+
+        // enter が壊れたあと、カーネルが受け取った分の完了を待つ上限
+        constexpr std::chrono::milliseconds kDrainTimeout{ 200 };
+    } // namespace
+
+    // ---- 最小限のリング（SQ は本スレッドのみが生産者、CQ は本スレッドのみが消費者） ----
+    struct UringReadService::Ring {
+        int fd = -1;
+
+        void* sqMap = nullptr;
+        std::size_t sqMapSize = 0;
+        void* cqMap = nullptr;
+        std::size_t cqMapSize = 0;
+        io_uring_sqe* sqes = nullptr;
+        std::size_t sqesSize = 0;
+
+        unsigned* sqHead = nullptr;
+        unsigned* sqTail = nullptr;
+        unsigned* sqArray = nullptr;
+        unsigned sqMask = 0;
+        unsigned sqEntries = 0;
+
+        unsigned* cqHead = nullptr;
+        unsigned* cqTail = nullptr;
+        io_uring_cqe* cqes = nullptr;
+        unsigned cqMask = 0;
+
+        unsigned localTail = 0;   // 未公開分を含む SQ tail
+        unsigned unsubmitted = 0; // 公開済みだが enter で渡していない数
+        bool broken = false;      // enter が回復不能なエラーを返した
+        unsigned lost = 0;        // broken 時に完了を回収できなかった SQE 数（0 なら後始末は確実）
+
+        ~Ring() {
+            if (sqes) ::munmap(sqes, sqesSize);
+            if (cqMap && cqMap != sqMap) ::munmap(cqMap, cqMapSize);
+            if (sqMap) ::munmap(sqMap, sqMapSize);
+            if (fd >= 0) ::close(fd);
+        }
+
+        bool Init(unsigned entries) {
+            io_uring_params p{};
+            fd = SysSetup(entries, &p);
+            if (fd < 0) return false;
+
+            sqMapSize = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+            cqMapSize = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+            const bool single = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (single) sqMapSize = cqMapSize = std::max(sqMapSize, cqMapSize);
+
+            sqMap = ::mmap(nullptr, sqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+            if (sqMap == MAP_FAILED) { sqMap = nullptr; return false; }
+            if (single) {
+                cqMap = sqMap;
+            } else {
+                cqMap = ::mmap(nullptr, cqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+                if (cqMap == MAP_FAILED) { cqMap = nullptr; return false; }
+            }
+            sqesSize = p.sq_entries * sizeof(io_uring_sqe);
+            void* s = ::mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+            if (s == MAP_FAILED) return false;
+            sqes = static_cast<io_uring_sqe*>(s);
+
+            auto* sq = static_cast<char*>(sqMap);
+            sqHead = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+            sqTail = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+            sqArray = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+            sqMask = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+            sqEntries = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_entries);
+
+            auto* cq = static_cast<char*>(cqMap);
+            cqHead = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+            cqTail = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+            cqes = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+            cqMask = *reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+
+            localTail = *sqTail;
+            return true;
+        }
+
+        bool Supports(std::initializer_list<unsigned> ops) {
+            const std::size_t bytes = sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op);
+            std::vector<std::byte> storage(bytes);
+            auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+            if (SysRegister(fd, IORING_REGISTER_PROBE, probe, 256) < 0) return false;
+            for (unsigned op : ops) {
+                if (op > probe->last_op) return false;
+                if ((probe->ops[op].flags & IO_URING_OP_SUPPORTED) == 0) return false;
+            }
+            return true;
+        }
+
+        // 空きが無ければ nullptr（呼び出し側で SQE 数を容量内に抑えている前提）
+        io_uring_sqe* NextSqe(std::uint64_t tag) noexcept {
+            const unsigned head = __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+            if (localTail - head >= sqEntries) return nullptr;
+            const unsigned idx = localTail & sqMask;
+            io_uring_sqe* sqe = &sqes[idx];
+            std::memset(sqe, 0, sizeof(*sqe));
+            sqe->user_data = tag;
+            sqArray[idx] = idx;
+            ++localTail;
+            return sqe;
+        }
+
+        void Publish() noexcept {
+            const unsigned published = *sqTail;
+            if (published == localTail) return;
+            unsubmitted += localTail - published;
+            __atomic_store_n(sqTail, localTail, __ATOMIC_RELEASE);
+        }
+
+        // 溜まっている CQE を fn(tag, res) で消化する。戻り値は消化数
+        template<class Fn>
+        unsigned Reap(Fn&& fn) {
+            unsigned head = *cqHead;
+            const unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+            unsigned n = 0;
+            while (head != tail) {
+                const io_uring_cqe& c = cqes[head & cqMask];
+                fn(c.user_data, c.res);
+                ++head;
+                ++n;
+            }
+            __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+            return n;
+        }
+
+        // 公開済み SQE を投入し、expected 件の CQE を消化し終えるまで待つ
+        // 戻り値 false：リングが使えなくなった（以降は blocking fallback）
+        template<class Fn>
+        bool SubmitAndWait(unsigned expected, AsyncReadStats& stats, Fn&& fn) {
+            Publish();
+            unsigned reaped = Reap(fn);
+            while (reaped < expected || unsubmitted > 0) {
+                const unsigned want = reaped < expected ? expected - reaped : 0;
+                const int r = SysEnter(fd, unsubmitted, want, want > 0 ? IORING_ENTER_GETEVENTS : 0);
+                ++stats.kernelSubmits;
+                if (r < 0) {
+                    const int err = errno;
+                    if (err == EINTR || err == EAGAIN || err == EBUSY) {
+                        reaped += Reap(fn);
+                        continue;
+                    }
+                    broken = true;
+                    Drain_(expected > reaped ? expected - reaped : 0, fn);
+                    return false;
+                }
+                unsubmitted -= std::min<unsigned>(unsubmitted, static_cast<unsigned>(r));
+                reaped += Reap(fn);
+            }
+            return true;
+        }
+
+        // enter が使えなくなった後始末：カーネルが受け取った SQE の完了を CQ から直接拾う
+        // （OPENAT が返した fd を呼び出し側が閉じられるように / READ の書き込み先を手放す前に）
+        // 受け取られていない SQE はもう投入されないので待たない。拾えなかった数は lost に残す
+        template<class Fn>
+        void Drain_(unsigned left, Fn&& fn) {
+            const unsigned notTaken = localTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+            unsigned inflight = left - std::min(left, notTaken);
+
+            const auto deadline = std::chrono::steady_clock::now() + kDrainTimeout;
+            while (inflight > 0 && std::chrono::steady_clock::now() < deadline) {
+                const unsigned n = Reap(fn);
+                inflight -= std::min(inflight, n);
+                if (n == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            lost += inflight;
+        }
+    };
+
+    namespace {
+        // ReadFiles の 1 ファイル分の状態
+        struct FileSlot final {
+            int fd = -1;
+            int openErr = 0;
+            int statErr = 0;
+            struct statx stx {};
+            detail::UninitBuffer buf;
+            std::uint64_t done = 0;
+            int readErr = 0;
+            bool reading = false; // READ を積んだ（EOF/エラー/完了で false）
+        };
+
+        IoError ErrFromRes(int res, IoErrorCode fallback, const char* msg, const std::string& path) {
+            return FS::detail::IoErrorFromErrno(-res, fallback, msg, path);
+        }
+    } // namespace
+
+    std::unique_ptr<UringReadService> UringReadService::TryCreate(std::uint32_t queueDepth) {
+        queueDepth = std::clamp<std::uint32_t>(queueDepth, 1, 4096);
+
+        auto ring = std::make_unique<Ring>();
+        if (!ring->Init(queueDepth * kSqePerFile)) return nullptr;
+        if (!ring->Supports({ IORING_OP_OPENAT, IORING_OP_STATX, IORING_OP_READ, IORING_OP_CLOSE })) return nullptr;
+
+        // リングが queueDepth 分の SQE を受けられない（entries が丸められた等）なら深さを合わせる
+        const std::uint32_t depth = std::max<std::uint32_t>(1, std::min<std::uint32_t>(queueDepth, ring->sqEntries / kSqePerFile));
+        return std::make_unique<UringReadService>(std::move(ring), depth);
+    }
+
+    UringReadService::UringReadService(std::unique_ptr<Ring> ring, std::uint32_t queueDepth)
+        : ring_(std::move(ring)), queueDepth_(queueDepth) {}
+
+    UringReadService::~UringReadService() = default;
+
+    void UringReadService::ReadFiles(Base::ConstSpan<std::string> nativePaths,
+                                     std::vector<IoResult<Base::SharedBuffer>>& out) {
+        using R = IoResult<Base::SharedBuffer>;
+
+        out.clear();
+        out.reserve(nativePaths.size());
+        for (std::size_t i = 0; i < nativePaths.size(); ++i) out.push_back(R::Ok(Base::SharedBuffer{}));
+
+        stats_.batches += 1;
+        stats_.requests += nativePaths.size();
+
+        Ring& ring = *ring_;
+        std::vector<FileSlot> slots;
+        std::vector<int> pendingClose; // 前チャンクで開いた fd（次の投入に相乗りさせる）
+        std::vector<int> closing;      // CLOSE を積んだ fd（CQE が来たら -1）
+
+        const auto queueClose = [&](unsigned& expected) {
+            closing.clear();
+            for (int fd : pendingClose) {
+                io_uring_sqe* sqe = ring.NextSqe(MakeTag(OpKind::Close, closing.size()));
+                if (!sqe) { ::close(fd); continue; }
+                sqe->opcode = IORING_OP_CLOSE;
+                sqe->fd = fd;
+                closing.push_back(fd);
+                ++expected;
+            }
+            pendingClose.clear();
+        };
+
+        // リングが壊れた投入の後始末：CQE が来なかった CLOSE は自分で閉じる
+        // （回収できなかった完了があると、どの CLOSE がカーネルで走ったか分からない。
+        //   二重 close で別の fd を閉じるよりは残す）
+        const auto closeUnfinished = [&] {
+            if (ring.lost == 0) {
+                for (int fd : closing) {
+                    if (fd >= 0) ::close(fd);
+                }
+            }
+            closing.clear();
+        };
+
+        for (std::size_t base = 0; base < nativePaths.size(); base += queueDepth_) {
+            const std::size_t count = std::min<std::size_t>(queueDepth_, nativePaths.size() - base);
+
+            if (ring.broken) {
+                for (int fd : pendingClose) ::close(fd);
+                pendingClose.clear();
+                for (std::size_t i = 0; i < count; ++i) out[base + i] = detail::ReadWholeFileBlocking(nativePaths[base + i]);
+                continue;
+            }
+
+            slots.clear();
+            slots.resize(count);
+
+            // ---- 1 往復目：OPENAT + STATX（+ 前チャンクの CLOSE） ----
+            unsigned expected = 0;
+            queueClose(expected);
+            for (std::size_t i = 0; i < count; ++i) {
+                const char* path = nativePaths[base + i].c_str();
+
+                io_uring_sqe* o = ring.NextSqe(MakeTag(OpKind::Open, i));
+                o->opcode = IORING_OP_OPENAT;
+                o->fd = AT_FDCWD;
+                o->addr = reinterpret_cast<std::uint64_t>(path);
+                o->open_flags = O_RDONLY | O_CLOEXEC;
+
+                io_uring_sqe* s = ring.NextSqe(MakeTag(OpKind::Stat, i));
+                s->opcode = IORING_OP_STATX;
+                s->fd = AT_FDCWD;
+                s->addr = reinterpret_cast<std::uint64_t>(path);
+                s->len = STATX_TYPE | STATX_SIZE;
+                s->off = reinterpret_cast<std::uint64_t>(&slots[i].stx);
+                expected += 2;
+            }
+
+            const bool ok1 = ring.SubmitAndWait(expected, stats_, [&](std::uint64_t tag, int res) {
+                const std::size_t i = TagIndex(tag);
+                switch (TagKind(tag)) {
+                case OpKind::Open:
+                    if (res >= 0) slots[i].fd = res; else slots[i].openErr = res;
+                    break;
+                case OpKind::Stat:
+                    if (res < 0) slots[i].statErr = res;
+                    break;
+                case OpKind::Close:
+                    closing[i] = -1; // 結果（失敗でも fd は手放されている）は見ない
+                    break;
+                default:
+                    break;
+                }
+            });
+            if (!ok1) {
+                // 途中状態は信用できないので、このチャンクは丸ごと blocking でやり直す
+                // 完了まで拾えた OPENAT の fd はここで閉じる（SubmitAndWait が受け取り済みの分を回収している）
+                for (FileSlot& s : slots) {
+                    if (s.fd >= 0) ::close(s.fd);
+                    s.fd = -1;
+                }
+                closeUnfinished();
+                for (std::size_t i = 0; i < count; ++i) out[base + i] = detail::ReadWholeFileBlocking(nativePaths[base + i]);
+                continue;
+            }
+
+            // ---- 2 往復目：READ ----
+            // open 成功・stat 失敗の組み合わせは競合（直後に消された等）。fd があるなら fstat で確かめる
+            for (std::size_t i = 0; i < count; ++i) {
+                FileSlot& s = slots[i];
+                const std::string& path = nativePaths[base + i];
+                if (s.fd < 0) {
+                    out[base + i] = R::Err(ErrFromRes(s.openErr, IoErrorCode::OpenFailed, "AsyncReadService: open failed", path));
+                    continue;
+                }
+                pendingClose.push_back(s.fd);
+
+                std::uint64_t size = 0;
+                bool isDir = false;
+                if (s.statErr == 0) {
+                    size = s.stx.stx_size;
+                    isDir = S_ISDIR(s.stx.stx_mode);
+                } else {
+                    struct stat st {};
+                    if (::fstat(s.fd, &st) != 0) {
+                        out[base + i] = R::Err(FS::detail::IoErrorFromErrno(errno, IoErrorCode::ReadFailed, "AsyncReadService: fstat failed", path));
+                        s.fd = -1;
+                        continue;
+                    }
+                    size = static_cast<std::uint64_t>(st.st_size);
+                    isDir = S_ISDIR(st.st_mode);
+                }
+
+                if (isDir) {
+                    out[base + i] = R::Err(IoError::Make(IoErrorCode::OpenFailed, "AsyncReadService: path is a directory", path));
+                    s.fd = -1;
+                    continue;
+                }
+                if (size >= kMaxRingFileBytes) {
+                    // 巨大ファイルはリングを占有させずにその場で読む
+                    auto buf = detail::UninitBuffer::Allocate(static_cast<std::size_t>(size));
+                    auto n = detail::PreadFully(s.fd, 0, buf.data(), buf.size, path);
+                    out[base + i] = n ? R::Ok(buf.Share(n.value())) : R::Err(std::move(n.error()));
+                    s.fd = -1;
+                    continue;
+                }
+                s.buf = detail::UninitBuffer::Allocate(static_cast<std::size_t>(size));
+                s.reading = size > 0;
+            }
+
+            // short read は残りを再投入する（通常ファイルではまず起きないが、途中で伸縮した場合など）
+            bool ok2 = true;
+            for (;;) {
+                unsigned issued = 0;
+                for (std::size_t i = 0; i < count; ++i) {
+                    FileSlot& s = slots[i];
+                    if (s.fd < 0 || !s.reading) continue;
+                    io_uring_sqe* r = ring.NextSqe(MakeTag(OpKind::Read, i));
+                    if (!r) break; // 残りは次の周回
+                    r->opcode = IORING_OP_READ;
+                    r->fd = s.fd;
+                    r->addr = reinterpret_cast<std::uint64_t>(s.buf.data() + s.done);
+                    r->len = static_cast<std::uint32_t>(s.buf.size - s.done);
+                    r->off = s.done;
+                    ++issued;
+                }
+                if (issued == 0) break;
+
+                ok2 = ring.SubmitAndWait(issued, stats_, [&](std::uint64_t tag, int res) {
+                    FileSlot& s = slots[TagIndex(tag)];
+                    if (res == -EINTR || res == -EAGAIN) return; // 再投入
+                    if (res < 0) { s.readErr = res; s.reading = false; return; }
+                    if (res == 0) { s.reading = false; return; } // stat 後に縮んだ
+                    s.done += static_cast<std::uint64_t>(res);
+                    if (s.done >= s.buf.size) s.reading = false;
+                });
+                if (!ok2) break;
+            }
+
+            for (std::size_t i = 0; i < count; ++i) {
+                FileSlot& s = slots[i];
+                if (s.fd < 0) continue; // 結果は確定済み
+                const std::string& path = nativePaths[base + i];
+                if (!ok2 && s.reading) {
+                    auto n = detail::PreadFully(s.fd, 0, s.buf.data(), s.buf.size, path);
+                    out[base + i] = n ? R::Ok(s.buf.Share(n.value())) : R::Err(std::move(n.error()));
+                    continue;
+                }
+                if (s.readErr != 0) {
+                    out[base + i] = R::Err(ErrFromRes(s.readErr, IoErrorCode::ReadFailed, "AsyncReadService: read failed", path));
+                    continue;
+                }
+                out[base + i] = R::Ok(s.buf.Share(static_cast<std::size_t>(s.done)));
+            }
+        }
+
+        // 最後のチャンクの CLOSE（戻る前に fd を解放しておく）
+        if (!pendingClose.empty()) {
+            if (ring.broken) {
+                for (int fd : pendingClose) ::close(fd);
+                pendingClose.clear();
+            } else {
+                unsigned expected = 0;
+                queueClose(expected);
+                const bool ok = ring.SubmitAndWait(expected, stats_, [&](std::uint64_t tag, int) {
+                    if (TagKind(tag) == OpKind::Close) closing[TagIndex(tag)] = -1;
+                });
+                if (!ok) closeUnfinished();
+            }
+        }
+    }
+
+    void UringReadService::ReadAt(Base::ConstSpan<ReadAtRequest> requests,
+                                  std::vector<IoResult<std::size_t>>& out) {
+        using R = IoResult<std::size_t>;
+        static const std::string kNoPath = "<fd>";
+
+        out.clear();
+        out.reserve(requests.size());
+        for (std::size_t i = 0; i < requests.size(); ++i) out.push_back(R::Ok(0));
+
+        stats_.batches += 1;
+        stats_.requests += requests.size();
+
+        Ring& ring = *ring_;
+        std::vector<std::size_t> done(requests.size(), 0);
+        std::vector<int> err(requests.size(), 0);
+        std::vector<std::uint8_t> active(requests.size(), 0);
+
+        const std::size_t perRound = static_cast<std::size_t>(queueDepth_) * kSqePerFile;
+        for (std::size_t base = 0; base < requests.size(); base += perRound) {
+            const std::size_t end = std::min(requests.size(), base + perRound);
+            for (std::size_t i = base; i < end; ++i) {
+                active[i] = requests[i].bytes > 0 ? 1 : 0;
+            }
+
+            bool ok = !ring.broken;
+            while (ok) {
+                unsigned issued = 0;
+                for (std::size_t i = base; i < end; ++i) {
+                    if (!active[i]) continue;
+                    const ReadAtRequest& q = requests[i];
+                    io_uring_sqe* r = ring.NextSqe(MakeTag(OpKind::Read, i));
+                    if (!r) break;
+                    r->opcode = IORING_OP_READ;
+                    r->fd = q.fd;
+                    r->addr = reinterpret_cast<std::uint64_t>(q.dst + done[i]);
+                    r->len = static_cast<std::uint32_t>(std::min<std::uint64_t>(q.bytes - done[i], kMaxRingFileBytes));
+                    r->off = q.offset + done[i];
+                    ++issued;
+                }
+                if (issued == 0) break;
+
+                ok = ring.SubmitAndWait(issued, stats_, [&](std::uint64_t tag, int res) {
+                    const std::size_t i = TagIndex(tag);
+                    if (res == -EINTR || res == -EAGAIN) return;
+                    if (res < 0) { err[i] = res; active[i] = 0; return; }
+                    if (res == 0) { active[i] = 0; return; } // EOF
+                    done[i] += static_cast<std::size_t>(res);
+                    if (done[i] >= requests[i].bytes) active[i] = 0;
+                });
+            }
+
+            for (std::size_t i = base; i < end; ++i) {
+                const ReadAtRequest& q = requests[i];
+                if (active[i]) {
+                    // リングが壊れた：残りを blocking で
+                    auto n = detail::PreadFully(q.fd, q.offset + done[i], q.dst + done[i], q.bytes - done[i], kNoPath);
+                    out[i] = n ? R::Ok(done[i] + n.value()) : R::Err(std::move(n.error()));
+                    continue;
+                }
+                out[i] = err[i] != 0
+                    ? R::Err(ErrFromRes(err[i], IoErrorCode::ReadFailed, "AsyncReadService: read failed", kNoPath))
+                    : R::Ok(done[i]);
+            }
+        }
+    }
+
+#else // !ENGINE_IO_HAS_URING
+
+    struct UringReadService::Ring {};
+
+    std::unique_ptr<UringReadService> UringReadService::TryCreate(std::uint32_t) { return nullptr; }
+
+    UringReadService::UringReadService(std::unique_ptr<Ring> ring, std::uint32_t queueDepth)
+        : ring_(std::move(ring)), queueDepth_(queueDepth) {}
+
+    UringReadService::~UringReadService() = default;
+
+    void UringReadService::ReadFiles(Base::ConstSpan<std::string>, std::vector<IoResult<Base::SharedBuffer>>& out) { out.clear(); }
+    void UringReadService::ReadAt(Base::ConstSpan<ReadAtRequest>, std::vector<IoResult<std::size_t>>& out) { out.clear(); }
+
+#endif
+
+} // namespace Engine::IO::Async
@@ -0,0 +1,206 @@
+#include "engine/io/compression/LzBlock.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Engine::IO::Compression {
+
+    namespace {
+        constexpr int         kHashLog = 14;
+        constexpr std::size_t kMaxOffset = 65535;
+        // 末尾付近は match を探さない（最後の sequence を literal で閉じるため）
+        constexpr std::size_t kEndLiterals = 5;
+        constexpr std::size_t kMatchSearchMargin = 12;
+
+        inline std::uint32_t Read32(const std::byte* p) noexcept {
+            std::uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        inline std::uint32_t Hash32(std::uint32_t v) noexcept {
+            return (v * 2654435761u) >> (32 - kHashLog);
+        }
+
+        // 15 以上の長さを 255 区切りで書く
+        inline std::byte* WriteLengthExt(std::byte* op, std::size_t len) noexcept {
+            while (len >= 255) {
+                *op++ = std::byte{ 255 };
+                len -= 255;
+            }
+            *op++ = static_cast<std::byte>(len);
+            return op;
+        }
+
+        inline bool ReadLengthExt(const std::byte*& ip, const std::byte* iend, std::size_t& len) noexcept {
+            for (;;) {
+                if (ip >= iend) return false;
+                const unsigned b = std::to_integer<unsigned>(*ip++);
+                len += b;
+                if (b != 255) return true;
+            }
+        }
+    } // namespace
+
+    std::size_t LzCompressBlock(const std::byte* src, std::size_t srcBytes,
+                                std::byte* dst, std::size_t dstCapacity) {
+        if (dstCapacity < LzCompressBound(srcBytes)) return 0;
+
+        std::byte* op = dst;
+        const std::byte* const base = src;
+        const std::byte* const iend = src + srcBytes;
+        const std::byte* anchor = src;
+
+        auto emit = [&](const std::byte* litEnd, std::size_t matchLen, std::size_t offset) {
+            const std::size_t litLen = static_cast<std::size_t>(litEnd - anchor);
+            std::byte* token = op++;
+            unsigned t = 0;
+
+            if (litLen >= 15) { t = 15u << 4; op = WriteLengthExt(op, litLen - 15); }
+            else              { t = static_cast<unsigned>(litLen) << 4; }
+            if (litLen != 0) std::memcpy(op, anchor, litLen);
+            op += litLen;
+
+            if (matchLen != 0) {
+                *op++ = static_cast<std::byte>(offset & 0xFF);
+                *op++ = static_cast<std::byte>((offset >> 8) & 0xFF);
+                const std::size_t ml = matchLen - kMinMatch;
+                if (ml >= 15) { t |= 15u; op = WriteLengthExt(op, ml - 15); }
+                else          { t |= static_cast<unsigned>(ml); }
+            }
+            *token = static_cast<std::byte>(t);
+        };
+
+        if (srcBytes > kMatchSearchMargin) {
+            // ブロック単位で呼ばれるのでスレッドごとに使い回す
+            thread_local std::vector<std::uint32_t> table;
+            table.assign(std::size_t{ 1 } << kHashLog, 0xFFFFFFFFu);
+
+            const std::byte* const mflimit = iend - kMatchSearchMargin;
+            const std::byte* const matchEnd = iend - kEndLiterals;
+            const std::byte* ip = src;
+            std::size_t misses = 0;
+
+            while (ip < mflimit) {
+                const std::uint32_t seq = Read32(ip);
+                const std::uint32_t h = Hash32(seq);
+                const std::uint32_t refPos = table[h];
+                table[h] = static_cast<std::uint32_t>(ip - base);
+
+                if (refPos == 0xFFFFFFFFu ||
+                    static_cast<std::size_t>(ip - base) - refPos > kMaxOffset ||
+                    Read32(base + refPos) != seq) {
+                    // 見つからない区間が続いたら歩幅を広げる（圧縮できないデータで時間を使わない）
+                    ip += 1 + (misses++ >> 6);
+                    continue;
+                }
+                misses = 0;
+
+                const std::byte* ref = base + refPos;
+
+                // 後ろ向きに伸ばす
+                while (ip > anchor && ref > base && ip[-1] == ref[-1]) { --ip; --ref; }
+
+                // 前向きに伸ばす
+                std::size_t len = kMinMatch;
+                while (ip + len < matchEnd && ip[len] == ref[len]) ++len;
+
+                emit(ip, len, static_cast<std::size_t>(ip - ref));
+                ip += len;
+                anchor = ip;
+
+                // 飛ばした位置も少しだけ登録しておく（次の match が見つかりやすくなる）
+                if (ip < mflimit) {
+                    table[Hash32(Read32(ip - 2))] = static_cast<std::uint32_t>(ip - 2 - base);
+                }
+            }
+        }
+
+        // 残りは literal で閉じる
+        emit(iend, 0, 0);
+        return static_cast<std::size_t>(op - dst);
+    }
+
+    bool LzDecompressBlock(const std::byte* src, std::size_t srcBytes,
+                           std::byte* dst, std::size_t dstBytes) {
+        const std::byte* ip = src;
+        const std::byte* const iend = src + srcBytes;
+        std::byte* op = dst;
+        std::byte* const oend = dst + dstBytes;
+
+        while (ip < iend) {
+            const unsigned token = std::to_integer<unsigned>(*ip++);
+
+            // 短い literal + 短い match（テキスト系アセットの大半）は長さ確認を 1 回で済ませる
+            {
+                const std::size_t ll = token >> 4;
+                const std::size_t ml = (token & 15u) + kMinMatch;
+                if (ll < 15 && (token & 15u) < 15 && iend - ip >= 18 && oend - op >= 32) {
+                    std::memcpy(op, ip, 16);
+                    ip += ll;
+                    op += ll;
+                    const std::size_t offset = std::to_integer<std::size_t>(ip[0]) | (std::to_integer<std::size_t>(ip[1]) << 8);
+                    if (offset >= 8 && offset <= static_cast<std::size_t>(op - dst)) {
+                        ip += 2;
+                        const std::byte* ref = op - offset;
+                        std::memcpy(op, ref, 8);
+                        std::memcpy(op + 8, ref + 8, 8);
+                        std::memcpy(op + 16, ref + 16, 2);
+                        op += ml;
+                        continue;
+                    }
+                    // 近い offset / 壊れた入力は通常経路で処理する
+                    ip -= ll;
+                    op -= ll;
+                }
+            }
+
+            std::size_t litLen = token >> 4;
+            if (litLen == 15 && !ReadLengthExt(ip, iend, litLen)) return false;
+            if (litLen > static_cast<std::size_t>(iend - ip) || litLen > static_cast<std::size_t>(oend - op)) return false;
+
+            // 両端に余裕があれば 16 バイト単位で多めにコピーする（はみ出しは後で上書きされる）
+            if (litLen <= 16 && iend - ip >= 16 && oend - op >= 16) {
+                std::memcpy(op, ip, 16);
+            } else if (litLen != 0) {
+                std::memcpy(op, ip, litLen);
+            }
+            ip += litLen;
+            op += litLen;
+
+            if (ip == iend) break; // 最後の sequence
+
+            if (iend - ip < 2) return false;
+            const std::size_t offset = std::to_integer<std::size_t>(ip[0]) | (std::to_integer<std::size_t>(ip[1]) << 8);
+            ip += 2;
+
+            std::size_t matchLen = token & 15u;
+            if (matchLen == 15 && !ReadLengthExt(ip, iend, matchLen)) return false;
+            matchLen += kMinMatch;
+
+            if (offset == 0 || offset > static_cast<std::size_t>(op - dst)) return false;
+            if (matchLen > static_cast<std::size_t>(oend - op)) return false;
+
+            const std::byte* ref = op - offset;
+            std::byte* const mend = op + matchLen;
+            if (offset >= 8 && oend - mend >= 8) {
+                // 8 バイトずつ（offset >= 8 なら読み元と書き先が 1 回のコピー内で重ならない）
+                do {
+                    std::memcpy(op, ref, 8);
+                    op += 8;
+                    ref += 8;
+                } while (op < mend);
+                op = mend;
+            } else if (offset >= matchLen) {
+                std::memcpy(op, ref, matchLen);
+                op = mend;
+            } else {
+                // 重なり（短い周期の繰り返し）は前から 1 バイトずつ
+                while (op < mend) *op++ = *ref++;
+            }
+        }
+        return op == oend;
+    }
+
+} // namespace Engine::IO::Compression
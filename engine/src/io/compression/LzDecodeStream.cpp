@@ -0,0 +1,306 @@
+#include "engine/io/compression/LzDecodeStream.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace Engine::IO::Compression {
+
+    using Engine::IO::IoErrorCode;
+    using Engine::IO::Stream::SeekWhence;
+    using Engine::IO::Stream::StreamCaps;
+
+    LzDecodeStream::LzDecodeStream(LzFrame frame)
+        : LzDecodeStream(std::move(frame), Options{}) {}
+
+    LzDecodeStream::LzDecodeStream(LzFrame frame, Options opt)
+        : frame_(std::move(frame)), opt_(opt) {
+        const std::size_t blocks = frame_.BlockCount();
+        const std::size_t workers = (std::min)({ opt_.workers, blocks,
+                                                 Engine::IO::Async::IoWorkerPool::Shared()->ThreadCount() });
+
+        // 1 ブロックしかないなら先読みする意味が無い
+        if (workers == 0 || blocks <= 1) return;
+
+        const std::size_t window = (std::max<std::size_t>)(opt_.readAheadBlocks, 1);
+        slots_.resize((std::min)(window, blocks));
+        maxActive_ = workers;
+
+        std::lock_guard lock(mutex_);
+        Pump_();
+    }
+
+    LzDecodeStream::~LzDecodeStream() {
+        inflight_.WaitIdle();
+        StopWorkers_();
+    }
+
+    void LzDecodeStream::StopWorkers_() {
+        // pool に積んだ仕事は this を触るので、全部戻るまで待つ
+        // （RunDecode_ は長くても 1 ブロック展開したら stop_ を見て戻る）
+        std::unique_lock lock(mutex_);
+        stop_ = true;
+        cv_.wait(lock, [this] { return active_ == 0; });
+    }
+
+    void LzDecodeStream::Pump_() {
+        if (stop_) return;
+        const std::size_t end = (std::min)(frame_.BlockCount(), readBlock_ + slots_.size());
+        const std::size_t pending = end > nextDecode_ ? end - nextDecode_ : 0;
+        const std::size_t want = (std::min)(pending, maxActive_);
+
+        const auto& pool = Engine::IO::Async::IoWorkerPool::Shared();
+        while (active_ < want) {
+            ++active_;
+            pool->Submit([this] { RunDecode_(); });
+        }
+    }
+
+    void LzDecodeStream::RunDecode_() {
+        std::vector<std::byte> scratch;
+
+        std::unique_lock lock(mutex_);
+        for (;;) {
+            // 取れるブロックが無ければ pool の thread を返す（次に窓が進んだら Pump_ が積み直す）
+            if (stop_ || nextDecode_ >= frame_.BlockCount() || nextDecode_ >= readBlock_ + slots_.size()) {
+                --active_;
+                cv_.notify_all();
+                return;
+            }
+
+            const std::size_t block = nextDecode_++;
+            const std::uint64_t gen = generation_;
+            lock.unlock();
+
+            // 展開は lock の外で、自分のバッファに行う
+            scratch.resize(frame_.BlockOriginalSize(block));
+            const bool ok = static_cast<bool>(frame_.DecodeBlock(block, scratch.data()));
+
+            lock.lock();
+            // Seek で捨てられた / もう読まれない位置のブロックは publish しない
+            if (gen != generation_ || block < readBlock_) continue;
+
+            Slot& s = slots_[block % slots_.size()];
+            s.bytes.swap(scratch);
+            s.block = block;
+            s.failed = !ok;
+            cv_.notify_all();
+        }
+    }
+
+    const std::vector<std::byte>* LzDecodeStream::AcquireBlock_(std::size_t block) {
+        if (slots_.empty()) {
+            if (syncBlock_ != block) {
+                syncBytes_.resize(frame_.BlockOriginalSize(block));
+                if (!frame_.DecodeBlock(block, syncBytes_.data())) {
+                    syncBlock_ = kNoBlock;
+                    return nullptr;
+                }
+                syncBlock_ = block;
+            }
+            return &syncBytes_;
+        }
+
+        std::unique_lock lock(mutex_);
+        if (block != readBlock_) {
+            // 前のブロックを読み終えた（slot を空ける）。後ろへ戻る / 遠くへ飛ぶなら先読みを捨てる
+            const bool inWindow = block > readBlock_ && block < nextDecode_;
+            readBlock_ = block;
+            if (!inWindow) {
+                ++generation_;
+                nextDecode_ = block;
+                for (auto& s : slots_) s.block = kNoBlock;
+            }
+        }
+
+        Slot& s = slots_[block % slots_.size()];
+        if (s.block != block && block == nextDecode_) {
+            // まだ誰も取っていない：pool が空くのを待たずにここで展開する（残りの窓は pool に任せる）
+            ++nextDecode_;
+            Pump_();
+            lock.unlock();
+
+            syncBytes_.resize(frame_.BlockOriginalSize(block));
+            const bool ok = static_cast<bool>(frame_.DecodeBlock(block, syncBytes_.data()));
+
+            lock.lock();
+            s.bytes.swap(syncBytes_);
+            s.block = block;
+            s.failed = !ok;
+        } else {
+            Pump_();
+            // 取られているブロックは pool 上で展開中なので、待てば必ず publish される
+            cv_.wait(lock, [&] { return s.block == block; });
+        }
+        // block == readBlock_ の slot は reader が次のブロックへ進むまで上書きされない
+        return s.failed ? nullptr : &s.bytes;
+    }
+
+    StreamCaps LzDecodeStream::Caps() const noexcept {
+        StreamCaps c;
+        c.readable = open_;
+        c.writable = false;
+        c.seekable = open_;
+        c.asyncRead = open_;
+        return c;
+    }
+
+    Base::Result<std::size_t, IoError> LzDecodeStream::Read(void* dst, std::size_t bytes) {
+        using R = Base::Result<std::size_t, IoError>;
+        if (!open_) return R::Err(IoError::Make(IoErrorCode::ReadFailed, "LzDecodeStream: read on closed stream"));
+        if (bytes == 0) return R::Ok(0);
+
+        const std::uint64_t size = frame_.OriginalSize();
+        auto* out = static_cast<std::byte*>(dst);
+        std::size_t done = 0;
+
+        while (done < bytes && pos_ < size) {
+            const std::size_t block = static_cast<std::size_t>(pos_ / frame_.BlockSize());
+            const std::size_t inBlock = static_cast<std::size_t>(pos_ % frame_.BlockSize());
+
+            const std::vector<std::byte>* b = AcquireBlock_(block);
+            if (!b) {
+                return R::Err(IoError::Make(IoErrorCode::ReadFailed, "LzDecodeStream: corrupt block", std::to_string(block)));
+            }
+
+            const std::size_t n = (std::min)(bytes - done, b->size() - inBlock);
+            std::memcpy(out + done, b->data() + inBlock, n);
+            done += n;
+            pos_ += n;
+        }
+
+        eof_ = (pos_ >= size);
+        return R::Ok(done);
+    }
+
+    void LzDecodeStream::ReadAtAsync(std::uint64_t offset, Base::Span<std::byte> dst,
+                                     Engine::IO::Stream::ReadCompletion completion) {
+        using R = Base::Result<std::size_t, IoError>;
+        if (!open_) {
+            completion(R::Err(IoError::Make(IoErrorCode::ReadFailed, "LzDecodeStream: read on closed stream")));
+            return;
+        }
+
+        const std::uint64_t size = frame_.OriginalSize();
+        const std::size_t total = offset >= size ? 0 : static_cast<std::size_t>(
+            (std::min<std::uint64_t>)(size - offset, static_cast<std::uint64_t>(dst.size())));
+        if (total == 0) {
+            completion(R::Ok(0));
+            return;
+        }
+
+        // ブロック毎に 1 つの仕事にして、最後に終わった worker が completion を呼ぶ
+        struct Request final {
+            std::atomic<std::size_t> remaining{ 0 };
+            std::atomic<bool> failed{ false };
+            std::atomic<std::size_t> failedBlock{ 0 };
+            Engine::IO::Stream::ReadCompletion completion;
+        };
+
+        const std::uint64_t bs = frame_.BlockSize();
+        const std::size_t first = static_cast<std::size_t>(offset / bs);
+        const std::size_t last = static_cast<std::size_t>((offset + total - 1) / bs);
+
+        auto req = std::make_shared<Request>();
+        req->remaining.store(last - first + 1, std::memory_order_relaxed);
+        req->completion = std::move(completion);
+
+        inflight_.Begin();
+        const auto& pool = Engine::IO::Async::IoWorkerPool::Shared();
+        for (std::size_t block = first; block <= last; ++block) {
+            pool->Submit([this, req, block, offset, total, out = dst.data()] {
+                const std::uint64_t blockBegin = static_cast<std::uint64_t>(block) * frame_.BlockSize();
+                const std::size_t blockSize = frame_.BlockOriginalSize(block);
+
+                // 要求範囲とブロックの重なり
+                const std::uint64_t from = (std::max)(offset, blockBegin);
+                const std::uint64_t to = (std::min)(offset + total, blockBegin + blockSize);
+                std::byte* dstPart = out + (from - offset);
+
+                bool ok = true;
+                if (from == blockBegin && to == blockBegin + blockSize) {
+                    // ブロック全体が収まるなら dst に直接展開する
+                    ok = static_cast<bool>(frame_.DecodeBlock(block, dstPart));
+                } else {
+                    thread_local std::vector<std::byte> scratch;
+                    scratch.resize(blockSize);
+                    ok = static_cast<bool>(frame_.DecodeBlock(block, scratch.data()));
+                    if (ok) std::memcpy(dstPart, scratch.data() + (from - blockBegin), static_cast<std::size_t>(to - from));
+                }
+                if (!ok) {
+                    req->failedBlock.store(block, std::memory_order_relaxed);
+                    req->failed.store(true, std::memory_order_release);
+                }
+
+                if (req->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+                if (req->failed.load(std::memory_order_acquire)) {
+                    req->completion(R::Err(IoError::Make(IoErrorCode::ReadFailed, "LzDecodeStream: corrupt block",
+                                                         std::to_string(req->failedBlock.load(std::memory_order_relaxed)))));
+                } else {
+                    req->completion(R::Ok(total));
+                }
+                inflight_.End();
+            });
+        }
+    }
+
+    Base::Result<std::size_t, IoError> LzDecodeStream::Write(const void*, std::size_t) {
+        return Base::Result<std::size_t, IoError>::Err(
+            IoError::Make(IoErrorCode::NotSupported, "LzDecodeStream: write not supported (read-only)"));
+    }
+
+    Base::Result<std::uint64_t, IoError> LzDecodeStream::Tell() const {
+        using R = Base::Result<std::uint64_t, IoError>;
+        if (!open_) return R::Err(IoError::Make(IoErrorCode::SeekFailed, "LzDecodeStream: tell on closed stream"));
+        return R::Ok(pos_);
+    }
+
+    Base::Result<std::uint64_t, IoError> LzDecodeStream::Seek(std::int64_t offset, SeekWhence whence) {
+        using R = Base::Result<std::uint64_t, IoError>;
+        if (!open_) return R::Err(IoError::Make(IoErrorCode::SeekFailed, "LzDecodeStream: seek on closed stream"));
+
+        const std::int64_t size = static_cast<std::int64_t>(frame_.OriginalSize());
+        std::int64_t target = offset;
+        switch (whence) {
+        case SeekWhence::Begin:   target = offset; break;
+        case SeekWhence::Current: target = static_cast<std::int64_t>(pos_) + offset; break;
+        case SeekWhence::End:     target = size + offset; break;
+        default: break;
+        }
+        if (target < 0 || target > size) {
+            return R::Err(IoError::Make(IoErrorCode::SeekFailed, "LzDecodeStream: seek out of range",
+                                        "target=" + std::to_string(target)));
+        }
+
+        // 先読みの入れ替えは次の Read で行う（Seek を連打しても展開しない）
+        pos_ = static_cast<std::uint64_t>(target);
+        eof_ = false;
+        return R::Ok(pos_);
+    }
+
+    Base::Result<std::uint64_t, IoError> LzDecodeStream::Size() const {
+        using R = Base::Result<std::uint64_t, IoError>;
+        if (!open_) return R::Err(IoError::Make(IoErrorCode::NotSupported, "LzDecodeStream: size on closed stream"));
+        return R::Ok(frame_.OriginalSize());
+    }
+
+    Base::Result<void, IoError> LzDecodeStream::Flush() {
+        return Base::Result<void, IoError>::Err(
+            IoError::Make(IoErrorCode::NotSupported, "LzDecodeStream: flush not supported (read-only)"));
+    }
+
+    Base::Result<void, IoError> LzDecodeStream::Close() {
+        if (!open_) return Base::Result<void, IoError>::Ok();
+        inflight_.WaitIdle();
+        StopWorkers_();
+        open_ = false;
+        eof_ = false;
+        syncBytes_.clear();
+        slots_.clear();
+        return Base::Result<void, IoError>::Ok();
+    }
+
+} // namespace Engine::IO::Compression
@@ -0,0 +1,214 @@
+#include "engine/io/compression/LzFrame.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "engine/io/async/IoWorkerPool.hpp"
+#include "engine/io/compression/LzBlock.hpp"
+
+namespace Engine::IO::Compression {
+
+    using Engine::IO::IoErrorCode;
+
+    namespace {
+        constexpr char          kMagic[4] = { 'G', 'L', 'Z', '1' };
+        constexpr std::size_t   kHeaderSize = 24;
+        constexpr std::uint32_t kRawFlag = 0x80000000u;
+
+        void StoreU32(std::byte* p, std::uint32_t v) noexcept {
+            for (int i = 0; i < 4; ++i) p[i] = static_cast<std::byte>((v >> (8 * i)) & 0xFF);
+        }
+        void StoreU64(std::byte* p, std::uint64_t v) noexcept {
+            for (int i = 0; i < 8; ++i) p[i] = static_cast<std::byte>((v >> (8 * i)) & 0xFF);
+        }
+        std::uint32_t LoadU32(const std::byte* p) noexcept {
+            std::uint32_t v = 0;
+            for (int i = 3; i >= 0; --i) v = (v << 8) | std::to_integer<std::uint32_t>(p[i]);
+            return v;
+        }
+        std::uint64_t LoadU64(const std::byte* p) noexcept {
+            std::uint64_t v = 0;
+            for (int i = 7; i >= 0; --i) v = (v << 8) | std::to_integer<std::uint64_t>(p[i]);
+            return v;
+        }
+
+        IoError Corrupt(const char* msg) {
+            return IoError::Make(IoErrorCode::ReadFailed, msg);
+        }
+    } // namespace
+
+    std::vector<std::byte> LzFrame::Encode(Base::ConstSpan<std::byte> src) {
+        return Encode(src, Options{});
+    }
+
+    std::vector<std::byte> LzFrame::Encode(Base::ConstSpan<std::byte> src, const Options& opt) {
+        const std::uint32_t bs = std::clamp(opt.blockSize, kLzMinBlockSize, kLzMaxBlockSize);
+        const std::size_t count = (src.size() + bs - 1) / bs;
+
+        std::vector<std::byte> out(kHeaderSize + count * 4);
+        std::memcpy(out.data(), kMagic, 4);
+        StoreU32(out.data() + 4, bs);
+        StoreU64(out.data() + 8, src.size());
+        StoreU32(out.data() + 16, static_cast<std::uint32_t>(count));
+        StoreU32(out.data() + 20, 0);
+
+        std::vector<std::byte> scratch(LzCompressBound(bs));
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::byte* in = src.data() + i * bs;
+            const std::size_t n = (std::min<std::size_t>)(bs, src.size() - i * bs);
+
+            const std::size_t c = LzCompressBlock(in, n, scratch.data(), scratch.size());
+            std::uint32_t entry = 0;
+            if (c != 0 && c < n) {
+                out.insert(out.end(), scratch.data(), scratch.data() + c);
+                entry = static_cast<std::uint32_t>(c);
+            } else {
+                out.insert(out.end(), in, in + n);
+                entry = static_cast<std::uint32_t>(n) | kRawFlag;
+            }
+            StoreU32(out.data() + kHeaderSize + i * 4, entry);
+        }
+        return out;
+    }
+
+    IoResult<LzFrame> LzFrame::Parse(Base::SharedBuffer frame) {
+        using R = IoResult<LzFrame>;
+
+        const std::byte* p = frame.data();
+        if (frame.size() < kHeaderSize || std::memcmp(p, kMagic, 4) != 0) {
+            return R::Err(Corrupt("LzFrame: bad magic or truncated header"));
+        }
+
+        LzFrame f;
+        f.blockSize_ = LoadU32(p + 4);
+        f.originalSize_ = LoadU64(p + 8);
+        f.blockCount_ = LoadU32(p + 16);
+
+        if (f.blockSize_ < kLzMinBlockSize || f.blockSize_ > kLzMaxBlockSize) {
+            return R::Err(Corrupt("LzFrame: invalid block size"));
+        }
+        if (f.blockCount_ != (f.originalSize_ + f.blockSize_ - 1) / f.blockSize_) {
+            return R::Err(Corrupt("LzFrame: block count does not match original size"));
+        }
+        const std::uint64_t tableEnd = kHeaderSize + static_cast<std::uint64_t>(f.blockCount_) * 4;
+        if (tableEnd > frame.size()) {
+            return R::Err(Corrupt("LzFrame: truncated block table"));
+        }
+
+        f.offsets_.resize(f.blockCount_ + 1);
+        std::uint64_t off = tableEnd;
+        for (std::size_t i = 0; i < f.blockCount_; ++i) {
+            f.offsets_[i] = off;
+            off += LoadU32(p + kHeaderSize + i * 4) & ~kRawFlag;
+        }
+        f.offsets_[f.blockCount_] = off;
+        if (off > frame.size()) {
+            return R::Err(Corrupt("LzFrame: truncated block data"));
+        }
+
+        f.frame_ = std::move(frame);
+        return R::Ok(std::move(f));
+    }
+
+    std::size_t LzFrame::BlockOriginalSize(std::size_t i) const noexcept {
+        const std::uint64_t begin = static_cast<std::uint64_t>(i) * blockSize_;
+        return static_cast<std::size_t>((std::min<std::uint64_t>)(blockSize_, originalSize_ - begin));
+    }
+
+    IoResultVoid LzFrame::DecodeBlock(std::size_t i, std::byte* dst) const {
+        if (i >= blockCount_) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::ReadFailed, "LzFrame: block index out of range",
+                                                   std::to_string(i)));
+        }
+
+        const std::byte* src = frame_.data() + offsets_[i];
+        const std::size_t stored = static_cast<std::size_t>(offsets_[i + 1] - offsets_[i]);
+        const std::size_t n = BlockOriginalSize(i);
+        const bool raw = (LoadU32(frame_.data() + kHeaderSize + i * 4) & kRawFlag) != 0;
+
+        if (raw) {
+            if (stored != n) return IoResultVoid::Err(Corrupt("LzFrame: raw block size mismatch"));
+            std::memcpy(dst, src, n);
+            return IoResultVoid::Ok();
+        }
+        if (!LzDecompressBlock(src, stored, dst, n)) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::ReadFailed, "LzFrame: corrupt block", std::to_string(i)));
+        }
+        return IoResultVoid::Ok();
+    }
+
+    IoResult<Base::SharedBuffer> LzFrame::DecodeAll(std::size_t workers) const {
+        using R = IoResult<Base::SharedBuffer>;
+
+        if (originalSize_ == 0) return R::Ok(Base::SharedBuffer{});
+
+        // 全体を上書きするので 0 初期化しない（vector だと展開前に memset が走る）
+        const std::size_t size = static_cast<std::size_t>(originalSize_);
+        std::shared_ptr<std::byte[]> storage(new std::byte[size]);
+        std::byte* const out = storage.get();
+        auto wrap = [&] {
+            return Base::SharedBuffer(std::shared_ptr<const void>(storage, out), Base::ConstSpan<std::byte>{ out, size });
+        };
+
+        workers = (std::max<std::size_t>)(1, (std::min)(workers, blockCount_));
+
+        if (workers == 1) {
+            for (std::size_t i = 0; i < blockCount_; ++i) {
+                auto r = DecodeBlock(i, out + i * blockSize_);
+                if (!r) return R::Err(std::move(r.error()));
+            }
+            return R::Ok(wrap());
+        }
+
+        // ブロックを 1 つずつ取り合う（圧縮率のばらつきで偏らないように）
+        // - 手伝いは共有 IoWorkerPool に投げる（呼び出し毎に thread を作らない。同時に動く数は pool の大きさで頭打ち）
+        // - 呼び出しスレッドは自分でも回すので、pool が混んでいて手伝いが始まらなくても終わる
+        // - 始まっていない手伝いは待たない（closed を立てたら何もせずに戻る）。pool の worker から呼ばれても詰まらない
+        struct Shared final {
+            std::atomic<std::size_t> next{ 0 };
+            std::atomic<bool> failed{ false };
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::size_t active = 0;
+            bool closed = false;
+        };
+        auto st = std::make_shared<Shared>();
+        auto run = [this, out, st] {
+            for (;;) {
+                const std::size_t i = st->next.fetch_add(1, std::memory_order_relaxed);
+                if (i >= blockCount_ || st->failed.load(std::memory_order_relaxed)) return;
+                if (!DecodeBlock(i, out + i * blockSize_)) st->failed.store(true, std::memory_order_relaxed);
+            }
+        };
+
+        const auto& pool = Engine::IO::Async::IoWorkerPool::Shared();
+        workers = (std::min)(workers, pool->ThreadCount() + 1);
+        for (std::size_t w = 1; w < workers; ++w) {
+            pool->Submit([st, run] {
+                {
+                    std::lock_guard<std::mutex> lk(st->mutex);
+                    if (st->closed) return; // 呼び出し側はもう戻った（this / out に触らない）
+                    ++st->active;
+                }
+                run();
+                std::lock_guard<std::mutex> lk(st->mutex);
+                if (--st->active == 0) st->cv.notify_all();
+            });
+        }
+        run();
+        {
+            std::unique_lock<std::mutex> lk(st->mutex);
+            st->closed = true;
+            st->cv.wait(lk, [&] { return st->active == 0; });
+        }
+
+        if (st->failed.load()) return R::Err(Corrupt("LzFrame: corrupt block"));
+        return R::Ok(wrap());
+    }
+
+} // namespace Engine::IO::Compression
@@ -0,0 +1,592 @@
+#include "engine/io/fs/InotifyFileWatcher.hpp"
+
+#if defined(__linux__)
+#define ENGINE_IO_HAS_INOTIFY 1
+#else
+#define ENGINE_IO_HAS_INOTIFY 0
+#endif
+
+#if ENGINE_IO_HAS_INOTIFY
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <deque>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <dirent.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "engine/io/fs/NativeFileStream.hpp"
+#include "engine/io/fs/NativeFileSystem.hpp"
+#endif
+
+namespace Engine::IO::FS {
+
+#if ENGINE_IO_HAS_INOTIFY
+
+    using Engine::IO::IoErrorCode;
+    using Engine::IO::Path::Uri;
+
+    namespace {
+
+        constexpr std::uint32_t kDirMask =
+            IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB |
+            IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_ONLYDIR;
+
+        // recursive 登録の深さ上限（bind mount の循環などの保険）
+        constexpr std::size_t kMaxTreeDepth = 64;
+
+        constexpr const char* kBackend = "inotify";
+
+        // "a/b/c" -> ("a/b", "c") / "c" -> (".", "c") / "/c" -> ("/", "c")
+        std::pair<std::string, std::string> SplitParent(const std::string& path) {
+            const auto slash = path.find_last_of('/');
+            if (slash == std::string::npos) return { ".", path };
+            if (slash == 0) return { "/", path.substr(1) };
+            return { path.substr(0, slash), path.substr(slash + 1) };
+        }
+
+        std::string JoinChild(const std::string& dir, std::string_view name) {
+            std::string out;
+            out.reserve(dir.size() + name.size() + 1);
+            out = dir;
+            if (out.empty() || out.back() != '/') out.push_back('/');
+            out.append(name.data(), name.size());
+            return out;
+        }
+
+        bool IsUnder(const std::string& path, const std::string& dir) {
+            return path.size() > dir.size() && path.compare(0, dir.size(), dir) == 0 &&
+                   (dir.back() == '/' || path[dir.size()] == '/');
+        }
+
+        std::string_view RelativeTo(const std::string& path, const std::string& dir) {
+            std::string_view rel(path);
+            rel.remove_prefix(dir.size());
+            while (!rel.empty() && rel.front() == '/') rel.remove_prefix(1);
+            return rel;
+        }
+
+    } // namespace
+
+    struct InotifyFileWatcher::State final {
+        struct Entry final {
+            Uri uri;
+            std::string nativePath; // ファイル監視は親ディレクトリ + "/" + 名前の形に揃える
+            WatchOptions opt{};
+            bool tree = false;      // ディレクトリ監視（false はファイル監視）
+            std::vector<int> wds;   // tree は先頭が監視ルート
+        };
+
+        struct Dir final {
+            std::string path;
+            std::size_t refs = 0;
+            std::vector<WatchId> files; // この中のファイルを監視している entry
+            std::vector<WatchId> trees; // このディレクトリを含む tree entry
+        };
+
+        // MOVED_FROM を同じ Poll 内の MOVED_TO と突き合わせるための保留
+        struct PendingMove final {
+            std::uint32_t cookie = 0;
+            int wd = -1;
+            std::string path;
+            bool isDir = false;
+            std::vector<WatchId> renamedBy; // Renamed として出した tree entry
+        };
+
+        // 1 回の Poll で作るイベント（coalesce 用に path ごとの最後の位置を持つ）
+        struct Batch final {
+            std::vector<FileChangeEvent> events;
+            std::unordered_map<std::string, std::size_t> last;
+            std::vector<PendingMove> moves;
+        };
+
+        int fd = -1;
+        std::string root;
+        std::unordered_map<WatchId, Entry> entries;
+        std::unordered_map<int, Dir> dirs;
+        std::unordered_map<std::string, int> wdByPath;
+        std::unordered_map<std::string, std::vector<WatchId>> files; // native path -> ファイル監視
+        std::deque<FileChangeEvent> ready;                           // maxEvents で返し切れなかった分
+        WatchId nextId = 1;
+        std::size_t watchLimit = 0;                                  // 0 = カーネルの上限のみ
+
+        ~State() {
+            if (fd >= 0) ::close(fd);
+        }
+
+        // ---------------- watch の共有 ----------------
+
+        IoResult<int> AcquireDir(const std::string& path) {
+            if (auto it = wdByPath.find(path); it != wdByPath.end()) {
+                ++dirs[it->second].refs;
+                return IoResult<int>::Ok(it->second);
+            }
+
+            if (watchLimit != 0 && dirs.size() >= watchLimit) {
+                return IoResult<int>::Err(detail::IoErrorFromErrno(
+                    ENOSPC, IoErrorCode::OpenFailed, "InotifyFileWatcher: watch limit reached", path));
+            }
+
+            const int wd = ::inotify_add_watch(fd, path.c_str(), kDirMask);
+            if (wd < 0) {
+                return IoResult<int>::Err(detail::IoErrorFromErrno(
+                    errno, IoErrorCode::OpenFailed, "InotifyFileWatcher: inotify_add_watch failed", path));
+            }
+
+            // 別表記の同じディレクトリ（"./a" と "a" 等）は同じ wd が返る。最初の表記を使う
+            wdByPath.emplace(path, wd);
+            Dir& d = dirs[wd];
+            if (d.refs == 0 && d.path.empty()) d.path = path;
+            ++d.refs;
+            return IoResult<int>::Ok(wd);
+        }
+
+        void ForgetDir(int wd) {
+            auto it = dirs.find(wd);
+            if (it == dirs.end()) return;
+            for (auto p = wdByPath.begin(); p != wdByPath.end();) {
+                p = (p->second == wd) ? wdByPath.erase(p) : std::next(p);
+            }
+            dirs.erase(it);
+        }
+
+        void ReleaseDir(int wd) {
+            auto it = dirs.find(wd);
+            if (it == dirs.end()) return;
+            if (it->second.refs > 1) {
+                --it->second.refs;
+                return;
+            }
+            ::inotify_rm_watch(fd, wd);
+            ForgetDir(wd);
+        }
+
+        static void EraseId(std::vector<WatchId>& v, WatchId id) {
+            v.erase(std::remove(v.begin(), v.end(), id), v.end());
+        }
+
+        // ---------------- tree（ディレクトリ監視） ----------------
+
+        // path とその配下（recursive のとき）に watch を張る
+        // - found には監視ルート以外で見つけたパスと種類を積む（後から出来たディレクトリの中身を Created にする用）
+        // - たどる途中で消えたディレクトリは飛ばす。それ以外で張れなければ（ENOSPC / 権限なし等）エラー
+        //   （張れた分は e.wds に残る。外すのは呼び出し側）
+        IoResultVoid AttachTree(WatchId id, Entry& e, const std::string& path, std::size_t depth,
+                                std::vector<std::pair<std::string, bool>>* found) {
+            auto wd = AcquireDir(path);
+            if (!wd) {
+                if (depth > 0 && wd.error().code == IoErrorCode::NotFound) return IoResultVoid::Ok();
+                return IoResultVoid::Err(std::move(wd.error()));
+            }
+
+            if (std::find(e.wds.begin(), e.wds.end(), wd.value()) != e.wds.end()) {
+                ReleaseDir(wd.value()); // 同じディレクトリを 2 回たどった（symlink 等）
+                return IoResultVoid::Ok();
+            }
+            e.wds.push_back(wd.value());
+            dirs[wd.value()].trees.push_back(id);
+
+            if (!e.opt.recursive && !found) return IoResultVoid::Ok();
+
+            DIR* d = ::opendir(path.c_str());
+            if (!d) return IoResultVoid::Ok(); // watch を張った直後に消えた
+            std::vector<std::string> subdirs;
+            while (dirent* ent = ::readdir(d)) {
+                const std::string_view name(ent->d_name);
+                if (name == "." || name == "..") continue;
+
+                std::string child = JoinChild(path, name);
+                bool isDir = ent->d_type == DT_DIR;
+                if (ent->d_type == DT_UNKNOWN) {
+                    struct stat st {};
+                    isDir = ::lstat(child.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+                }
+                if (found) found->emplace_back(child, isDir);
+                if (isDir) subdirs.push_back(std::move(child));
+            }
+            ::closedir(d);
+
+            if (!e.opt.recursive || depth + 1 >= kMaxTreeDepth) return IoResultVoid::Ok();
+            for (const auto& sub : subdirs) {
+                if (auto r = AttachTree(id, e, sub, depth + 1, found); !r) return r;
+            }
+            return IoResultVoid::Ok();
+        }
+
+        // entry の watch を全部外す
+        void DetachAll(WatchId id, Entry& e) {
+            for (int wd : e.wds) {
+                if (auto d = dirs.find(wd); d != dirs.end()) {
+                    EraseId(e.tree ? d->second.trees : d->second.files, id);
+                    ReleaseDir(wd);
+                }
+            }
+            e.wds.clear();
+        }
+
+        // tree entry から path 以下の watch を外す（ディレクトリが移動した / 消えた）
+        void DetachSubtree(WatchId id, Entry& e, const std::string& path) {
+            for (auto it = e.wds.begin(); it != e.wds.end();) {
+                auto d = dirs.find(*it);
+                if (d != dirs.end() && (d->second.path == path || IsUnder(d->second.path, path))) {
+                    EraseId(d->second.trees, id);
+                    ReleaseDir(*it);
+                    it = e.wds.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        // ---------------- イベント生成 ----------------
+
+        void Emit(Batch& b, const Entry& e, FileChangeKind kind, Uri path, const Uri* oldPath = nullptr) {
+            std::string key = path.ToString();
+
+            if (e.opt.coalesce) {
+                if (auto it = b.last.find(key); it != b.last.end()) {
+                    const FileChangeKind prev = b.events[it->second].kind;
+                    // 同じ種類の連続 / 作成・更新直後の更新は 1 つで足りる
+                    if (prev == kind && !oldPath) return;
+                    if (kind == FileChangeKind::Modified &&
+                        (prev == FileChangeKind::Created || prev == FileChangeKind::Renamed)) {
+                        return;
+                    }
+                }
+            }
+
+            FileChangeEvent ev;
+            ev.kind = kind;
+            ev.path = std::move(path);
+            if (oldPath) {
+                ev.oldPath = *oldPath;
+                ev.hasOldPath = true;
+            }
+            ev.backend = kBackend;
+            b.last[std::move(key)] = b.events.size();
+            b.events.push_back(std::move(ev));
+        }
+
+        static Uri ChildUri(const Entry& e, const std::string& full) {
+            const std::string_view rel = RelativeTo(full, e.nativePath);
+            Uri u = e.uri;
+            auto child = Engine::IO::Path::Path::FromNormalized(std::string(rel));
+            u.path = u.path.Empty() ? std::move(child) : u.path.Join(child);
+            return u;
+        }
+
+        static bool Wants(const Entry& e, bool isDir) {
+            return isDir ? e.opt.watchDirectories : e.opt.watchFiles;
+        }
+
+        void EmitUnknownAll(Batch& b) {
+            for (const auto& [id, e] : entries) Emit(b, e, FileChangeKind::Unknown, e.uri);
+        }
+
+        // カーネルが watch を外した（ディレクトリごと消えた / unmount）
+        void OnIgnored(Batch& b, int wd) {
+            auto it = dirs.find(wd);
+            if (it == dirs.end()) return; // RemoveWatch で外した分
+            const Dir d = it->second;
+
+            for (WatchId id : d.files) {
+                auto e = entries.find(id);
+                if (e == entries.end()) continue;
+                e->second.wds.clear();
+                Emit(b, e->second, FileChangeKind::Unknown, e->second.uri);
+            }
+            for (WatchId id : d.trees) {
+                auto e = entries.find(id);
+                if (e == entries.end()) continue;
+                auto& wds = e->second.wds;
+                const bool isRoot = !wds.empty() && wds.front() == wd;
+                wds.erase(std::remove(wds.begin(), wds.end(), wd), wds.end());
+                if (isRoot) Emit(b, e->second, FileChangeKind::Unknown, e->second.uri);
+            }
+            ForgetDir(wd);
+        }
+
+        void OnFileEntries(Batch& b, const std::string& full, FileChangeKind kind) {
+            auto it = files.find(full);
+            if (it == files.end()) return;
+            for (WatchId id : it->second) {
+                if (auto e = entries.find(id); e != entries.end()) Emit(b, e->second, kind, e->second.uri);
+            }
+        }
+
+        void Dispatch(Batch& b, const inotify_event& ev) {
+            if (ev.mask & IN_Q_OVERFLOW) {
+                EmitUnknownAll(b);
+                return;
+            }
+            if (ev.mask & IN_IGNORED) {
+                OnIgnored(b, ev.wd);
+                return;
+            }
+            if (ev.len == 0) return; // ディレクトリ自身（DELETE_SELF）：続く IN_IGNORED で扱う
+
+            auto dit = dirs.find(ev.wd);
+            if (dit == dirs.end()) return;
+
+            const std::string full = JoinChild(dit->second.path, std::string_view(ev.name));
+            const bool isDir = (ev.mask & IN_ISDIR) != 0;
+            const std::vector<WatchId> trees = dit->second.trees; // AttachTree で dirs が rehash されうる
+
+            FileChangeKind kind = FileChangeKind::Unknown;
+            if (ev.mask & (IN_CREATE | IN_MOVED_TO)) kind = FileChangeKind::Created;
+            else if (ev.mask & (IN_DELETE | IN_MOVED_FROM)) kind = FileChangeKind::Removed;
+            else if (ev.mask & (IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB)) kind = FileChangeKind::Modified;
+            if (kind == FileChangeKind::Unknown) return;
+
+            // ファイル監視は rename も Removed / Created で届ける（監視対象が名前そのものなので）
+            OnFileEntries(b, full, kind);
+
+            if (ev.mask & IN_MOVED_FROM) {
+                PendingMove m;
+                m.cookie = ev.cookie;
+                m.wd = ev.wd;
+                m.path = full;
+                m.isDir = isDir;
+                b.moves.push_back(std::move(m));
+                if (isDir) {
+                    for (WatchId id : trees) {
+                        if (auto e = entries.find(id); e != entries.end()) DetachSubtree(id, e->second, full);
+                    }
+                }
+                return; // tree 側は MOVED_TO を待つ（FlushMoves で Removed にする）
+            }
+
+            PendingMove* from = nullptr;
+            if (ev.mask & IN_MOVED_TO) {
+                for (auto& m : b.moves) {
+                    if (m.cookie == ev.cookie) { from = &m; break; }
+                }
+            }
+
+            for (WatchId id : trees) {
+                auto eit = entries.find(id);
+                if (eit == entries.end() || !IsUnder(full, eit->second.nativePath)) continue;
+                Entry& e = eit->second;
+
+                if (isDir && e.opt.recursive && kind == FileChangeKind::Created) {
+                    // 新しいディレクトリにも張る。張るまでの間に出来た中身は Created として出す
+                    std::vector<std::pair<std::string, bool>> found;
+                    if (!AttachTree(id, e, full, 1, &found)) {
+                        // 張れない部分木がある：この監視はもう全部は見えていない。Unknown で取り直してもらう
+                        DetachSubtree(id, e, full);
+                        Emit(b, e, FileChangeKind::Unknown, e.uri);
+                        continue;
+                    }
+                    for (const auto& [p, d] : found) {
+                        if (Wants(e, d)) Emit(b, e, FileChangeKind::Created, ChildUri(e, p));
+                    }
+                }
+
+                if (!Wants(e, isDir)) continue;
+
+                if (from && IsUnder(from->path, e.nativePath)) {
+                    const Uri oldUri = ChildUri(e, from->path);
+                    Emit(b, e, FileChangeKind::Renamed, ChildUri(e, full), &oldUri);
+                    from->renamedBy.push_back(id);
+                    continue;
+                }
+                Emit(b, e, kind, ChildUri(e, full));
+            }
+        }
+
+        // 対にならなかった MOVED_FROM（監視外へ移動）は Removed
+        void FlushMoves(Batch& b) {
+            for (const auto& m : b.moves) {
+                auto dit = dirs.find(m.wd);
+                if (dit == dirs.end()) continue;
+                for (WatchId id : dit->second.trees) {
+                    auto e = entries.find(id);
+                    if (e == entries.end() || !Wants(e->second, m.isDir)) continue;
+                    if (std::find(m.renamedBy.begin(), m.renamedBy.end(), id) != m.renamedBy.end()) continue;
+                    Emit(b, e->second, FileChangeKind::Removed, ChildUri(e->second, m.path));
+                }
+            }
+            b.moves.clear();
+        }
+
+        IoResultVoid Drain() {
+            Batch b;
+            alignas(inotify_event) char buf[64 * 1024];
+
+            for (;;) {
+                const ssize_t n = ::read(fd, buf, sizeof(buf));
+                if (n < 0) {
+                    if (errno == EINTR) continue;
+                    if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+                    return IoResultVoid::Err(detail::IoErrorFromErrno(
+                        errno, IoErrorCode::ReadFailed, "InotifyFileWatcher: read failed", root));
+                }
+                if (n == 0) break;
+
+                for (ssize_t off = 0; off < n;) {
+                    const auto* ev = reinterpret_cast<const inotify_event*>(buf + off);
+                    Dispatch(b, *ev);
+                    off += static_cast<ssize_t>(sizeof(inotify_event) + ev->len);
+                }
+            }
+
+            FlushMoves(b);
+            for (auto& ev : b.events) ready.push_back(std::move(ev));
+            return IoResultVoid::Ok();
+        }
+    };
+
+    std::unique_ptr<InotifyFileWatcher> InotifyFileWatcher::TryCreate(std::string rootDirectory) {
+        const int fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd < 0) return nullptr;
+
+        auto st = std::make_unique<State>();
+        st->fd = fd;
+        st->root = std::move(rootDirectory);
+        return std::make_unique<InotifyFileWatcher>(std::move(st));
+    }
+
+    InotifyFileWatcher::InotifyFileWatcher(std::unique_ptr<State> state) : state_(std::move(state)) {}
+    InotifyFileWatcher::~InotifyFileWatcher() = default;
+
+    bool InotifyFileWatcher::IsOpen() const noexcept { return state_ && state_->fd >= 0; }
+
+    std::size_t InotifyFileWatcher::DirectoryWatchCount() const noexcept {
+        return state_ ? state_->dirs.size() : 0;
+    }
+
+    void InotifyFileWatcher::SetWatchLimit(std::size_t maxDirectories) noexcept {
+        if (state_) state_->watchLimit = maxDirectories;
+    }
+
+    IoResult<WatchId> InotifyFileWatcher::AddWatch(const Uri& uri, const WatchOptions& opt) {
+        if (!IsOpen()) {
+            return IoResult<WatchId>::Err(IoError::Make(IoErrorCode::NotSupported, "InotifyFileWatcher: closed"));
+        }
+        State& s = *state_;
+
+        auto np = detail::ToNativePath(s.root, uri);
+        if (!np) return IoResult<WatchId>::Err(std::move(np.error()));
+        std::string path = std::move(np.value());
+        while (path.size() > 1 && path.back() == '/') path.pop_back();
+
+        State::Entry e;
+        e.uri = uri;
+        e.opt = opt;
+
+        const WatchId id = s.nextId++;
+
+        struct stat st {};
+        if (::stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+            e.tree = true;
+            e.nativePath = path;
+            // 一部しか張れない監視は返さない（変化を取りこぼす）。呼び出し側でポーリング等に回す
+            if (auto r = s.AttachTree(id, e, path, 0, nullptr); !r) {
+                s.DetachAll(id, e);
+                return IoResult<WatchId>::Err(std::move(r.error()));
+            }
+            s.entries.emplace(id, std::move(e));
+            return IoResult<WatchId>::Ok(id);
+        }
+
+        // ファイル（まだ無くても良い）：親ディレクトリを監視する
+        auto [dir, name] = SplitParent(path);
+        auto wd = s.AcquireDir(dir);
+        if (!wd) return IoResult<WatchId>::Err(std::move(wd.error()));
+
+        e.nativePath = JoinChild(dir, name);
+        e.wds.push_back(wd.value());
+        s.dirs[wd.value()].files.push_back(id);
+        s.files[e.nativePath].push_back(id);
+        s.entries.emplace(id, std::move(e));
+        return IoResult<WatchId>::Ok(id);
+    }
+
+    IoResultVoid InotifyFileWatcher::RemoveWatch(WatchId id) {
+        if (!state_) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::NotFound, "InotifyFileWatcher: unknown watch id"));
+        }
+        State& s = *state_;
+
+        auto it = s.entries.find(id);
+        if (it == s.entries.end()) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::NotFound, "InotifyFileWatcher: unknown watch id"));
+        }
+        State::Entry& e = it->second;
+
+        s.DetachAll(id, e);
+        if (!e.tree) {
+            if (auto f = s.files.find(e.nativePath); f != s.files.end()) {
+                State::EraseId(f->second, id);
+                if (f->second.empty()) s.files.erase(f);
+            }
+        }
+        s.entries.erase(it);
+        return IoResultVoid::Ok();
+    }
+
+    IoResult<std::size_t> InotifyFileWatcher::Poll(std::vector<FileChangeEvent>& outEvents, std::size_t maxEvents) {
+        if (!IsOpen()) {
+            return IoResult<std::size_t>::Err(IoError::Make(IoErrorCode::NotSupported, "InotifyFileWatcher: closed"));
+        }
+        State& s = *state_;
+
+        // 前回の残りが maxEvents 以上あれば読まない（カーネル側で溜めておく）
+        if (s.ready.size() < maxEvents) {
+            if (auto r = s.Drain(); !r) return IoResult<std::size_t>::Err(std::move(r.error()));
+        }
+
+        std::size_t emitted = 0;
+        while (emitted < maxEvents && !s.ready.empty()) {
+            outEvents.push_back(std::move(s.ready.front()));
+            s.ready.pop_front();
+            ++emitted;
+        }
+        return IoResult<std::size_t>::Ok(emitted);
+    }
+
+    IoResultVoid InotifyFileWatcher::Close() {
+        if (state_) {
+            if (state_->fd >= 0) ::close(state_->fd);
+            state_->fd = -1;
+            state_->entries.clear();
+            state_->dirs.clear();
+            state_->wdByPath.clear();
+            state_->files.clear();
+            state_->ready.clear();
+        }
+        return IoResultVoid::Ok();
+    }
+
+#else // !ENGINE_IO_HAS_INOTIFY
+
+    struct InotifyFileWatcher::State {};
+
+    std::unique_ptr<InotifyFileWatcher> InotifyFileWatcher::TryCreate(std::string) { return nullptr; }
+
+    InotifyFileWatcher::InotifyFileWatcher(std::unique_ptr<State> state) : state_(std::move(state)) {}
+    InotifyFileWatcher::~InotifyFileWatcher() = default;
+
+    bool InotifyFileWatcher::IsOpen() const noexcept { return false; }
+    std::size_t InotifyFileWatcher::DirectoryWatchCount() const noexcept { return 0; }
+    void InotifyFileWatcher::SetWatchLimit(std::size_t) noexcept {}
+
+    IoResult<WatchId> InotifyFileWatcher::AddWatch(const Engine::IO::Path::Uri&, const WatchOptions&) {
+        return IoResult<WatchId>::Err(IoError::Make(IoErrorCode::NotSupported, "InotifyFileWatcher: not supported"));
+    }
+    IoResultVoid InotifyFileWatcher::RemoveWatch(WatchId) {
+        return IoResultVoid::Err(IoError::Make(IoErrorCode::NotSupported, "InotifyFileWatcher: not supported"));
+    }
+    IoResult<std::size_t> InotifyFileWatcher::Poll(std::vector<FileChangeEvent>&, std::size_t) {
+        return IoResult<std::size_t>::Err(IoError::Make(IoErrorCode::NotSupported, "InotifyFileWatcher: not supported"));
+    }
+    IoResultVoid InotifyFileWatcher::Close() { return IoResultVoid::Ok(); }
+
+#endif
+
+} // namespace Engine::IO::FS
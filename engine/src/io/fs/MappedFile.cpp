@@ -0,0 +1,78 @@
+#include "engine/io/fs/MappedFile.hpp"
+
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "engine/io/fs/NativeFileStream.hpp" // detail::IoErrorFromErrno
+
+namespace Engine::IO::FS {
+
+    using Engine::IO::IoErrorCode;
+
+    IoResult<std::shared_ptr<const MappedFile>> MappedFile::Open(const std::string& nativePath) {
+        return Open(nativePath, Options{});
+    }
+
+    IoResult<std::shared_ptr<const MappedFile>> MappedFile::Open(const std::string& nativePath, const Options& opt) {
+        using R = IoResult<std::shared_ptr<const MappedFile>>;
+
+        int fd = -1;
+        do {
+            fd = ::open(nativePath.c_str(), O_RDONLY | O_CLOEXEC);
+        } while (fd < 0 && errno == EINTR);
+        if (fd < 0) {
+            return R::Err(detail::IoErrorFromErrno(errno, IoErrorCode::OpenFailed, "MappedFile: open failed", nativePath));
+        }
+
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            const int err = errno;
+            ::close(fd);
+            return R::Err(detail::IoErrorFromErrno(err, IoErrorCode::ReadFailed, "MappedFile: fstat failed", nativePath));
+        }
+        if (!S_ISREG(st.st_mode)) {
+            ::close(fd);
+            return R::Err(IoError::Make(IoErrorCode::OpenFailed, "MappedFile: not a regular file", nativePath));
+        }
+
+        auto r = Map(fd, static_cast<std::size_t>(st.st_size), nativePath, opt);
+        // mapping は fd を閉じても残る
+        ::close(fd);
+        return r;
+    }
+
+    IoResult<std::shared_ptr<const MappedFile>> MappedFile::Map(int fd, std::size_t size, const std::string& nativePath,
+                                                                const Options& opt) {
+        using R = IoResult<std::shared_ptr<const MappedFile>>;
+
+        if (size == 0) {
+            return R::Ok(std::shared_ptr<const MappedFile>(new MappedFile(nullptr, 0, nativePath)));
+        }
+
+        int flags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+        if (opt.populate) flags |= MAP_POPULATE;
+#endif
+        void* p = ::mmap(nullptr, size, PROT_READ, flags, fd, 0);
+        if (p == MAP_FAILED) {
+            return R::Err(detail::IoErrorFromErrno(errno, IoErrorCode::ReadFailed, "MappedFile: mmap failed", nativePath));
+        }
+
+        if (opt.sequential) (void)::madvise(p, size, MADV_SEQUENTIAL);
+        if (opt.willNeed && !opt.populate) (void)::madvise(p, size, MADV_WILLNEED);
+
+        return R::Ok(std::shared_ptr<const MappedFile>(
+            new MappedFile(static_cast<const std::byte*>(p), size, nativePath)));
+    }
+
+    MappedFile::~MappedFile() {
+        if (data_ && size_ > 0) {
+            ::munmap(const_cast<std::byte*>(data_), size_);
+        }
+    }
+
+} // namespace Engine::IO::FS
@@ -0,0 +1,707 @@
+#include "engine/io/fs/MemoryFileSystem.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "engine/io/path/PathUtils.hpp"
+#include "engine/io/stream/MemoryStream.hpp"
+#include "engine/io/stream/SpanStream.hpp"
+
+namespace Engine::IO::FS {
+
+    using Engine::IO::IoErrorCode;
+    using Engine::IO::Path::Uri;
+    using Engine::IO::Path::UriScheme;
+    using Engine::IO::Stream::FileOpenMode;
+    using Engine::IO::Stream::IStream;
+
+    namespace {
+
+        struct Node final {
+            FileType type = FileType::None;
+            Base::SharedBuffer blob; // Regular のみ
+            TimeNs mtimeNs = 0;
+        };
+
+        // memory 内パス（"a/b.txt"。ルートは ""）を正規化する
+        IoResult<std::string> NormalizeMemoryPath(std::string_view raw) {
+            using R = IoResult<std::string>;
+
+            while (!raw.empty() && (raw.front() == '/' || raw.front() == '\\')) raw.remove_prefix(1);
+            if (raw.empty()) return R::Ok(std::string{});
+
+            Engine::IO::Path::NormalizeOptions opt;
+            opt.resolveDotDot = false; // ".." は一律拒否
+            auto nr = Engine::IO::Path::Normalize(raw, opt);
+            if (!nr) {
+                return R::Err(IoError::Make(IoErrorCode::InvalidPath, "MemoryFS: invalid path", std::string(raw)));
+            }
+
+            std::string p = std::move(nr.value());
+            while (!p.empty() && p.back() == '/') p.pop_back();
+            if (p == ".") p.clear();
+            return R::Ok(std::move(p));
+        }
+
+        // scheme 無し / memory://（loose parse では authority も path に入る）
+        IoResult<std::string> PathOf(const Uri& uri) {
+            if (uri.scheme != UriScheme::None && uri.scheme != UriScheme::Unknown) {
+                return IoResult<std::string>::Err(IoError::Make(
+                    IoErrorCode::NotSupported, "MemoryFS: unsupported uri scheme", uri.ToString()));
+            }
+            if (uri.authority.empty()) return NormalizeMemoryPath(uri.path.Str());
+
+            std::string p = uri.authority;
+            if (!uri.path.Empty()) {
+                p.push_back('/');
+                p += uri.path.Str();
+            }
+            return NormalizeMemoryPath(p);
+        }
+
+        std::string_view ParentOf(std::string_view p) noexcept {
+            const auto slash = p.rfind('/');
+            return slash == std::string_view::npos ? std::string_view{} : p.substr(0, slash);
+        }
+
+        bool IsUnder(std::string_view p, std::string_view dir) noexcept {
+            if (dir.empty()) return !p.empty();
+            return p.size() > dir.size() && p.compare(0, dir.size(), dir) == 0 && p[dir.size()] == '/';
+        }
+
+        // dir の配下の key 範囲 [first, last)
+        // - 配下は key 順で連続しているが dir の直後とは限らない
+        //   （'.' や '-' は '/' より前に並ぶので "a" < "a-old" < "a.json" < "a/x" になる）
+        // - "dir/" 以上 "dir0"（'0' は '/' の次）未満を引く
+        template <class Map>
+        auto DescendantRange(Map& nodes, const std::string& dir) {
+            if (dir.empty()) return std::make_pair(nodes.upper_bound(dir), nodes.end()); // ルートは "" 以外の全部
+            return std::make_pair(nodes.lower_bound(dir + '/'), nodes.lower_bound(dir + '0'));
+        }
+
+        FileInfo InfoOf(const Node& n) {
+            FileInfo fi;
+            fi.type = n.type;
+            fi.sizeBytes = n.type == FileType::Regular ? n.blob.size() : 0;
+            fi.mtimeNs = n.mtimeNs;
+            fi.backend = "memory";
+            return fi;
+        }
+
+        std::string JoinUriText(const std::string& base, std::string_view rel) {
+            std::string out = base;
+            if (!out.empty() && out.back() != '/') out.push_back('/');
+            out.append(rel.data(), rel.size());
+            return out;
+        }
+
+        bool IsHidden(std::string_view rel) noexcept {
+            // いずれかの要素が dotfile なら hidden
+            std::size_t start = 0;
+            for (;;) {
+                if (start < rel.size() && rel[start] == '.') return true;
+                const auto slash = rel.find('/', start);
+                if (slash == std::string_view::npos) return false;
+                start = slash + 1;
+            }
+        }
+
+        // watcher 1 個分の受け口（State からは weak_ptr で参照する）
+        struct WatchQueue final {
+            struct Watch final {
+                std::string path;
+                WatchOptions opt{};
+            };
+
+            std::mutex mutex;
+            std::unordered_map<WatchId, Watch> watches;
+            std::deque<FileChangeEvent> events;
+        };
+
+    } // namespace
+
+    struct MemoryFileSystem::State final {
+        mutable std::mutex mutex;
+        std::map<std::string, Node, std::less<>> nodes; // ルート（""）は常に Directory
+        std::vector<std::weak_ptr<WatchQueue>> watchers;
+        TimeNs lastMtime = 0;
+
+        State() {
+            Node root;
+            root.type = FileType::Directory;
+            nodes.emplace(std::string{}, std::move(root));
+        }
+
+        // 変更毎に必ず進む mtime（stat ポーリング側が取りこぼさないように）
+        TimeNs NextMtime_() {
+            const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            lastMtime = (std::max)(static_cast<TimeNs>(now), lastMtime + 1);
+            return lastMtime;
+        }
+
+        const Node* Find_(std::string_view p) const {
+            auto it = nodes.find(p);
+            return it == nodes.end() ? nullptr : &it->second;
+        }
+
+        // 以下 mutex 保持中に呼ぶ
+        void Notify_(FileChangeKind kind, const std::string& path, FileType type, const std::string* oldPath = nullptr) {
+            if (watchers.empty()) return;
+
+            auto matches = [&](const WatchQueue::Watch& w, const std::string& p) {
+                if (type == FileType::Directory ? !w.opt.watchDirectories : !w.opt.watchFiles) return false;
+                if (p == w.path) return true;
+                if (!IsUnder(p, w.path)) return false;
+                // 非再帰は直下のみ
+                return w.opt.recursive || ParentOf(p) == w.path;
+            };
+
+            FileChangeEvent ev;
+            ev.kind = kind;
+            ev.path = Engine::IO::Path::ParseUriLoose(path);
+            if (oldPath) {
+                ev.oldPath = Engine::IO::Path::ParseUriLoose(*oldPath);
+                ev.hasOldPath = true;
+            }
+            ev.backend = "MemoryFS";
+
+            std::size_t keep = 0;
+            for (std::size_t i = 0; i < watchers.size(); ++i) {
+                auto q = watchers[i].lock();
+                if (!q) continue; // 破棄済みの watcher は詰める
+                watchers[keep++] = watchers[i];
+
+                std::lock_guard<std::mutex> lk(q->mutex);
+                for (const auto& [id, w] : q->watches) {
+                    if (!matches(w, path) && !(oldPath && matches(w, *oldPath))) continue;
+
+                    // 同じ path への連続した Modified はまとめる
+                    if (w.opt.coalesce && kind == FileChangeKind::Modified && !q->events.empty()) {
+                        const auto& last = q->events.back();
+                        if (last.kind == kind && last.path.path.Str() == ev.path.path.Str()) break;
+                    }
+                    q->events.push_back(ev);
+                    break; // 同じ watcher には 1 件だけ
+                }
+            }
+            watchers.resize(keep);
+        }
+
+        // 親ディレクトリを作る（途中にファイルがあれば失敗）
+        IoResultVoid MakeParents_(std::string_view p) {
+            std::size_t pos = 0;
+            for (;;) {
+                pos = p.find('/', pos);
+                if (pos == std::string_view::npos) return IoResultVoid::Ok();
+                const std::string_view dir = p.substr(0, pos);
+                ++pos;
+
+                auto it = nodes.find(dir);
+                if (it != nodes.end()) {
+                    if (it->second.type != FileType::Directory) {
+                        return IoResultVoid::Err(IoError::Make(
+                            IoErrorCode::AlreadyExists, "MemoryFS: parent is a file", std::string(dir)));
+                    }
+                    continue;
+                }
+                Node d;
+                d.type = FileType::Directory;
+                d.mtimeNs = NextMtime_();
+                const std::string key(dir);
+                nodes.emplace(key, std::move(d));
+                Notify_(FileChangeKind::Created, key, FileType::Directory);
+            }
+        }
+
+        // ファイルを置く / 差し替える（親は存在する前提）
+        IoResultVoid Store_(const std::string& p, Base::SharedBuffer blob) {
+            if (p.empty()) {
+                return IoResultVoid::Err(IoError::Make(IoErrorCode::InvalidPath, "MemoryFS: cannot write to root"));
+            }
+
+            auto it = nodes.find(p);
+            if (it != nodes.end() && it->second.type == FileType::Directory) {
+                return IoResultVoid::Err(IoError::Make(IoErrorCode::AlreadyExists, "MemoryFS: path is a directory", p));
+            }
+
+            const bool created = (it == nodes.end());
+            if (created) it = nodes.emplace(p, Node{}).first;
+
+            it->second.type = FileType::Regular;
+            it->second.blob = std::move(blob);
+            it->second.mtimeNs = NextMtime_();
+            Notify_(created ? FileChangeKind::Created : FileChangeKind::Modified, p, FileType::Regular);
+            return IoResultVoid::Ok();
+        }
+
+        IoResultVoid RequireParentDir_(const std::string& p) const {
+            const Node* parent = Find_(ParentOf(p));
+            if (!parent) {
+                return IoResultVoid::Err(IoError::Make(IoErrorCode::NotFound, "MemoryFS: parent directory not found", p));
+            }
+            if (parent->type != FileType::Directory) {
+                return IoResultVoid::Err(IoError::Make(IoErrorCode::InvalidPath, "MemoryFS: parent is not a directory", p));
+            }
+            return IoResultVoid::Ok();
+        }
+    };
+
+    namespace {
+
+        // 書き込み open の stream
+        // - MemoryStream に書き、Flush で複製を / Close で作業バッファそのものを blob として差し替える
+        // - 破棄時に未確定の書き込みがあれば Close 相当で確定する
+        // - 既存ファイルを truncate で開いたら、何も書かなくても Close で空の blob に置き換える
+        class MemoryWriteStream final : public IStream {
+        public:
+            MemoryWriteStream(std::shared_ptr<MemoryFileSystem::State> state, std::string path,
+                              std::vector<std::byte> initial, bool readable, bool append, bool truncated)
+                : state_(std::move(state)), path_(std::move(path)), readable_(readable)
+                , buf_(std::move(initial), Engine::IO::Stream::MemoryStream::Options{}), dirty_(truncated) {
+                if (append) (void)buf_.Seek(0, Engine::IO::Stream::SeekWhence::End);
+            }
+
+            ~MemoryWriteStream() override { (void)Close(); }
+
+            Engine::IO::Stream::StreamCaps Caps() const noexcept override {
+                Engine::IO::Stream::StreamCaps c;
+                c.readable = open_ && readable_;
+                c.writable = open_;
+                c.seekable = open_;
+                return c;
+            }
+
+            bool IsOpen() const noexcept override { return open_; }
+            bool IsEof() const noexcept override { return buf_.IsEof(); }
+
+            IoResult<std::size_t> Read(void* dst, std::size_t bytes) override {
+                if (!open_ || !readable_) {
+                    return IoResult<std::size_t>::Err(IoError::Make(IoErrorCode::ReadFailed, "MemoryFS: stream not readable", path_));
+                }
+                return buf_.Read(dst, bytes);
+            }
+
+            IoResult<std::size_t> Write(const void* src, std::size_t bytes) override {
+                if (!open_) {
+                    return IoResult<std::size_t>::Err(IoError::Make(IoErrorCode::WriteFailed, "MemoryFS: write on closed stream", path_));
+                }
+                auto wr = buf_.Write(src, bytes);
+                if (wr && wr.value() > 0) dirty_ = true;
+                return wr;
+            }
+
+            IoResult<std::uint64_t> Tell() const override { return buf_.Tell(); }
+            IoResult<std::uint64_t> Seek(std::int64_t offset, Engine::IO::Stream::SeekWhence whence) override {
+                return buf_.Seek(offset, whence);
+            }
+            IoResult<std::uint64_t> Size() const override { return buf_.Size(); }
+
+            IoResultVoid Flush() override {
+                if (!open_) {
+                    return IoResultVoid::Err(IoError::Make(IoErrorCode::WriteFailed, "MemoryFS: flush on closed stream", path_));
+                }
+                if (!dirty_) return IoResultVoid::Ok();
+                // 書き続けるので作業バッファは手放さない（複製を blob にする）
+                return Commit_(Base::SharedBuffer::Copy(Base::ConstSpan<std::byte>(buf_.Buffer().data(), buf_.Buffer().size())));
+            }
+
+            IoResultVoid Close() override {
+                if (!open_) return IoResultVoid::Ok();
+                open_ = false;
+                if (!dirty_) return IoResultVoid::Ok();
+                return Commit_(Base::SharedBuffer::FromVector(std::move(buf_.Buffer())));
+            }
+
+        private:
+            IoResultVoid Commit_(Base::SharedBuffer blob) {
+                std::lock_guard<std::mutex> lk(state_->mutex);
+                // open 後に親ごと消されていたら確定しない
+                auto pr = state_->RequireParentDir_(path_);
+                if (!pr) return pr;
+                auto sr = state_->Store_(path_, std::move(blob));
+                if (sr) dirty_ = false;
+                return sr;
+            }
+
+        private:
+            std::shared_ptr<MemoryFileSystem::State> state_;
+            std::string path_;
+            bool readable_ = false;
+            Engine::IO::Stream::MemoryStream buf_;
+            bool dirty_ = false;
+            bool open_ = true;
+        };
+
+        class MemoryFileWatcher final : public IFileWatcher {
+        public:
+            explicit MemoryFileWatcher(std::shared_ptr<WatchQueue> q) : q_(std::move(q)) {}
+
+            const char* Name() const noexcept override { return "MemoryFileWatcher"; }
+            bool IsOpen() const noexcept override { return open_; }
+
+            IoResult<WatchId> AddWatch(const Uri& uri, const WatchOptions& opt = {}) override {
+                if (!open_) {
+                    return IoResult<WatchId>::Err(IoError::Make(IoErrorCode::NotSupported, "MemoryFileWatcher: closed"));
+                }
+                auto p = PathOf(uri);
+                if (!p) return IoResult<WatchId>::Err(std::move(p.error()));
+
+                std::lock_guard<std::mutex> lk(q_->mutex);
+                const WatchId id = nextId_++;
+                q_->watches.emplace(id, WatchQueue::Watch{ std::move(p.value()), opt });
+                return IoResult<WatchId>::Ok(id);
+            }
+
+            IoResultVoid RemoveWatch(WatchId id) override {
+                std::lock_guard<std::mutex> lk(q_->mutex);
+                if (q_->watches.erase(id) == 0) {
+                    return IoResultVoid::Err(IoError::Make(IoErrorCode::NotFound, "MemoryFileWatcher: unknown watch id"));
+                }
+                return IoResultVoid::Ok();
+            }
+
+            IoResult<std::size_t> Poll(std::vector<FileChangeEvent>& outEvents, std::size_t maxEvents = 256) override {
+                if (!open_) {
+                    return IoResult<std::size_t>::Err(IoError::Make(IoErrorCode::NotSupported, "MemoryFileWatcher: closed"));
+                }
+                std::lock_guard<std::mutex> lk(q_->mutex);
+                std::size_t emitted = 0;
+                while (emitted < maxEvents && !q_->events.empty()) {
+                    outEvents.push_back(std::move(q_->events.front()));
+                    q_->events.pop_front();
+                    ++emitted;
+                }
+                return IoResult<std::size_t>::Ok(emitted);
+            }
+
+            IoResultVoid Close() override {
+                std::lock_guard<std::mutex> lk(q_->mutex);
+                q_->watches.clear();
+                q_->events.clear();
+                open_ = false;
+                return IoResultVoid::Ok();
+            }
+
+        private:
+            std::shared_ptr<WatchQueue> q_;
+            WatchId nextId_ = 1;
+            bool open_ = true;
+        };
+
+    } // namespace
+
+    MemoryFileSystem::MemoryFileSystem() : state_(std::make_shared<State>()) {}
+    MemoryFileSystem::~MemoryFileSystem() = default;
+
+    IoResultVoid MemoryFileSystem::Put(std::string_view path, Base::SharedBuffer blob) {
+        auto p = NormalizeMemoryPath(path);
+        if (!p) return IoResultVoid::Err(std::move(p.error()));
+
+        std::lock_guard<std::mutex> lk(state_->mutex);
+        auto mr = state_->MakeParents_(p.value());
+        if (!mr) return mr;
+        return state_->Store_(p.value(), std::move(blob));
+    }
+
+    IoResultVoid MemoryFileSystem::Put(std::string_view path, std::vector<std::byte> bytes) {
+        return Put(path, Base::SharedBuffer::FromVector(std::move(bytes)));
+    }
+
+    IoResult<Base::SharedBuffer> MemoryFileSystem::ReadShared(std::string_view path) const {
+        using R = IoResult<Base::SharedBuffer>;
+        auto p = NormalizeMemoryPath(path);
+        if (!p) return R::Err(std::move(p.error()));
+
+        std::lock_guard<std::mutex> lk(state_->mutex);
+        const Node* n = state_->Find_(p.value());
+        if (!n) return R::Err(IoError::Make(IoErrorCode::NotFound, "MemoryFS: not found", p.value()));
+        if (n->type != FileType::Regular) {
+            return R::Err(IoError::Make(IoErrorCode::ReadFailed, "MemoryFS: not a file", p.value()));
+        }
+        return R::Ok(n->blob);
+    }
+
+    IoResult<Base::SharedBuffer> MemoryFileSystem::ReadShared(const Uri& uri) const {
+        auto p = PathOf(uri);
+        if (!p) return IoResult<Base::SharedBuffer>::Err(std::move(p.error()));
+        return ReadShared(std::string_view(p.value()));
+    }
+
+    std::size_t MemoryFileSystem::FileCount() const {
+        std::lock_guard<std::mutex> lk(state_->mutex);
+        return static_cast<std::size_t>(std::count_if(state_->nodes.begin(), state_->nodes.end(),
+            [](const auto& kv) { return kv.second.type == FileType::Regular; }));
+    }
+
+    std::uint64_t MemoryFileSystem::TotalBytes() const {
+        std::lock_guard<std::mutex> lk(state_->mutex);
+        std::uint64_t total = 0;
+        for (const auto& [p, n] : state_->nodes) total += n.blob.size();
+        return total;
+    }
+
+    IoResult<std::unique_ptr<IStream>> MemoryFileSystem::Open(const Uri& uri, FileOpenMode mode) {
+        using R = IoResult<std::unique_ptr<IStream>>;
+
+        if (!Engine::IO::Stream::IsValid(mode)) {
+            return R::Err(IoError::Make(IoErrorCode::OpenFailed, "MemoryFS: invalid open mode", uri.ToString()));
+        }
+
+        auto pr = PathOf(uri);
+        if (!pr) return R::Err(std::move(pr.error()));
+        std::string p = std::move(pr.value());
+
+        std::lock_guard<std::mutex> lk(state_->mutex);
+        const Node* n = state_->Find_(p);
+        if (n && n->type == FileType::Directory) {
+            return R::Err(IoError::Make(IoErrorCode::OpenFailed, "MemoryFS: path is a directory", p));
+        }
+
+        // 読み取り：blob を共有した SpanStream（コピー無し）
+        if (!Engine::IO::Stream::CanWrite(mode)) {
+            if (!n) return R::Err(IoError::Make(IoErrorCode::NotFound, "MemoryFS: not found", p));
+            return R::Ok(std::make_unique<Engine::IO::Stream::SpanStream>(n->blob));
+        }
+
+        // 書き込み：OS と同じく open 時点でファイルを作る（親ディレクトリは必要）
+        std::vector<std::byte> initial;
+        bool truncated = false;
+        if (!n) {
+            if (!Engine::IO::Stream::Has(mode, FileOpenMode::CreateIfMissing)) {
+                return R::Err(IoError::Make(IoErrorCode::NotFound, "MemoryFS: not found", p));
+            }
+            auto rr = state_->RequireParentDir_(p);
+            if (!rr) return R::Err(std::move(rr.error()));
+            auto sr = state_->Store_(p, Base::SharedBuffer{});
+            if (!sr) return R::Err(std::move(sr.error()));
+        } else if (!Engine::IO::Stream::Has(mode, FileOpenMode::Truncate)) {
+            initial.assign(n->blob.begin(), n->blob.end());
+        } else {
+            truncated = !n->blob.empty();
+        }
+
+        return R::Ok(std::make_unique<MemoryWriteStream>(
+            state_, std::move(p), std::move(initial),
+            Engine::IO::Stream::CanRead(mode), Engine::IO::Stream::IsAppend(mode), truncated));
+    }
+
+    IoResult<bool> MemoryFileSystem::Exists(const Uri& uri) {
+        auto p = PathOf(uri);
+        if (!p) return IoResult<bool>::Err(std::move(p.error()));
+
+        std::lock_guard<std::mutex> lk(state_->mutex);
+        return IoResult<bool>::Ok(state_->Find_(p.value()) != nullptr);
+    }
+
+    IoResult<FileInfo> MemoryFileSystem::Stat(const Uri& uri) {
+        using R = IoResult<FileInfo>;
+        auto p = PathOf(uri);
+        if (!p) return R::Err(std::move(p.error()));
+
+        std::lock_guard<std::mutex> lk(state_->mutex);
+        const Node* n = state_->Find_(p.value());
+        if (!n) return R::Err(IoError::Make(IoErrorCode::NotFound, "MemoryFS: not found", p.value()));
+        return R::Ok(InfoOf(*n));
+    }
+
+    IoResultVoid MemoryFileSystem::CreateDirectories(const Uri& uri) {
+        auto pr = PathOf(uri);
+        if (!pr) return IoResultVoid::Err(std::move(pr.error()));
+        const std::string& p = pr.value();
+        if (p.empty()) return IoResultVoid::Ok();
+
+        std::lock_guard<std::mutex> lk(state_->mutex);
+        auto mr = state_->MakeParents_(p);
+        if (!mr) return mr;
+
+        if (const Node* n = state_->Find_(p)) {
+            if (n->type == FileType::Directory) return IoResultVoid::Ok();
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::AlreadyExists, "MemoryFS: path is a file", p));
+        }
+
+        Node d;
+        d.type = FileType::Directory;
+        d.mtimeNs = state_->NextMtime_();
+        state_->nodes.emplace(p, std::move(d));
+        state_->Notify_(FileChangeKind::Created, p, FileType::Directory);
+        return IoResultVoid::Ok();
+    }
+
+    IoResultVoid MemoryFileSystem::Remove(const Uri& uri, const RemoveOptions& opt) {
+        auto pr = PathOf(uri);
+        if (!pr) return IoResultVoid::Err(std::move(pr.error()));
+        const std::string& p = pr.value();
+        if (p.empty()) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::PermissionDenied, "MemoryFS: cannot remove root"));
+        }
+
+        std::lock_guard<std::mutex> lk(state_->mutex);
+        auto& nodes = state_->nodes;
+        auto it = nodes.find(p);
+        if (it == nodes.end()) return IoResultVoid::Err(IoError::Make(IoErrorCode::NotFound, "MemoryFS: not found", p));
+
+        const FileType type = it->second.type;
+        if (type == FileType::Directory) {
+            const auto [first, last] = DescendantRange(nodes, p);
+            if (first != last && !opt.recursive) {
+                return IoResultVoid::Err(IoError::Make(IoErrorCode::WriteFailed, "MemoryFS: directory not empty", p));
+            }
+            for (auto c = first; c != last; ++c) {
+                state_->Notify_(FileChangeKind::Removed, c->first, c->second.type);
+            }
+            nodes.erase(first, last);
+            nodes.erase(it);
+        } else {
+            nodes.erase(it);
+        }
+
+        state_->Notify_(FileChangeKind::Removed, p, type);
+        if (auto parent = nodes.find(ParentOf(p)); parent != nodes.end()) parent->second.mtimeNs = state_->NextMtime_();
+        return IoResultVoid::Ok();
+    }
+
+    IoResultVoid MemoryFileSystem::Move(const Uri& from, const Uri& to) {
+        auto fr = PathOf(from);
+        if (!fr) return IoResultVoid::Err(std::move(fr.error()));
+        auto tr = PathOf(to);
+        if (!tr) return IoResultVoid::Err(std::move(tr.error()));
+        const std::string& src = fr.value();
+        const std::string& dst = tr.value();
+
+        if (src.empty() || dst.empty()) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::PermissionDenied, "MemoryFS: cannot move root"));
+        }
+        if (src == dst) return IoResultVoid::Ok();
+        if (IsUnder(dst, src)) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::InvalidPath, "MemoryFS: cannot move a directory into itself", dst));
+        }
+
+        std::lock_guard<std::mutex> lk(state_->mutex);
+        auto& nodes = state_->nodes;
+        auto it = nodes.find(src);
+        if (it == nodes.end()) return IoResultVoid::Err(IoError::Make(IoErrorCode::NotFound, "MemoryFS: not found", src));
+
+        auto rr = state_->RequireParentDir_(dst);
+        if (!rr) return rr;
+
+        const FileType type = it->second.type;
+        if (const Node* d = state_->Find_(dst)) {
+            // rename(2) と同じくファイル同士なら置き換える
+            if (type != FileType::Regular || d->type != FileType::Regular) {
+                return IoResultVoid::Err(IoError::Make(IoErrorCode::AlreadyExists, "MemoryFS: destination exists", dst));
+            }
+        }
+
+        // 配下ごと key を付け替える
+        std::vector<std::pair<std::string, Node>> moved;
+        moved.emplace_back(dst, std::move(it->second));
+        if (type == FileType::Directory) {
+            const auto [first, last] = DescendantRange(nodes, src);
+            for (auto c = first; c != last; ++c) {
+                moved.emplace_back(dst + c->first.substr(src.size()), std::move(c->second));
+            }
+            nodes.erase(first, last);
+        }
+        nodes.erase(it);
+        for (auto& [k, n] : moved) nodes.insert_or_assign(std::move(k), std::move(n));
+
+        state_->Notify_(FileChangeKind::Renamed, dst, type, &src);
+        return IoResultVoid::Ok();
+    }
+
+    IoResultVoid MemoryFileSystem::Copy(const Uri& from, const Uri& to) {
+        auto fr = PathOf(from);
+        if (!fr) return IoResultVoid::Err(std::move(fr.error()));
+        auto tr = PathOf(to);
+        if (!tr) return IoResultVoid::Err(std::move(tr.error()));
+
+        std::lock_guard<std::mutex> lk(state_->mutex);
+        const Node* s = state_->Find_(fr.value());
+        if (!s) return IoResultVoid::Err(IoError::Make(IoErrorCode::NotFound, "MemoryFS: not found", fr.value()));
+        if (s->type != FileType::Regular) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::NotSupported, "MemoryFS: copy supports files only", fr.value()));
+        }
+        if (fr.value() == tr.value()) return IoResultVoid::Ok();
+
+        auto rr = state_->RequireParentDir_(tr.value());
+        if (!rr) return rr;
+
+        // blob は不変なので共有するだけ
+        Base::SharedBuffer blob = s->blob;
+        return state_->Store_(tr.value(), std::move(blob));
+    }
+
+    IoResult<std::vector<DirectoryEntry>> MemoryFileSystem::List(const Uri& uri, const ListOptions& opt) {
+        using R = IoResult<std::vector<DirectoryEntry>>;
+        auto pr = PathOf(uri);
+        if (!pr) return R::Err(std::move(pr.error()));
+        const std::string& dir = pr.value();
+
+        std::lock_guard<std::mutex> lk(state_->mutex);
+        const auto& nodes = state_->nodes;
+        auto it = nodes.find(dir);
+        if (it == nodes.end() || it->second.type != FileType::Directory) {
+            return R::Err(IoError::Make(IoErrorCode::NotFound, "MemoryFS: directory not found", dir));
+        }
+
+        const std::size_t prefixLen = dir.empty() ? 0 : dir.size() + 1;
+        // loose parse した memory:// は ToString で scheme 名を復元できないので、ここで組み立てる
+        const std::string base = "memory://" + dir;
+
+        std::vector<DirectoryEntry> out;
+        const auto [first, last] = DescendantRange(nodes, dir);
+        for (it = first; it != last; ++it) {
+            const std::string_view rel = std::string_view(it->first).substr(prefixLen);
+            if (!opt.recursive && rel.find('/') != std::string_view::npos) continue;
+
+            const Node& n = it->second;
+            if (n.type == FileType::Directory ? !opt.includeDirectories : !opt.includeFiles) continue;
+            if (!opt.includeHidden && IsHidden(rel)) continue;
+
+            DirectoryEntry e;
+            e.path = JoinUriText(base, rel);
+            e.name = std::string(Engine::IO::Path::Filename(rel));
+            e.type = n.type;
+            if (opt.includeInfo) { e.info = InfoOf(n); e.hasInfo = true; }
+            out.push_back(std::move(e));
+        }
+        return R::Ok(std::move(out));
+    }
+
+    IoResult<std::string> MemoryFileSystem::ToNativePathString(const Uri& uri) {
+        return IoResult<std::string>::Err(IoError::Make(IoErrorCode::NotSupported, "MemoryFS: no native path", uri.ToString()));
+    }
+
+    FileSystemCapabilities MemoryFileSystem::Capabilities() const noexcept {
+        FileSystemCapabilities c;
+        c.canIterate = true;
+        c.supportsHiddenFlag = true;
+        c.caseSensitivePaths = true;
+        c.supportsWatch = true;
+        c.supportsRecursiveWatch = true;
+        return c;
+    }
+
+    IoResult<std::unique_ptr<DirectoryIterator>> MemoryFileSystem::Iterate(const Uri& uri, const ListOptions& opt) {
+        using R = IoResult<std::unique_ptr<DirectoryIterator>>;
+        auto lr = List(uri, opt);
+        if (!lr) return R::Err(std::move(lr.error()));
+        return R::Ok(std::make_unique<VectorDirectoryIterator>(std::move(lr.value()), "MemoryIterator"));
+    }
+
+    IoResult<std::unique_ptr<IFileWatcher>> MemoryFileSystem::CreateWatcher() {
+        auto q = std::make_shared<WatchQueue>();
+        {
+            std::lock_guard<std::mutex> lk(state_->mutex);
+            state_->watchers.push_back(q);
+        }
+        return IoResult<std::unique_ptr<IFileWatcher>>::Ok(std::make_unique<MemoryFileWatcher>(std::move(q)));
+    }
+
+} // namespace Engine::IO::FS
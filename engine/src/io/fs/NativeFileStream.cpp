@@ -0,0 +1,314 @@
+#include "engine/io/fs/NativeFileStream.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Engine::IO::FS {
+
+    using Engine::IO::IoErrorCode;
+    using Engine::IO::Stream::FileOpenMode;
+    using Engine::IO::Stream::SeekWhence;
+    using Engine::IO::Stream::StreamCaps;
+
+    namespace detail {
+        IoError IoErrorFromErrno(int err, IoErrorCode fallback, const char* msg, const std::string& path) {
+            IoErrorCode code = fallback;
+            switch (err) {
+            case ENOENT:
+            case ENOTDIR:
+                code = IoErrorCode::NotFound; break;
+            case EACCES:
+            case EPERM:
+            case EROFS:
+                code = IoErrorCode::PermissionDenied; break;
+            case EEXIST:
+                code = IoErrorCode::AlreadyExists; break;
+            case ENAMETOOLONG:
+            case EINVAL:
+                code = IoErrorCode::InvalidPath; break;
+            default:
+                break;
+            }
+            return IoError::Make(code, msg, path + ": " + std::strerror(err));
+        }
+    } // namespace detail
+
+    namespace {
+        int ToOpenFlags(FileOpenMode mode) noexcept {
+            int flags = O_CLOEXEC;
+            const bool r = Engine::IO::Stream::CanRead(mode);
+            const bool w = Engine::IO::Stream::CanWrite(mode);
+            if (r && w) flags |= O_RDWR;
+            else if (w) flags |= O_WRONLY;
+            else        flags |= O_RDONLY;
+
+            if (Engine::IO::Stream::Has(mode, FileOpenMode::Append))          flags |= O_APPEND;
+            if (Engine::IO::Stream::Has(mode, FileOpenMode::CreateIfMissing)) flags |= O_CREAT;
+            if (Engine::IO::Stream::Has(mode, FileOpenMode::Truncate))        flags |= O_TRUNC;
+            return flags;
+        }
+
+        int ToAdvice(AccessHint hint) noexcept {
+            switch (hint) {
+            case AccessHint::Sequential: return POSIX_FADV_SEQUENTIAL;
+            case AccessHint::Random:     return POSIX_FADV_RANDOM;
+            default:                     return POSIX_FADV_NORMAL;
+            }
+        }
+    } // namespace
+
+    NativeFileStream::NativeFileStream(int fd, FileOpenMode mode, std::string nativePath)
+        : fd_(fd), mode_(mode), path_(std::move(nativePath)) {}
+
+    NativeFileStream::~NativeFileStream() {
+        // デストラクタで例外は禁止。best-effort close
+        (void)Close();
+    }
+
+    IoResult<std::unique_ptr<NativeFileStream>>
+    NativeFileStream::Open(const std::string& nativePath, FileOpenMode mode, AccessHint hint) {
+        using R = IoResult<std::unique_ptr<NativeFileStream>>;
+
+        if (!Engine::IO::Stream::IsValid(mode)) {
+            return R::Err(IoError::Make(IoErrorCode::NotSupported, "NativeFileStream: invalid open mode", nativePath));
+        }
+
+        int fd = -1;
+        do {
+            fd = ::open(nativePath.c_str(), ToOpenFlags(mode), 0644);
+        } while (fd < 0 && errno == EINTR);
+
+        if (fd < 0) {
+            return R::Err(detail::IoErrorFromErrno(errno, IoErrorCode::OpenFailed, "NativeFileStream: open failed", nativePath));
+        }
+
+        // 読み取り専用 open はディレクトリでも成功してしまうので弾く
+        struct stat st {};
+        if (::fstat(fd, &st) == 0 && S_ISDIR(st.st_mode)) {
+            ::close(fd);
+            return R::Err(IoError::Make(IoErrorCode::OpenFailed, "NativeFileStream: path is a directory", nativePath));
+        }
+
+        auto s = std::make_unique<NativeFileStream>(fd, mode, nativePath);
+        if (Engine::IO::Stream::IsAppend(mode)) {
+            s->pos_ = static_cast<std::uint64_t>(st.st_size);
+        }
+        if (Engine::IO::Stream::CanRead(mode)) {
+            s->Advise(hint);
+        }
+        return R::Ok(std::move(s));
+    }
+
+    StreamCaps NativeFileStream::Caps() const noexcept {
+        StreamCaps c;
+        c.readable = IsOpen() && Engine::IO::Stream::CanRead(mode_);
+        c.writable = IsOpen() && Engine::IO::Stream::CanWrite(mode_);
+        c.seekable = IsOpen();
+        c.asyncRead = c.readable;
+        return c;
+    }
+
+    IoResult<std::size_t> NativeFileStream::ReadAt(std::uint64_t offset, void* dst, std::size_t bytes) const {
+        if (fd_ < 0) {
+            return IoResult<std::size_t>::Err(IoError::Make(IoErrorCode::ReadFailed, "NativeFileStream: read on closed stream", path_));
+        }
+
+        auto* out = static_cast<std::byte*>(dst);
+        std::size_t done = 0;
+        while (done < bytes) {
+            const ssize_t n = ::pread(fd_, out + done, bytes - done, static_cast<off_t>(offset + done));
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return IoResult<std::size_t>::Err(
+                    detail::IoErrorFromErrno(errno, IoErrorCode::ReadFailed, "NativeFileStream: pread failed", path_));
+            }
+            if (n == 0) break; // EOF
+            done += static_cast<std::size_t>(n);
+        }
+        return IoResult<std::size_t>::Ok(done);
+    }
+
+    void NativeFileStream::ReadAtAsync(std::uint64_t offset, Engine::Base::Span<std::byte> dst,
+                                       Engine::IO::Stream::ReadCompletion completion) {
+        if (fd_ < 0) {
+            completion(IoResult<std::size_t>::Err(IoError::Make(IoErrorCode::ReadFailed, "NativeFileStream: read on closed stream", path_)));
+            return;
+        }
+        if (!Engine::IO::Stream::CanRead(mode_)) {
+            completion(IoResult<std::size_t>::Err(IoError::Make(IoErrorCode::NotSupported, "NativeFileStream: not opened for read", path_)));
+            return;
+        }
+        if (dst.empty()) {
+            completion(IoResult<std::size_t>::Ok(0));
+            return;
+        }
+
+        // worker が拾うまでの間にカーネル側の読み込みを始めさせておく
+        WillNeed(offset, dst.size());
+
+        inflight_.Begin();
+        Engine::IO::Async::IoWorkerPool::Shared()->Submit(
+            [this, offset, dst, completion = std::move(completion)]() mutable {
+                completion(ReadAt(offset, dst.data(), dst.size()));
+                inflight_.End();
+            });
+    }
+
+    IoResult<std::size_t> NativeFileStream::Read(void* dst, std::size_t bytes) {
+        if (!Engine::IO::Stream::CanRead(mode_)) {
+            return IoResult<std::size_t>::Err(IoError::Make(IoErrorCode::NotSupported, "NativeFileStream: not opened for read", path_));
+        }
+        if (bytes == 0) return IoResult<std::size_t>::Ok(0);
+
+        auto r = ReadAt(pos_, dst, bytes);
+        if (!r) return r;
+
+        const std::size_t n = r.value();
+        pos_ += static_cast<std::uint64_t>(n);
+        eof_ = (n < bytes);
+        return IoResult<std::size_t>::Ok(n);
+    }
+
+    IoResult<std::size_t> NativeFileStream::Write(const void* src, std::size_t bytes) {
+        if (fd_ < 0) {
+            return IoResult<std::size_t>::Err(IoError::Make(IoErrorCode::WriteFailed, "NativeFileStream: write on closed stream", path_));
+        }
+        if (!Engine::IO::Stream::CanWrite(mode_)) {
+            return IoResult<std::size_t>::Err(IoError::Make(IoErrorCode::NotSupported, "NativeFileStream: not opened for write", path_));
+        }
+        if (bytes == 0) return IoResult<std::size_t>::Ok(0);
+
+        const auto* in = static_cast<const std::byte*>(src);
+        const bool append = Engine::IO::Stream::IsAppend(mode_);
+
+        std::size_t done = 0;
+        while (done < bytes) {
+            // O_APPEND 中の pwrite は offset を無視する（Linux）ので write を使う
+            const ssize_t n = append
+                ? ::write(fd_, in + done, bytes - done)
+                : ::pwrite(fd_, in + done, bytes - done, static_cast<off_t>(pos_ + done));
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return IoResult<std::size_t>::Err(
+                    detail::IoErrorFromErrno(errno, IoErrorCode::WriteFailed, "NativeFileStream: write failed", path_));
+            }
+            done += static_cast<std::size_t>(n);
+        }
+
+        if (append) {
+            const off_t cur = ::lseek(fd_, 0, SEEK_CUR);
+            pos_ = cur >= 0 ? static_cast<std::uint64_t>(cur) : pos_ + done;
+        } else {
+            pos_ += static_cast<std::uint64_t>(done);
+        }
+        eof_ = false;
+        return IoResult<std::size_t>::Ok(done);
+    }
+
+    IoResult<std::uint64_t> NativeFileStream::Tell() const {
+        if (fd_ < 0) {
+            return IoResult<std::uint64_t>::Err(IoError::Make(IoErrorCode::SeekFailed, "NativeFileStream: tell on closed stream", path_));
+        }
+        return IoResult<std::uint64_t>::Ok(pos_);
+    }
+
+    IoResult<std::uint64_t> NativeFileStream::Seek(std::int64_t offset, SeekWhence whence) {
+        if (fd_ < 0) {
+            return IoResult<std::uint64_t>::Err(IoError::Make(IoErrorCode::SeekFailed, "NativeFileStream: seek on closed stream", path_));
+        }
+
+        std::int64_t base = 0;
+        switch (whence) {
+        case SeekWhence::Begin:   base = 0; break;
+        case SeekWhence::Current: base = static_cast<std::int64_t>(pos_); break;
+        case SeekWhence::End: {
+            auto sz = Size();
+            if (!sz) return sz;
+            base = static_cast<std::int64_t>(sz.value());
+            break;
+        }
+        default: break;
+        }
+
+        const std::int64_t target = base + offset;
+        if (target < 0) {
+            return IoResult<std::uint64_t>::Err(IoError::Make(
+                IoErrorCode::SeekFailed, "NativeFileStream: seek before begin",
+                "target=" + std::to_string(target)));
+        }
+
+        // 末尾より先への seek は許可（書き込みで穴あきファイルになる POSIX と同じ挙動）
+        pos_ = static_cast<std::uint64_t>(target);
+        eof_ = false;
+        return IoResult<std::uint64_t>::Ok(pos_);
+    }
+
+    IoResult<std::uint64_t> NativeFileStream::Size() const {
+        if (fd_ < 0) {
+            return IoResult<std::uint64_t>::Err(IoError::Make(IoErrorCode::NotSupported, "NativeFileStream: size on closed stream", path_));
+        }
+        struct stat st {};
+        if (::fstat(fd_, &st) != 0) {
+            return IoResult<std::uint64_t>::Err(
+                detail::IoErrorFromErrno(errno, IoErrorCode::ReadFailed, "NativeFileStream: fstat failed", path_));
+        }
+        return IoResult<std::uint64_t>::Ok(static_cast<std::uint64_t>(st.st_size));
+    }
+
+    IoResultVoid NativeFileStream::Flush() {
+        if (fd_ < 0) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::NotSupported, "NativeFileStream: flush on closed stream", path_));
+        }
+        // ユーザー空間バッファを持たないので no-op（永続化が必要なら呼び出し側で fsync 相当を行う）
+        return IoResultVoid::Ok();
+    }
+
+    IoResultVoid NativeFileStream::Sync() {
+        if (fd_ < 0) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::NotSupported, "NativeFileStream: sync on closed stream", path_));
+        }
+#if defined(__APPLE__)
+        const int rc = ::fsync(fd_);
+#else
+        // サイズ等のメタデータも書き込みに必要な分は含まれる（mtime だけは待たない）
+        const int rc = ::fdatasync(fd_);
+#endif
+        if (rc != 0) {
+            return IoResultVoid::Err(
+                detail::IoErrorFromErrno(errno, IoErrorCode::WriteFailed, "NativeFileStream: fdatasync failed", path_));
+        }
+        return IoResultVoid::Ok();
+    }
+
+    IoResultVoid NativeFileStream::Close() {
+        if (fd_ < 0) return IoResultVoid::Ok();
+
+        // 実行中の ReadAtAsync が fd を使い終わるまで待つ（閉じた fd 番号の再利用で別ファイルを読まないため）
+        inflight_.WaitIdle();
+
+        const int fd = fd_;
+        fd_ = -1;
+        eof_ = false;
+        // close は EINTR でも fd が解放済みのことがあるので再試行しない
+        if (::close(fd) != 0 && errno != EINTR) {
+            return IoResultVoid::Err(
+                detail::IoErrorFromErrno(errno, IoErrorCode::WriteFailed, "NativeFileStream: close failed", path_));
+        }
+        return IoResultVoid::Ok();
+    }
+
+    void NativeFileStream::Advise(AccessHint hint, std::uint64_t offset, std::uint64_t length) const noexcept {
+        if (fd_ < 0) return;
+        (void)::posix_fadvise(fd_, static_cast<off_t>(offset), static_cast<off_t>(length), ToAdvice(hint));
+    }
+
+    void NativeFileStream::WillNeed(std::uint64_t offset, std::uint64_t length) const noexcept {
+        if (fd_ < 0) return;
+        (void)::posix_fadvise(fd_, static_cast<off_t>(offset), static_cast<off_t>(length), POSIX_FADV_WILLNEED);
+    }
+
+} // namespace Engine::IO::FS
@@ -0,0 +1,644 @@
+#include "engine/io/fs/NativeFileSystem.hpp"
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "engine/io/fs/InotifyFileWatcher.hpp"
+
+namespace Engine::IO::FS {
+
+    using Engine::IO::IoErrorCode;
+    using Engine::IO::Path::Uri;
+    using Engine::IO::Path::UriScheme;
+    using Engine::IO::Stream::FileOpenMode;
+
+    namespace {
+
+        // 再帰列挙の深さ上限（followSymlinks で循環した場合の保険）
+        constexpr std::size_t kMaxIterateDepth = 64;
+
+        TimeNs ToNs(const struct timespec& ts) noexcept {
+            return static_cast<TimeNs>(ts.tv_sec) * 1'000'000'000 + static_cast<TimeNs>(ts.tv_nsec);
+        }
+
+        FileType TypeFromMode(mode_t m) noexcept {
+            if (S_ISREG(m)) return FileType::Regular;
+            if (S_ISDIR(m)) return FileType::Directory;
+            if (S_ISLNK(m)) return FileType::Symlink;
+            return FileType::Other;
+        }
+
+        FileInfo InfoFromStat(const struct stat& st) {
+            FileInfo fi;
+            fi.type = TypeFromMode(st.st_mode);
+            fi.sizeBytes = fi.type == FileType::Regular ? static_cast<std::uint64_t>(st.st_size) : 0;
+            fi.mtimeNs = ToNs(st.st_mtim);
+            fi.ctimeNs = ToNs(st.st_ctim);
+            fi.atimeNs = ToNs(st.st_atim);
+            fi.permissions = static_cast<std::uint32_t>(st.st_mode & 07777);
+            fi.backend = "file";
+            return fi;
+        }
+
+        // Uri -> OS パス
+        // - scheme 無し：root + path
+        // - file://    ："/" + authority + path（Loose/厳格どちらのパース結果でも同じになる）
+        IoResult<std::string> ResolveNativePath(const std::string& root, const Uri& uri) {
+            if (uri.scheme != UriScheme::None && uri.scheme != UriScheme::File) {
+                return IoResult<std::string>::Err(IoError::Make(
+                    IoErrorCode::NotSupported, "NativeFS: unsupported uri scheme", uri.ToString()));
+            }
+            if (uri.path.HasNullByte()) {
+                return IoResult<std::string>::Err(IoError::Make(
+                    IoErrorCode::InvalidPath, "NativeFS: path contains null byte"));
+            }
+            if (uri.path.HasTraversal()) {
+                return IoResult<std::string>::Err(IoError::Make(
+                    IoErrorCode::PathEscapesRoot, "NativeFS: path traversal is not allowed", uri.path.Str()));
+            }
+
+            std::string out;
+            if (uri.scheme == UriScheme::File) {
+                out.reserve(uri.authority.size() + uri.path.Str().size() + 2);
+                out.push_back('/');
+                if (!uri.authority.empty()) {
+                    out += uri.authority;
+                    if (!uri.path.Empty()) out.push_back('/');
+                }
+                std::string_view p = uri.path.Str();
+                while (!p.empty() && p.front() == '/') p.remove_prefix(1);
+                out.append(p.data(), p.size());
+                return IoResult<std::string>::Ok(std::move(out));
+            }
+
+            // scheme 無し
+            if (uri.path.IsAbsoluteLike() && root.empty()) {
+                return IoResult<std::string>::Ok(uri.path.Str());
+            }
+            if (uri.path.IsAbsoluteLike()) {
+                return IoResult<std::string>::Err(IoError::Make(
+                    IoErrorCode::PathEscapesRoot, "NativeFS: absolute path with rootDirectory", uri.path.Str()));
+            }
+
+            if (root.empty()) {
+                out = uri.path.Empty() ? std::string(".") : uri.path.Str();
+                return IoResult<std::string>::Ok(std::move(out));
+            }
+
+            out.reserve(root.size() + uri.path.Str().size() + 1);
+            out = root;
+            if (!uri.path.Empty()) {
+                if (out.back() != '/') out.push_back('/');
+                out += uri.path.Str();
+            }
+            return IoResult<std::string>::Ok(std::move(out));
+        }
+
+        // DirectoryEntry::path 用：列挙元 URI の文字列に相対パスを足す
+        std::string JoinUriText(const std::string& base, std::string_view rel) {
+            std::string out = base;
+            if (!out.empty() && out.back() != '/') out.push_back('/');
+            out.append(rel.data(), rel.size());
+            return out;
+        }
+
+        IoResultVoid RemoveTree(const std::string& path) {
+            struct stat st {};
+            if (::lstat(path.c_str(), &st) != 0) {
+                return IoResultVoid::Err(detail::IoErrorFromErrno(errno, IoErrorCode::WriteFailed, "NativeFS: lstat failed", path));
+            }
+
+            if (S_ISDIR(st.st_mode)) {
+                DIR* d = ::opendir(path.c_str());
+                if (!d) {
+                    return IoResultVoid::Err(detail::IoErrorFromErrno(errno, IoErrorCode::WriteFailed, "NativeFS: opendir failed", path));
+                }
+                while (dirent* e = ::readdir(d)) {
+                    if (std::strcmp(e->d_name, ".") == 0 || std::strcmp(e->d_name, "..") == 0) continue;
+                    auto r = RemoveTree(path + "/" + e->d_name);
+                    if (!r) {
+                        ::closedir(d);
+                        return r;
+                    }
+                }
+                ::closedir(d);
+                if (::rmdir(path.c_str()) != 0) {
+                    return IoResultVoid::Err(detail::IoErrorFromErrno(errno, IoErrorCode::WriteFailed, "NativeFS: rmdir failed", path));
+                }
+                return IoResultVoid::Ok();
+            }
+
+            if (::unlink(path.c_str()) != 0) {
+                return IoResultVoid::Err(detail::IoErrorFromErrno(errno, IoErrorCode::WriteFailed, "NativeFS: unlink failed", path));
+            }
+            return IoResultVoid::Ok();
+        }
+
+        // ---------------- NativeDirectoryIterator ----------------
+        // opendir/readdir によるストリーミング列挙
+        // - d_type で種別が分かる場合は stat を呼ばない（includeInfo / DT_UNKNOWN のときだけ fstatat）
+        // - 再帰は DIR* のスタックで行う（List で全件を vector に溜めない）
+        class NativeDirectoryIterator final : public DirectoryIterator {
+        public:
+            NativeDirectoryIterator(std::string nativeRoot, std::string uriBase, ListOptions opt)
+                : nativeRoot_(std::move(nativeRoot)), uriBase_(std::move(uriBase)), opt_(opt) {}
+
+            ~NativeDirectoryIterator() override { CloseAll_(); }
+
+            IoResultVoid OpenRoot() {
+                DIR* d = ::opendir(nativeRoot_.c_str());
+                if (!d) {
+                    return IoResultVoid::Err(detail::IoErrorFromErrno(errno, IoErrorCode::OpenFailed, "NativeFS: opendir failed", nativeRoot_));
+                }
+                stack_.push_back(Frame{ d, std::string{} });
+                open_ = true;
+                return IoResultVoid::Ok();
+            }
+
+            const char* BackendName() const noexcept override { return "NativeFS"; }
+            bool IsOpen() const noexcept override { return open_; }
+
+            IoResult<bool> Next(DirectoryEntry& out) override {
+                if (!open_) {
+                    return IoResult<bool>::Err(IoError::Make(
+                        IoErrorCode::ReadFailed, "NativeDirectoryIterator: next on closed iterator"));
+                }
+
+                while (!stack_.empty()) {
+                    DIR* dir = stack_.back().dir;
+
+                    errno = 0;
+                    dirent* e = ::readdir(dir);
+                    if (!e) {
+                        if (errno != 0) {
+                            return IoResult<bool>::Err(detail::IoErrorFromErrno(
+                                errno, IoErrorCode::ReadFailed, "NativeFS: readdir failed", nativeRoot_));
+                        }
+                        ::closedir(dir);
+                        stack_.pop_back();
+                        continue;
+                    }
+
+                    const char* name = e->d_name;
+                    if (std::strcmp(name, ".") == 0 || std::strcmp(name, "..") == 0) continue;
+                    if (!opt_.includeHidden && name[0] == '.') continue;
+
+                    FileType type = FileType::Other;
+                    switch (e->d_type) {
+                    case DT_REG: type = FileType::Regular; break;
+                    case DT_DIR: type = FileType::Directory; break;
+                    case DT_LNK: type = FileType::Symlink; break;
+                    case DT_UNKNOWN: type = FileType::None; break; // 要 stat
+                    default: break;
+                    }
+
+                    const bool needStat = opt_.includeInfo || type == FileType::None
+                        || (type == FileType::Symlink && opt_.followSymlinks);
+
+                    struct stat st {};
+                    bool hasStat = false;
+                    if (needStat) {
+                        const int flags = opt_.followSymlinks ? 0 : AT_SYMLINK_NOFOLLOW;
+                        if (::fstatat(::dirfd(dir), name, &st, flags) == 0) {
+                            hasStat = true;
+                            type = TypeFromMode(st.st_mode);
+                        } else if (type == FileType::None) {
+                            // 列挙中に消えたなど：飛ばす
+                            continue;
+                        }
+                    }
+
+                    std::string rel = stack_.back().rel.empty()
+                        ? std::string(name)
+                        : stack_.back().rel + "/" + name;
+
+                    // 再帰：ディレクトリ自体を返すかどうかとは独立
+                    if (type == FileType::Directory && opt_.recursive && stack_.size() < kMaxIterateDepth) {
+                        const int fd = ::openat(::dirfd(dir), name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+                        if (fd >= 0) {
+                            if (DIR* sub = ::fdopendir(fd)) {
+                                stack_.push_back(Frame{ sub, rel });
+                            } else {
+                                ::close(fd);
+                            }
+                        }
+                    }
+
+                    const bool want = (type == FileType::Directory) ? opt_.includeDirectories : opt_.includeFiles;
+                    if (!want) continue;
+
+                    out.path = JoinUriText(uriBase_, rel);
+                    out.name = name;
+                    out.type = type;
+                    out.hasInfo = opt_.includeInfo && hasStat;
+                    out.info = out.hasInfo ? InfoFromStat(st) : FileInfo{};
+                    return IoResult<bool>::Ok(true);
+                }
+
+                return IoResult<bool>::Ok(false);
+            }
+
+            IoResultVoid Reset() override {
+                if (!open_) {
+                    return IoResultVoid::Err(IoError::Make(
+                        IoErrorCode::NotSupported, "NativeDirectoryIterator: reset on closed iterator"));
+                }
+                CloseAll_();
+                return OpenRoot();
+            }
+
+            IoResultVoid Close() override {
+                CloseAll_();
+                open_ = false;
+                return IoResultVoid::Ok();
+            }
+
+        private:
+            struct Frame final {
+                DIR* dir = nullptr;
+                std::string rel; // root からの相対（"" = root）
+            };
+
+            void CloseAll_() noexcept {
+                for (auto& f : stack_) {
+                    if (f.dir) ::closedir(f.dir);
+                }
+                stack_.clear();
+            }
+
+        private:
+            std::string nativeRoot_;
+            std::string uriBase_;
+            ListOptions opt_{};
+            std::vector<Frame> stack_;
+            bool open_ = false;
+        };
+
+        // ---------------- NativePollingWatcher ----------------
+        // stat ポーリングの watcher
+        // - 監視対象そのもの（ファイル or ディレクトリ）の存在/mtime/size の変化を検出する
+        // - ディレクトリはエントリの追加/削除で mtime が変わるので Modified として届く
+        // - recursive は未対応（Capabilities().supportsRecursiveWatch=false）
+        class NativePollingWatcher final : public IFileWatcher {
+        public:
+            explicit NativePollingWatcher(std::string root) : root_(std::move(root)) {}
+
+            const char* Name() const noexcept override { return "NativePollingWatcher"; }
+            bool IsOpen() const noexcept override { return open_; }
+
+            IoResult<WatchId> AddWatch(const Uri& uri, const WatchOptions& opt = {}) override {
+                if (!open_) {
+                    return IoResult<WatchId>::Err(IoError::Make(IoErrorCode::NotSupported, "NativePollingWatcher: closed"));
+                }
+                auto np = ResolveNativePath(root_, uri);
+                if (!np) return IoResult<WatchId>::Err(std::move(np.error()));
+
+                Entry w;
+                w.uri = uri;
+                w.nativePath = std::move(np.value());
+                w.opt = opt;
+                Probe_(w.nativePath, w.snap);
+
+                const WatchId id = nextId_++;
+                entries_.emplace(id, std::move(w));
+                return IoResult<WatchId>::Ok(id);
+            }
+
+            IoResultVoid RemoveWatch(WatchId id) override {
+                if (entries_.erase(id) == 0) {
+                    return IoResultVoid::Err(IoError::Make(IoErrorCode::NotFound, "NativePollingWatcher: unknown watch id"));
+                }
+                return IoResultVoid::Ok();
+            }
+
+            IoResult<std::size_t> Poll(std::vector<FileChangeEvent>& outEvents, std::size_t maxEvents = 256) override {
+                if (!open_) {
+                    return IoResult<std::size_t>::Err(IoError::Make(IoErrorCode::NotSupported, "NativePollingWatcher: closed"));
+                }
+
+                std::size_t emitted = 0;
+                for (auto& [id, w] : entries_) {
+                    if (emitted >= maxEvents) break;
+
+                    Snapshot now;
+                    Probe_(w.nativePath, now);
+
+                    FileChangeKind kind = FileChangeKind::Unknown;
+                    if (!w.snap.exists && now.exists) kind = FileChangeKind::Created;
+                    else if (w.snap.exists && !now.exists) kind = FileChangeKind::Removed;
+                    else if (now.exists && (now.mtimeNs != w.snap.mtimeNs || now.size != w.snap.size)) kind = FileChangeKind::Modified;
+
+                    const FileType t = now.exists ? now.type : w.snap.type;
+                    w.snap = now;
+
+                    if (kind == FileChangeKind::Unknown) continue;
+                    if (t == FileType::Directory ? !w.opt.watchDirectories : !w.opt.watchFiles) continue;
+
+                    FileChangeEvent ev;
+                    ev.kind = kind;
+                    ev.path = w.uri;
+                    ev.backend = "NativeFS";
+                    outEvents.push_back(std::move(ev));
+                    ++emitted;
+                }
+                return IoResult<std::size_t>::Ok(emitted);
+            }
+
+            IoResultVoid Close() override {
+                entries_.clear();
+                open_ = false;
+                return IoResultVoid::Ok();
+            }
+
+        private:
+            struct Snapshot final {
+                bool exists = false;
+                FileType type = FileType::None;
+                TimeNs mtimeNs = 0;
+                std::uint64_t size = 0;
+            };
+
+            struct Entry final {
+                Uri uri;
+                std::string nativePath;
+                WatchOptions opt{};
+                Snapshot snap{};
+            };
+
+            static void Probe_(const std::string& path, Snapshot& out) {
+                struct stat st {};
+                if (::stat(path.c_str(), &st) != 0) {
+                    out = Snapshot{};
+                    return;
+                }
+                out.exists = true;
+                out.type = TypeFromMode(st.st_mode);
+                out.mtimeNs = ToNs(st.st_mtim);
+                out.size = static_cast<std::uint64_t>(st.st_size);
+            }
+
+        private:
+            std::string root_;
+            std::unordered_map<WatchId, Entry> entries_;
+            WatchId nextId_ = 1;
+            bool open_ = true;
+        };
+
+    } // namespace
+
+    IoResult<std::string> detail::ToNativePath(const std::string& rootDirectory, const Uri& uri) {
+        return ResolveNativePath(rootDirectory, uri);
+    }
+
+    NativeFileSystem::NativeFileSystem() = default;
+    NativeFileSystem::NativeFileSystem(Options opt) : opt_(std::move(opt)) {}
+    NativeFileSystem::~NativeFileSystem() = default;
+
+    void NativeFileSystem::SetOptions(Options opt) { opt_ = std::move(opt); }
+    const NativeFileSystem::Options& NativeFileSystem::GetOptions() const noexcept { return opt_; }
+
+    IoResult<std::unique_ptr<NativeFileStream>>
+    NativeFileSystem::OpenFile(const Uri& uri, FileOpenMode mode) {
+        using R = IoResult<std::unique_ptr<NativeFileStream>>;
+
+        auto np = ResolveNativePath(opt_.rootDirectory, uri);
+        if (!np) return R::Err(std::move(np.error()));
+
+        auto sr = NativeFileStream::Open(np.value(), mode, opt_.readHint);
+        if (!sr) return sr;
+
+        auto& s = sr.value();
+        // 小さいファイルは丸ごと先読みさせる（最初の Read で待たされにくくする）
+        if (Engine::IO::Stream::CanRead(mode) && opt_.willNeedMaxBytes > 0) {
+            auto sz = s->Size();
+            if (sz && sz.value() > 0 && sz.value() <= opt_.willNeedMaxBytes) {
+                s->WillNeed(0, sz.value());
+            }
+        }
+        return sr;
+    }
+
+    IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>
+    NativeFileSystem::Open(const Uri& uri, FileOpenMode mode) {
+        using R = IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>;
+        auto r = OpenFile(uri, mode);
+        if (!r) return R::Err(std::move(r.error()));
+        return R::Ok(std::move(r.value()));
+    }
+
+    IoResult<bool> NativeFileSystem::Exists(const Uri& uri) {
+        auto np = ResolveNativePath(opt_.rootDirectory, uri);
+        if (!np) return IoResult<bool>::Err(std::move(np.error()));
+
+        struct stat st {};
+        if (::stat(np.value().c_str(), &st) == 0) return IoResult<bool>::Ok(true);
+        if (errno == ENOENT || errno == ENOTDIR) return IoResult<bool>::Ok(false);
+        return IoResult<bool>::Err(detail::IoErrorFromErrno(errno, IoErrorCode::ReadFailed, "NativeFS: stat failed", np.value()));
+    }
+
+    IoResult<FileInfo> NativeFileSystem::Stat(const Uri& uri) {
+        auto np = ResolveNativePath(opt_.rootDirectory, uri);
+        if (!np) return IoResult<FileInfo>::Err(std::move(np.error()));
+
+        struct stat st {};
+        if (::stat(np.value().c_str(), &st) != 0) {
+            return IoResult<FileInfo>::Err(detail::IoErrorFromErrno(errno, IoErrorCode::ReadFailed, "NativeFS: stat failed", np.value()));
+        }
+        return IoResult<FileInfo>::Ok(InfoFromStat(st));
+    }
+
+    IoResultVoid NativeFileSystem::CreateDirectories(const Uri& uri) {
+        auto np = ResolveNativePath(opt_.rootDirectory, uri);
+        if (!np) return IoResultVoid::Err(std::move(np.error()));
+
+        const std::string& path = np.value();
+        // 先頭から 1 要素ずつ mkdir（mkdir -p）
+        for (std::size_t i = 1; i <= path.size(); ++i) {
+            if (i != path.size() && path[i] != '/') continue;
+
+            const std::string part = path.substr(0, i);
+            if (::mkdir(part.c_str(), 0755) == 0) continue;
+            if (errno != EEXIST) {
+                return IoResultVoid::Err(detail::IoErrorFromErrno(errno, IoErrorCode::WriteFailed, "NativeFS: mkdir failed", part));
+            }
+
+            struct stat st {};
+            if (::stat(part.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) {
+                return IoResultVoid::Err(IoError::Make(IoErrorCode::AlreadyExists, "NativeFS: path exists and is not a directory", part));
+            }
+        }
+        return IoResultVoid::Ok();
+    }
+
+    IoResultVoid NativeFileSystem::Remove(const Uri& uri, const RemoveOptions& opt) {
+        auto np = ResolveNativePath(opt_.rootDirectory, uri);
+        if (!np) return IoResultVoid::Err(std::move(np.error()));
+
+        const std::string& path = np.value();
+        struct stat st {};
+        if (::lstat(path.c_str(), &st) != 0) {
+            return IoResultVoid::Err(detail::IoErrorFromErrno(errno, IoErrorCode::WriteFailed, "NativeFS: lstat failed", path));
+        }
+
+        if (S_ISDIR(st.st_mode)) {
+            if (opt.recursive) return RemoveTree(path);
+            if (::rmdir(path.c_str()) != 0) {
+                return IoResultVoid::Err(detail::IoErrorFromErrno(errno, IoErrorCode::WriteFailed, "NativeFS: rmdir failed", path));
+            }
+            return IoResultVoid::Ok();
+        }
+
+        if (::unlink(path.c_str()) != 0) {
+            return IoResultVoid::Err(detail::IoErrorFromErrno(errno, IoErrorCode::WriteFailed, "NativeFS: unlink failed", path));
+        }
+        return IoResultVoid::Ok();
+    }
+
+    IoResultVoid NativeFileSystem::Move(const Uri& from, const Uri& to) {
+        auto a = ResolveNativePath(opt_.rootDirectory, from);
+        if (!a) return IoResultVoid::Err(std::move(a.error()));
+        auto b = ResolveNativePath(opt_.rootDirectory, to);
+        if (!b) return IoResultVoid::Err(std::move(b.error()));
+
+        if (::rename(a.value().c_str(), b.value().c_str()) != 0) {
+            return IoResultVoid::Err(detail::IoErrorFromErrno(errno, IoErrorCode::WriteFailed, "NativeFS: rename failed", a.value()));
+        }
+        return IoResultVoid::Ok();
+    }
+
+    IoResultVoid NativeFileSystem::Copy(const Uri& from, const Uri& to) {
+        auto a = ResolveNativePath(opt_.rootDirectory, from);
+        if (!a) return IoResultVoid::Err(std::move(a.error()));
+        auto b = ResolveNativePath(opt_.rootDirectory, to);
+        if (!b) return IoResultVoid::Err(std::move(b.error()));
+
+        auto src = NativeFileStream::Open(a.value(), Engine::IO::Stream::OpenReadBinary(), AccessHint::Sequential);
+        if (!src) return IoResultVoid::Err(std::move(src.error()));
+
+        // 隣の一時ファイルに書いてから rename する（途中で失敗しても to は元のまま / 半端なファイルを残さない）
+        const std::string tmp = b.value() + ".tmp~";
+        auto dst = NativeFileStream::Open(tmp, Engine::IO::Stream::OpenWriteBinaryTruncate(true), AccessHint::Sequential);
+        if (!dst) return IoResultVoid::Err(std::move(dst.error()));
+
+        const auto fail = [&](IoError e) {
+            (void)dst.value()->Close();
+            (void)::unlink(tmp.c_str());
+            return IoResultVoid::Err(std::move(e));
+        };
+
+        std::vector<std::byte> buf(opt_.copyBufferBytes > 0 ? opt_.copyBufferBytes : 64 * 1024);
+        for (;;) {
+            auto rr = src.value()->Read(buf.data(), buf.size());
+            if (!rr) return fail(std::move(rr.error()));
+            if (rr.value() == 0) break;
+
+            auto wr = dst.value()->Write(buf.data(), rr.value());
+            if (!wr) return fail(std::move(wr.error()));
+        }
+
+        auto cr = dst.value()->Close();
+        if (!cr) {
+            (void)::unlink(tmp.c_str());
+            return cr;
+        }
+        if (::rename(tmp.c_str(), b.value().c_str()) != 0) {
+            const int err = errno;
+            (void)::unlink(tmp.c_str());
+            return IoResultVoid::Err(detail::IoErrorFromErrno(err, IoErrorCode::WriteFailed, "NativeFS: rename failed", b.value()));
+        }
+        return IoResultVoid::Ok();
+    }
+
+    IoResult<std::vector<DirectoryEntry>>
+    NativeFileSystem::List(const Uri& uri, const ListOptions& opt) {
+        using R = IoResult<std::vector<DirectoryEntry>>;
+
+        auto it = Iterate(uri, opt);
+        if (!it) return R::Err(std::move(it.error()));
+
+        std::vector<DirectoryEntry> out;
+        DirectoryEntry e;
+        for (;;) {
+            auto nr = it.value()->Next(e);
+            if (!nr) return R::Err(std::move(nr.error()));
+            if (!nr.value()) break;
+            out.push_back(std::move(e));
+        }
+        return R::Ok(std::move(out));
+    }
+
+    IoResult<std::string> NativeFileSystem::ToNativePathString(const Uri& uri) {
+        return ResolveNativePath(opt_.rootDirectory, uri);
+    }
+
+    FileSystemCapabilities NativeFileSystem::Capabilities() const noexcept {
+        FileSystemCapabilities c;
+        c.canIterate = true;
+        c.supportsSymlink = true;
+        c.supportsPermissions = true;
+        c.supportsHiddenFlag = true;   // dotfile を hidden とみなす
+        c.caseSensitivePaths = true;
+        c.supportsToNativePath = true;
+        c.supportsMtime = true;
+        c.supportsCtime = true;
+        c.supportsAtime = true;
+        c.supportsWatch = true;
+        // recursive は InotifyFileWatcher のみ（inotify が使えず polling に落ちた場合は AddWatch で無視される）
+#if defined(__linux__)
+        c.supportsRecursiveWatch = true;
+#else
+        c.supportsRecursiveWatch = false;
+#endif
+        c.maxPathBytes = PATH_MAX;
+        c.maxNameBytes = NAME_MAX;
+        return c;
+    }
+
+    IoResult<std::unique_ptr<DirectoryIterator>>
+    NativeFileSystem::Iterate(const Uri& uri, const ListOptions& opt) {
+        using R = IoResult<std::unique_ptr<DirectoryIterator>>;
+
+        auto np = ResolveNativePath(opt_.rootDirectory, uri);
+        if (!np) return R::Err(std::move(np.error()));
+
+        auto it = std::make_unique<NativeDirectoryIterator>(std::move(np.value()), uri.ToString(), opt);
+        auto or_ = it->OpenRoot();
+        if (!or_) return R::Err(std::move(or_.error()));
+        return R::Ok(std::move(it));
+    }
+
+    IoResult<std::unique_ptr<IFileWatcher>> NativeFileSystem::CreateWatcher() {
+        if (auto w = InotifyFileWatcher::TryCreate(opt_.rootDirectory)) {
+            return IoResult<std::unique_ptr<IFileWatcher>>::Ok(std::move(w));
+        }
+        return IoResult<std::unique_ptr<IFileWatcher>>::Ok(
+            std::make_unique<NativePollingWatcher>(opt_.rootDirectory));
+    }
+
+    IoResultVoid NativeFileSystem::SyncDirectory(const Uri& uri) {
+        auto np = ResolveNativePath(opt_.rootDirectory, uri);
+        if (!np) return IoResultVoid::Err(std::move(np.error()));
+        const std::string& path = np.value().empty() ? std::string(".") : np.value();
+
+        const int fd = ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd < 0) {
+            return IoResultVoid::Err(detail::IoErrorFromErrno(errno, IoErrorCode::WriteFailed, "NativeFS: open dir failed", path));
+        }
+        const int rc = ::fsync(fd);
+        const int err = errno;
+        ::close(fd);
+        if (rc != 0) {
+            return IoResultVoid::Err(detail::IoErrorFromErrno(err, IoErrorCode::WriteFailed, "NativeFS: fsync dir failed", path));
+        }
+        return IoResultVoid::Ok();
+    }
+
+} // namespace Engine::IO::FS
@@ -0,0 +1,513 @@
+#include "engine/io/fs/VfsDirectoryIndex.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace Engine::IO::FS {
+
+    namespace {
+        using Engine::IO::Path::UriView;
+        using Engine::IO::IoErrorCode;
+
+        constexpr std::uint32_t kNoOwner = std::numeric_limits<std::uint32_t>::max();
+
+        // "scheme://" より後ろ（前後の "/" を除く）
+        std::string RelOf(UriView u) {
+            std::string r;
+            detail::AppendRelText(r, u);
+            while (!r.empty() && (r.back() == '/' || r.back() == '\\')) r.pop_back();
+            return r;
+        }
+
+        bool IsHiddenName(std::string_view name) noexcept {
+            return !name.empty() && name.front() == '.';
+        }
+
+        void AppendSegment(std::string& rel, std::string_view name) {
+            if (!rel.empty()) rel.push_back('/');
+            rel.append(name.data(), name.size());
+        }
+
+    } // namespace
+
+    struct VfsDirectoryIndex::Node final {
+        FileType type = FileType::Directory;
+        std::uint64_t size = 0;
+        TimeNs mtime = 0;
+        std::uint32_t owner = kNoOwner; // ファイルのみ
+
+        std::map<std::string, std::unique_ptr<Node>, std::less<>> children;
+
+        bool IsDirectory() const noexcept { return type == FileType::Directory; }
+    };
+
+    struct VfsDirectoryIndex::SchemeTree final {
+        std::string scheme;
+        std::unique_ptr<Node> root;
+    };
+
+    namespace {
+        using Node = VfsDirectoryIndex::Node;
+
+        // mp の rel ディレクトリ配下を dir に入れる
+        // 既にある名前は触らない（先に入れた = priority の高い mount が勝つ）。ディレクトリ同士は中身を合成する
+        IoResultVoid Fill(const MountTable& mounts, const MountPoint& mp, std::uint32_t owner, std::string& rel, Node& dir) {
+            ListOptions opt;
+            opt.includeHidden = true;
+            opt.includeInfo = true;
+
+            auto lr = mp.fs->List(mounts.ResolveRel(mp, rel), opt);
+            if (!lr) {
+                if (detail::IsNotFound(lr.error())) return IoResultVoid::Ok();
+                return IoResultVoid::Err(std::move(lr.error()));
+            }
+
+            for (auto& e : lr.value()) {
+                if (e.name.empty()) continue;
+
+                auto [it, inserted] = dir.children.try_emplace(e.name);
+                if (inserted) {
+                    auto n = std::make_unique<Node>();
+                    n->type = e.type;
+                    if (!e.IsDirectory()) {
+                        n->owner = owner;
+                        if (e.hasInfo) {
+                            n->size = e.info.sizeBytes;
+                            n->mtime = e.info.mtimeNs;
+                        }
+                    }
+                    it->second = std::move(n);
+                }
+
+                Node& n = *it->second;
+                if (e.IsDirectory() && n.IsDirectory()) {
+                    const std::size_t len = rel.size();
+                    AppendSegment(rel, e.name);
+                    auto fr = Fill(mounts, mp, owner, rel, n);
+                    rel.resize(len);
+                    if (!fr) return fr;
+                }
+            }
+            return IoResultVoid::Ok();
+        }
+
+        // rel 1 パス分を cands（priority 降順）から組み立てる。どこにも無ければ nullptr
+        IoResult<std::unique_ptr<Node>> BuildPath(const MountTable& mounts,
+                                                  const std::vector<const MountPoint*>& cands,
+                                                  const std::vector<std::uint32_t>& owners,
+                                                  const std::string& rel) {
+            using R = IoResult<std::unique_ptr<Node>>;
+
+            std::unique_ptr<Node> node;
+            if (rel.empty()) node = std::make_unique<Node>(); // root は常にディレクトリ
+
+            for (std::size_t i = 0; i < cands.size(); ++i) {
+                const MountPoint* mp = cands[i];
+                if (!mp || !mp->fs) continue;
+
+                bool isDir = rel.empty();
+                if (!rel.empty()) {
+                    auto sr = mp->fs->Stat(mounts.ResolveRel(*mp, rel));
+                    if (!sr) {
+                        if (detail::IsNotFound(sr.error())) continue;
+                        return R::Err(std::move(sr.error()));
+                    }
+                    const FileInfo& info = sr.value();
+                    isDir = info.IsDirectory();
+                    if (!node) {
+                        node = std::make_unique<Node>();
+                        node->type = info.type;
+                        if (!isDir) {
+                            node->owner = owners[i];
+                            node->size = info.sizeBytes;
+                            node->mtime = info.mtimeNs;
+                        }
+                    }
+                }
+
+                if (isDir && node->IsDirectory()) {
+                    std::string r = rel;
+                    auto fr = Fill(mounts, *mp, owners[i], r, *node);
+                    if (!fr) return R::Err(std::move(fr.error()));
+                }
+            }
+            return R::Ok(std::move(node));
+        }
+
+        // src を dst に重ねる（src は新しく足された 1 mount 分）
+        // ファイル同士は rank（小さいほど priority が高い）で勝者を決める。ファイルとディレクトリがぶつかったら conflicts に積む
+        void Merge(Node& dst, Node& src, const std::vector<std::size_t>& rankOf,
+                   std::string& rel, std::vector<std::string>& conflicts) {
+            auto rank = [&](std::uint32_t owner) {
+                return owner < rankOf.size() ? rankOf[owner] : std::numeric_limits<std::size_t>::max();
+            };
+
+            for (auto& [name, child] : src.children) {
+                auto it = dst.children.find(name);
+                if (it == dst.children.end()) {
+                    dst.children.emplace(name, std::move(child));
+                    continue;
+                }
+
+                Node& d = *it->second;
+                const std::size_t len = rel.size();
+                AppendSegment(rel, name);
+
+                if (d.IsDirectory() && child->IsDirectory()) {
+                    Merge(d, *child, rankOf, rel, conflicts);
+                } else if (!d.IsDirectory() && !child->IsDirectory()) {
+                    if (rank(child->owner) < rank(d.owner)) {
+                        d.type = child->type;
+                        d.size = child->size;
+                        d.mtime = child->mtime;
+                        d.owner = child->owner;
+                    }
+                } else {
+                    conflicts.push_back(rel);
+                }
+                rel.resize(len);
+            }
+        }
+
+        void Collect(const Node& dir, const std::string& scheme, std::string& rel, const ListOptions& opt,
+                     const std::vector<std::string>& owners, std::vector<DirectoryEntry>& out) {
+            for (const auto& [name, child] : dir.children) {
+                if (!opt.includeHidden && IsHiddenName(name)) continue;
+
+                const std::size_t len = rel.size();
+                AppendSegment(rel, name);
+
+                const bool isDir = child->IsDirectory();
+                if (isDir ? opt.includeDirectories : opt.includeFiles) {
+                    DirectoryEntry e;
+                    e.path.reserve(scheme.size() + 3 + rel.size());
+                    e.path += scheme;
+                    e.path += "://";
+                    e.path += rel;
+                    e.name = name;
+                    e.type = child->type;
+                    if (opt.includeInfo) {
+                        e.info.type = child->type;
+                        e.info.sizeBytes = child->size;
+                        e.info.mtimeNs = child->mtime;
+                        if (child->owner < owners.size()) e.info.backend = owners[child->owner];
+                        e.hasInfo = true;
+                    }
+                    out.push_back(std::move(e));
+                }
+                if (isDir && opt.recursive) Collect(*child, scheme, rel, opt, owners, out);
+
+                rel.resize(len);
+            }
+        }
+
+        void Count(const Node& dir, VfsDirectoryIndex::Stats& st) {
+            for (const auto& [name, child] : dir.children) {
+                if (child->IsDirectory()) {
+                    ++st.directories;
+                    Count(*child, st);
+                } else {
+                    ++st.files;
+                }
+            }
+        }
+
+        // rel をたどる（途中で無ければ nullptr）
+        const Node* Walk(const Node& root, std::string_view rel) {
+            const Node* n = &root;
+            while (!rel.empty()) {
+                const auto slash = rel.find('/');
+                const std::string_view seg = rel.substr(0, slash);
+                rel = (slash == std::string_view::npos) ? std::string_view{} : rel.substr(slash + 1);
+                if (seg.empty()) continue;
+
+                if (!n->IsDirectory()) return nullptr;
+                auto it = n->children.find(seg);
+                if (it == n->children.end()) return nullptr;
+                n = it->second.get();
+            }
+            return n;
+        }
+
+    } // namespace
+
+    VfsDirectoryIndex::VfsDirectoryIndex() = default;
+    VfsDirectoryIndex::~VfsDirectoryIndex() = default;
+
+    std::uint32_t VfsDirectoryIndex::Intern_(const std::string& mountName) {
+        std::unique_lock<std::shared_mutex> lk(mutex_);
+        for (std::size_t i = 0; i < owners_.size(); ++i) {
+            if (owners_[i] == mountName) return static_cast<std::uint32_t>(i);
+        }
+        owners_.push_back(mountName);
+        return static_cast<std::uint32_t>(owners_.size() - 1);
+    }
+
+    IoResultVoid VfsDirectoryIndex::Rebuild(const MountTable& mounts) {
+        std::vector<std::string> schemes;
+        for (const auto& m : mounts.All()) {
+            const std::string_view s = detail::SchemeName(m.mountUri);
+            if (s.empty()) continue;
+            if (std::find(schemes.begin(), schemes.end(), s) == schemes.end()) schemes.emplace_back(s);
+        }
+
+        {
+            std::unique_lock<std::shared_mutex> lk(mutex_);
+            trees_.clear();
+        }
+
+        IoResultVoid first = IoResultVoid::Ok();
+        for (const auto& s : schemes) {
+            auto r = RebuildScheme(mounts, s);
+            if (!r && first) first = std::move(r);
+        }
+        return first;
+    }
+
+    IoResultVoid VfsDirectoryIndex::RebuildScheme(const MountTable& mounts, std::string_view scheme) {
+        const auto& cands = mounts.CandidatesForScheme(scheme);
+
+        std::vector<std::uint32_t> owners;
+        owners.reserve(cands.size());
+        for (const auto* mp : cands) owners.push_back(Intern_(mp->name));
+
+        // 列挙は lock の外
+        std::unique_ptr<Node> root;
+        IoResultVoid result = IoResultVoid::Ok();
+        if (!cands.empty()) {
+            auto br = BuildPath(mounts, cands, owners, std::string{});
+            if (br) root = std::move(br.value());
+            else result = IoResultVoid::Err(std::move(br.error()));
+        }
+
+        std::unique_lock<std::shared_mutex> lk(mutex_);
+        ++refreshes_;
+        auto it = std::find_if(trees_.begin(), trees_.end(),
+            [&](const std::unique_ptr<SchemeTree>& t) { return t->scheme == scheme; });
+
+        if (!root) {
+            // mount が無い / 列挙に失敗した scheme は索引しない
+            if (it != trees_.end()) trees_.erase(it);
+            return result;
+        }
+        if (it == trees_.end()) {
+            auto t = std::make_unique<SchemeTree>();
+            t->scheme = std::string(scheme);
+            trees_.push_back(std::move(t));
+            it = std::prev(trees_.end());
+        }
+        (*it)->root = std::move(root);
+        return result;
+    }
+
+    IoResultVoid VfsDirectoryIndex::AddMount(const MountTable& mounts, const MountPoint& mp) {
+        const std::string_view scheme = detail::SchemeName(mp.mountUri);
+        if (scheme.empty() || !mp.fs) return IoResultVoid::Ok();
+
+        if (!HasScheme_(scheme)) return RebuildScheme(mounts, scheme);
+
+        // 新しい mount だけを列挙
+        const std::uint32_t owner = Intern_(mp.name);
+        auto br = BuildPath(mounts, { &mp }, { owner }, std::string{});
+        if (!br) {
+            std::unique_lock<std::shared_mutex> lk(mutex_);
+            trees_.erase(std::remove_if(trees_.begin(), trees_.end(),
+                [&](const std::unique_ptr<SchemeTree>& t) { return t->scheme == scheme; }), trees_.end());
+            return IoResultVoid::Err(std::move(br.error()));
+        }
+
+        std::vector<std::string> conflicts;
+        {
+            std::unique_lock<std::shared_mutex> lk(mutex_);
+            ++refreshes_;
+
+            // owner id -> 現在の priority 順位
+            std::vector<std::size_t> rankOf(owners_.size(), std::numeric_limits<std::size_t>::max());
+            const auto& cands = mounts.CandidatesForScheme(scheme);
+            for (std::size_t i = 0; i < cands.size(); ++i) {
+                for (std::size_t o = 0; o < owners_.size(); ++o) {
+                    if (owners_[o] == cands[i]->name) rankOf[o] = std::min(rankOf[o], i);
+                }
+            }
+
+            for (auto& t : trees_) {
+                if (t->scheme != scheme) continue;
+                std::string rel;
+                Merge(*t->root, *br.value(), rankOf, rel, conflicts);
+            }
+        }
+
+        // ファイルとディレクトリが入れ替わる所は全候補から取り直す
+        for (const auto& rel : conflicts) {
+            auto r = RefreshRel_(mounts, std::string(scheme), rel);
+            if (!r) return r;
+        }
+        return IoResultVoid::Ok();
+    }
+
+    IoResultVoid VfsDirectoryIndex::Refresh(const MountTable& mounts, UriView vfsUri) {
+        return RefreshRel_(mounts, std::string(detail::SchemeName(vfsUri)), RelOf(vfsUri));
+    }
+
+    IoResultVoid VfsDirectoryIndex::RefreshRel_(const MountTable& mounts, const std::string& scheme, const std::string& rel) {
+        // 索引していない scheme は何もしない
+        if (!HasScheme_(scheme)) return IoResultVoid::Ok();
+        if (rel.empty()) return RebuildScheme(mounts, scheme);
+
+        const auto& cands = mounts.CandidatesForScheme(scheme);
+        std::vector<std::uint32_t> owners;
+        owners.reserve(cands.size());
+        for (const auto* mp : cands) owners.push_back(Intern_(mp->name));
+
+        auto br = BuildPath(mounts, cands, owners, rel);
+        if (!br) return IoResultVoid::Err(std::move(br.error()));
+        std::unique_ptr<Node> node = std::move(br.value());
+
+        std::unique_lock<std::shared_mutex> lk(mutex_);
+        ++refreshes_;
+        for (auto& t : trees_) {
+            if (t->scheme != scheme) continue;
+
+            // 親までたどる（差し込む時は途中のディレクトリを作る）
+            Node* parent = t->root.get();
+            std::string_view rest = rel;
+            for (;;) {
+                const auto slash = rest.find('/');
+                if (slash == std::string_view::npos) break;
+                const std::string_view seg = rest.substr(0, slash);
+                rest.remove_prefix(slash + 1);
+                if (seg.empty()) continue;
+
+                auto it = parent->children.find(seg);
+                if (it == parent->children.end()) {
+                    if (!node) return IoResultVoid::Ok();
+                    it = parent->children.emplace(std::string(seg), std::make_unique<Node>()).first;
+                } else if (!it->second->IsDirectory()) {
+                    if (!node) return IoResultVoid::Ok();
+                    *it->second = Node{};
+                }
+                parent = it->second.get();
+            }
+
+            if (node) {
+                auto it = parent->children.find(rest);
+                if (it == parent->children.end()) parent->children.emplace(std::string(rest), std::move(node));
+                else it->second = std::move(node);
+            } else {
+                auto it = parent->children.find(rest);
+                if (it != parent->children.end()) parent->children.erase(it);
+            }
+            break;
+        }
+        return IoResultVoid::Ok();
+    }
+
+    void VfsDirectoryIndex::ApplyChanges(const MountTable& mounts, const std::vector<FileChangeEvent>& events) {
+        // (scheme, rel) に直して重複を除く
+        std::vector<std::pair<std::string, std::string>> targets;
+        auto add = [&](UriView changed) {
+            const std::string p = RelOf(changed);
+            for (const auto& m : mounts.All()) {
+                const std::string_view scheme = detail::SchemeName(m.mountUri);
+                if (scheme.empty()) continue;
+
+                const std::string root = RelOf(m.rootUri);
+                std::string rel;
+                if (root.empty()) rel = p;
+                else if (p == root) rel.clear();
+                else if (p.size() > root.size() && p.compare(0, root.size(), root) == 0 && p[root.size()] == '/') rel = p.substr(root.size() + 1);
+                else continue;
+
+                std::pair<std::string, std::string> key(std::string(scheme), std::move(rel));
+                if (std::find(targets.begin(), targets.end(), key) == targets.end()) targets.push_back(std::move(key));
+            }
+        };
+
+        for (const auto& ev : events) {
+            add(ev.path);
+            if (ev.hasOldPath) add(ev.oldPath);
+        }
+
+        for (const auto& [scheme, rel] : targets) {
+            (void)RefreshRel_(mounts, scheme, rel);
+        }
+    }
+
+    void VfsDirectoryIndex::Clear() {
+        std::unique_lock<std::shared_mutex> lk(mutex_);
+        trees_.clear();
+        owners_.clear();
+    }
+
+    bool VfsDirectoryIndex::IsIndexed(UriView vfsUri) const {
+        return HasScheme_(detail::SchemeName(vfsUri));
+    }
+
+    bool VfsDirectoryIndex::HasScheme_(std::string_view scheme) const {
+        if (scheme.empty()) return false;
+
+        std::shared_lock<std::shared_mutex> lk(mutex_);
+        for (const auto& t : trees_) {
+            if (t->scheme == scheme) return true;
+        }
+        return false;
+    }
+
+    std::optional<VfsDirectoryIndex::FileRecord> VfsDirectoryIndex::Find(UriView vfsUri) const {
+        const std::string_view scheme = detail::SchemeName(vfsUri);
+        const std::string rel = RelOf(vfsUri);
+
+        std::shared_lock<std::shared_mutex> lk(mutex_);
+        for (const auto& t : trees_) {
+            if (t->scheme != scheme) continue;
+
+            const Node* n = Walk(*t->root, rel);
+            if (!n) return std::nullopt;
+
+            FileRecord r;
+            r.type = n->type;
+            r.sizeBytes = n->size;
+            r.mtimeNs = n->mtime;
+            if (n->owner < owners_.size()) r.mount = owners_[n->owner];
+            return r;
+        }
+        return std::nullopt;
+    }
+
+    IoResult<std::vector<DirectoryEntry>> VfsDirectoryIndex::List(UriView vfsUri, const ListOptions& opt) const {
+        using R = IoResult<std::vector<DirectoryEntry>>;
+
+        const std::string_view scheme = detail::SchemeName(vfsUri);
+        std::string rel = RelOf(vfsUri);
+
+        std::shared_lock<std::shared_mutex> lk(mutex_);
+        for (const auto& t : trees_) {
+            if (t->scheme != scheme) continue;
+
+            const Node* n = Walk(*t->root, rel);
+            if (!n || !n->IsDirectory()) {
+                return R::Err(IoError::Make(IoErrorCode::NotFound, "VfsDirectoryIndex: directory not found", rel));
+            }
+
+            std::vector<DirectoryEntry> out;
+            out.reserve(n->children.size());
+            Collect(*n, t->scheme, rel, opt, owners_, out);
+            return R::Ok(std::move(out));
+        }
+        return R::Err(IoError::Make(IoErrorCode::NotFound, "VfsDirectoryIndex: scheme not indexed", std::string(scheme)));
+    }
+
+    VfsDirectoryIndex::Stats VfsDirectoryIndex::GetStats() const {
+        std::shared_lock<std::shared_mutex> lk(mutex_);
+        Stats st;
+        st.schemes = trees_.size();
+        st.refreshes = refreshes_;
+        for (const auto& t : trees_) Count(*t->root, st);
+        return st;
+    }
+
+} // namespace Engine::IO::FS
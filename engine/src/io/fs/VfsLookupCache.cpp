@@ -0,0 +1,96 @@
+#include "engine/io/fs/VfsLookupCache.hpp"
+
+#include <utility>
+
+namespace Engine::IO::FS {
+
+    void VfsLookupCache::SetOptions(Options opt) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        opt_ = opt;
+        if (!opt_.enabled) map_.clear();
+    }
+
+    void VfsLookupCache::SyncGeneration_(std::uint64_t generation) {
+        if (generation == generation_) return;
+        generation_ = generation;
+        if (!map_.empty()) {
+            map_.clear();
+            ++stats_.invalidations;
+        }
+    }
+
+    void VfsLookupCache::Insert_(std::string key, Entry e) {
+        if (opt_.maxEntries != 0 && map_.size() >= opt_.maxEntries && map_.find(key) == map_.end()) {
+            map_.clear();
+            ++stats_.invalidations;
+        }
+        map_.insert_or_assign(std::move(key), std::move(e));
+    }
+
+    std::optional<VfsLookupCache::Entry> VfsLookupCache::Find(const std::string& key, std::uint64_t generation) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        if (!opt_.enabled) return std::nullopt;
+
+        SyncGeneration_(generation);
+        auto it = map_.find(key);
+        if (it == map_.end()) {
+            ++stats_.misses;
+            return std::nullopt;
+        }
+        if (it->second.Found()) ++stats_.hits;
+        else                    ++stats_.negativeHits;
+        return it->second;
+    }
+
+    void VfsLookupCache::StoreFound(std::string key, std::uint64_t generation, const MountPoint& mp,
+                                    Engine::IO::Path::Uri nativeUri) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        if (!opt_.enabled) return;
+
+        SyncGeneration_(generation);
+        Entry e;
+        e.mp = &mp;
+        e.nativeUri = std::move(nativeUri);
+        Insert_(std::move(key), std::move(e));
+    }
+
+    void VfsLookupCache::StoreMissing(std::string key, std::uint64_t generation) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        if (!opt_.enabled || !opt_.cacheNegative) return;
+
+        SyncGeneration_(generation);
+        Insert_(std::move(key), Entry{});
+    }
+
+    void VfsLookupCache::Erase(const std::string& key) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        map_.erase(key);
+    }
+
+    void VfsLookupCache::Clear() {
+        std::lock_guard<std::mutex> lk(mutex_);
+        if (map_.empty()) return;
+        map_.clear();
+        ++stats_.invalidations;
+    }
+
+    void VfsLookupCache::ApplyChanges(const std::vector<FileChangeEvent>& events) {
+        for (const auto& ev : events) {
+            if (ev.kind != FileChangeKind::Modified) {
+                Clear();
+                return;
+            }
+        }
+    }
+
+    std::size_t VfsLookupCache::Size() const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return map_.size();
+    }
+
+    VfsLookupCache::Stats VfsLookupCache::GetStats() const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return stats_;
+    }
+
+} // namespace Engine::IO::FS
@@ -0,0 +1,177 @@
+#include "engine/io/pak/PakArchive.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include "engine/io/async/IoWorkerPool.hpp"
+#include "engine/io/compression/LzFrame.hpp"
+#include "engine/io/stream/SpanStream.hpp"
+
+namespace Engine::IO::Pak {
+
+    using Engine::IO::IoErrorCode;
+
+    IoResult<std::shared_ptr<const PakArchive>> PakArchive::FromBuffer(Base::SharedBuffer image) {
+        using R = IoResult<std::shared_ptr<const PakArchive>>;
+
+        PakHeader h;
+        if (!DecodeHeader(image.data(), image.size(), h)) {
+            return R::Err(IoError::Make(IoErrorCode::ReadFailed, "PakArchive: bad magic or truncated header"));
+        }
+        if (h.version != kVersion) {
+            return R::Err(IoError::Make(IoErrorCode::NotSupported, "PakArchive: unsupported version",
+                                        "version=" + std::to_string(h.version)));
+        }
+
+        // TOC / string table が image に収まっているか（payload 範囲は Read 時に検査）
+        const std::uint64_t size = image.size();
+        const std::uint64_t tocBytes = static_cast<std::uint64_t>(h.entryCount) * kTocEntrySize;
+        if (h.tocOffset > size || tocBytes > size - h.tocOffset ||
+            h.stringsOffset > size || h.stringsSize > size - h.stringsOffset) {
+            return R::Err(IoError::Make(IoErrorCode::ReadFailed, "PakArchive: toc out of range"));
+        }
+
+        auto a = std::shared_ptr<PakArchive>(new PakArchive());
+        a->header_ = h;
+        a->toc_ = image.data() + h.tocOffset;
+        a->strings_ = reinterpret_cast<const char*>(image.data() + h.stringsOffset);
+        a->image_ = std::move(image);
+        return R::Ok(std::move(a));
+    }
+
+    PakTocEntry PakArchive::EntryAt(std::size_t index) const noexcept {
+        return DecodeTocEntry(toc_ + index * kTocEntrySize);
+    }
+
+    std::string_view PakArchive::PathOf(const PakTocEntry& e) const noexcept {
+        // 壊れた TOC でも範囲外を読まない
+        if (e.pathOffset > header_.stringsSize || e.pathLength > header_.stringsSize - e.pathOffset) return {};
+        return std::string_view(strings_ + e.pathOffset, e.pathLength);
+    }
+
+    std::optional<PakTocEntry> PakArchive::Find(std::string_view path) const {
+        const std::uint64_t h = HashPath(path);
+
+        // hash 昇順の TOC を lower_bound
+        std::size_t lo = 0;
+        std::size_t hi = header_.entryCount;
+        while (lo < hi) {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            if (detail::LoadU64(toc_ + mid * kTocEntrySize) < h) lo = mid + 1;
+            else hi = mid;
+        }
+
+        // 同 hash（衝突）は path で確定
+        for (std::size_t i = lo; i < header_.entryCount; ++i) {
+            if (detail::LoadU64(toc_ + i * kTocEntrySize) != h) break;
+            PakTocEntry e = EntryAt(i);
+            if (PathOf(e) == path) return e;
+        }
+        return std::nullopt;
+    }
+
+    namespace {
+        // これ未満のブロック数なら、スレッドを起こすより 1 スレッドで展開した方が速い
+        constexpr std::size_t kParallelDecodeMinBlocks = 4;
+    } // namespace
+
+    IoResult<Base::SharedBuffer> PakArchive::Stored_(const PakTocEntry& e) const {
+        if (e.dataOffset > image_.size() || e.storedSize > image_.size() - e.dataOffset) {
+            return IoResult<Base::SharedBuffer>::Err(
+                IoError::Make(IoErrorCode::ReadFailed, "PakArchive: payload out of range", std::string(PathOf(e))));
+        }
+        return IoResult<Base::SharedBuffer>::Ok(image_.Slice(static_cast<std::size_t>(e.dataOffset),
+                                                             static_cast<std::size_t>(e.storedSize)));
+    }
+
+    IoResult<Engine::IO::Compression::LzFrame> PakArchive::Frame_(const PakTocEntry& e) const {
+        using R = IoResult<Engine::IO::Compression::LzFrame>;
+
+        auto stored = Stored_(e);
+        if (!stored) return R::Err(std::move(stored.error()));
+
+        auto fr = Engine::IO::Compression::LzFrame::Parse(std::move(stored.value()));
+        if (!fr) return fr;
+        if (fr.value().OriginalSize() != e.originalSize) {
+            return R::Err(IoError::Make(IoErrorCode::ReadFailed, "PakArchive: size mismatch in compressed payload",
+                                        std::string(PathOf(e))));
+        }
+        return fr;
+    }
+
+    IoResult<Base::SharedBuffer> PakArchive::Read(const PakTocEntry& e) const {
+        using R = IoResult<Base::SharedBuffer>;
+
+        switch (e.compression) {
+        case PakCompression::None:
+            return Stored_(e);
+        case PakCompression::Lz: {
+            auto fr = Frame_(e);
+            if (!fr) return R::Err(std::move(fr.error()));
+            const auto& frame = fr.value();
+            // 呼び出しスレッド + 共有 IoWorkerPool で展開する（Read 毎に thread を作らない）
+            const std::size_t workers = frame.BlockCount() >= kParallelDecodeMinBlocks
+                ? Engine::IO::Async::IoWorkerPool::Shared()->ThreadCount() + 1
+                : 1;
+            return frame.DecodeAll(workers);
+        }
+        default:
+            return R::Err(IoError::Make(IoErrorCode::NotSupported, "PakArchive: unsupported compression",
+                                        std::string(PathOf(e))));
+        }
+    }
+
+    IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>
+    PakArchive::OpenStream(const PakTocEntry& e, const Engine::IO::Compression::LzDecodeStream::Options& decode) const {
+        using R = IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>;
+
+        switch (e.compression) {
+        case PakCompression::None: {
+            auto stored = Stored_(e);
+            if (!stored) return R::Err(std::move(stored.error()));
+            return R::Ok(std::make_unique<Engine::IO::Stream::SpanStream>(std::move(stored.value())));
+        }
+        case PakCompression::Lz: {
+            auto fr = Frame_(e);
+            if (!fr) return R::Err(std::move(fr.error()));
+            return R::Ok(std::make_unique<Engine::IO::Compression::LzDecodeStream>(std::move(fr.value()), decode));
+        }
+        default:
+            return R::Err(IoError::Make(IoErrorCode::NotSupported, "PakArchive: unsupported compression",
+                                        std::string(PathOf(e))));
+        }
+    }
+
+    IoResult<Base::SharedBuffer> PakArchive::ReadFile(std::string_view path) const {
+        auto e = Find(path);
+        if (!e) {
+            return IoResult<Base::SharedBuffer>::Err(IoError::Make(IoErrorCode::NotFound, "PakArchive: not found", std::string(path)));
+        }
+        return Read(*e);
+    }
+
+    const std::vector<std::uint32_t>& PakArchive::PathOrder() const {
+        std::call_once(pathOrderOnce_, [this] {
+            pathOrder_.resize(header_.entryCount);
+            for (std::uint32_t i = 0; i < header_.entryCount; ++i) pathOrder_[i] = i;
+            std::sort(pathOrder_.begin(), pathOrder_.end(), [this](std::uint32_t a, std::uint32_t b) {
+                return PathOf(EntryAt(a)) < PathOf(EntryAt(b));
+            });
+        });
+        return pathOrder_;
+    }
+
+    bool PakArchive::HasDirectory(std::string_view dir) const {
+        if (dir.empty()) return true;
+
+        std::string prefix(dir);
+        prefix.push_back('/');
+
+        const auto& order = PathOrder();
+        auto it = std::lower_bound(order.begin(), order.end(), std::string_view(prefix),
+            [this](std::uint32_t idx, std::string_view key) { return PathOf(EntryAt(idx)) < key; });
+        if (it == order.end()) return false;
+        return PathOf(EntryAt(*it)).substr(0, prefix.size()) == prefix;
+    }
+
+} // namespace Engine::IO::Pak
@@ -0,0 +1,22 @@
+#include "engine/io/pak/PakArchive.hpp"
+
+#include "engine/io/fs/MappedFile.hpp"
+
+namespace Engine::IO::Pak {
+
+    IoResult<std::shared_ptr<const PakArchive>> PakArchive::OpenMapped(const std::string& nativePath) {
+        using R = IoResult<std::shared_ptr<const PakArchive>>;
+
+        // TOC 参照はランダムアクセスになるので sequential は付けない
+        Engine::IO::FS::MappedFile::Options mo;
+        mo.sequential = false;
+        mo.willNeed = false;
+
+        auto mf = Engine::IO::FS::MappedFile::Open(nativePath, mo);
+        if (!mf) return R::Err(std::move(mf.error()));
+
+        const auto bytes = mf.value()->Bytes();
+        return FromBuffer(Base::SharedBuffer(std::move(mf.value()), bytes));
+    }
+
+} // namespace Engine::IO::Pak
@@ -0,0 +1,254 @@
+#include "engine/io/pak/PakFileSystem.hpp"
+
+#include <algorithm>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+
+#include "engine/io/path/PathUtils.hpp"
+
+namespace Engine::IO::Pak {
+
+    using Engine::IO::IoErrorCode;
+    using Engine::IO::FS::DirectoryEntry;
+    using Engine::IO::FS::DirectoryIterator;
+    using Engine::IO::FS::FileInfo;
+    using Engine::IO::FS::FileSystemCapabilities;
+    using Engine::IO::FS::FileType;
+    using Engine::IO::FS::IFileWatcher;
+    using Engine::IO::FS::ListOptions;
+    using Engine::IO::FS::RemoveOptions;
+    using Engine::IO::Path::Uri;
+    using Engine::IO::Stream::FileOpenMode;
+
+    namespace {
+        IoError ReadOnlyError(const char* op) {
+            return IoError::Make(IoErrorCode::NotSupported, "PakFS: read-only backend", op);
+        }
+
+        FileInfo FileInfoOf(const PakTocEntry& e) {
+            FileInfo fi;
+            fi.type = FileType::Regular;
+            fi.sizeBytes = e.originalSize;
+            fi.backend = "pak";
+            return fi;
+        }
+
+        FileInfo DirectoryInfo() {
+            FileInfo fi;
+            fi.type = FileType::Directory;
+            fi.backend = "pak";
+            return fi;
+        }
+
+        std::string JoinUriText(const std::string& base, std::string_view rel) {
+            std::string out = base;
+            if (!out.empty() && out.back() != '/') out.push_back('/');
+            out.append(rel.data(), rel.size());
+            return out;
+        }
+    } // namespace
+
+    PakFileSystem::PakFileSystem(std::shared_ptr<const PakArchive> archive)
+        : archive_(std::move(archive)) {}
+
+    PakFileSystem::PakFileSystem(std::shared_ptr<const PakArchive> archive, Options opt)
+        : archive_(std::move(archive)), opt_(std::move(opt)) {}
+
+    PakFileSystem::~PakFileSystem() = default;
+
+    void PakFileSystem::SetOptions(Options opt) { opt_ = std::move(opt); }
+    const PakFileSystem::Options& PakFileSystem::GetOptions() const noexcept { return opt_; }
+
+    IoResult<std::string> PakFileSystem::InnerPath_(const Uri& uri) const {
+        using R = IoResult<std::string>;
+
+        // strict parse なら fragment、loose parse（Vfs の JoinRootAndRel）なら path に '#' が残る
+        std::string_view p;
+        if (!uri.fragment.empty()) {
+            p = uri.fragment;
+        } else {
+            p = uri.path.Str();
+            if (const auto hash = p.find('#'); hash != std::string_view::npos) p = p.substr(hash + 1);
+        }
+
+        while (!p.empty() && p.front() == '/') p.remove_prefix(1);
+        while (!p.empty() && p.back() == '/') p.remove_suffix(1);
+
+        if (Engine::IO::Path::ContainsTraversal(p) || Engine::IO::Path::ContainsNullByte(p)) {
+            return R::Err(IoError::Make(IoErrorCode::InvalidPath, "PakFS: invalid path", std::string(p)));
+        }
+
+        std::string prefix = opt_.rootPrefix;
+        while (!prefix.empty() && prefix.back() == '/') prefix.pop_back();
+        if (prefix.empty()) return R::Ok(std::string(p));
+        if (p.empty()) return R::Ok(std::move(prefix));
+
+        prefix.push_back('/');
+        prefix.append(p.data(), p.size());
+        return R::Ok(std::move(prefix));
+    }
+
+    IoResult<Base::SharedBuffer> PakFileSystem::ReadShared(const Uri& uri) const {
+        using R = IoResult<Base::SharedBuffer>;
+        if (!archive_) return R::Err(IoError::Make(IoErrorCode::NotFound, "PakFS: no archive"));
+
+        auto ip = InnerPath_(uri);
+        if (!ip) return R::Err(std::move(ip.error()));
+        return archive_->ReadFile(ip.value());
+    }
+
+    IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>
+    PakFileSystem::Open(const Uri& uri, FileOpenMode mode) {
+        using R = IoResult<std::unique_ptr<Engine::IO::Stream::IStream>>;
+
+        if (Engine::IO::Stream::CanWrite(mode) || Engine::IO::Stream::IsAppend(mode)) {
+            return R::Err(IoError::Make(IoErrorCode::PermissionDenied, "PakFS: write open on read-only backend", uri.ToString()));
+        }
+
+        if (!archive_) return R::Err(IoError::Make(IoErrorCode::NotFound, "PakFS: no archive"));
+
+        auto ip = InnerPath_(uri);
+        if (!ip) return R::Err(std::move(ip.error()));
+
+        auto e = archive_->Find(ip.value());
+        if (!e) return R::Err(IoError::Make(IoErrorCode::NotFound, "PakFS: not found", ip.value()));
+        return archive_->OpenStream(*e, opt_.decode);
+    }
+
+    IoResult<bool> PakFileSystem::Exists(const Uri& uri) {
+        if (!archive_) return IoResult<bool>::Ok(false);
+
+        auto ip = InnerPath_(uri);
+        if (!ip) return IoResult<bool>::Err(std::move(ip.error()));
+        return IoResult<bool>::Ok(archive_->Find(ip.value()).has_value() || archive_->HasDirectory(ip.value()));
+    }
+
+    IoResult<FileInfo> PakFileSystem::Stat(const Uri& uri) {
+        using R = IoResult<FileInfo>;
+        if (!archive_) return R::Err(IoError::Make(IoErrorCode::NotFound, "PakFS: no archive"));
+
+        auto ip = InnerPath_(uri);
+        if (!ip) return R::Err(std::move(ip.error()));
+
+        if (auto e = archive_->Find(ip.value())) return R::Ok(FileInfoOf(*e));
+        if (archive_->HasDirectory(ip.value())) return R::Ok(DirectoryInfo());
+        return R::Err(IoError::Make(IoErrorCode::NotFound, "PakFS: not found", ip.value()));
+    }
+
+    IoResultVoid PakFileSystem::CreateDirectories(const Uri&) { return IoResultVoid::Err(ReadOnlyError("CreateDirectories")); }
+    IoResultVoid PakFileSystem::Remove(const Uri&, const RemoveOptions&) { return IoResultVoid::Err(ReadOnlyError("Remove")); }
+    IoResultVoid PakFileSystem::Move(const Uri&, const Uri&) { return IoResultVoid::Err(ReadOnlyError("Move")); }
+    IoResultVoid PakFileSystem::Copy(const Uri&, const Uri&) { return IoResultVoid::Err(ReadOnlyError("Copy")); }
+
+    IoResult<std::vector<DirectoryEntry>>
+    PakFileSystem::List(const Uri& uri, const ListOptions& opt) {
+        using R = IoResult<std::vector<DirectoryEntry>>;
+        if (!archive_) return R::Err(IoError::Make(IoErrorCode::NotFound, "PakFS: no archive"));
+
+        auto ip = InnerPath_(uri);
+        if (!ip) return R::Err(std::move(ip.error()));
+
+        const std::string& dir = ip.value();
+        if (!archive_->HasDirectory(dir)) {
+            return R::Err(IoError::Make(IoErrorCode::NotFound, "PakFS: directory not found", dir));
+        }
+
+        const std::string prefix = dir.empty() ? std::string{} : dir + "/";
+        const std::string base = uri.ToString();
+        const auto& order = archive_->PathOrder();
+
+        // path 昇順なので prefix 配下は連続区間になる
+        auto it = std::lower_bound(order.begin(), order.end(), std::string_view(prefix),
+            [this](std::uint32_t idx, std::string_view key) { return archive_->PathOf(archive_->EntryAt(idx)) < key; });
+
+        std::vector<DirectoryEntry> out;
+        std::unordered_set<std::string_view> seenDirs;
+
+        auto hidden = [&](std::string_view rel) {
+            if (opt.includeHidden) return false;
+            // いずれかの要素が dotfile なら hidden
+            std::size_t start = 0;
+            for (;;) {
+                if (start < rel.size() && rel[start] == '.') return true;
+                const auto slash = rel.find('/', start);
+                if (slash == std::string_view::npos) return false;
+                start = slash + 1;
+            }
+        };
+
+        auto emitDir = [&](std::string_view rel) {
+            if (!opt.includeDirectories || !seenDirs.insert(rel).second || hidden(rel)) return;
+            DirectoryEntry d;
+            d.path = JoinUriText(base, rel);
+            d.name = std::string(Engine::IO::Path::Filename(rel));
+            d.type = FileType::Directory;
+            if (opt.includeInfo) { d.info = DirectoryInfo(); d.hasInfo = true; }
+            out.push_back(std::move(d));
+        };
+
+        for (; it != order.end(); ++it) {
+            const PakTocEntry e = archive_->EntryAt(*it);
+            const std::string_view full = archive_->PathOf(e);
+            if (full.substr(0, prefix.size()) != prefix) break;
+
+            const std::string_view rel = full.substr(prefix.size());
+            const auto slash = rel.find('/');
+
+            if (slash != std::string_view::npos) {
+                if (!opt.recursive) {
+                    emitDir(rel.substr(0, slash));
+                    continue;
+                }
+                // 再帰時は途中のディレクトリも全部出す
+                for (auto s = slash; s != std::string_view::npos; s = rel.find('/', s + 1)) {
+                    emitDir(rel.substr(0, s));
+                }
+            }
+
+            if (!opt.includeFiles || hidden(rel)) continue;
+
+            DirectoryEntry f;
+            f.path = JoinUriText(base, rel);
+            f.name = std::string(Engine::IO::Path::Filename(rel));
+            f.type = FileType::Regular;
+            if (opt.includeInfo) { f.info = FileInfoOf(e); f.hasInfo = true; }
+            out.push_back(std::move(f));
+        }
+        return R::Ok(std::move(out));
+    }
+
+    IoResult<std::string> PakFileSystem::ToNativePathString(const Uri& uri) {
+        return IoResult<std::string>::Err(IoError::Make(IoErrorCode::NotSupported, "PakFS: no native path", uri.ToString()));
+    }
+
+    FileSystemCapabilities PakFileSystem::Capabilities() const noexcept {
+        FileSystemCapabilities c;
+        c.canOpenWrite = false;
+        c.canIterate = true;
+        c.canCreateDirectories = false;
+        c.canRemove = false;
+        c.canRemoveRecursive = false;
+        c.canMove = false;
+        c.canCopy = false;
+        c.supportsHiddenFlag = true;
+        c.caseSensitivePaths = true;
+        c.supportsMtime = false;
+        return c;
+    }
+
+    IoResult<std::unique_ptr<DirectoryIterator>>
+    PakFileSystem::Iterate(const Uri& uri, const ListOptions& opt) {
+        using R = IoResult<std::unique_ptr<DirectoryIterator>>;
+        auto lr = List(uri, opt);
+        if (!lr) return R::Err(std::move(lr.error()));
+        return R::Ok(std::make_unique<Engine::IO::FS::VectorDirectoryIterator>(std::move(lr.value()), "PakIterator"));
+    }
+
+    IoResult<std::unique_ptr<IFileWatcher>> PakFileSystem::CreateWatcher() {
+        // pak は不変なので監視対象が無い
+        return IoResult<std::unique_ptr<IFileWatcher>>::Err(
+            IoError::Make(IoErrorCode::NotSupported, "PakFS: watch not supported"));
+    }
+
+} // namespace Engine::IO::Pak
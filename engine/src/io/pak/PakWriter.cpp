@@ -0,0 +1,182 @@
+#include "engine/io/pak/PakWriter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace Engine::IO::Pak {
+
+    using Engine::IO::IoErrorCode;
+    using Engine::IO::Stream::SeekWhence;
+
+    namespace {
+        IoResultVoid WriteAll(Engine::IO::Stream::IStream& out, const void* src, std::size_t bytes) {
+            auto wr = out.Write(src, bytes);
+            if (!wr) return IoResultVoid::Err(std::move(wr.error()));
+            if (wr.value() != bytes) {
+                return IoResultVoid::Err(IoError::Make(IoErrorCode::WriteFailed, "PakWriter: short write"));
+            }
+            return IoResultVoid::Ok();
+        }
+
+        std::uint64_t AlignUp(std::uint64_t v, std::uint64_t a) noexcept {
+            return (v + a - 1) & ~(a - 1);
+        }
+    } // namespace
+
+    std::string PakWriter::NormalizePath_(std::string_view path) {
+        std::string p(path);
+        std::replace(p.begin(), p.end(), '\\', '/');
+
+        std::size_t head = 0;
+        for (;;) {
+            if (p.compare(head, 2, "./") == 0) head += 2;
+            else if (head < p.size() && p[head] == '/') head += 1;
+            else break;
+        }
+        return p.substr(head);
+    }
+
+    IoResultVoid PakWriter::Add(std::string_view path, PayloadProvider provider, PakCompression compression) {
+        std::string p = NormalizePath_(path);
+        if (p.empty() || !provider) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::InvalidPath, "PakWriter: empty path or provider", std::string(path)));
+        }
+        if (!paths_.insert(p).second) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::AlreadyExists, "PakWriter: duplicate path", p));
+        }
+        pending_.push_back(Pending{ std::move(p), std::move(provider), compression });
+        return IoResultVoid::Ok();
+    }
+
+    IoResultVoid PakWriter::AddBuffer(std::string_view path, Base::SharedBuffer bytes, PakCompression compression) {
+        return Add(path, [b = std::move(bytes)]() { return IoResult<Base::SharedBuffer>::Ok(b); }, compression);
+    }
+
+    IoResultVoid PakWriter::WriteTo(Engine::IO::Stream::IStream& out) {
+        const std::uint32_t align = opt_.alignment == 0 ? 1u : opt_.alignment;
+        if ((align & (align - 1)) != 0) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::NotSupported, "PakWriter: alignment must be a power of two"));
+        }
+        if (pending_.size() > std::numeric_limits<std::uint32_t>::max()) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::NotSupported, "PakWriter: too many entries"));
+        }
+        // TOC の pathOffset / pathLength は 32bit。string table 全体が収まらないなら何も書かずに断る
+        std::uint64_t stringsBytes = 0;
+        for (const auto& p : pending_) stringsBytes += p.path.size();
+        if (stringsBytes > std::numeric_limits<std::uint32_t>::max()) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::NotSupported, "PakWriter: path table too large",
+                                                   std::to_string(stringsBytes)));
+        }
+        if (!out.Caps().seekable) {
+            return IoResultVoid::Err(IoError::Make(IoErrorCode::NotSupported, "PakWriter: output must be seekable"));
+        }
+
+        // header は最後に書き戻すので、まず領域だけ確保
+        std::array<std::byte, kHeaderSize> headerBytes{};
+        if (auto r = WriteAll(out, headerBytes.data(), headerBytes.size()); !r) return r;
+
+        static constexpr std::array<std::byte, 256> kZeros{};
+        std::uint64_t pos = kHeaderSize;
+
+        auto padTo = [&](std::uint64_t target) -> IoResultVoid {
+            while (pos < target) {
+                const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(target - pos, kZeros.size()));
+                if (auto r = WriteAll(out, kZeros.data(), n); !r) return r;
+                pos += n;
+            }
+            return IoResultVoid::Ok();
+        };
+
+        // ---- payload（追加順）----
+        std::vector<PakTocEntry> toc;
+        toc.reserve(pending_.size());
+        for (auto& p : pending_) {
+            if (p.compression != PakCompression::None && p.compression != PakCompression::Lz) {
+                return IoResultVoid::Err(IoError::Make(IoErrorCode::NotSupported, "PakWriter: unsupported compression", p.path));
+            }
+
+            auto bytes = p.provider();
+            if (!bytes) return IoResultVoid::Err(std::move(bytes.error()));
+
+            PakTocEntry e;
+            e.pathHash = HashPath(p.path);
+            e.originalSize = bytes.value().size();
+            e.compression = PakCompression::None;
+
+            Base::SharedBuffer stored = std::move(bytes.value());
+            if (p.compression == PakCompression::Lz && !stored.empty()) {
+                Engine::IO::Compression::LzFrame::Options lo;
+                lo.blockSize = opt_.lzBlockSize;
+                auto frame = Engine::IO::Compression::LzFrame::Encode(stored.Bytes(), lo);
+                if (frame.size() < stored.size()) {
+                    stored = Base::SharedBuffer::FromVector(std::move(frame));
+                    e.compression = PakCompression::Lz;
+                }
+            }
+
+            if (auto r = padTo(AlignUp(pos, align)); !r) return r;
+
+            e.dataOffset = pos;
+            e.storedSize = stored.size();
+            toc.push_back(e);
+
+            if (!stored.empty()) {
+                if (auto r = WriteAll(out, stored.data(), stored.size()); !r) return r;
+            }
+            pos += stored.size();
+        }
+
+        // ---- TOC（hash 昇順、同 hash は path 昇順）----
+        std::vector<std::size_t> order(pending_.size());
+        for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+        std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+            if (toc[a].pathHash != toc[b].pathHash) return toc[a].pathHash < toc[b].pathHash;
+            return pending_[a].path < pending_[b].path;
+        });
+
+        std::string strings;
+        strings.reserve(static_cast<std::size_t>(stringsBytes));
+        for (std::size_t i : order) {
+            toc[i].pathOffset = static_cast<std::uint32_t>(strings.size());
+            toc[i].pathLength = static_cast<std::uint32_t>(pending_[i].path.size());
+            strings += pending_[i].path;
+        }
+
+        if (auto r = padTo(AlignUp(pos, 8)); !r) return r;
+
+        PakHeader h;
+        h.entryCount = static_cast<std::uint32_t>(pending_.size());
+        h.alignment = align;
+        h.tocOffset = pos;
+
+        std::vector<std::byte> tocBytes(toc.size() * kTocEntrySize);
+        for (std::size_t k = 0; k < order.size(); ++k) {
+            EncodeTocEntry(toc[order[k]], tocBytes.data() + k * kTocEntrySize);
+        }
+        if (!tocBytes.empty()) {
+            if (auto r = WriteAll(out, tocBytes.data(), tocBytes.size()); !r) return r;
+        }
+        pos += tocBytes.size();
+
+        h.stringsOffset = pos;
+        h.stringsSize = strings.size();
+        if (!strings.empty()) {
+            if (auto r = WriteAll(out, strings.data(), strings.size()); !r) return r;
+        }
+        pos += strings.size();
+
+        // ---- header を書き戻す ----
+        EncodeHeader(h, headerBytes.data());
+        auto sr = out.Seek(0, SeekWhence::Begin);
+        if (!sr) return IoResultVoid::Err(std::move(sr.error()));
+        if (auto r = WriteAll(out, headerBytes.data(), headerBytes.size()); !r) return r;
+
+        auto er = out.Seek(static_cast<std::int64_t>(pos), SeekWhence::Begin);
+        if (!er) return IoResultVoid::Err(std::move(er.error()));
+        return out.Flush();
+    }
+
+} // namespace Engine::IO::Pak
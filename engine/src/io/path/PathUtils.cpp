@@ -1,9 +1,16 @@
 #include "engine/io/path/PathUtils.hpp"
 
+#include <bit>
 #include <cctype>
+#include <cstddef>
 #include <string>
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ENGINE_PATH_SSE2 1
+#endif
+
 namespace Engine::IO::Path {
 
     static inline bool IsAlpha(char c) noexcept {
@@ -409,4 +416,143 @@ namespace Engine::IO::Path {
         return out;
     }
 
+    // ---------------- 1 パス版 ----------------
+
+    namespace {
+
+        // i 以降で最初の区切り（'/'、convertBackslash なら '\\' も）。無ければ s.size()
+        std::size_t FindSeparator(std::string_view s, std::size_t i, bool convertBackslash) noexcept {
+#if defined(ENGINE_PATH_SSE2)
+            const __m128i slash = _mm_set1_epi8('/');
+            const __m128i back = _mm_set1_epi8('\\');
+            while (i + 16 <= s.size()) {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s.data() + i));
+                __m128i hit = _mm_cmpeq_epi8(v, slash);
+                if (convertBackslash) hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, back));
+                const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+                if (mask != 0) return i + static_cast<std::size_t>(std::countr_zero(mask));
+                i += 16;
+            }
+#endif
+            for (; i < s.size(); ++i) {
+                const char c = s[i];
+                if (c == '/' || (convertBackslash && c == '\\')) return i;
+            }
+            return s.size();
+        }
+
+        // RemoveDotSegments のスタックを out の上で直接やる
+        class SegmentWriter final {
+        public:
+            SegmentWriter(std::string& out, std::size_t prefixLen) noexcept : out_(out), prefixLen_(prefixLen) {}
+
+            void Push(std::string_view seg) {
+                if (seg.empty() || (seg.size() == 1 && seg[0] == '.')) return;
+                if (seg.size() == 2 && seg[0] == '.' && seg[1] == '.') {
+                    if (out_.size() == prefixLen_) {
+                        escaped_ = true;
+                        return;
+                    }
+                    const std::size_t pos = out_.find_last_of('/');
+                    out_.resize((pos == std::string::npos || pos < prefixLen_) ? prefixLen_ : pos);
+                    return;
+                }
+                if (!out_.empty() && out_.back() != '/') out_.push_back('/');
+                out_.append(seg.data(), seg.size());
+            }
+
+            // s を区切りで分けて順に Push
+            void PushAll(std::string_view s, bool convertBackslash) {
+                std::size_t i = 0;
+                while (i <= s.size()) {
+                    const std::size_t j = FindSeparator(s, i, convertBackslash);
+                    Push(s.substr(i, j - i));
+                    i = j + 1;
+                }
+            }
+
+            bool Escaped() const noexcept { return escaped_; }
+
+        private:
+            std::string& out_;
+            std::size_t prefixLen_ = 0;
+            bool escaped_ = false;
+        };
+
+        // RemoveDotSegments の prefix 判定を NormalizeSlashes 後の文字で行う
+        // at(k) は NormalizeSlashes 後の k 文字目（範囲外は '\0'）。戻り値は消費した入力文字数
+        template<class At>
+        std::size_t WritePrefix(std::string& out, At at, bool squashSlashes) {
+            if (std::isalpha(static_cast<unsigned char>(at(0))) && at(1) == ':' && at(2) == '/') {
+                out.push_back(at(0));
+                out += ":/";
+                return 3;
+            }
+            // squash 済みなら "//" は残らない
+            if (!squashSlashes && at(0) == '/' && at(1) == '/') {
+                out += "//";
+                return 2;
+            }
+            if (at(0) == '/') {
+                out.push_back('/');
+                return 1;
+            }
+            return 0;
+        }
+
+    } // namespace
+
+    bool IsAbsolutePathLikeRaw(std::string_view p, bool normalizeSeparators) noexcept {
+        if (p.empty()) return false;
+        // NormalizeSlashes は区切りかどうかを変えないので、先頭 3 文字だけ見れば足りる
+        if (p[0] == '/' || (normalizeSeparators && p[0] == '\\')) return true;
+        if (p.size() >= 2 && IsSlash(p[0]) && IsSlash(p[1])) return true;
+        if (p.size() >= 3 &&
+            std::isalpha(static_cast<unsigned char>(p[0])) &&
+            p[1] == ':' &&
+            IsSlash(p[2])) {
+            return true;
+        }
+        return false;
+    }
+
+    bool NormalizeInto(std::string& out, std::string_view path, bool normalizeSeparators, bool squashSlashes) {
+        out.clear();
+        out.reserve(path.size());
+
+        auto at = [&](std::size_t k) -> char {
+            if (k >= path.size()) return '\0';
+            const char c = path[k];
+            return (normalizeSeparators && c == '\\') ? '/' : c;
+        };
+        const std::size_t consumed = WritePrefix(out, at, squashSlashes);
+
+        SegmentWriter w(out, out.size());
+        w.PushAll(path.substr(consumed), normalizeSeparators);
+        return w.Escaped();
+    }
+
+    bool NormalizeJoinInto(std::string& out, std::string_view root, std::string_view rel,
+                           bool normalizeSeparators, bool squashSlashes) {
+        if (root.empty()) root = "assets";
+        // JoinRootAndRelative は rel 先頭の区切りを剥がす
+        while (!rel.empty() && IsSlash(rel.front())) rel.remove_prefix(1);
+
+        out.clear();
+        out.reserve(root.size() + 1 + rel.size());
+
+        // root 側は JoinRootAndRelative が常に '\\' -> '/' にし、末尾に '/' を足す
+        const bool addSlash = (root.back() != '/' && root.back() != '\\');
+        auto at = [&](std::size_t k) -> char {
+            if (k < root.size()) return root[k] == '\\' ? '/' : root[k];
+            return (k == root.size() && addSlash) ? '/' : '\0';
+        };
+        std::size_t consumed = WritePrefix(out, at, squashSlashes);
+
+        SegmentWriter w(out, out.size());
+        if (consumed < root.size()) w.PushAll(root.substr(consumed), true);
+        w.PushAll(rel, normalizeSeparators);
+        return w.Escaped();
+    }
+
 } // namespace Engine::IO::Path
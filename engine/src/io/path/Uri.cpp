@@ -1,22 +1,25 @@
 #include "engine/io/path/Uri.hpp"
 
-#include <algorithm>
 #include <cctype>
+#include <cstddef>
 
 namespace Engine::IO::Path {
 
-    static std::string ToLower(std::string_view sv) {
-        std::string out(sv);
-        std::transform(out.begin(), out.end(), out.begin(),
-                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-        return out;
-    }
+    namespace {
+        bool EqualsNoCase(std::string_view a, std::string_view lower) noexcept {
+            if (a.size() != lower.size()) return false;
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                if (std::tolower(static_cast<unsigned char>(a[i])) != lower[i]) return false;
+            }
+            return true;
+        }
+    } // namespace
 
-    static UriScheme SchemeFrom(std::string_view schemeLower) {
-        if (schemeLower == "asset") return UriScheme::Asset;
-        if (schemeLower == "file")  return UriScheme::File;
-        if (schemeLower == "http")  return UriScheme::Http;
-        if (schemeLower == "https") return UriScheme::Https;
+    UriScheme SchemeFromText(std::string_view text) noexcept {
+        if (EqualsNoCase(text, "asset")) return UriScheme::Asset;
+        if (EqualsNoCase(text, "file"))  return UriScheme::File;
+        if (EqualsNoCase(text, "http"))  return UriScheme::Http;
+        if (EqualsNoCase(text, "https")) return UriScheme::Https;
         return UriScheme::Unknown;
     }
 
@@ -104,8 +107,7 @@ namespace Engine::IO::Path {
         }
 
         // scheme part
-        const std::string schemeLower = ToLower(base.substr(0, schemePos));
-        uri.scheme = SchemeFrom(schemeLower);
+        uri.scheme = SchemeFromText(base.substr(0, schemePos));
         if (uri.scheme == UriScheme::Unknown) {
             uri.schemeText = std::string(base.substr(0, schemePos));
         }
@@ -167,7 +169,7 @@ namespace Engine::IO::Path {
             return u;
         }
 
-        u.scheme = SchemeFrom(std::string(s.substr(0, pos)));
+        u.scheme = SchemeFromText(s.substr(0, pos));
 
         // "://"" の直後から
         std::string_view rest = s.substr(pos + 3);
@@ -181,4 +183,26 @@ namespace Engine::IO::Path {
         return u;
     }
 
+    Uri SiblingUri(const Uri& uri, std::string_view suffix) {
+        Uri u = uri;
+        if (!u.path.Empty()) {
+            u.path = Path::FromNormalized(u.path.Str() + std::string(suffix));
+        } else {
+            u.authority += suffix;
+        }
+        return u;
+    }
+
+    Uri ParentUri(const Uri& uri) {
+        Uri u = uri;
+        u.query.clear();
+        u.fragment.clear();
+        if (!u.path.Empty()) {
+            u.path = u.path.Parent();
+        } else {
+            u.authority.clear();
+        }
+        return u;
+    }
+
 } // namespace Engine::IO::Path
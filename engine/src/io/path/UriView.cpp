@@ -0,0 +1,166 @@
+#include "engine/io/path/UriView.hpp"
+
+#include <cstddef>
+
+#include "engine/io/path/PathUtils.hpp"
+
+namespace Engine::IO::Path {
+
+    namespace {
+        using R = Base::Result<UriView, IoError>;
+
+        R Invalid(const char* msg, std::string_view s) {
+            return R::Err(IoError::Make(Engine::IO::IoErrorCode::InvalidPath, msg, std::string(s)));
+        }
+
+        // 正規化済みの相対論理パスか（Path::Parse を通した結果と同じ形か）を 1 パスで見る
+        // 戻り値：nullptr = OK / それ以外はエラーメッセージ
+        const char* CheckNormalized(std::string_view p, bool allowAbsoluteLike) noexcept {
+            if (p.empty()) return nullptr;
+            if (!allowAbsoluteLike && IsAbsoluteLike(p)) return "absolute-like path is not allowed";
+
+            std::size_t segStart = 0;
+            for (std::size_t i = 0; i <= p.size(); ++i) {
+                const char c = (i < p.size()) ? p[i] : '/';
+                if (c == '\0') return "path contains null byte";
+                if (c == '\\') return "uri path is not normalized (use ParseUri)";
+                if (c != '/') continue;
+
+                const std::string_view seg = p.substr(segStart, i - segStart);
+                if (seg == "..") return "path traversal is not allowed";
+                if (seg.empty() || seg == ".") {
+                    // file:// の "/abs" 先頭だけは許す
+                    if (!(allowAbsoluteLike && i == 0)) return "uri path is not normalized (use ParseUri)";
+                }
+                segStart = i + 1;
+            }
+            return nullptr;
+        }
+
+        constexpr std::string_view KnownSchemeName(UriScheme s) noexcept {
+            switch (s) {
+            case UriScheme::Asset: return "asset";
+            case UriScheme::File:  return "file";
+            case UriScheme::Http:  return "http";
+            case UriScheme::Https: return "https";
+            default:               return {};
+            }
+        }
+
+    } // namespace
+
+    UriView::UriView(const Uri& u) noexcept
+        : scheme(u.scheme)
+        , schemeText(u.scheme == UriScheme::Unknown ? std::string_view(u.schemeText) : KnownSchemeName(u.scheme))
+        , authority(u.authority)
+        , path(u.path.Str())
+        , query(u.query)
+        , fragment(u.fragment) {}
+
+    std::string_view UriView::SchemeName() const noexcept {
+        if (scheme == UriScheme::None) return {};
+        if (scheme == UriScheme::Unknown) return schemeText;
+        return KnownSchemeName(scheme);
+    }
+
+    std::string UriView::ToString() const {
+        std::string out;
+        out.reserve(schemeText.size() + 3 + authority.size() + 1 + path.size() + query.size() + fragment.size() + 2);
+
+        if (scheme != UriScheme::None) {
+            out += SchemeName();
+            out += "://";
+            out += authority;
+            if (!authority.empty() && !path.empty() && path.front() != '/') out += '/';
+        }
+        out += path;
+
+        if (!query.empty()) {
+            out += '?';
+            out += query;
+        }
+        if (!fragment.empty()) {
+            out += '#';
+            out += fragment;
+        }
+        return out;
+    }
+
+    Uri UriView::ToUri() const {
+        Uri u;
+        u.scheme = scheme;
+        if (scheme == UriScheme::Unknown) u.schemeText = std::string(schemeText);
+        u.authority = std::string(authority);
+        u.path = Path::FromNormalized(std::string(path));
+        u.query = std::string(query);
+        u.fragment = std::string(fragment);
+        return u;
+    }
+
+    R ParseUriView(std::string_view s) {
+        if (s.empty()) return Invalid("uri is empty", s);
+
+        UriView v;
+        const std::size_t n = s.size();
+        std::size_t i = 0;
+
+        // scheme：最初の '/' '?' '#' より前に "://" があれば
+        for (std::size_t k = 0; k < n; ++k) {
+            const char c = s[k];
+            if (c == ':') {
+                if (k + 2 < n && s[k + 1] == '/' && s[k + 2] == '/') {
+                    v.schemeText = s.substr(0, k);
+                    v.scheme = SchemeFromText(v.schemeText);
+                    i = k + 3;
+                }
+                break;
+            }
+            if (c == '/' || c == '?' || c == '#') break;
+        }
+
+        // authority は次の "/" まで（scheme がある時だけ）
+        std::size_t k = i;
+        if (v.HasScheme()) {
+            while (k < n && s[k] != '/' && s[k] != '?' && s[k] != '#') ++k;
+            v.authority = s.substr(i, k - i);
+            if (k < n && s[k] == '/') ++k; // "/" を除いて論理パスへ
+        }
+
+        // path / query / fragment
+        std::size_t p = k;
+        while (k < n && s[k] != '?' && s[k] != '#') ++k;
+        v.path = s.substr(p, k - p);
+        if (k < n && s[k] == '?') {
+            p = ++k;
+            while (k < n && s[k] != '#') ++k;
+            v.query = s.substr(p, k - p);
+        }
+        if (k < n && s[k] == '#') v.fragment = s.substr(k + 1);
+
+        // file:// は tool 用途が多いので absolute-like を許可（ParseUri と同じ）
+        if (const char* err = CheckNormalized(v.path, v.scheme == UriScheme::File)) return Invalid(err, s);
+        if (v.authority.find('\0') != std::string_view::npos) return Invalid("path contains null byte", s);
+
+        return R::Ok(v);
+    }
+
+    UriView ParseUriViewLoose(std::string_view s) noexcept {
+        UriView v;
+
+        const auto pos = s.find("://");
+        if (pos == std::string_view::npos) {
+            v.path = s;
+            return v;
+        }
+
+        v.schemeText = s.substr(0, pos);
+        v.scheme = SchemeFromText(v.schemeText);
+
+        // "res:///a" などは先頭スラッシュを剥がして相対寄りに
+        std::string_view rest = s.substr(pos + 3);
+        while (!rest.empty() && (rest.front() == '/' || rest.front() == '\\')) rest.remove_prefix(1);
+        v.path = rest;
+        return v;
+    }
+
+} // namespace Engine::IO::Path
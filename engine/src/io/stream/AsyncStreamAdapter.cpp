@@ -0,0 +1,120 @@
+#include "engine/io/stream/AsyncStreamAdapter.hpp"
+
+namespace Engine::IO::Stream {
+
+    using Engine::IO::IoErrorCode;
+
+    std::unique_ptr<IStream> AsyncStreamAdapter::Wrap(std::unique_ptr<IStream> inner) {
+        if (!inner || inner->Caps().asyncRead) return inner;
+        return std::make_unique<AsyncStreamAdapter>(std::move(inner));
+    }
+
+    AsyncStreamAdapter::AsyncStreamAdapter(std::unique_ptr<IStream> inner)
+        : AsyncStreamAdapter(std::move(inner), Options{}) {}
+
+    AsyncStreamAdapter::AsyncStreamAdapter(std::unique_ptr<IStream> inner, Options opt)
+        : inner_(std::move(inner))
+        , pool_(opt.pool ? std::move(opt.pool) : Engine::IO::Async::IoWorkerPool::Shared()) {}
+
+    AsyncStreamAdapter::~AsyncStreamAdapter() {
+        // worker が inner_ を触り終えてから破棄する
+        inflight_.WaitIdle();
+    }
+
+    StreamCaps AsyncStreamAdapter::Caps() const noexcept {
+        std::lock_guard<std::mutex> lk(mutex_);
+        StreamCaps c = inner_->Caps();
+        c.asyncRead = c.readable && c.seekable;
+        return c;
+    }
+
+    bool AsyncStreamAdapter::IsOpen() const noexcept {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return inner_->IsOpen();
+    }
+
+    bool AsyncStreamAdapter::IsEof() const noexcept {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return inner_->IsEof();
+    }
+
+    IoResult<std::size_t> AsyncStreamAdapter::Read(void* dst, std::size_t bytes) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return inner_->Read(dst, bytes);
+    }
+
+    IoResult<std::size_t> AsyncStreamAdapter::Write(const void* src, std::size_t bytes) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return inner_->Write(src, bytes);
+    }
+
+    IoResult<std::size_t> AsyncStreamAdapter::ReadAtLocked_(std::uint64_t offset, Base::Span<std::byte> dst) {
+        // 呼び出し側の読み位置を壊さないよう、読み終えたら元へ戻す
+        auto saved = inner_->Tell();
+        if (!saved) return IoResult<std::size_t>::Err(std::move(saved.error()));
+
+        auto sr = inner_->Seek(static_cast<std::int64_t>(offset), SeekWhence::Begin);
+        if (!sr) return IoResult<std::size_t>::Err(std::move(sr.error()));
+
+        std::size_t done = 0;
+        IoResult<std::size_t> result = IoResult<std::size_t>::Ok(0);
+        while (done < dst.size()) {
+            auto r = inner_->Read(dst.data() + done, dst.size() - done);
+            if (!r) { result = std::move(r); break; }
+            if (r.value() == 0) break; // EOF
+            done += r.value();
+        }
+        if (result) result = IoResult<std::size_t>::Ok(done);
+
+        (void)inner_->Seek(static_cast<std::int64_t>(saved.value()), SeekWhence::Begin);
+        return result;
+    }
+
+    void AsyncStreamAdapter::ReadAtAsync(std::uint64_t offset, Base::Span<std::byte> dst, ReadCompletion completion) {
+        const StreamCaps c = Caps();
+        if (!c.asyncRead) {
+            completion(IoResult<std::size_t>::Err(IoError::Make(
+                IoErrorCode::NotSupported, "AsyncStreamAdapter: inner stream is not readable+seekable")));
+            return;
+        }
+
+        inflight_.Begin();
+        pool_->Submit([this, offset, dst, completion = std::move(completion)]() mutable {
+            IoResult<std::size_t> r = IoResult<std::size_t>::Ok(0);
+            {
+                std::lock_guard<std::mutex> lk(mutex_);
+                r = ReadAtLocked_(offset, dst);
+            }
+            // completion は lock の外で呼ぶ（中から同期 API を呼べるように）
+            completion(std::move(r));
+            inflight_.End();
+        });
+    }
+
+    IoResult<std::uint64_t> AsyncStreamAdapter::Tell() const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return inner_->Tell();
+    }
+
+    IoResult<std::uint64_t> AsyncStreamAdapter::Seek(std::int64_t offset, SeekWhence whence) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return inner_->Seek(offset, whence);
+    }
+
+    IoResult<std::uint64_t> AsyncStreamAdapter::Size() const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return inner_->Size();
+    }
+
+    IoResultVoid AsyncStreamAdapter::Flush() {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return inner_->Flush();
+    }
+
+    IoResultVoid AsyncStreamAdapter::Close() {
+        inflight_.WaitIdle();
+        std::lock_guard<std::mutex> lk(mutex_);
+        return inner_->Close();
+    }
+
+} // namespace Engine::IO::Stream
@@ -2,6 +2,9 @@
 
 #include <algorithm>
 #include <cstring>
+#include <utility>
+
+#include "engine/io/async/IoWorkerPool.hpp"
 
 namespace Engine::IO::Stream {
 
@@ -15,6 +18,7 @@ namespace Engine::IO::Stream {
         if (opt_.enableRead && opt_.readBufferSize > 0) {
             rbuf_.resize(opt_.readBufferSize);
         }
+        ResetReadAhead_();
         if (opt_.enableWrite && opt_.writeBufferSize > 0) {
             wbuf_.resize(opt_.writeBufferSize);
         }
@@ -23,10 +27,15 @@ namespace Engine::IO::Stream {
     BufferedStream::~BufferedStream() {
         // デストラクタで例外は禁止。best-effort flush
         (void)Flush();
+        // worker が pbuf_ を書き終えてから破棄する
+        DropPrefetch_();
     }
 
     StreamCaps BufferedStream::Caps() const noexcept {
-        return inner_ ? inner_->Caps() : StreamCaps{};
+        StreamCaps c = inner_ ? inner_->Caps() : StreamCaps{};
+        // ReadAtAsync は実装していない（バッファとの整合を取らないため。必要なら AsyncStreamAdapter で包む）
+        c.asyncRead = false;
+        return c;
     }
 
     bool BufferedStream::IsOpen() const noexcept {
@@ -36,6 +45,8 @@ namespace Engine::IO::Stream {
     bool BufferedStream::IsEof() const noexcept {
         // read buffer に未消費があれば EOF ではない
         if (rpos_ < rlen_) return false;
+        // 裏読み中の chunk があるかもしれない（発行するのは直前の refill が満杯だったときだけ）
+        if (pfIssued_) return false;
         return inner_ ? inner_->IsEof() : true;
     }
 
@@ -50,6 +61,10 @@ namespace Engine::IO::Stream {
     }
 
     IoResultVoid BufferedStream::SyncForWrite() {
+        // 裏読みは inner の位置を動かしていないので、捨てるだけでよい
+        DropPrefetch_();
+        ResetReadAhead_();
+
         // 未消費の read buffer がある場合、
         // inner の位置は「先読み済み」の末尾にあるため、論理位置まで戻す必要がある
         if (rlen_ > rpos_) {
@@ -82,13 +97,106 @@ namespace Engine::IO::Stream {
             return IoResult<std::size_t>::Ok(0);
         }
 
-        auto rr = inner_->Read(rbuf_.data(), rbuf_.size());
+        // 裏読み済みの chunk があれば入れ替えるだけ
+        if (auto pf = WaitPrefetch_()) {
+            if (*pf && pf->value() > 0) {
+                // ReadAtAsync は inner の位置を動かさないので、使った分だけ進める
+                const std::size_t n = pf->value();
+                auto sr = inner_->Seek(static_cast<std::int64_t>(n), SeekWhence::Current);
+                if (sr) {
+                    std::swap(rbuf_, pbuf_);
+                    rlen_ = n;
+                    GrowReadAhead_();
+                    if (n == pfSize_) StartPrefetch_();
+                    return IoResult<std::size_t>::Ok(rlen_);
+                }
+            }
+            // 失敗 / EOF は同期読みでやり直す（エラーはそちらで返る）
+        }
+
+        const std::size_t want = readAhead_;
+        if (rbuf_.size() < want) rbuf_.resize(want);
+
+        auto rr = inner_->Read(rbuf_.data(), want);
         if (!rr) return rr; // inner 由来のエラーをそのまま返す
 
         rlen_ = rr.value();
+        GrowReadAhead_();
+        // 満杯まで読めた = まだ続きがありそうなときだけ裏読みする
+        if (rlen_ == want) StartPrefetch_();
         return IoResult<std::size_t>::Ok(rlen_);
     }
 
+    void BufferedStream::ResetReadAhead_() noexcept {
+        readAhead_ = opt_.readBufferSize;
+        seqRefills_ = 0;
+    }
+
+    void BufferedStream::GrowReadAhead_() noexcept {
+        ++seqRefills_;
+        if (!opt_.adaptiveReadAhead || seqRefills_ < 2) return;
+
+        // 2 回続けて refill したら順次読みとみなし、倍々で広げる
+        const std::size_t cap = (std::max)(opt_.maxReadAheadSize, opt_.readBufferSize);
+        readAhead_ = (readAhead_ >= cap / 2) ? cap : readAhead_ * 2;
+    }
+
+    void BufferedStream::StartPrefetch_() {
+        if (!opt_.backgroundPrefetch || pfIssued_ || seqRefills_ < 2) return;
+        // pool の worker 上（AsyncStreamAdapter の要求の中など）では裏読みしない
+        // inner の ReadAtAsync も同じ pool に積まれるので、待つ側が worker を塞いで詰まりうる
+        if (Engine::IO::Async::IoWorkerPool::Current()) return;
+
+        const auto caps = inner_->Caps();
+        if (!caps.asyncRead || !caps.seekable) return;
+
+        // inner は rbuf_ の末尾に居る = 次の chunk の先頭
+        auto tr = inner_->Tell();
+        if (!tr) return;
+
+        // 裏読み中は pbuf_ に触らないので、広げるのはここだけ
+        pfSize_ = readAhead_;
+        if (pbuf_.size() < pfSize_) pbuf_.resize(pfSize_);
+
+        {
+            std::lock_guard<std::mutex> lk(pfMutex_);
+            pfResult_.reset();
+        }
+        pfIssued_ = true;
+
+        inner_->ReadAtAsync(tr.value(), Base::Span<std::byte>(pbuf_.data(), pfSize_),
+            [this](IoResult<std::size_t> r) {
+                // notify は lock 中に行う（起きた側がすぐ this を破棄してもよいように）
+                std::lock_guard<std::mutex> lk(pfMutex_);
+                pfResult_.emplace(std::move(r));
+                pfCv_.notify_all();
+            });
+    }
+
+    std::optional<IoResult<std::size_t>> BufferedStream::WaitPrefetch_() {
+        if (!pfIssued_) return std::nullopt;
+        pfIssued_ = false;
+
+        std::unique_lock<std::mutex> lk(pfMutex_);
+        if (auto* pool = Engine::IO::Async::IoWorkerPool::Current()) {
+            // 別スレッドで発行した裏読みを worker 上で待つ：まだ始まっていなければ積まれた仕事を自分で流す
+            while (!pfResult_.has_value()) {
+                lk.unlock();
+                const bool ran = pool->RunOne();
+                lk.lock();
+                if (!ran) break; // 積まれていない = 実行中か済み（完了を待てばよい）
+            }
+        }
+        pfCv_.wait(lk, [&] { return pfResult_.has_value(); });
+        auto r = std::move(pfResult_);
+        pfResult_.reset();
+        return r;
+    }
+
+    void BufferedStream::DropPrefetch_() {
+        (void)WaitPrefetch_();
+    }
+
     IoResultVoid BufferedStream::FlushWriteBuffer() {
         if (!opt_.enableWrite || wbuf_.empty() || wlen_ == 0) {
             return IoResultVoid::Ok();
@@ -135,6 +243,18 @@ namespace Engine::IO::Stream {
             const std::size_t avail = (rlen_ > rpos_) ? (rlen_ - rpos_) : 0;
 
             if (avail == 0) {
+                // 大きい読み：バッファを経由せず dst へ直接読む
+                // （裏読み中の chunk がある場合はそちらが先なので補充に回す）
+                const std::size_t need = bytes - out;
+                if (!pfIssued_ && need >= readAhead_) {
+                    auto rr = inner_->Read(outPtr + out, need);
+                    if (!rr) return rr;
+                    if (rr.value() == 0) break; // EOF
+                    out += rr.value();
+                    ++seqRefills_;
+                    continue;
+                }
+
                 // バッファ補充
                 auto fr = FillReadBuffer();
                 if (!fr) return fr;
@@ -257,9 +377,11 @@ namespace Engine::IO::Stream {
         auto fr = FlushWriteBuffer();
         if (!fr) return IoResult<std::uint64_t>::Err(fr.error());
 
-        // read buffer は無効化（位置が飛ぶので）
+        // read buffer / 裏読みは無効化（位置が飛ぶので）
         rpos_ = 0;
         rlen_ = 0;
+        DropPrefetch_();
+        ResetReadAhead_();
 
         return inner_->Seek(offset, whence);
     }
@@ -309,6 +431,7 @@ namespace Engine::IO::Stream {
         // read buffer 破棄
         rpos_ = 0;
         rlen_ = 0;
+        DropPrefetch_();
 
         return inner_->Close();
     }
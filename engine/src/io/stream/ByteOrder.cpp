@@ -0,0 +1,95 @@
+#include "engine/io/stream/ByteOrder.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ENGINE_STREAM_SSE2 1
+#endif
+
+namespace Engine::IO::Stream {
+
+    namespace {
+
+        template<class U>
+        void SwapScalar(unsigned char* p, std::size_t count) noexcept {
+            for (std::size_t i = 0; i < count; ++i, p += sizeof(U)) {
+                U v;
+                std::memcpy(&v, p, sizeof(U));
+                v = ByteSwap(v);
+                std::memcpy(p, &v, sizeof(U));
+            }
+        }
+
+#if defined(ENGINE_STREAM_SSE2)
+        // 16bit 単位の上下 byte 入れ替え（pshufb は SSSE3 なので shift で）
+        inline __m128i Swap16(__m128i v) noexcept {
+            return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        }
+
+        template<int ElemBytes>
+        __m128i SwapLanes(__m128i v) noexcept {
+            if constexpr (ElemBytes == 2) {
+                return Swap16(v);
+            } else if constexpr (ElemBytes == 4) {
+                // 32bit 内の 16bit 2 つを入れ替えてから byte swap
+                v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+                v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+                return Swap16(v);
+            } else {
+                // 64bit 内の 16bit 4 つを逆順にしてから byte swap
+                v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+                v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+                return Swap16(v);
+            }
+        }
+
+        template<int ElemBytes>
+        std::size_t SwapSimd(unsigned char* p, std::size_t count) noexcept {
+            const std::size_t perBlock = 16 / ElemBytes;
+            std::size_t i = 0;
+            for (; i + perBlock <= count; i += perBlock, p += 16) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(p), SwapLanes<ElemBytes>(v));
+            }
+            return i;
+        }
+#endif
+
+        template<class U>
+        void SwapRun(unsigned char* p, std::size_t count) noexcept {
+            std::size_t done = 0;
+#if defined(ENGINE_STREAM_SSE2)
+            done = SwapSimd<static_cast<int>(sizeof(U))>(p, count);
+#endif
+            SwapScalar<U>(p + done * sizeof(U), count - done);
+        }
+
+    } // namespace
+
+    void ByteSwapInPlace(void* data, std::size_t count, std::size_t elemBytes) noexcept {
+        auto* p = static_cast<unsigned char*>(data);
+        switch (elemBytes) {
+        case 2: SwapRun<std::uint16_t>(p, count); break;
+        case 4: SwapRun<std::uint32_t>(p, count); break;
+        case 8: SwapRun<std::uint64_t>(p, count); break;
+        default: break; // 1 byte は何もしない
+        }
+    }
+
+    void ByteSwapFields(void* data, std::size_t count, std::size_t stride,
+                        Base::ConstSpan<std::uint8_t> fieldBytes) noexcept {
+        auto* base = static_cast<unsigned char*>(data);
+        for (std::size_t i = 0; i < count; ++i) {
+            unsigned char* p = base + i * stride;
+            for (const std::uint8_t w : fieldBytes) {
+                switch (w) {
+                case 2: SwapScalar<std::uint16_t>(p, 1); break;
+                case 4: SwapScalar<std::uint32_t>(p, 1); break;
+                case 8: SwapScalar<std::uint64_t>(p, 1); break;
+                default: break;
+                }
+                p += w;
+            }
+        }
+    }
+
+} // namespace Engine::IO::Stream
@@ -31,6 +31,28 @@ namespace Engine::IO::Stream {
         return IoResult<std::size_t>::Ok(n);
     }
 
+    void MemoryStream::ReadAtAsync(std::uint64_t offset, Base::Span<std::byte> dst, ReadCompletion completion) {
+        if (!open_) {
+            completion(IoResult<std::size_t>::Err(IoError::Make(
+                Engine::IO::IoErrorCode::ReadFailed,
+                "MemoryStream: read on closed stream")));
+            return;
+        }
+        if (!opt_.readable) {
+            completion(IoResult<std::size_t>::Err(IoError::Make(
+                Engine::IO::IoErrorCode::NotSupported,
+                "MemoryStream: read not supported")));
+            return;
+        }
+
+        const std::uint64_t size = static_cast<std::uint64_t>(buf_.size());
+        const std::size_t n = offset >= size ? 0 : static_cast<std::size_t>(
+            (std::min<std::uint64_t>)(size - offset, static_cast<std::uint64_t>(dst.size()))
+        );
+        if (n > 0) std::memcpy(dst.data(), buf_.data() + offset, n);
+        completion(IoResult<std::size_t>::Ok(n));
+    }
+
     IoResult<std::size_t> MemoryStream::Write(const void* src, std::size_t bytes)  {
         if (!open_) {
             return IoResult<std::size_t>::Err(IoError::Make(
@@ -25,6 +25,21 @@ namespace Engine::IO::Stream {
         return IoResult<std::size_t>::Ok(n);
     }
 
+    void SpanStream::ReadAtAsync(std::uint64_t offset, Base::Span<std::byte> dst, ReadCompletion completion) {
+        if (!open_) {
+            completion(IoResult<std::size_t>::Err(IoError::Make(
+                Engine::IO::IoErrorCode::ReadFailed,
+                "SpanStream: read on closed stream")));
+            return;
+        }
+
+        const std::size_t n = offset >= size_ ? 0 : static_cast<std::size_t>(
+            (std::min<std::uint64_t>)(size_ - offset, static_cast<std::uint64_t>(dst.size()))
+        );
+        if (n > 0) std::memcpy(dst.data(), ro_ + offset, n);
+        completion(IoResult<std::size_t>::Ok(n));
+    }
+
     IoResult<std::size_t> SpanStream::Write(const void* src, std::size_t bytes)  {
         if (!open_) {
             return IoResult<std::size_t>::Err(IoError::Make(
@@ -112,6 +127,7 @@ namespace Engine::IO::Stream {
     IoResultVoid SpanStream::Close()  {
         open_ = false;
         eof_ = false;
+        shared_ = Base::SharedBuffer{}; // 共有バッファの参照を手放す
         return IoResultVoid::Ok();
     }
 }
\ No newline at end of file
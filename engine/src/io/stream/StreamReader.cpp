@@ -11,9 +11,27 @@ StreamReader::StreamReader(IStream& s) : s_(s) {
 }
 
 IoResult<std::size_t> StreamReader::ReadExactly(void* dst, std::size_t bytes) {
-    std::size_t done = 0;
     auto* out = static_cast<std::byte*>(dst);
 
+    // 先読み済みの分から
+    std::size_t done = std::min(llen_ - lpos_, bytes);
+    if (done != 0) {
+        std::memcpy(out, lbuf_.data() + lpos_, done);
+        lpos_ += done;
+    }
+
+    // 小さい残りはバッファ経由（次の読みもバッファから取れる）
+    if (bytes - done < lbuf_.size()) {
+        if (done < bytes) {
+            auto e = Ensure_(bytes - done);
+            if (!e) return IoResult<std::size_t>::Err(e.error());
+            std::memcpy(out + done, lbuf_.data() + lpos_, bytes - done);
+            lpos_ += bytes - done;
+        }
+        return IoResult<std::size_t>::Ok(bytes);
+    }
+
+    // 大きい残りは dst へ直接
     while (done < bytes) {
         auto rr = s_.Read(out + done, bytes - done);
         if (!rr) return rr;
@@ -29,112 +47,123 @@ IoResult<std::size_t> StreamReader::ReadExactly(void* dst, std::size_t bytes) {
     return IoResult<std::size_t>::Ok(done);
 }
 
-IoResult<std::vector<std::byte>> StreamReader::ReadAllBytes(std::size_t maxBytes) {
-    if (maxBytes == 0) maxBytes = 0; // 0 は無制限扱い（呼び出し側で opt.maxBytes を渡す想定）
+IoResultVoid StreamReader::Ensure_(std::size_t n) {
+    if (llen_ - lpos_ >= n) return IoResultVoid::Ok();
 
-    std::vector<std::byte> out;
-    out.reserve(64 * 1024);
+    // 残りを先頭へ寄せてから足す
+    const std::size_t rest = llen_ - lpos_;
+    if (rest != 0 && lpos_ != 0) std::memmove(lbuf_.data(), lbuf_.data() + lpos_, rest);
+    lpos_ = 0;
+    llen_ = rest;
+
+    while (llen_ < n) {
+        auto rr = s_.Read(lbuf_.data() + llen_, lbuf_.size() - llen_);
+        if (!rr) return IoResultVoid::Err(rr.error());
+        if (rr.value() == 0) {
+            return IoResultVoid::Err(IoError::Make(
+                Engine::IO::IoErrorCode::EndOfStream,
+                "StreamReader: unexpected EOF in ReadExactly"));
+        }
+        llen_ += rr.value();
+    }
+    return IoResultVoid::Ok();
+}
 
-    std::vector<std::byte> tmp;
-    tmp.resize(64 * 1024);
+IoResult<std::vector<std::byte>> StreamReader::ReadAllBytes(std::size_t maxBytes) {
+    // 0 は無制限扱い（呼び出し側で opt.maxBytes を渡す想定）
+    const std::size_t rest = llen_ - lpos_;
+    if (maxBytes != 0 && rest > maxBytes) {
+        return IoResult<std::vector<std::byte>>::Err(IoError::Make(
+            Engine::IO::IoErrorCode::ReadFailed,
+            "StreamReader: ReadAllBytes exceeded maxBytes"));
+    }
 
-    for (;;) {
-        auto rr = s_.Read(tmp.data(), tmp.size());
-        if (!rr) return IoResult<std::vector<std::byte>>::Err(rr.error());
+    ReadToEndOptions opt{};
+    opt.maxBytes = (maxBytes == 0) ? 0 : std::max<std::size_t>(maxBytes - rest, 1);
 
-        const std::size_t n = rr.value();
-        if (n == 0) break;
+    std::vector<std::byte> out;
+    auto rr = ReadToEnd(s_, out, opt);
+    if (!rr) return IoResult<std::vector<std::byte>>::Err(rr.error());
 
-        if (maxBytes != 0 && out.size() + n > maxBytes) {
+    // 先読み済みの分を前に足す（ReadLine 等と混ぜた時だけ）
+    if (rest != 0) {
+        if (maxBytes != 0 && out.size() + rest > maxBytes) {
             return IoResult<std::vector<std::byte>>::Err(IoError::Make(
                 Engine::IO::IoErrorCode::ReadFailed,
                 "StreamReader: ReadAllBytes exceeded maxBytes"));
         }
-
-        out.insert(out.end(), tmp.begin(), tmp.begin() + static_cast<std::ptrdiff_t>(n));
+        out.insert(out.begin(), lbuf_.begin() + static_cast<std::ptrdiff_t>(lpos_),
+                   lbuf_.begin() + static_cast<std::ptrdiff_t>(llen_));
+        lpos_ = llen_;
     }
-
     return IoResult<std::vector<std::byte>>::Ok(std::move(out));
 }
 
 IoResult<std::uint8_t> StreamReader::ReadU8() {
-    std::uint8_t v = 0;
-    auto r = ReadExactly(&v, 1);
-    if (!r) return IoResult<std::uint8_t>::Err(r.error());
-    return IoResult<std::uint8_t>::Ok(v);
+    auto e = Ensure_(1);
+    if (!e) return IoResult<std::uint8_t>::Err(e.error());
+    return IoResult<std::uint8_t>::Ok(static_cast<std::uint8_t>(lbuf_[lpos_++]));
 }
 
-IoResult<std::uint16_t> StreamReader::ReadU16LE() {
-    std::uint8_t b[2]{};
-    auto r = ReadExactly(b, 2);
-    if (!r) return IoResult<std::uint16_t>::Err(r.error());
-    const std::uint16_t v = static_cast<std::uint16_t>(b[0]) |
-                            (static_cast<std::uint16_t>(b[1]) << 8);
-    return IoResult<std::uint16_t>::Ok(v);
-}
-
-IoResult<std::uint32_t> StreamReader::ReadU32LE() {
-    std::uint8_t b[4]{};
-    auto r = ReadExactly(b, 4);
-    if (!r) return IoResult<std::uint32_t>::Err(r.error());
-    const std::uint32_t v = static_cast<std::uint32_t>(b[0]) |
-                            (static_cast<std::uint32_t>(b[1]) << 8) |
-                            (static_cast<std::uint32_t>(b[2]) << 16) |
-                            (static_cast<std::uint32_t>(b[3]) << 24);
-    return IoResult<std::uint32_t>::Ok(v);
-}
-
-IoResult<std::uint64_t> StreamReader::ReadU64LE() {
-    std::uint8_t b[8]{};
-    auto r = ReadExactly(b, 8);
-    if (!r) return IoResult<std::uint64_t>::Err(r.error());
-    std::uint64_t v = 0;
-    for (int i = 0; i < 8; ++i) {
-        v |= (static_cast<std::uint64_t>(b[i]) << (8 * i));
-    }
-    return IoResult<std::uint64_t>::Ok(v);
-}
+IoResult<std::uint16_t> StreamReader::ReadU16LE() { return ReadScalar_<std::uint16_t>(std::endian::little); }
+IoResult<std::uint32_t> StreamReader::ReadU32LE() { return ReadScalar_<std::uint32_t>(std::endian::little); }
+IoResult<std::uint64_t> StreamReader::ReadU64LE() { return ReadScalar_<std::uint64_t>(std::endian::little); }
+IoResult<std::uint16_t> StreamReader::ReadU16BE() { return ReadScalar_<std::uint16_t>(std::endian::big); }
+IoResult<std::uint32_t> StreamReader::ReadU32BE() { return ReadScalar_<std::uint32_t>(std::endian::big); }
+IoResult<std::uint64_t> StreamReader::ReadU64BE() { return ReadScalar_<std::uint64_t>(std::endian::big); }
 
 IoResult<std::string> StreamReader::ReadAllText(const TextReadOptions& opt) {
-    const std::size_t limit = opt.maxBytes; // 0=無制限
-    auto br = ReadAllBytes(limit);
-    if (!br) return IoResult<std::string>::Err(br.error());
+    // std::string へ直接読む（bytes -> string のコピーをしない）
+    const std::size_t rest = llen_ - lpos_;
+    if (opt.maxBytes != 0 && rest > opt.maxBytes) {
+        return IoResult<std::string>::Err(IoError::Make(
+            Engine::IO::IoErrorCode::ReadFailed,
+            "StreamReader: ReadAllBytes exceeded maxBytes"));
+    }
 
-    auto bytes = std::move(br.value());
+    ReadToEndOptions ro{};
+    ro.maxBytes = (opt.maxBytes == 0) ? 0 : std::max<std::size_t>(opt.maxBytes - rest, 1); // 0=無制限
 
-    // UTF-8 BOM を削除
-    std::size_t start = 0;
-    if (opt.stripUtf8Bom && bytes.size() >= 3) {
-        if (bytes[0] == std::byte{0xEF} && bytes[1] == std::byte{0xBB} && bytes[2] == std::byte{0xBF}) {
-            start = 3;
+    std::string s;
+    auto rr = ReadToEnd(s_, s, ro);
+    if (!rr) return IoResult<std::string>::Err(rr.error());
+    if (rest != 0) {
+        if (opt.maxBytes != 0 && s.size() + rest > opt.maxBytes) {
+            return IoResult<std::string>::Err(IoError::Make(
+                Engine::IO::IoErrorCode::ReadFailed,
+                "StreamReader: ReadAllBytes exceeded maxBytes"));
         }
+        s.insert(0, reinterpret_cast<const char*>(lbuf_.data() + lpos_), rest);
+        lpos_ = llen_;
     }
 
-    std::string s;
-    s.reserve(bytes.size() - start);
-    for (std::size_t i = start; i < bytes.size(); ++i) {
-        s.push_back(static_cast<char>(bytes[i]));
+    // UTF-8 BOM を削除
+    if (opt.stripUtf8Bom && s.size() >= 3 &&
+        static_cast<unsigned char>(s[0]) == 0xEF &&
+        static_cast<unsigned char>(s[1]) == 0xBB &&
+        static_cast<unsigned char>(s[2]) == 0xBF) {
+        s.erase(0, 3);
     }
 
     if (!opt.normalizeNewlines) {
         return IoResult<std::string>::Ok(std::move(s));
     }
 
-    // 改行正規化: "\r\n" -> "\n", "\r" -> "\n"
-    std::string out;
-    out.reserve(s.size());
+    // 改行正規化: "\r\n" -> "\n", "\r" -> "\n"（縮むだけなのでその場で詰める）
+    std::size_t w = 0;
     for (std::size_t i = 0; i < s.size(); ++i) {
         const char c = s[i];
         if (c == '\r') {
             if (i + 1 < s.size() && s[i + 1] == '\n') {
                 ++i; // skip '\n'
             }
-            out.push_back('\n');
+            s[w++] = '\n';
         } else {
-            out.push_back(c);
+            s[w++] = c;
         }
     }
-    return IoResult<std::string>::Ok(std::move(out));
+    s.resize(w);
+    return IoResult<std::string>::Ok(std::move(s));
 }
 
 IoResult<std::size_t> StreamReader::FillLineBuffer() {
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// ベンチ用の小道具（計測・テストデータ生成）
+namespace Bench {
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Sample final {
+        const char* name = "";
+        double ms = 0.0;
+        std::uint64_t bytes = 0;
+    };
+
+    // fn を iterations 回実行し、最速の 1 回を返す（ページキャッシュが温まった状態を測る）
+    template <class Fn>
+    Sample Measure(const char* name, int iterations, Fn&& fn) {
+        Sample best;
+        best.name = name;
+        best.ms = 1e300;
+        for (int i = 0; i < iterations; ++i) {
+            const auto t0 = Clock::now();
+            const std::uint64_t bytes = fn();
+            const auto t1 = Clock::now();
+            const double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+            if (ms < best.ms) {
+                best.ms = ms;
+                best.bytes = bytes;
+            }
+        }
+        return best;
+    }
+
+    inline void Print(const Sample& s) {
+        const double mbps = s.ms > 0.0 ? (static_cast<double>(s.bytes) / (1024.0 * 1024.0)) / (s.ms / 1000.0) : 0.0;
+        std::printf("  %-32s %10.3f ms  %10.1f MiB/s\n", s.name, s.ms, mbps);
+    }
+
+    // 決定的な内容のファイルを作る
+    inline void WriteFile(const std::filesystem::path& p, std::size_t size) {
+        std::filesystem::create_directories(p.parent_path());
+        std::vector<char> buf(size);
+        std::uint32_t x = 0x9E3779B9u ^ static_cast<std::uint32_t>(size);
+        for (auto& c : buf) {
+            x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+            c = static_cast<char>(x);
+        }
+        std::ofstream ofs(p, std::ios::binary | std::ios::trunc);
+        ofs.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+    }
+
+} // namespace Bench
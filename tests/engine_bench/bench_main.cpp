@@ -0,0 +1,18 @@
+#include <cstdio>
+
+// 各ベンチの入口（対応 backend がある場合のみリンクされる）
+#if defined(ENGINE_BENCH_NATIVE_FS)
+int RunNativeFsBench(int argc, char** argv);
+int RunPakBench(int argc, char** argv);
+#endif
+
+int main(int argc, char** argv) {
+    int rc = 0;
+#if defined(ENGINE_BENCH_NATIVE_FS)
+    rc |= RunNativeFsBench(argc, argv);
+    rc |= RunPakBench(argc, argv);
+#endif
+    (void)argc;
+    (void)argv;
+    return rc;
+}
@@ -0,0 +1,88 @@
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../BenchCommon.hpp"
+
+#include "engine/io/fs/NativeFileSystem.hpp"
+#include "engine/io/path/Uri.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+    // 現状の読み込み経路（AssetCatalog と同じ ifstream 全読み）
+    std::uint64_t ReadAllIfstream(const std::string& path, std::vector<char>& out) {
+        std::ifstream ifs(path, std::ios::in | std::ios::binary);
+        if (!ifs) return 0;
+        ifs.seekg(0, std::ios::end);
+        const auto size = static_cast<std::size_t>(ifs.tellg());
+        ifs.seekg(0, std::ios::beg);
+        out.resize(size);
+        ifs.read(out.data(), static_cast<std::streamsize>(size));
+        return static_cast<std::uint64_t>(ifs.gcount());
+    }
+
+    // NativeFileSystem 経由（open + fstat + pread）
+    std::uint64_t ReadAllNative(Engine::IO::FS::NativeFileSystem& nfs, const std::string& rel, std::vector<char>& out) {
+        auto sr = nfs.OpenFile(Engine::IO::Path::ParseUriLoose(rel), Engine::IO::Stream::OpenReadBinary());
+        if (!sr) return 0;
+        auto& s = *sr.value();
+        const auto size = static_cast<std::size_t>(s.Size().value());
+        out.resize(size);
+        auto rr = s.ReadAt(0, out.data(), size);
+        return rr ? static_cast<std::uint64_t>(rr.value()) : 0;
+    }
+
+} // namespace
+
+// usage: engine_bench [smallFileCount] [largeFileMiB]
+int RunNativeFsBench(int argc, char** argv) {
+    const int smallCount = argc > 1 ? std::atoi(argv[1]) : 2000;
+    const int largeMiB   = argc > 2 ? std::atoi(argv[2]) : 64;
+    constexpr int kIterations = 5;
+
+    const fs::path root = fs::temp_directory_path() / "engine_bench_native_fs";
+    fs::remove_all(root);
+
+    std::vector<std::string> smallFiles;
+    smallFiles.reserve(static_cast<std::size_t>(smallCount));
+    for (int i = 0; i < smallCount; ++i) {
+        const std::string rel = "small/f" + std::to_string(i) + ".bin";
+        Bench::WriteFile(root / rel, 4 * 1024 + static_cast<std::size_t>(i % 13) * 1024);
+        smallFiles.push_back(rel);
+    }
+    Bench::WriteFile(root / "large.bin", static_cast<std::size_t>(largeMiB) * 1024 * 1024);
+
+    Engine::IO::FS::NativeFileSystem::Options opt;
+    opt.rootDirectory = root.string();
+    Engine::IO::FS::NativeFileSystem nfs(opt);
+
+    std::vector<char> buf;
+
+    std::printf("[NativeFS] %d small files (4-16KiB), 1 x %d MiB\n", smallCount, largeMiB);
+
+    Bench::Print(Bench::Measure("small: ifstream", kIterations, [&] {
+        std::uint64_t total = 0;
+        for (const auto& rel : smallFiles) total += ReadAllIfstream((root / rel).string(), buf);
+        return total;
+    }));
+    Bench::Print(Bench::Measure("small: NativeFS (pread)", kIterations, [&] {
+        std::uint64_t total = 0;
+        for (const auto& rel : smallFiles) total += ReadAllNative(nfs, rel, buf);
+        return total;
+    }));
+
+    Bench::Print(Bench::Measure("large: ifstream", kIterations, [&] {
+        return ReadAllIfstream((root / "large.bin").string(), buf);
+    }));
+    Bench::Print(Bench::Measure("large: NativeFS (pread)", kIterations, [&] {
+        return ReadAllNative(nfs, "large.bin", buf);
+    }));
+
+    fs::remove_all(root);
+    return 0;
+}
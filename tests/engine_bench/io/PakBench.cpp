@@ -0,0 +1,151 @@
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../BenchCommon.hpp"
+
+#include "engine/io/fs/MappedFile.hpp"
+#include "engine/io/fs/NativeFileStream.hpp"
+#include "engine/io/fs/NativeFileSystem.hpp"
+#include "engine/io/pak/PakArchive.hpp"
+#include "engine/io/pak/PakWriter.hpp"
+#include "engine/io/path/Uri.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+    // 実アセットに近い、ある程度圧縮の効くデータ（json / シェーダ / メッシュの数値列を想定）
+    void WriteAssetLikeFile(const fs::path& p, std::size_t size, std::uint32_t seed) {
+        static const char* kWords[] = { "\"position\": [", "0.25, ", "1.0, ", "-0.5], ", "\"uv\": ",
+                                        "float4 ", "texture2D ", "sampler ", "\n", "{", "}" };
+        fs::create_directories(p.parent_path());
+        std::string buf;
+        buf.reserve(size);
+        std::uint32_t x = seed | 1u;
+        while (buf.size() < size) {
+            x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+            if (x % 8 == 0) buf.push_back(static_cast<char>(x >> 8));
+            else buf += kWords[(x >> 4) % 11];
+        }
+        buf.resize(size);
+        std::ofstream ofs(p, std::ios::binary | std::ios::trunc);
+        ofs.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+    }
+
+    // ページキャッシュから追い出す（ディスク律速の状態を作る。dirty ページは先に書き出す）
+    void DropPageCache(const fs::path& p) {
+        const int fd = ::open(p.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return;
+        (void)::fdatasync(fd);
+        (void)::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+
+    std::uint64_t ReadLoose(Engine::IO::FS::NativeFileSystem& nfs, const std::vector<std::string>& files, std::vector<char>& buf) {
+        std::uint64_t total = 0;
+        for (const auto& rel : files) {
+            auto sr = nfs.OpenFile(Engine::IO::Path::ParseUriLoose(rel), Engine::IO::Stream::OpenReadBinary());
+            if (!sr) continue;
+            const auto size = static_cast<std::size_t>(sr.value()->Size().value());
+            buf.resize(size);
+            auto rr = sr.value()->ReadAt(0, buf.data(), size);
+            if (rr) total += rr.value();
+        }
+        return total;
+    }
+
+    std::uint64_t ReadPak(const fs::path& pakPath, const std::vector<std::string>& files) {
+        auto ar = Engine::IO::Pak::PakArchive::OpenMapped(pakPath.string());
+        if (!ar) return 0;
+
+        std::uint64_t total = 0;
+        volatile unsigned sink = 0;
+        for (const auto& rel : files) {
+            auto rb = ar.value()->ReadFile(rel);
+            if (!rb) continue;
+            // mmap の遅延読み込みを計測に含めるため、全ページに触る
+            const auto& b = rb.value();
+            for (std::size_t i = 0; i < b.size(); i += 4096) sink = sink + std::to_integer<unsigned>(b[i]);
+            total += b.size();
+        }
+        return total;
+    }
+
+    bool BuildPak(const fs::path& root, const std::vector<std::string>& files, const fs::path& out,
+                  Engine::IO::Pak::PakCompression compression) {
+        Engine::IO::Pak::PakWriter w;
+        for (const auto& rel : files) {
+            const std::string native = (root / rel).string();
+            auto ar = w.Add(rel, [native]() -> Engine::IO::Pak::IoResult<Engine::Base::SharedBuffer> {
+                auto mf = Engine::IO::FS::MappedFile::Open(native);
+                if (!mf) return Engine::IO::Pak::IoResult<Engine::Base::SharedBuffer>::Err(std::move(mf.error()));
+                const auto bytes = mf.value()->Bytes();
+                return Engine::IO::Pak::IoResult<Engine::Base::SharedBuffer>::Ok(Engine::Base::SharedBuffer(std::move(mf.value()), bytes));
+            }, compression);
+            if (!ar) return false;
+        }
+        auto os = Engine::IO::FS::NativeFileStream::Open(out.string(), Engine::IO::Stream::OpenWriteBinaryTruncate(true),
+                                                         Engine::IO::FS::AccessHint::Sequential);
+        if (!os) return false;
+        return static_cast<bool>(w.WriteTo(*os.value())) && static_cast<bool>(os.value()->Close());
+    }
+
+} // namespace
+
+// usage: engine_bench [smallFileCount] [largeFileMiB] [pakFileCount]
+// - cold: 各反復の前にページキャッシュから追い出す（ディスク律速の環境での比較）
+// - warm: キャッシュ済み（展開コストそのものの比較）
+int RunPakBench(int argc, char** argv) {
+    const int fileCount = argc > 3 ? std::atoi(argv[3]) : 400;
+    constexpr int kIterations = 5;
+
+    const fs::path root = fs::temp_directory_path() / "engine_bench_pak";
+    fs::remove_all(root);
+
+    std::vector<std::string> files;
+    files.reserve(static_cast<std::size_t>(fileCount));
+    for (int i = 0; i < fileCount; ++i) {
+        const std::string rel = "assets/f" + std::to_string(i) + ".dat";
+        // 16KB〜1MB 程度のばらつき
+        WriteAssetLikeFile(root / "loose" / rel, 16 * 1024 + static_cast<std::size_t>(i % 16) * 64 * 1024, static_cast<std::uint32_t>(i));
+        files.push_back(rel);
+    }
+
+    const fs::path rawPak = root / "raw.pak";
+    const fs::path lzPak = root / "lz.pak";
+    if (!BuildPak(root / "loose", files, rawPak, Engine::IO::Pak::PakCompression::None) ||
+        !BuildPak(root / "loose", files, lzPak, Engine::IO::Pak::PakCompression::Lz)) {
+        std::printf("[Pak] failed to build paks\n");
+        return 1;
+    }
+
+    Engine::IO::FS::NativeFileSystem::Options opt;
+    opt.rootDirectory = (root / "loose").string();
+    Engine::IO::FS::NativeFileSystem nfs(opt);
+    std::vector<char> buf;
+
+    std::printf("[Pak] %d files, raw.pak %.1f MiB, lz.pak %.1f MiB\n", fileCount,
+                static_cast<double>(fs::file_size(rawPak)) / (1024.0 * 1024.0),
+                static_cast<double>(fs::file_size(lzPak)) / (1024.0 * 1024.0));
+
+    auto dropLoose = [&] { for (const auto& rel : files) DropPageCache(root / "loose" / rel); };
+
+    // MiB/s は展開後のバイト数基準
+    Bench::Print(Bench::Measure("cold: loose files (pread)", kIterations, [&] { dropLoose(); return ReadLoose(nfs, files, buf); }));
+    Bench::Print(Bench::Measure("cold: pak raw (mmap)", kIterations, [&] { DropPageCache(rawPak); return ReadPak(rawPak, files); }));
+    Bench::Print(Bench::Measure("cold: pak lz (mmap + decode)", kIterations, [&] { DropPageCache(lzPak); return ReadPak(lzPak, files); }));
+
+    Bench::Print(Bench::Measure("warm: loose files (pread)", kIterations, [&] { return ReadLoose(nfs, files, buf); }));
+    Bench::Print(Bench::Measure("warm: pak raw (mmap)", kIterations, [&] { return ReadPak(rawPak, files); }));
+    Bench::Print(Bench::Measure("warm: pak lz (mmap + decode)", kIterations, [&] { return ReadPak(lzPak, files); }));
+
+    fs::remove_all(root);
+    return 0;
+}
@@ -46,7 +46,7 @@ TEST_CASE("AssetCatalog: build entries with resolvedPath") {
     REQUIRE(e != nullptr);
     CHECK(!e->sourcePath.empty());
     CHECK(!e->resolvedPath.empty());
-    CHECK(e->resolvedPath.find("assets") != std::string::npos);
+    CHECK(e->resolvedPath.View().find("assets") != std::string_view::npos);
 }
 
 TEST_CASE("AssetCatalog: duplicate id should fail") {
@@ -73,3 +73,70 @@ TEST_CASE("AssetCatalog: duplicate id should fail") {
     CHECK(!r);
     CHECK(r.error().code == Engine::Asset::AssetErrorCode::InvalidCatalogEntry);
 }
+
+TEST_CASE("AssetCatalog: parallel build matches serial result") {
+    fs::path tmp = fs::temp_directory_path() / "asset_catalog_test_parallel";
+    fs::remove_all(tmp);
+
+    fs::path assetsRoot = tmp / "assets";
+    fs::path catalogPath = tmp / "config/engine/asset_catalog.json";
+
+    constexpr int kCount = 5000;
+    std::string json = R"({ "assets":[)";
+    for (int i = 0; i < kCount; ++i) {
+        if (i != 0) json += ",";
+        json += R"({"id":"e)" + std::to_string(i) + R"(","type":"text","path":"dir/./f)" + std::to_string(i) + R"(.txt"})";
+    }
+    json += "]}";
+    WriteText(catalogPath, json);
+
+    AssetPathResolver::Options options;
+    options.assetsRoot = assetsRoot.string();
+    AssetPathResolver resolver(options);
+    CatalogParser parser;
+
+    AssetCatalog::BuildOptions build;
+    build.maxWorkers = 4;
+    build.minEntriesPerWorker = 16;
+    AssetCatalog catalog(build);
+
+    auto r = catalog.LoadFromFile(catalogPath.string(), parser, resolver);
+    REQUIRE(r);
+    CHECK(catalog.Entries().size() == static_cast<std::size_t>(kCount));
+
+    const auto* e = catalog.Find(AssetId::FromString("e4999"));
+    REQUIRE(e != nullptr);
+    CHECK(e->resolvedPath.View() == resolver.Resolve("dir/f4999.txt").value());
+}
+
+TEST_CASE("AssetCatalog: parallel build reports the first duplicate in catalog order") {
+    fs::path tmp = fs::temp_directory_path() / "asset_catalog_test_parallel_dup";
+    fs::remove_all(tmp);
+
+    fs::path assetsRoot = tmp / "assets";
+    fs::path catalogPath = tmp / "config/engine/asset_catalog.json";
+
+    std::string json = R"({ "assets":[)";
+    for (int i = 0; i < 1000; ++i) {
+        json += R"({"id":"e)" + std::to_string(i) + R"(","type":"text","path":"f.txt"},)";
+    }
+    // 後半に2種類の重複：先に現れる "e10" が報告されるべき
+    json += R"({"id":"e10","type":"text","path":"x.txt"},)";
+    json += R"({"id":"e5","type":"text","path":"y.txt"}]})";
+    WriteText(catalogPath, json);
+
+    AssetPathResolver::Options options;
+    options.assetsRoot = assetsRoot.string();
+    AssetPathResolver resolver(options);
+    CatalogParser parser;
+
+    AssetCatalog::BuildOptions build;
+    build.maxWorkers = 8;
+    build.minEntriesPerWorker = 1;
+    AssetCatalog catalog(build);
+
+    auto r = catalog.LoadFromFile(catalogPath.string(), parser, resolver);
+    REQUIRE(!r);
+    CHECK(r.error().code == Engine::Asset::AssetErrorCode::InvalidCatalogEntry);
+    CHECK(r.error().detail == "e10");
+}
@@ -0,0 +1,64 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "engine/asset/core/AssetDependencyGraph.hpp"
+
+using Engine::Asset::AssetId;
+using Engine::Asset::Core::AssetDependencyGraph;
+
+static AssetId Id(const char* s) { return AssetId::FromString(s); }
+
+static std::size_t IndexOf(const std::vector<AssetId>& v, const AssetId& id) {
+    return static_cast<std::size_t>(std::find(v.begin(), v.end(), id) - v.begin());
+}
+
+TEST_CASE("AssetDependencyGraph: affected set is ordered dependencies first") {
+    AssetDependencyGraph g;
+    // tex <- mat_a <- model
+    // tex <- mat_b
+    // other（無関係）
+    const std::vector<AssetId> matDeps{ Id("tex") };
+    const std::vector<AssetId> modelDeps{ Id("mat_a"), Id("mat_b") };
+    g.SetDependencies(Id("mat_a"), matDeps);
+    g.SetDependencies(Id("mat_b"), matDeps);
+    g.SetDependencies(Id("model"), modelDeps);
+    g.SetDependencies(Id("other"), std::vector<AssetId>{ Id("sound") });
+
+    std::vector<AssetId> out;
+    g.CollectAffected(std::vector<AssetId>{ Id("tex") }, out);
+    REQUIRE(out.size() == 4);
+    CHECK(out.front() == Id("tex"));
+    CHECK(IndexOf(out, Id("mat_a")) < IndexOf(out, Id("model")));
+    CHECK(IndexOf(out, Id("mat_b")) < IndexOf(out, Id("model")));
+    CHECK(IndexOf(out, Id("other")) == out.size());
+
+    // roots 同士に依存関係があれば、渡した順ではなく依存順
+    g.CollectAffected(std::vector<AssetId>{ Id("model"), Id("mat_a") }, out);
+    REQUIRE(out.size() == 2);
+    CHECK(out[0] == Id("mat_a"));
+    CHECK(out[1] == Id("model"));
+
+    // 依存の置き換え
+    g.SetDependencies(Id("model"), std::vector<AssetId>{ Id("mat_b") });
+    g.CollectAffected(std::vector<AssetId>{ Id("mat_a") }, out);
+    CHECK(out.size() == 1);
+    CHECK(g.DependentsOf(Id("mat_a")).empty());
+}
+
+TEST_CASE("AssetDependencyGraph: cycles terminate and Remove unlinks both sides") {
+    AssetDependencyGraph g;
+    g.SetDependencies(Id("a"), std::vector<AssetId>{ Id("b"), Id("b"), Id("a") }); // 重複と自己依存は無視
+    g.SetDependencies(Id("b"), std::vector<AssetId>{ Id("a") });
+    CHECK(g.DependenciesOf(Id("a")).size() == 1);
+
+    std::vector<AssetId> out;
+    g.CollectAffected(std::vector<AssetId>{ Id("a") }, out);
+    CHECK(out.size() == 2);
+
+    g.Remove(Id("b"));
+    CHECK(g.DependenciesOf(Id("a")).empty());
+    CHECK(g.DependentsOf(Id("a")).empty());
+    CHECK(g.NodeCount() == 0);
+}
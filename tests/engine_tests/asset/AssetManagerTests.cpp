@@ -1,5 +1,7 @@
 #include "doctest/doctest.h"
 
+#include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -27,21 +29,23 @@ namespace {
     class MemoryAssetSource final : public Loading::IAssetSource {
     public:
         void Put(const std::string& path, std::vector<std::byte> bytes) {
-            map_[path] = std::move(bytes);
+            map_[path] = Engine::Base::SharedBuffer::FromVector(std::move(bytes));
         }
 
-        Engine::Base::Result<std::vector<std::byte>, Engine::Base::Error<AssetErrorCode>>
+        void Erase(const std::string& path) { map_.erase(path); }
+
+        Engine::Base::Result<Engine::Base::SharedBuffer, Engine::Base::Error<AssetErrorCode>>
         ReadAll(std::string_view resolvedPath) override {
             auto it = map_.find(std::string(resolvedPath));
             if (it == map_.end()) {
-                return Engine::Base::Result<std::vector<std::byte>, Engine::Base::Error<AssetErrorCode>>::Err(
+                return Engine::Base::Result<Engine::Base::SharedBuffer, Engine::Base::Error<AssetErrorCode>>::Err(
                     Engine::Base::Error<AssetErrorCode>::Make(AssetErrorCode::SourceReadFailed, "MemoryAssetSource: not found", std::string(resolvedPath)));
             }
-            return Engine::Base::Result<std::vector<std::byte>, Engine::Base::Error<AssetErrorCode>>::Ok(it->second);
+            return Engine::Base::Result<Engine::Base::SharedBuffer, Engine::Base::Error<AssetErrorCode>>::Ok(it->second);
         }
 
     private:
-        std::unordered_map<std::string, std::vector<std::byte>> map_;
+        std::unordered_map<std::string, Engine::Base::SharedBuffer> map_;
     };
 
     static std::vector<std::byte> BytesOf(const std::string& s) {
@@ -103,6 +107,48 @@ TEST_CASE("AssetManager: sync load -> cache hit") {
     CHECK(h2.value().generation() == h1.value().generation());
 }
 
+TEST_CASE("AssetManager: catalog miss loads only with override path and type hint") {
+    AssetCatalog catalog; // 空
+
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::TextLoader>());
+    MemoryAssetSource source;
+    source.Put("mem://tool/a.txt", BytesOf("tool"));
+    Loading::AssetPipeline pipeline(source, registry);
+
+    Core::AssetStorage storage;
+    Core::AssetLifetime lifetime;
+    Core::AssetCachePolicy::Options options;
+    Core::AssetCachePolicy policy(options);
+    AssetManager mgr(catalog, pipeline, storage, lifetime, policy, nullptr, nullptr);
+
+    const AssetId id = AssetId::FromString("tool.a");
+
+    // override も hint も無い
+    auto r0 = mgr.Load(id, AssetRequest::Default());
+    REQUIRE(!r0);
+    CHECK(r0.error().code == AssetErrorCode::CatalogNotFound);
+
+    // override だけでは type が決まらない
+    auto r1 = mgr.Load(id, AssetRequest::WithOverridePath("mem://tool/a.txt"));
+    REQUIRE(!r1);
+    CHECK(r1.error().code == AssetErrorCode::CatalogNotFound);
+
+    // hint だけでは読む場所が無い
+    auto r2 = mgr.Load(id, AssetRequest::WithTypeHint(AssetType::FromString("text")));
+    REQUIRE(!r2);
+    CHECK(r2.error().code == AssetErrorCode::CatalogNotFound);
+
+    AssetRequest req = AssetRequest::WithOverridePath("mem://tool/a.txt");
+    req.useTypeHint = true;
+    req.expectedType = AssetType::FromString("text");
+    auto r3 = mgr.Load(id, req);
+    REQUIRE(r3);
+    auto sp = mgr.GetShared<Loaders::TextAsset>(r3.value());
+    REQUIRE(sp != nullptr);
+    CHECK(sp->text == "tool");
+}
+
 TEST_CASE("AssetManager: reload increments generation and stale handle") {
     // pipeline 等は上と同様に組む（省略）
     // ポイントは：
@@ -120,3 +166,264 @@ TEST_CASE("AssetManager: reload fail + KeepOldIfAny keeps Ready") {
     // 3) fallback=KeepOldIfAny なら Ready のまま旧データ維持
     CHECK(true);
 }
+
+namespace {
+    struct CoroFixture {
+        AssetCatalog catalog;
+        Loading::LoaderRegistry registry;
+        MemoryAssetSource source;
+        Core::AssetStorage storage;
+        Core::AssetLifetime lifetime;
+        Core::AssetCachePolicy::Options policyOptions;
+        Core::AssetCachePolicy policy{ policyOptions };
+        std::unique_ptr<Loading::AssetPipeline> pipeline;
+        std::unique_ptr<AssetManager> mgr;
+
+        CoroFixture() {
+            registry.Register(std::make_unique<Loaders::TextLoader>());
+            source.Put("mem://a.txt", BytesOf("A"));
+            source.Put("mem://b.txt", BytesOf("B"));
+            source.Put("mem://c.txt", BytesOf("C"));
+            pipeline = std::make_unique<Loading::AssetPipeline>(source, registry);
+            mgr = std::make_unique<AssetManager>(catalog, *pipeline, storage, lifetime, policy, nullptr, nullptr);
+        }
+
+        static AssetRequest Req(const std::string& path) {
+            AssetRequest r = AssetRequest::AsyncLoad();
+            r.overridePath = path; // catalog無しで進めるため override + type hint
+            r.useTypeHint = true;
+            r.expectedType = AssetType::FromString("text");
+            return r;
+        }
+    };
+
+    Task<std::string> LoadText(AssetManager& mgr, const char* id, std::string path, IResumeExecutor* ex = nullptr) {
+        auto r = co_await mgr.LoadAsync(AssetId::FromString(id), CoroFixture::Req(path), ex);
+        if (!r) co_return std::string("error");
+        auto sp = mgr.GetShared<Loaders::TextAsset>(r.value());
+        co_return sp ? sp->text : std::string("null");
+    }
+
+    Task<std::string> LoadSequence(AssetManager& mgr) {
+        // 順に書いた読み込みがフレームを跨いで進む
+        std::string a = co_await LoadText(mgr, "a", "mem://a.txt");
+        std::string b = co_await LoadText(mgr, "b", "mem://b.txt");
+        co_return a + b;
+    }
+} // namespace
+
+TEST_CASE("AssetManager: co_await LoadAsync resumes in Update") {
+    CoroFixture f;
+
+    auto t = LoadSequence(*f.mgr);
+    t.Start();
+    CHECK(!t.IsDone());
+    CHECK(f.mgr->PendingAwaiters() == 1);
+
+    f.mgr->Update(); // a が Ready -> b を要求して再び suspend
+    CHECK(!t.IsDone());
+    f.mgr->Update();
+    REQUIRE(t.IsDone());
+    CHECK(t.Result() == "AB");
+
+    // キャッシュヒットは suspend しない
+    auto again = LoadText(*f.mgr, "a", "mem://a.txt");
+    again.Start();
+    REQUIRE(again.IsDone());
+    CHECK(again.Result() == "A");
+
+    // 失敗は Err で返る
+    auto missing = LoadText(*f.mgr, "missing", "mem://none.txt");
+    missing.Start();
+    f.mgr->Update();
+    REQUIRE(missing.IsDone());
+    CHECK(missing.Result() == "error");
+}
+
+TEST_CASE("AssetManager: failed co_await does not keep a reference") {
+    CoroFixture f;
+    Core::AssetCachePolicy::Options popt;
+    popt.keepFailedRecords = false;
+    f.policy.SetOptions(popt);
+
+    auto missing = LoadText(*f.mgr, "missing", "mem://none.txt");
+    missing.Start();
+    f.mgr->Update();
+    REQUIRE(missing.IsDone());
+    CHECK(missing.Result() == "error");
+
+    const Core::AssetRecord* rec = f.storage.Find(AssetId::FromString("missing"));
+    REQUIRE(rec);
+    CHECK(rec->IsFailed());
+    CHECK(rec->refCount == 0);
+    CHECK(f.mgr->EvictIfPossible(AssetId::FromString("missing")));
+    CHECK(f.storage.Find(AssetId::FromString("missing")) == nullptr);
+}
+
+TEST_CASE("AssetManager: WhenAll loads a group in one batch and executor controls resumption") {
+    CoroFixture f;
+    AssetManager::Options opt;
+    opt.maxLoadsPerFrame = 8;
+    f.mgr->SetOptions(opt);
+
+    ManualExecutor ex;
+    std::vector<Task<std::string>> group;
+    group.push_back(LoadText(*f.mgr, "a", "mem://a.txt", &ex));
+    group.push_back(LoadText(*f.mgr, "b", "mem://b.txt", &ex));
+    group.push_back(LoadText(*f.mgr, "c", "mem://c.txt", &ex));
+
+    auto all = WhenAll(std::move(group));
+    all.Start();
+    CHECK(f.mgr->PendingAwaiters() == 3);
+
+    // 3 件とも同じ Update で読まれるが、再開は executor を回すまで起きない
+    f.mgr->Update();
+    CHECK(f.mgr->PendingAwaiters() == 0);
+    CHECK(!all.IsDone());
+
+    CHECK(ex.RunPending() == 3);
+    REQUIRE(all.IsDone());
+    const auto texts = all.Result();
+    REQUIRE(texts.size() == 3);
+    CHECK(texts[0] == "A");
+    CHECK(texts[1] == "B");
+    CHECK(texts[2] == "C");
+}
+
+namespace {
+    AssetHandle LoadSyncText(CoroFixture& f, const char* id, const std::string& path) {
+        AssetRequest r = CoroFixture::Req(path);
+        r.sync = AssetRequest::SyncWith::Sync;
+        auto h = f.mgr->Load(AssetId::FromString(id), r);
+        REQUIRE(h);
+        return h.value();
+    }
+
+    std::string TextOf(CoroFixture& f, const char* id) {
+        const Core::AssetRecord* rec = f.storage.Find(AssetId::FromString(id));
+        if (!rec) return "none";
+        auto sp = f.mgr->GetShared<Loaders::TextAsset>(AssetHandle::Make(rec->id, rec->generation));
+        return sp ? std::string(sp->text) : std::string("null");
+    }
+} // namespace
+
+TEST_CASE("AssetManager: reload transaction swaps changed assets and dependents together") {
+    CoroFixture f;
+    const AssetHandle tex = LoadSyncText(f, "tex", "mem://a.txt");
+    const AssetHandle mat = LoadSyncText(f, "mat", "mem://b.txt");
+    const AssetHandle other = LoadSyncText(f, "other", "mem://c.txt");
+    f.mgr->SetDependencies(mat.id(), std::vector<AssetId>{ tex.id() });
+
+    f.source.Put("mem://a.txt", BytesOf("A2"));
+    f.source.Put("mem://b.txt", BytesOf("B2"));
+    f.mgr->RequestReload(tex.id());
+    f.mgr->RequestReload(tex.id()); // 重複は 1 件
+    f.mgr->Update();
+
+    // 変わった tex と、それに依存する mat が同じ Update で入れ替わる
+    CHECK(f.mgr->GetShared<Loaders::TextAsset>(tex) == nullptr);
+    CHECK(f.mgr->GetShared<Loaders::TextAsset>(mat) == nullptr);
+    CHECK(TextOf(f, "tex") == "A2");
+    CHECK(TextOf(f, "mat") == "B2");
+    CHECK(f.storage.Find(tex.id())->generation == tex.generation() + 1);
+    CHECK(f.storage.Find(mat.id())->generation == mat.generation() + 1);
+
+    // 無関係な asset はそのまま
+    CHECK(f.storage.Find(other.id())->generation == other.generation());
+
+    const auto& st = f.mgr->GetReloadStats();
+    CHECK(st.transactions == 1);
+    CHECK(st.swapped == 2);
+    CHECK(st.dependents == 1);
+    CHECK(!f.mgr->ReloadInFlight());
+}
+
+TEST_CASE("AssetManager: off-thread reload keeps old versions visible until the swap") {
+    CoroFixture f;
+    Loading::AssetPipeline reloadPipeline(f.source, f.registry);
+    f.mgr->SetReloadPipeline(&reloadPipeline);
+
+    const AssetHandle tex = LoadSyncText(f, "tex", "mem://a.txt");
+    const AssetHandle mat = LoadSyncText(f, "mat", "mem://b.txt");
+    LoadSyncText(f, "other", "mem://c.txt");
+    f.mgr->SetDependencies(mat.id(), std::vector<AssetId>{ tex.id() });
+
+    f.source.Put("mem://a.txt", BytesOf("A2"));
+    f.mgr->RequestReload(tex.id());
+    f.mgr->Update();
+    CHECK(f.mgr->ReloadInFlight());
+
+    // decode が終わっても、次の Update までは旧データのまま
+    f.mgr->WaitForReload();
+    CHECK(f.mgr->GetShared<Loaders::TextAsset>(tex)->text == "A");
+    CHECK(f.mgr->GetShared<Loaders::TextAsset>(mat)->text == "B");
+
+    // decode 中に来た変更は次のトランザクションへ
+    f.source.Put("mem://c.txt", BytesOf("C2"));
+    f.mgr->RequestReload(AssetId::FromString("other"));
+
+    f.mgr->Update();
+    CHECK(TextOf(f, "tex") == "A2");
+    CHECK(TextOf(f, "mat") == "B");
+    CHECK(f.storage.Find(tex.id())->generation == tex.generation() + 1);
+    CHECK(f.storage.Find(mat.id())->generation == mat.generation() + 1);
+    CHECK(TextOf(f, "other") == "C");
+    CHECK(f.mgr->ReloadInFlight());
+
+    f.mgr->WaitForReload();
+    f.mgr->Update();
+    CHECK(TextOf(f, "other") == "C2");
+    CHECK(f.mgr->GetReloadStats().transactions == 2);
+    CHECK(!f.mgr->ReloadInFlight());
+}
+
+TEST_CASE("AssetManager: reload transaction skips records evicted and reloaded during decode") {
+    CoroFixture f;
+    Loading::AssetPipeline reloadPipeline(f.source, f.registry);
+    f.mgr->SetReloadPipeline(&reloadPipeline);
+
+    const AssetHandle tex = LoadSyncText(f, "tex", "mem://a.txt");
+    f.source.Put("mem://a.txt", BytesOf("A2"));
+    f.mgr->RequestReload(tex.id());
+    f.mgr->Update();
+    REQUIRE(f.mgr->ReloadInFlight());
+    f.mgr->WaitForReload(); // decode 済み・差し替え前
+
+    // その間に evict されて別の内容で読み直された
+    f.mgr->Release(tex);
+    REQUIRE(f.mgr->EvictIfPossible(tex.id()));
+    f.source.Put("mem://a.txt", BytesOf("A3"));
+    const AssetHandle again = LoadSyncText(f, "tex", "mem://a.txt");
+    CHECK(again.generation() != tex.generation());
+
+    // 古い decode 結果（A2）で上書きしない
+    f.mgr->Update();
+    CHECK(TextOf(f, "tex") == "A3");
+    CHECK(f.storage.Find(tex.id())->generation == again.generation());
+    CHECK(f.mgr->GetReloadStats().stale == 1);
+    CHECK(f.mgr->GetReloadStats().swapped == 0);
+}
+
+TEST_CASE("AssetManager: failed reload transaction keeps every old version") {
+    CoroFixture f;
+    const AssetHandle tex = LoadSyncText(f, "tex", "mem://a.txt");
+    const AssetHandle mat = LoadSyncText(f, "mat", "mem://b.txt");
+    f.mgr->SetDependencies(mat.id(), std::vector<AssetId>{ tex.id() });
+
+    f.source.Put("mem://a.txt", BytesOf("A2"));
+    f.source.Erase("mem://b.txt"); // 依存側が読めない
+    f.mgr->RequestReload(tex.id());
+    f.mgr->Update();
+
+    // KeepOldIfAny：tex も差し替えない（mat と食い違った状態を見せない）
+    CHECK(f.mgr->GetShared<Loaders::TextAsset>(tex)->text == "A");
+    CHECK(f.mgr->GetShared<Loaders::TextAsset>(mat)->text == "B");
+    CHECK(f.mgr->GetState(mat) == AssetState::Ready);
+    CHECK(f.mgr->GetError(mat) != nullptr);
+    CHECK(f.mgr->GetError(tex) == nullptr);
+
+    const auto& st = f.mgr->GetReloadStats();
+    CHECK(st.rolledBack == 1);
+    CHECK(st.failed == 1);
+    CHECK(st.swapped == 0);
+}
@@ -59,3 +59,22 @@ TEST_CASE("AssetPathResolver: reject escape root") {
 
 
 }
+
+TEST_CASE("AssetPathResolver: resolve parsed uri views") {
+    AssetPathResolver::Options options;
+    options.assetsRoot = "assets";
+    AssetPathResolver r(options);
+
+    auto strict = r.Resolve(Engine::IO::Path::ParseUriView("res://textures/a.ppm").value());
+    REQUIRE(strict);
+    CHECK(strict.value() == "assets/textures/a.ppm");
+
+    auto loose = r.Resolve(Engine::IO::Path::ParseUriViewLoose("res:///textures/a.ppm"));
+    REQUIRE(loose);
+    CHECK(loose.value() == r.Resolve("res:///textures/a.ppm").value());
+
+    options.allowSchemes = false;
+    r.SetOptions(options);
+    CHECK(r.Resolve(Engine::IO::Path::ParseUriViewLoose("res://a.ppm")).error().code
+          == Engine::Asset::AssetErrorCode::InvalidPath);
+}
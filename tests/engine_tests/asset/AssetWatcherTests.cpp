@@ -1,11 +1,18 @@
 #include "doctest/doctest.h"
 
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "engine/asset/hot_reload/AssetWatcher.hpp"
 #include "engine/asset/AssetId.hpp"
+#include "engine/io/fs/IFileWatcher.hpp"
+#include "engine/io/fs/NativeFileSystem.hpp"
 
 namespace fs = std::filesystem;
 using Engine::Asset::HotReload::AssetWatcher;
@@ -70,3 +77,318 @@ TEST_CASE("AssetWatcher: removed and keepWatchingMissing=false") {
     CHECK(ch[0].kind == AssetChangeKind::Removed);
     CHECK(w.IsWatching(id) == false);
 }
+
+namespace {
+    using Engine::IO::FS::FileChangeEvent;
+    using Engine::IO::FS::FileChangeKind;
+    using Engine::IO::FS::IFileWatcher;
+    using Engine::IO::FS::IoResult;
+    using Engine::IO::FS::IoResultVoid;
+    using Engine::IO::FS::WatchId;
+    using Engine::IO::FS::WatchOptions;
+
+    // イベントをテストから積む watcher（AddWatch / RemoveWatch の回数を数える）
+    class FakeWatcher final : public IFileWatcher {
+    public:
+        struct Shared final {
+            std::vector<std::string> watching;
+            std::vector<FileChangeEvent> queue;
+            int adds = 0;
+            int removes = 0;
+            int polls = 0;
+        };
+
+        explicit FakeWatcher(Shared& s) : s_(s) {}
+
+        const char* Name() const noexcept override { return "Fake"; }
+        bool IsOpen() const noexcept override { return true; }
+
+        IoResult<WatchId> AddWatch(const Engine::IO::Path::Uri& uri, const WatchOptions&) override {
+            ++s_.adds;
+            s_.watching.push_back(uri.path.Str());
+            return IoResult<WatchId>::Ok(static_cast<WatchId>(s_.watching.size()));
+        }
+        IoResultVoid RemoveWatch(WatchId) override {
+            ++s_.removes;
+            return IoResultVoid::Ok();
+        }
+        IoResult<std::size_t> Poll(std::vector<FileChangeEvent>& out, std::size_t) override {
+            ++s_.polls;
+            const std::size_t n = s_.queue.size();
+            for (auto& e : s_.queue) out.push_back(std::move(e));
+            s_.queue.clear();
+            return IoResult<std::size_t>::Ok(n);
+        }
+        IoResultVoid Close() override { return IoResultVoid::Ok(); }
+
+    private:
+        Shared& s_;
+    };
+
+    FileChangeEvent EventFor(FileChangeKind kind, const std::string& path) {
+        FileChangeEvent e;
+        e.kind = kind;
+        e.path.path = Engine::IO::Path::Path::FromNormalized(path);
+        return e;
+    }
+} // namespace
+
+TEST_CASE("AssetWatcher: re-probes only paths reported by the file watcher") {
+    fs::path tmp = fs::temp_directory_path() / "asset_watcher_test3";
+    fs::remove_all(tmp);
+    const std::string a = (tmp / "a.txt").string();
+    const std::string b = (tmp / "b.txt").string();
+    WriteFile(a, "1");
+    WriteFile(b, "1");
+
+    FakeWatcher::Shared shared;
+    AssetWatcher::Options opt;
+    opt.debounceMs = 0;
+    AssetWatcher w(opt, std::make_unique<FakeWatcher>(shared));
+    CHECK(w.UsesFileWatcher());
+
+    const AssetId ida = AssetId::FromString("a");
+    const AssetId idb = AssetId::FromString("b");
+    const AssetId idb2 = AssetId::FromString("b2");
+    w.Watch(ida, a);
+    w.Watch(idb, b);
+    w.Watch(idb2, b); // 同じファイルの watch は共有
+    CHECK(shared.adds == 2);
+    CHECK(w.PolledCount() == 0);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    WriteFile(a, "2");
+    WriteFile(b, "2");
+
+    // イベントが来ていなければ stat しない（変化に気付かない）
+    CHECK(w.Poll().empty());
+
+    shared.queue.push_back(EventFor(FileChangeKind::Modified, b));
+    auto ch = w.Poll();
+    REQUIRE(ch.size() == 2);
+    CHECK(ch[0].kind == AssetChangeKind::Modified);
+    CHECK(ch[1].kind == AssetChangeKind::Modified);
+    CHECK((ch[0].id == idb || ch[0].id == idb2));
+
+    w.Unwatch(idb);
+    CHECK(shared.removes == 0);
+    w.Unwatch(idb2);
+    CHECK(shared.removes == 1);
+
+    // Unknown（watcher が見失った）は stat し直して張り直す
+    shared.queue.push_back(EventFor(FileChangeKind::Unknown, a));
+    ch = w.Poll();
+    REQUIRE(ch.size() == 1);
+    CHECK(ch[0].id == ida);
+    CHECK(shared.adds == 3);
+}
+
+TEST_CASE("AssetWatcher: falls back to polling without a file watcher") {
+    AssetWatcher::Options opt;
+    opt.useFileWatcher = false;
+    AssetWatcher w(opt);
+    CHECK(!w.UsesFileWatcher());
+
+    w.Watch(AssetId::FromString("x"), (fs::temp_directory_path() / "asset_watcher_missing/x.txt").string());
+    CHECK(w.PolledCount() == 1);
+    w.Clear();
+    CHECK(w.PolledCount() == 0);
+}
+
+TEST_CASE("AssetWatcher: polling budget spreads probes over polls") {
+    fs::path tmp = fs::temp_directory_path() / "asset_watcher_budget";
+    fs::remove_all(tmp);
+
+    AssetWatcher::Options opt;
+    opt.useFileWatcher = false;
+    opt.debounceMs = 0;
+    opt.pollBudgetFiles = 4;
+    opt.hotWindowMs = 0; // 全部すぐ cold
+    AssetWatcher w(opt);
+
+    std::vector<fs::path> files;
+    for (int i = 0; i < 10; ++i) {
+        files.push_back(tmp / ("f" + std::to_string(i) + ".txt"));
+        WriteFile(files.back(), "1");
+        w.Watch(AssetId::FromString(files.back().string()), files.back().string());
+    }
+
+    CHECK(w.Poll().empty());
+    CHECK(w.GetPollStats().lastProbes == 4);
+    CHECK(w.GetPollStats().polledFiles == 10);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    for (const auto& f : files) WriteFile(f, "2");
+
+    // 1 回の Poll は予算分だけ。3 回で全員 1 回ずつ見る
+    std::size_t total = 0;
+    for (int i = 0; i < 3; ++i) {
+        auto ch = w.Poll();
+        CHECK(ch.size() <= 4);
+        CHECK(w.GetPollStats().lastProbes <= 4);
+        total += ch.size();
+    }
+    CHECK(total == files.size());
+
+    const auto st = w.GetPollStats();
+    CHECK(st.coldSweepNs > 0);
+    CHECK(st.worstColdSweepNs >= st.coldSweepNs);
+}
+
+TEST_CASE("AssetWatcher: hot files are probed every poll") {
+    fs::path tmp = fs::temp_directory_path() / "asset_watcher_hot";
+    fs::remove_all(tmp);
+
+    AssetWatcher::Options opt;
+    opt.useFileWatcher = false;
+    opt.debounceMs = 0;
+    opt.pollBudgetFiles = 4;
+    opt.hotWindowMs = 0;
+    AssetWatcher w(opt);
+
+    for (int i = 0; i < 20; ++i) {
+        const fs::path f = tmp / ("cold" + std::to_string(i) + ".txt");
+        WriteFile(f, "1");
+        w.Watch(AssetId::FromString(f.string()), f.string());
+    }
+    (void)w.Poll(); // hot 期間 0 なので全部 cold へ
+
+    // 後から Watch した（ロードされた）ファイルは hot
+    opt.hotWindowMs = 60'000;
+    w.SetOptions(opt);
+    const fs::path hotFile = tmp / "hot.txt";
+    WriteFile(hotFile, "1");
+    const AssetId hotId = AssetId::FromString("hot");
+    w.Watch(hotId, hotFile.string());
+    CHECK(w.GetPollStats().hotFiles == 1);
+
+    for (int round = 0; round < 3; ++round) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        WriteFile(hotFile, std::to_string(round + 2));
+
+        auto ch = w.Poll();
+        REQUIRE(ch.size() == 1);
+        CHECK(ch[0].id == hotId);
+        CHECK(ch[0].kind == AssetChangeKind::Modified);
+    }
+}
+
+TEST_CASE("AssetWatcher: content hash suppresses touches without content change") {
+    fs::path tmp = fs::temp_directory_path() / "asset_watcher_hash";
+    fs::remove_all(tmp);
+    const fs::path f = tmp / "a.txt";
+    WriteFile(f, "same");
+
+    AssetWatcher::Options opt;
+    opt.useFileWatcher = false;
+    opt.debounceMs = 0;
+    opt.verifyContentHash = true;
+    AssetWatcher w(opt);
+
+    const AssetId id = AssetId::FromString("a");
+    w.Watch(id, f.string());
+    w.WaitForHashing();
+    CHECK(w.Poll().empty()); // 基準を取り込む
+    CHECK(w.FindWatched(id)->hasContentHash);
+
+    // 同じ内容で書き直す（mtime だけ変わる）
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    WriteFile(f, "same");
+    CHECK(w.Poll().empty()); // 確かめ待ち
+    CHECK(w.GetHashStats().pending == 1);
+    w.WaitForHashing();
+    CHECK(w.Poll().empty());
+    CHECK(w.GetHashStats().suppressed == 1);
+
+    // 内容が変われば出る
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    WriteFile(f, "different");
+    CHECK(w.Poll().empty());
+    w.WaitForHashing();
+    auto ch = w.Poll();
+    REQUIRE(ch.size() == 1);
+    CHECK(ch[0].kind == AssetChangeKind::Modified);
+    CHECK(ch[0].id == id);
+    CHECK(ch[0].detectedNs != 0);
+    CHECK(w.GetHashStats().pending == 0);
+    CHECK(w.GetHashStats().hashedFiles == 3);
+}
+
+namespace {
+    using Engine::IO::FS::DirectoryEntry;
+    using Engine::IO::FS::DirectoryIterator;
+    using Engine::IO::FS::FileInfo;
+    using Engine::IO::FS::FileSystemCapabilities;
+    using Engine::IO::FS::IFileSystem;
+    using Engine::IO::FS::ListOptions;
+    using Engine::IO::FS::NativeFileSystem;
+    using Engine::IO::FS::RemoveOptions;
+    using Engine::IO::Path::Uri;
+    using Engine::IO::Stream::FileOpenMode;
+    using Engine::IO::Stream::IStream;
+
+    // NativeFileSystem に Open の回数と開いた path を足す
+    class OpenCountingFs final : public IFileSystem {
+    public:
+        NativeFileSystem native;
+        std::atomic<int> opens{ 0 };
+        std::mutex mutex;
+        std::vector<std::string> paths;
+
+        const char* Name() const noexcept override { return "OpenCountingFS"; }
+
+        IoResult<std::unique_ptr<IStream>> Open(const Uri& uri, FileOpenMode mode) override {
+            ++opens;
+            {
+                std::lock_guard<std::mutex> lk(mutex);
+                paths.push_back(uri.path.Str());
+            }
+            return native.Open(uri, mode);
+        }
+        IoResult<bool> Exists(const Uri& uri) override { return native.Exists(uri); }
+        IoResult<FileInfo> Stat(const Uri& uri) override { return native.Stat(uri); }
+        IoResultVoid CreateDirectories(const Uri& uri) override { return native.CreateDirectories(uri); }
+        IoResultVoid Remove(const Uri& uri, const RemoveOptions& opt = {}) override { return native.Remove(uri, opt); }
+        IoResultVoid Move(const Uri& from, const Uri& to) override { return native.Move(from, to); }
+        IoResultVoid Copy(const Uri& from, const Uri& to) override { return native.Copy(from, to); }
+        IoResult<std::vector<DirectoryEntry>> List(const Uri& uri, const ListOptions& opt = {}) override { return native.List(uri, opt); }
+        IoResult<std::string> ToNativePathString(const Uri& uri) override { return native.ToNativePathString(uri); }
+        FileSystemCapabilities Capabilities() const noexcept override { return native.Capabilities(); }
+        IoResult<std::unique_ptr<DirectoryIterator>> Iterate(const Uri& uri, const ListOptions& opt = {}) override { return native.Iterate(uri, opt); }
+        IoResult<std::unique_ptr<IFileWatcher>> CreateWatcher() override { return native.CreateWatcher(); }
+    };
+} // namespace
+
+TEST_CASE("AssetWatcher: content hash reads through the configured file system") {
+    fs::path tmp = fs::temp_directory_path() / "asset_watcher_hash_fs";
+    fs::remove_all(tmp);
+    const fs::path a = tmp / "a.txt";
+    const fs::path b = tmp / "b.txt";
+    WriteFile(a, "aaa");
+    WriteFile(b, "bbb");
+
+    AssetWatcher::Options opt;
+    opt.useFileWatcher = false;
+    opt.debounceMs = 0;
+    opt.verifyContentHash = true;
+    AssetWatcher w(opt);
+    auto counting = std::make_shared<OpenCountingFs>();
+    w.SetFileSystem(counting);
+
+    w.Watch(AssetId::FromString("a"), a.string());
+    w.Watch(AssetId::FromString("b"), b.string());
+    w.WaitForHashing();
+    CHECK(w.Poll().empty());
+    CHECK(w.FindWatched(AssetId::FromString("a"))->hasContentHash);
+    CHECK(w.FindWatched(AssetId::FromString("b"))->hasContentHash);
+    CHECK(counting->opens == 2);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    WriteFile(a, "aaa");
+    CHECK(w.Poll().empty());
+    w.WaitForHashing();
+    CHECK(w.Poll().empty());
+    CHECK(w.GetHashStats().suppressed == 1);
+    CHECK(counting->opens == 3);
+    CHECK(counting->paths.back() == a.string());
+}
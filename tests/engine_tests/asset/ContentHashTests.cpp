@@ -0,0 +1,42 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "engine/asset/detail/ContentHash.hpp"
+
+using Engine::Asset::Detail::ContentHash64;
+using Engine::Asset::Detail::ContentHasher;
+
+TEST_CASE("ContentHash: matches XXH64 reference values") {
+    CHECK(ContentHash64("", 0) == 0xEF46DB3751D8E999ull);
+    CHECK(ContentHash64("abc", 3) == 0x44BC2CF5AD770999ull);
+
+    const std::string s = "Nobody inspects the spammish repetition";
+    CHECK(ContentHash64(s.data(), s.size()) == 0xFBCEA83C8A378BF1ull);
+}
+
+TEST_CASE("ContentHash: incremental updates match one-shot") {
+    std::vector<std::uint8_t> data(1000);
+    std::uint32_t x = 12345;
+    for (auto& b : data) {
+        x = x * 1664525u + 1013904223u;
+        b = static_cast<std::uint8_t>(x >> 24);
+    }
+
+    for (std::size_t len : { 0u, 1u, 31u, 32u, 33u, 100u, 1000u }) {
+        const auto expected = ContentHash64(data.data(), len);
+        for (std::size_t step : { 1u, 7u, 32u, 61u }) {
+            ContentHasher h;
+            for (std::size_t off = 0; off < len; off += step) {
+                h.Update(data.data() + off, std::min(step, len - off));
+            }
+            CHECK(h.Digest() == expected);
+            CHECK(h.TotalBytes() == len);
+        }
+    }
+
+    CHECK(ContentHash64(data.data(), 64) != ContentHash64(data.data() + 1, 64));
+}
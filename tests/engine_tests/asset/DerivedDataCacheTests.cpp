@@ -0,0 +1,215 @@
+#include "doctest/doctest.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/asset/loaders/SoundLoader.hpp"
+#include "engine/asset/loaders/TextureLoader.hpp"
+#include "engine/asset/loading/AssetPipeline.hpp"
+#include "engine/asset/loading/DerivedDataCache.hpp"
+#include "engine/asset/loading/LoaderRegistry.hpp"
+#include "engine/asset/loading/MemoryAssetSource.hpp"
+#include "engine/io/fs/MemoryFileSystem.hpp"
+#include "engine/io/path/Uri.hpp"
+
+using namespace Engine::Asset;
+using Engine::Base::SharedBuffer;
+using Engine::IO::FS::MemoryFileSystem;
+using Engine::IO::Path::ParseUri;
+using Loading::DerivedDataCache;
+using Loading::DerivedDataKey;
+using AssetError = Engine::Base::Error<AssetErrorCode>;
+
+namespace {
+
+    SharedBuffer Bytes(const std::string& s) {
+        return SharedBuffer::Copy({ reinterpret_cast<const std::byte*>(s.data()), s.size() });
+    }
+
+    std::string Text(const SharedBuffer& b) {
+        return std::string(reinterpret_cast<const char*>(b.data()), b.size());
+    }
+
+    DerivedDataKey Key(std::uint64_t content, std::uint32_t version = 1) {
+        DerivedDataKey k;
+        k.contentHash = content;
+        k.loader = AssetType::FromString("texture");
+        k.loaderVersion = version;
+        return k;
+    }
+
+    Engine::IO::Path::Uri CacheDir() { return ParseUri("memory://ddc").value(); }
+
+    // decode の回数を数える（derived data は TextureLoader にそのまま渡す）
+    class CountingTextureLoader final : public Loading::IAssetLoader {
+    public:
+        AssetType GetType() const noexcept override { return inner_.GetType(); }
+
+        Engine::Base::Result<Core::AnyAsset, AssetError>
+        Load(const SharedBuffer& bytes, const Loading::LoadContext& ctx) override {
+            ++decodes;
+            return inner_.Load(bytes, ctx);
+        }
+
+        std::uint32_t DerivedDataVersion() const noexcept override { return inner_.DerivedDataVersion(); }
+
+        Engine::Base::Result<SharedBuffer, AssetError>
+        SaveDerived(const Core::AnyAsset& asset, const Loading::LoadContext& ctx) override {
+            return inner_.SaveDerived(asset, ctx);
+        }
+
+        Engine::Base::Result<Core::AnyAsset, AssetError>
+        LoadDerived(const SharedBuffer& data, const Loading::LoadContext& ctx) override {
+            return inner_.LoadDerived(data, ctx);
+        }
+
+        int decodes = 0;
+
+    private:
+        Loaders::TextureLoader inner_;
+    };
+
+    Loading::LoadContext Ctx(const char* path) {
+        Loading::LoadContext ctx;
+        ctx.id = AssetId::FromString(path);
+        ctx.type = AssetType::FromString("texture");
+        ctx.resolvedPath = Core::InternedPath::Intern(path);
+        return ctx;
+    }
+
+} // namespace
+
+TEST_CASE("DerivedDataCache: store, find and reject mismatched or corrupt entries") {
+    auto fs = std::make_shared<MemoryFileSystem>();
+    DerivedDataCache cache(fs, CacheDir());
+
+    CHECK(!cache.Find(Key(1)));
+    cache.Store(Key(1), Bytes("decoded"));
+    cache.Flush();
+
+    auto hit = cache.Find(Key(1));
+    REQUIRE(hit);
+    CHECK(Text(*hit) == "decoded");
+
+    // loader の version が違えば別の entry
+    CHECK(!cache.Find(Key(1, 2)));
+
+    // 中身が壊れていたら miss にして消す
+    const std::string name = Key(1).FileName();
+    REQUIRE(fs->Put("ddc/" + name, Bytes("garbage")));
+    CHECK(!cache.Find(Key(1)));
+    CHECK(!fs->ReadShared(std::string_view("ddc/" + name)));
+
+    const auto st = cache.Stats();
+    CHECK(st.hits == 1);
+    CHECK(st.misses == 3);
+    CHECK(st.corrupt == 1);
+    CHECK(st.entries == 0);
+    CHECK(st.bytes == 0);
+}
+
+TEST_CASE("DerivedDataCache: evicts least recently used entries and keeps the order across restarts") {
+    auto fs = std::make_shared<MemoryFileSystem>();
+    DerivedDataCache::Options opt;
+    opt.maxBytes = 3 * (64 + 4); // payload 4 byte の entry が 3 つまで
+
+    {
+        DerivedDataCache cache(fs, CacheDir(), opt);
+        for (std::uint64_t i = 1; i <= 3; ++i) cache.Store(Key(i), Bytes("abcd"));
+        cache.Flush();
+
+        CHECK(cache.Find(Key(1))); // 1 を使う -> 一番古いのは 2
+        cache.Store(Key(4), Bytes("abcd"));
+        cache.Flush();
+
+        CHECK(!cache.Find(Key(2)));
+        CHECK(cache.Find(Key(3)));
+        CHECK(cache.Stats().evictions == 1);
+        // 使った順：1, 4, 3（破棄時に lru.idx へ）
+    }
+
+    DerivedDataCache cache(fs, CacheDir(), opt);
+    CHECK(cache.Stats().entries == 3);
+
+    // 次の起動でも 1 が一番古い
+    cache.Store(Key(5), Bytes("abcd"));
+    cache.Flush();
+    CHECK(!cache.Find(Key(1)));
+    CHECK(cache.Find(Key(4)));
+    CHECK(cache.Find(Key(3)));
+    CHECK(cache.Find(Key(5)));
+}
+
+TEST_CASE("DerivedDataCache: warm pipeline loads skip decoding and source edits invalidate") {
+    auto fs = std::make_shared<MemoryFileSystem>();
+    const std::string ppm = std::string("P6 2 1 255\n") + "\x01\x02\x03\x04\x05\x06";
+    REQUIRE(fs->Put("assets/a.ppm", Bytes(ppm)));
+
+    Loading::MemoryAssetSource source(fs);
+    Loading::LoaderRegistry registry;
+    auto loaderOwned = std::make_unique<CountingTextureLoader>();
+    CountingTextureLoader& loader = *loaderOwned;
+    registry.Register(std::move(loaderOwned));
+
+    const Loading::LoadContext ctx = Ctx("assets/a.ppm");
+
+    // 1 回目（cold）：decode して保存
+    {
+        DerivedDataCache cache(fs, CacheDir());
+        Loading::AssetPipeline pipeline(source, registry);
+        pipeline.SetDerivedDataCache(&cache);
+        auto r = pipeline.Load(ctx);
+        REQUIRE(r);
+        CHECK(loader.decodes == 1);
+    }
+
+    // 2 回目（warm start）：decode しない
+    {
+        DerivedDataCache cache(fs, CacheDir());
+        Loading::AssetPipeline pipeline(source, registry);
+        pipeline.SetDerivedDataCache(&cache);
+        auto r = pipeline.Load(ctx);
+        REQUIRE(r);
+        CHECK(loader.decodes == 1);
+        CHECK(cache.Stats().hits == 1);
+
+        const auto* tex = r.value().As<Loaders::TextureAsset>();
+        REQUIRE(tex);
+        CHECK(tex->width == 2);
+        CHECK(tex->height == 1);
+        const std::vector<std::uint8_t> expected{ 1, 2, 3, 255, 4, 5, 6, 255 };
+        CHECK(tex->rgba == expected);
+
+        // 元ファイルを変えると key が変わるので decode し直す
+        REQUIRE(fs->Put("assets/a.ppm", Bytes(std::string("P6 1 1 255\n") + "\x07\x08\x09")));
+        auto r2 = pipeline.Load(ctx);
+        REQUIRE(r2);
+        CHECK(loader.decodes == 2);
+        CHECK(r2.value().As<Loaders::TextureAsset>()->width == 1);
+    }
+}
+
+TEST_CASE("DerivedDataCache: sound derived data round-trips") {
+    Loaders::SoundLoader loader;
+    auto snd = std::make_shared<Loaders::SoundAsset>();
+    snd->sampleRate = 44100;
+    snd->channels = 2;
+    snd->pcm16 = { 1, -2, 300, -32768 };
+
+    const Loading::LoadContext ctx = Ctx("assets/a.wav");
+    auto saved = loader.SaveDerived(Core::AnyAsset::FromShared(snd), ctx);
+    REQUIRE(saved);
+    auto loaded = loader.LoadDerived(saved.value(), ctx);
+    REQUIRE(loaded);
+
+    const auto* out = loaded.value().As<Loaders::SoundAsset>();
+    REQUIRE(out);
+    CHECK(out->sampleRate == 44100);
+    CHECK(out->channels == 2);
+    CHECK(out->pcm16 == snd->pcm16);
+
+    // 長さが合わない payload は Err（pipeline は decode に戻る）
+    CHECK(!loader.LoadDerived(saved.value().Slice(0, 9), ctx));
+}
@@ -0,0 +1,83 @@
+#include "doctest/doctest.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "engine/asset/core/InternedPath.hpp"
+
+using Engine::Asset::Core::InternedPath;
+using Engine::Asset::Core::PathArena;
+
+TEST_CASE("InternedPath: same string -> same handle") {
+    PathArena arena;
+
+    std::string a = "assets/textures/player.ppm";
+    std::string b = a; // 別バッファ
+
+    const InternedPath pa = arena.Intern(a);
+    const InternedPath pb = arena.Intern(b);
+
+    CHECK(pa == pb);
+    CHECK(pa.Id() == pb.Id());
+    CHECK(pa.View() == a);
+    CHECK(std::string(pa.CStr()) == a);
+    CHECK(arena.Count() == 1);
+
+    const InternedPath pc = arena.Intern("assets/textures/enemy.ppm");
+    CHECK(pc != pa);
+    CHECK(arena.Count() == 2);
+
+    CHECK(arena.Find(a) == pa);
+    CHECK(arena.Find("assets/none").empty());
+}
+
+TEST_CASE("InternedPath: empty string -> empty handle") {
+    PathArena arena;
+    const InternedPath p = arena.Intern("");
+    CHECK(p.empty());
+    CHECK(p.Id() == 0);
+    CHECK(p.View().empty());
+    CHECK(std::string(p.CStr()).empty());
+    CHECK(arena.Count() == 0);
+}
+
+TEST_CASE("InternedPath: handles stay valid across block growth") {
+    PathArena arena;
+
+    std::vector<InternedPath> handles;
+    for (int i = 0; i < 5000; ++i) {
+        handles.push_back(arena.Intern("assets/dir/file_" + std::to_string(i) + ".bin"));
+    }
+    // 巨大 path は専用ブロックに入る
+    const std::string big(100 * 1024, 'x');
+    const InternedPath bigP = arena.Intern(big);
+
+    for (int i = 0; i < 5000; ++i) {
+        CHECK(handles[i].View() == "assets/dir/file_" + std::to_string(i) + ".bin");
+    }
+    CHECK(bigP.View() == big);
+}
+
+TEST_CASE("InternedPath: concurrent intern converges to one handle") {
+    PathArena arena;
+
+    constexpr int kThreads = 4;
+    constexpr int kPaths = 500;
+    std::vector<std::vector<InternedPath>> results(kThreads);
+
+    std::vector<std::thread> ts;
+    for (int t = 0; t < kThreads; ++t) {
+        ts.emplace_back([&, t] {
+            for (int i = 0; i < kPaths; ++i) {
+                results[t].push_back(arena.Intern("p/" + std::to_string(i)));
+            }
+        });
+    }
+    for (auto& th : ts) th.join();
+
+    CHECK(arena.Count() == kPaths);
+    for (int t = 1; t < kThreads; ++t) {
+        CHECK(results[t] == results[0]);
+    }
+}
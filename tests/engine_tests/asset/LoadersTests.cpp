@@ -0,0 +1,58 @@
+#include "doctest/doctest.h"
+
+#include <string>
+#include <vector>
+
+#include "engine/asset/loaders/BinaryLoader.hpp"
+#include "engine/asset/loaders/FontLoader.hpp"
+#include "engine/asset/loaders/TextLoader.hpp"
+#include "engine/base/SharedBuffer.hpp"
+
+using namespace Engine::Asset;
+using Engine::Base::SharedBuffer;
+
+static SharedBuffer BufferOf(const std::string& s) {
+    std::vector<std::byte> v(s.size());
+    for (std::size_t i = 0; i < s.size(); ++i) v[i] = static_cast<std::byte>(s[i]);
+    return SharedBuffer::FromVector(std::move(v));
+}
+
+TEST_CASE("SharedBuffer: slice shares the owner") {
+    const SharedBuffer b = BufferOf("0123456789");
+    const SharedBuffer s = b.Slice(2, 3);
+    CHECK(s.AsStringView() == "234");
+    CHECK(s.data() == b.data() + 2);
+    CHECK(s.Owner() == b.Owner());
+
+    CHECK(b.Slice(8, 100).AsStringView() == "89");
+    CHECK(b.Slice(100).empty());
+}
+
+TEST_CASE("Loaders: passthrough assets keep the source buffer without copying") {
+    Loading::LoadContext ctx;
+
+    const SharedBuffer src = BufferOf("\xEF\xBB\xBFhello");
+
+    Loaders::TextLoader text;
+    auto tr = text.Load(src, ctx);
+    REQUIRE(tr);
+    auto t = tr.value().ShareAs<Loaders::TextAsset>();
+    REQUIRE(t);
+    CHECK(t->text == "hello");
+    CHECK(t->text.data() == reinterpret_cast<const char*>(src.data()) + 3); // BOM 分ずらしただけ
+
+    Loaders::BinaryLoader bin;
+    auto br = bin.Load(src, ctx);
+    REQUIRE(br);
+    auto b = br.value().ShareAs<Loaders::BinaryAsset>();
+    REQUIRE(b);
+    CHECK(b->bytes.data() == src.data());
+    CHECK(b->bytes.size() == src.size());
+
+    Loaders::FontLoader font;
+    auto fr = font.Load(src, ctx);
+    REQUIRE(fr);
+    CHECK(fr.value().ShareAs<Loaders::FontAsset>()->bytes.data() == src.data());
+
+    CHECK(!font.Load(SharedBuffer{}, ctx)); // 空フォントはエラー
+}
@@ -0,0 +1,128 @@
+#include "doctest/doctest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "engine/asset/loading/MappedAssetSource.hpp"
+
+namespace fs = std::filesystem;
+using Engine::Asset::AssetErrorCode;
+using Engine::Asset::Loading::MappedAssetSource;
+
+static void WriteFile(const fs::path& p, const std::string& s) {
+    fs::create_directories(p.parent_path());
+    std::ofstream ofs(p.string(), std::ios::binary);
+    ofs << s;
+}
+
+static std::string ToString(const Engine::Base::SharedBuffer& b) {
+    return std::string(b.AsStringView());
+}
+
+TEST_CASE("MappedAssetSource: mapped and small-file paths return the same bytes") {
+    fs::path tmp = fs::temp_directory_path() / "mapped_asset_source_test";
+    fs::remove_all(tmp);
+
+    std::string big(100 * 1024, '\0');
+    for (std::size_t i = 0; i < big.size(); ++i) big[i] = static_cast<char>('a' + (i % 26));
+    WriteFile(tmp / "big.bin", big);
+    WriteFile(tmp / "small.txt", "hello");
+    WriteFile(tmp / "empty.bin", "");
+
+    MappedAssetSource::Options opt;
+    opt.rootDirectory = tmp.string();
+    opt.mapFiles = true;
+    opt.minMapBytes = 16 * 1024;
+    MappedAssetSource src(opt);
+
+    auto bigV = src.ReadAll("big.bin");
+    REQUIRE(bigV);
+    CHECK(bigV.value().Owner() != nullptr);
+    CHECK(ToString(bigV.value()) == big);
+
+    auto smallV = src.ReadAll("small.txt");
+    REQUIRE(smallV);
+    CHECK(ToString(smallV.value()) == "hello");
+
+    auto emptyV = src.ReadAll("empty.bin");
+    REQUIRE(emptyV);
+    CHECK(emptyV.value().empty());
+
+    // バッファは元のファイルが消えても参照が生きている間は読める
+    auto keep = bigV.value().Slice(26);
+    bigV = src.ReadAll("small.txt");
+    fs::remove(tmp / "big.bin");
+    CHECK(ToString(keep) == big.substr(26));
+
+    CHECK(src.Exists("small.txt"));
+    CHECK(!src.Exists("none.bin"));
+}
+
+TEST_CASE("MappedAssetSource: default reads are not affected by in-place rewrites") {
+    // 外部エディタがその場で上書き / truncate しても、読み込み済みの bytes は変わらない（mmap しない）
+    fs::path tmp = fs::temp_directory_path() / "mapped_asset_source_rewrite";
+    fs::remove_all(tmp);
+
+    const std::string v1(64 * 1024, 'a');
+    WriteFile(tmp / "tex.bin", v1);
+
+    MappedAssetSource::Options opt;
+    opt.rootDirectory = tmp.string();
+    MappedAssetSource src(opt);
+
+    auto old = src.ReadAll("tex.bin");
+    REQUIRE(old);
+
+    WriteFile(tmp / "tex.bin", "b"); // truncate + 上書き
+    CHECK(ToString(old.value()) == v1);
+
+    auto now = src.ReadAll("tex.bin");
+    REQUIRE(now);
+    CHECK(ToString(now.value()) == "b");
+}
+
+TEST_CASE("MappedAssetSource: missing file -> SourceNotFound") {
+    MappedAssetSource::Options opt;
+    opt.rootDirectory = (fs::temp_directory_path() / "mapped_asset_source_missing").string();
+    MappedAssetSource src(opt);
+
+    auto r = src.ReadAll("nope.bin");
+    REQUIRE(!r);
+    CHECK(r.error().code == AssetErrorCode::SourceNotFound);
+
+    opt.mapFiles = true;
+    opt.minMapBytes = 0; // 常に mmap の経路
+    src.SetOptions(opt);
+    auto r2 = src.ReadAll("nope.bin");
+    REQUIRE(!r2);
+    CHECK(r2.error().code == AssetErrorCode::SourceNotFound);
+}
+
+TEST_CASE("MappedAssetSource: ReadAllBatch through the batch reader matches ReadAll") {
+    fs::path tmp = fs::temp_directory_path() / "mapped_asset_source_batch";
+    fs::remove_all(tmp);
+    for (int i = 0; i < 40; ++i) WriteFile(tmp / ("a" + std::to_string(i) + ".txt"), "asset-" + std::to_string(i));
+
+    MappedAssetSource::Options opt;
+    opt.rootDirectory = tmp.string();
+    opt.batchReader = Engine::IO::Async::AsyncReadService::Create();
+    MappedAssetSource src(opt);
+
+    std::vector<std::string> names;
+    for (int i = 0; i < 40; ++i) names.push_back("a" + std::to_string(i) + ".txt");
+    names.push_back("missing.txt");
+    std::vector<std::string_view> views(names.begin(), names.end());
+
+    std::vector<Engine::Base::Result<Engine::Base::SharedBuffer, Engine::Asset::Loading::AssetError>> out;
+    src.ReadAllBatch(views, out);
+    REQUIRE(out.size() == names.size());
+    for (int i = 0; i < 40; ++i) {
+        REQUIRE(out[i]);
+        CHECK(ToString(out[i].value()) == "asset-" + std::to_string(i));
+    }
+    REQUIRE(!out[40]);
+    CHECK(out[40].error().code == AssetErrorCode::SourceNotFound);
+}
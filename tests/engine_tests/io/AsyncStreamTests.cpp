@@ -0,0 +1,137 @@
+#include "doctest/doctest.h"
+
+#include <cstring>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/io/compression/LzDecodeStream.hpp"
+#include "engine/io/compression/LzFrame.hpp"
+#include "engine/io/stream/AsyncStreamAdapter.hpp"
+#include "engine/io/stream/BufferedStream.hpp"
+#include "engine/io/stream/MemoryStream.hpp"
+#include "engine/io/stream/SpanStream.hpp"
+
+using Engine::Base::SharedBuffer;
+using Engine::IO::Compression::LzDecodeStream;
+using Engine::IO::Compression::LzFrame;
+using Engine::IO::Stream::AsyncStreamAdapter;
+using Engine::IO::Stream::BufferedStream;
+using Engine::IO::Stream::IStream;
+using Engine::IO::Stream::IoResult;
+using Engine::IO::Stream::MemoryStream;
+using Engine::IO::Stream::SeekWhence;
+using Engine::IO::Stream::SpanStream;
+
+namespace {
+
+    std::vector<std::byte> MakeBytes(std::size_t size) {
+        std::vector<std::byte> v(size);
+        std::uint32_t x = 12345;
+        for (auto& b : v) {
+            x = x * 1103515245u + 12345u;
+            // 圧縮が効くように値域を絞る
+            b = static_cast<std::byte>('a' + (x >> 16) % 4);
+        }
+        return v;
+    }
+
+    // ReadAtAsync を投げて完了を待つ
+    IoResult<std::size_t> ReadAtWait(IStream& s, std::uint64_t offset, std::vector<std::byte>& dst) {
+        std::promise<IoResult<std::size_t>> p;
+        auto f = p.get_future();
+        s.ReadAtAsync(offset, dst, [&p](IoResult<std::size_t> r) { p.set_value(std::move(r)); });
+        return f.get();
+    }
+
+} // namespace
+
+TEST_CASE("AsyncStream: memory and span streams complete inline") {
+    const auto data = MakeBytes(1000);
+
+    MemoryStream ms(data, MemoryStream::Options{});
+    SpanStream ss(SharedBuffer::Copy(data));
+    for (IStream* s : { static_cast<IStream*>(&ms), static_cast<IStream*>(&ss) }) {
+        CHECK(s->Caps().asyncRead);
+
+        std::vector<std::byte> out(300);
+        bool called = false;
+        s->ReadAtAsync(900, out, [&](IoResult<std::size_t> r) {
+            called = true;
+            REQUIRE(r);
+            CHECK(r.value() == 100);
+        });
+        CHECK(called);
+        CHECK(std::memcmp(out.data(), data.data() + 900, 100) == 0);
+        CHECK(s->Tell().value() == 0);
+    }
+}
+
+TEST_CASE("AsyncStream: LzDecodeStream decodes requested blocks in parallel") {
+    const auto data = MakeBytes(1 << 20);
+    LzFrame::Options fo;
+    fo.blockSize = 16 * 1024;
+    auto frame = LzFrame::Parse(SharedBuffer::FromVector(LzFrame::Encode(data, fo)));
+    REQUIRE(frame);
+
+    LzDecodeStream s(std::move(frame.value()));
+    CHECK(s.Caps().asyncRead);
+
+    // ブロック境界を跨ぐ / ブロックを丸ごと含む / 末尾を跨ぐ
+    const std::uint64_t offsets[] = { 0, 5000, 16 * 1024, 300001, (1 << 20) - 777 };
+    for (std::uint64_t off : offsets) {
+        std::vector<std::byte> out(100000);
+        auto r = ReadAtWait(s, off, out);
+        REQUIRE(r);
+        const std::size_t expect = std::min<std::size_t>(out.size(), data.size() - off);
+        CHECK(r.value() == expect);
+        CHECK(std::memcmp(out.data(), data.data() + off, expect) == 0);
+    }
+
+    // 同期 Read の位置とは独立
+    std::vector<std::byte> head(10);
+    CHECK(s.Read(head.data(), head.size()).value() == 10);
+    std::vector<std::byte> mid(10);
+    CHECK(ReadAtWait(s, 1000, mid));
+    CHECK(s.Tell().value() == 10);
+}
+
+TEST_CASE("AsyncStream: adapter emulates ReadAtAsync for sync-only streams") {
+    const auto data = MakeBytes(50000);
+
+    auto inner = std::make_unique<BufferedStream>(std::make_unique<MemoryStream>(data, MemoryStream::Options{}));
+    CHECK(!inner->Caps().asyncRead);
+
+    auto wrapped = AsyncStreamAdapter::Wrap(std::move(inner));
+    REQUIRE(wrapped);
+    CHECK(wrapped->Caps().asyncRead);
+
+    // 既に asyncRead を持つ stream は包まない
+    auto* raw = new MemoryStream(data, MemoryStream::Options{});
+    CHECK(AsyncStreamAdapter::Wrap(std::unique_ptr<IStream>(raw)).get() == raw);
+
+    std::vector<std::byte> head(7);
+    CHECK(wrapped->Read(head.data(), head.size()).value() == 7);
+
+    // 多数の要求を同時に投げる
+    std::vector<std::vector<std::byte>> bufs(16, std::vector<std::byte>(4000));
+    std::vector<std::promise<IoResult<std::size_t>>> done(bufs.size());
+    for (std::size_t i = 0; i < bufs.size(); ++i) {
+        wrapped->ReadAtAsync(i * 3300, bufs[i], [&done, i](IoResult<std::size_t> r) { done[i].set_value(std::move(r)); });
+    }
+    for (std::size_t i = 0; i < bufs.size(); ++i) {
+        auto r = done[i].get_future().get();
+        REQUIRE(r);
+        const std::size_t expect = std::min<std::size_t>(4000, data.size() - i * 3300);
+        CHECK(r.value() == expect);
+        CHECK(std::memcmp(bufs[i].data(), data.data() + i * 3300, expect) == 0);
+    }
+
+    // 同期側の位置は保たれる
+    CHECK(wrapped->Tell().value() == 7);
+    std::vector<std::byte> next(3);
+    CHECK(wrapped->Read(next.data(), next.size()).value() == 3);
+    CHECK(std::memcmp(next.data(), data.data() + 7, 3) == 0);
+}
@@ -0,0 +1,307 @@
+#include "doctest/doctest.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/io/async/AsyncWriteService.hpp"
+#include "engine/io/fs/MemoryFileSystem.hpp"
+#include "engine/io/fs/Vfs.hpp"
+#include "engine/io/helpers/WriteAllBytes.hpp"
+#include "engine/io/path/Uri.hpp"
+
+using Engine::Base::SharedBuffer;
+using Engine::IO::IoErrorCode;
+using Engine::IO::Async::AsyncWriteService;
+using Engine::IO::FS::DirectoryEntry;
+using Engine::IO::FS::DirectoryIterator;
+using Engine::IO::FS::FileInfo;
+using Engine::IO::FS::FileSystemCapabilities;
+using Engine::IO::FS::IFileSystem;
+using Engine::IO::FS::IFileWatcher;
+using Engine::IO::FS::IoResult;
+using Engine::IO::FS::IoResultVoid;
+using Engine::IO::FS::ListOptions;
+using Engine::IO::FS::MemoryFileSystem;
+using Engine::IO::FS::RemoveOptions;
+using Engine::IO::Path::ParseUri;
+using Engine::IO::Path::Uri;
+using Engine::IO::Stream::FileOpenMode;
+using Engine::IO::Stream::IStream;
+using Engine::IO::Stream::SeekWhence;
+using Engine::IO::Stream::StreamCaps;
+
+namespace {
+
+    SharedBuffer Bytes(const std::string& s) {
+        return SharedBuffer::Copy({ reinterpret_cast<const std::byte*>(s.data()), s.size() });
+    }
+
+    std::string Text(const SharedBuffer& b) {
+        return std::string(reinterpret_cast<const char*>(b.data()), b.size());
+    }
+
+    // 書き込み stream：Sync を数え、failWrites なら半分書いてから失敗する。failClose なら Close で失敗する
+    class ProbeWriteStream final : public IStream {
+    public:
+        ProbeWriteStream(std::unique_ptr<IStream> inner, std::atomic<int>& syncs, bool failWrites, bool failClose = false)
+            : inner_(std::move(inner)), syncs_(syncs), failWrites_(failWrites), failClose_(failClose) {}
+
+        StreamCaps Caps() const noexcept override { return inner_->Caps(); }
+        bool IsOpen() const noexcept override { return inner_->IsOpen(); }
+        bool IsEof() const noexcept override { return inner_->IsEof(); }
+        IoResult<std::size_t> Read(void* dst, std::size_t bytes) override { return inner_->Read(dst, bytes); }
+        IoResult<std::size_t> Write(const void* src, std::size_t bytes) override {
+            if (!failWrites_) return inner_->Write(src, bytes);
+            (void)inner_->Write(src, bytes / 2);
+            return IoResult<std::size_t>::Err(
+                Engine::IO::FS::IoError::Make(IoErrorCode::WriteFailed, "ProbeWriteStream: disk full"));
+        }
+        IoResult<std::uint64_t> Tell() const override { return inner_->Tell(); }
+        IoResult<std::uint64_t> Seek(std::int64_t offset, SeekWhence whence) override { return inner_->Seek(offset, whence); }
+        IoResult<std::uint64_t> Size() const override { return inner_->Size(); }
+        IoResultVoid Flush() override { return inner_->Flush(); }
+        IoResultVoid Sync() override {
+            ++syncs_;
+            return inner_->Sync();
+        }
+        IoResultVoid Close() override {
+            auto r = inner_->Close();
+            if (!failClose_) return r;
+            return IoResultVoid::Err(Engine::IO::FS::IoError::Make(IoErrorCode::WriteFailed, "ProbeWriteStream: close failed"));
+        }
+
+    private:
+        std::unique_ptr<IStream> inner_;
+        std::atomic<int>& syncs_;
+        bool failWrites_;
+        bool failClose_;
+    };
+
+    // MemoryFileSystem に gate（Open で止める）と Sync / SyncDirectory の計数を足す
+    class ProbeFs final : public IFileSystem {
+    public:
+        MemoryFileSystem mem;
+        std::atomic<int> syncs{ 0 };
+        std::atomic<int> dirSyncs{ 0 };
+        std::string failName;      // この名前を含む path への書き込みは失敗させる
+        std::string failCloseName; // この名前を含む path の Close は失敗させる
+
+        void Close() {
+            std::lock_guard<std::mutex> lk(m_);
+            closed_ = true;
+        }
+        void Open() {
+            {
+                std::lock_guard<std::mutex> lk(m_);
+                closed_ = false;
+            }
+            cv_.notify_all();
+        }
+        bool WaitBlocked() {
+            std::unique_lock<std::mutex> lk(m_);
+            return cv_.wait_for(lk, std::chrono::seconds(5), [&] { return blocked_; });
+        }
+
+        const char* Name() const noexcept override { return "ProbeFS"; }
+
+        IoResult<std::unique_ptr<IStream>> Open(const Uri& uri, FileOpenMode mode) override {
+            {
+                std::unique_lock<std::mutex> lk(m_);
+                blocked_ = closed_;
+                cv_.notify_all();
+                cv_.wait(lk, [&] { return !closed_; });
+                blocked_ = false;
+            }
+            auto r = mem.Open(uri, mode);
+            if (!r) return r;
+            const bool fail = !failName.empty() && uri.ToString().find(failName) != std::string::npos;
+            const bool failClose = !failCloseName.empty() && uri.ToString().find(failCloseName) != std::string::npos;
+            return IoResult<std::unique_ptr<IStream>>::Ok(
+                std::make_unique<ProbeWriteStream>(std::move(r.value()), syncs, fail, failClose));
+        }
+        IoResult<bool> Exists(const Uri& uri) override { return mem.Exists(uri); }
+        IoResult<FileInfo> Stat(const Uri& uri) override { return mem.Stat(uri); }
+        IoResultVoid CreateDirectories(const Uri& uri) override { return mem.CreateDirectories(uri); }
+        IoResultVoid Remove(const Uri& uri, const RemoveOptions& opt = {}) override { return mem.Remove(uri, opt); }
+        IoResultVoid Move(const Uri& from, const Uri& to) override { return mem.Move(from, to); }
+        IoResultVoid Copy(const Uri& from, const Uri& to) override { return mem.Copy(from, to); }
+        IoResult<std::vector<DirectoryEntry>> List(const Uri& uri, const ListOptions& opt = {}) override { return mem.List(uri, opt); }
+        IoResult<std::string> ToNativePathString(const Uri& uri) override { return mem.ToNativePathString(uri); }
+        FileSystemCapabilities Capabilities() const noexcept override { return mem.Capabilities(); }
+        IoResult<std::unique_ptr<DirectoryIterator>> Iterate(const Uri& uri, const ListOptions& opt = {}) override { return mem.Iterate(uri, opt); }
+        IoResult<std::unique_ptr<IFileWatcher>> CreateWatcher() override { return mem.CreateWatcher(); }
+        IoResultVoid SyncDirectory(const Uri&) override {
+            ++dirSyncs;
+            return IoResultVoid::Ok();
+        }
+
+    private:
+        std::mutex m_;
+        std::condition_variable cv_;
+        bool closed_ = false;
+        bool blocked_ = false;
+    };
+
+    std::vector<std::string> Names(MemoryFileSystem& fs, const char* dir) {
+        std::vector<std::string> out;
+        auto r = fs.List(Engine::IO::Path::ParseUriLoose(dir));
+        if (r) {
+            for (const auto& e : r.value()) out.push_back(e.name);
+        }
+        return out;
+    }
+
+} // namespace
+
+TEST_CASE("AsyncWriteService: writes behind and publishes via rename") {
+    auto fs = std::make_shared<ProbeFs>();
+    REQUIRE(fs->mem.Put("save/a.bin", Bytes("old")));
+
+    AsyncWriteService svc(fs);
+    std::atomic<int> ok{ 0 };
+    for (int i = 0; i < 4; ++i) {
+        const std::string name = "memory://save/f" + std::to_string(i) + ".bin";
+        svc.Submit(ParseUri(name).value(), Bytes("data" + std::to_string(i)), [&](IoResultVoid r) { ok += r ? 1 : 0; });
+    }
+    svc.Submit(ParseUri("memory://save/a.bin").value(), Bytes("new"), [&](IoResultVoid r) { ok += r ? 1 : 0; });
+    svc.Flush();
+
+    CHECK(ok == 5);
+    CHECK(Text(fs->mem.ReadShared("save/a.bin").value()) == "new");
+    CHECK(Text(fs->mem.ReadShared("save/f3.bin").value()) == "data3");
+    // 一時ファイルは残らない
+    CHECK(Names(fs->mem, "save").size() == 5);
+
+    const auto st = svc.Stats();
+    CHECK(st.files == 5);
+    CHECK(st.fileSyncs == 5);
+    CHECK(fs->syncs == 5);
+    // 同じディレクトリは batch 内で 1 回
+    CHECK(st.dirSyncs == st.batches);
+    CHECK(fs->dirSyncs == static_cast<int>(st.batches));
+}
+
+TEST_CASE("AsyncWriteService: queued writes to the same file are coalesced") {
+    auto fs = std::make_shared<ProbeFs>();
+    REQUIRE(fs->mem.CreateDirectories(ParseUri("memory://cache").value()));
+    AsyncWriteService svc(fs);
+
+    // 1 件目の Open で writer を止めておく
+    fs->Close();
+    svc.Submit(ParseUri("memory://cache/first.bin").value(), Bytes("1"));
+    REQUIRE(fs->WaitBlocked());
+
+    std::vector<std::string> results;
+    std::mutex m;
+    auto record = [&](const char* tag) {
+        return [&, tag](IoResultVoid r) {
+            std::lock_guard<std::mutex> lk(m);
+            results.push_back(std::string(tag) + (r ? ":ok" : ":err"));
+        };
+    };
+    const Uri target = ParseUri("memory://cache/state.bin").value();
+    svc.Submit(target, Bytes("v1"), record("a"));
+    svc.Submit(target, Bytes("v2"), record("b"));
+    svc.Submit(target, Bytes("v3"), record("c"));
+
+    fs->Open();
+    svc.Flush();
+
+    CHECK(Text(fs->mem.ReadShared("cache/state.bin").value()) == "v3");
+    CHECK(results == std::vector<std::string>{ "a:ok", "b:ok", "c:ok" });
+
+    const auto st = svc.Stats();
+    CHECK(st.submitted == 4);
+    CHECK(st.coalesced == 2);
+    CHECK(st.files == 2);
+}
+
+TEST_CASE("AsyncWriteService: a failed write never replaces the previous file") {
+    auto fs = std::make_shared<ProbeFs>();
+    fs->failName = "broken";
+    REQUIRE(fs->mem.Put("save/broken.bin", Bytes("previous contents")));
+
+    AsyncWriteService svc(fs);
+    bool failed = false;
+    svc.Submit(ParseUri("memory://save/broken.bin").value(), Bytes("half written data"), [&](IoResultVoid r) {
+        failed = !r && r.error().code == IoErrorCode::WriteFailed;
+    });
+    svc.Flush();
+
+    CHECK(failed);
+    CHECK(Text(fs->mem.ReadShared("save/broken.bin").value()) == "previous contents");
+    CHECK(Names(fs->mem, "save") == std::vector<std::string>{ "broken.bin" });
+    CHECK(svc.Stats().failures == 1);
+}
+
+TEST_CASE("WriteAllBytes: atomicReplace writes a temp file and renames it") {
+    ProbeFs fs;
+    REQUIRE(fs.mem.Put("cfg/settings.json", Bytes("{}")));
+
+    Engine::IO::Helpers::WriteAllOptions opt{};
+    opt.atomicReplace = true;
+    const std::string text = "{\"v\":2}";
+    REQUIRE(Engine::IO::Helpers::WriteAllBytes(
+        fs, ParseUri("memory://cfg/settings.json").value(),
+        Engine::Base::ConstSpan<std::byte>(reinterpret_cast<const std::byte*>(text.data()), text.size()), opt));
+
+    CHECK(Text(fs.mem.ReadShared("cfg/settings.json").value()) == text);
+    CHECK(Names(fs.mem, "cfg") == std::vector<std::string>{ "settings.json" });
+    CHECK(fs.syncs == 1);
+    CHECK(fs.dirSyncs == 1);
+}
+
+TEST_CASE("WriteAllBytes: atomicReplace through Vfs syncs the directory on the mounted backend") {
+    auto fs = std::make_shared<ProbeFs>();
+    REQUIRE(fs->mem.Put("root/cfg/settings.json", Bytes("{}")));
+
+    Engine::IO::FS::Vfs vfs;
+    Engine::IO::FS::MountPoint mp;
+    mp.name = "save";
+    mp.mountUri = ParseUri("save://").value();
+    mp.rootUri = ParseUri("memory://root").value();
+    mp.fs = fs;
+    REQUIRE(vfs.Mount(std::move(mp)));
+
+    Engine::IO::Helpers::WriteAllOptions opt{};
+    opt.atomicReplace = true;
+    const std::string text = "{\"v\":3}";
+    REQUIRE(Engine::IO::Helpers::WriteAllBytes(
+        vfs, ParseUri("save://cfg/settings.json").value(),
+        Engine::Base::ConstSpan<std::byte>(reinterpret_cast<const std::byte*>(text.data()), text.size()), opt));
+
+    CHECK(Text(fs->mem.ReadShared("root/cfg/settings.json").value()) == text);
+    CHECK(fs->syncs == 1);
+    CHECK(fs->dirSyncs == 1);
+
+    // 書ける mount が無ければエラー
+    CHECK(!vfs.SyncDirectory(ParseUri("other://cfg").value()));
+}
+
+TEST_CASE("WriteAllBytes: a failed Close aborts the replace") {
+    ProbeFs fs;
+    REQUIRE(fs.mem.Put("cfg/settings.json", Bytes("{}")));
+    fs.failCloseName = "settings.json";
+
+    const std::string text = "{\"v\":4}";
+    const Engine::Base::ConstSpan<std::byte> bytes(reinterpret_cast<const std::byte*>(text.data()), text.size());
+
+    Engine::IO::Helpers::WriteAllOptions opt{};
+    opt.atomicReplace = true;
+    auto r = Engine::IO::Helpers::WriteAllBytes(fs, ParseUri("memory://cfg/settings.json").value(), bytes, opt);
+    REQUIRE(!r);
+    CHECK(r.error().code == IoErrorCode::WriteFailed);
+    // 元のファイルは残り、一時ファイルは消える
+    CHECK(Text(fs.mem.ReadShared("cfg/settings.json").value()) == "{}");
+    CHECK(Names(fs.mem, "cfg") == std::vector<std::string>{ "settings.json" });
+    CHECK(fs.dirSyncs == 0);
+
+    // 置き換えない書き込みでも Close のエラーを返す
+    opt.atomicReplace = false;
+    CHECK(!Engine::IO::Helpers::WriteAllBytes(fs, ParseUri("memory://cfg/settings.json").value(), bytes, opt));
+}
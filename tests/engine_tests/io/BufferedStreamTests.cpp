@@ -0,0 +1,237 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "engine/io/async/IoWorkerPool.hpp"
+#include "engine/io/stream/AsyncStreamAdapter.hpp"
+#include "engine/io/stream/BufferedStream.hpp"
+#include "engine/io/stream/MemoryStream.hpp"
+
+using Engine::IO::Stream::AsyncStreamAdapter;
+using Engine::IO::Stream::BufferedStream;
+using Engine::IO::Stream::BufferingOptions;
+using Engine::IO::Stream::IoResult;
+using Engine::IO::Stream::IoResultVoid;
+using Engine::IO::Stream::IStream;
+using Engine::IO::Stream::MemoryStream;
+using Engine::IO::Stream::SeekWhence;
+using Engine::IO::Stream::StreamCaps;
+
+namespace {
+
+    std::vector<std::byte> MakeBytes(std::size_t size) {
+        std::vector<std::byte> v(size);
+        std::uint32_t x = 777;
+        for (auto& b : v) {
+            x = x * 1103515245u + 12345u;
+            b = static_cast<std::byte>(x >> 16);
+        }
+        return v;
+    }
+
+    // 同期 Read の回数 / 最大長を数える（asyncRead は持たない）
+    struct ProbeStats final {
+        std::atomic<std::size_t> reads{ 0 };
+        std::atomic<std::size_t> maxRead{ 0 };
+    };
+
+    class ProbeStream final : public IStream {
+    public:
+        ProbeStream(std::vector<std::byte> data, ProbeStats& stats)
+            : inner_(std::move(data), MemoryStream::Options{}), stats_(stats) {}
+
+        StreamCaps Caps() const noexcept override {
+            StreamCaps c = inner_.Caps();
+            c.asyncRead = false;
+            return c;
+        }
+        bool IsOpen() const noexcept override { return inner_.IsOpen(); }
+        bool IsEof() const noexcept override { return inner_.IsEof(); }
+
+        IoResult<std::size_t> Read(void* dst, std::size_t bytes) override {
+            ++stats_.reads;
+            std::size_t prev = stats_.maxRead.load();
+            while (bytes > prev && !stats_.maxRead.compare_exchange_weak(prev, bytes)) {}
+            return inner_.Read(dst, bytes);
+        }
+        IoResult<std::size_t> Write(const void* src, std::size_t bytes) override { return inner_.Write(src, bytes); }
+
+        IoResult<std::uint64_t> Tell() const override { return inner_.Tell(); }
+        IoResult<std::uint64_t> Seek(std::int64_t offset, SeekWhence whence) override { return inner_.Seek(offset, whence); }
+        IoResult<std::uint64_t> Size() const override { return inner_.Size(); }
+
+        IoResultVoid Flush() override { return inner_.Flush(); }
+        IoResultVoid Close() override { return inner_.Close(); }
+
+    private:
+        MemoryStream inner_;
+        ProbeStats& stats_;
+    };
+
+    BufferingOptions SmallOptions() {
+        BufferingOptions opt;
+        opt.readBufferSize = 4 * 1024;
+        opt.maxReadAheadSize = 64 * 1024;
+        return opt;
+    }
+
+    // 小さい Read を繰り返して全部読む
+    std::vector<std::byte> ReadInChunks(IStream& s, std::size_t chunk) {
+        std::vector<std::byte> out;
+        std::vector<std::byte> tmp(chunk);
+        for (;;) {
+            auto r = s.Read(tmp.data(), tmp.size());
+            REQUIRE(r);
+            if (r.value() == 0) break;
+            out.insert(out.end(), tmp.begin(), tmp.begin() + static_cast<std::ptrdiff_t>(r.value()));
+        }
+        return out;
+    }
+
+} // namespace
+
+TEST_CASE("BufferedStream: sequential reads grow read-ahead and prefetch in background") {
+    const auto data = MakeBytes(1024 * 1024 + 123);
+
+    ProbeStats stats;
+    // adapter の ReadAtAsync は IoWorkerPool 上で走る = 本当に裏で読む
+    BufferedStream s(std::make_unique<AsyncStreamAdapter>(std::make_unique<ProbeStream>(data, stats)), SmallOptions());
+
+    const auto out = ReadInChunks(s, 1000);
+    REQUIRE(out.size() == data.size());
+    CHECK(std::memcmp(out.data(), data.data(), data.size()) == 0);
+    CHECK(s.Tell().value() == data.size());
+
+    // 4KB から 64KB まで広がる（固定 4KB なら 257 回以上読むことになる）
+    CHECK(stats.maxRead.load() == 64 * 1024);
+    CHECK(stats.reads.load() < 40);
+}
+
+TEST_CASE("BufferedStream: seek resets read-ahead and keeps position consistent") {
+    const auto data = MakeBytes(300 * 1024);
+
+    BufferedStream s(std::make_unique<MemoryStream>(data, MemoryStream::Options{}), SmallOptions());
+
+    std::vector<std::byte> buf(3000);
+    for (int i = 0; i < 20; ++i) {
+        REQUIRE(s.Read(buf.data(), buf.size()).value() == buf.size());
+    }
+    CHECK(s.Tell().value() == 60000);
+
+    // 裏読み中でも位置が飛べばそこから読み直す
+    REQUIRE(s.Seek(100000, SeekWhence::Begin));
+    REQUIRE(s.Read(buf.data(), buf.size()).value() == buf.size());
+    CHECK(std::memcmp(buf.data(), data.data() + 100000, buf.size()) == 0);
+    CHECK(s.Tell().value() == 103000);
+
+    // 続きも正しい
+    const auto rest = ReadInChunks(s, 777);
+    REQUIRE(rest.size() == data.size() - 103000);
+    CHECK(std::memcmp(rest.data(), data.data() + 103000, rest.size()) == 0);
+}
+
+TEST_CASE("BufferedStream: large reads bypass the buffer and sync-only inner falls back") {
+    const auto data = MakeBytes(512 * 1024);
+
+    ProbeStats stats;
+    BufferedStream s(std::make_unique<ProbeStream>(data, stats), SmallOptions());
+
+    std::vector<std::byte> small(10);
+    REQUIRE(s.Read(small.data(), small.size()).value() == 10);
+
+    // buffer 残り + 直接読み
+    std::vector<std::byte> big(200 * 1024);
+    REQUIRE(s.Read(big.data(), big.size()).value() == big.size());
+    CHECK(std::memcmp(big.data(), data.data() + 10, big.size()) == 0);
+    CHECK(stats.maxRead.load() >= big.size() - 4 * 1024);
+
+    // asyncRead を持たない inner は同期 refill のまま最後まで読める
+    const auto rest = ReadInChunks(s, 500);
+    REQUIRE(rest.size() == data.size() - 10 - big.size());
+    CHECK(std::memcmp(rest.data(), data.data() + 10 + big.size(), rest.size()) == 0);
+    CHECK(s.IsEof());
+}
+
+TEST_CASE("BufferedStream: write after prefetched reads lands at the logical position") {
+    const auto data = MakeBytes(64 * 1024);
+
+    auto mem = std::make_unique<MemoryStream>(data, MemoryStream::Options{});
+    MemoryStream* raw = mem.get();
+    {
+        BufferedStream s(std::move(mem), SmallOptions());
+
+        std::vector<std::byte> buf(5000);
+        for (int i = 0; i < 3; ++i) {
+            REQUIRE(s.Read(buf.data(), buf.size()).value() == buf.size());
+        }
+
+        const std::byte patch[4] = { std::byte{ 1 }, std::byte{ 2 }, std::byte{ 3 }, std::byte{ 4 } };
+        REQUIRE(s.Write(patch, sizeof(patch)));
+        REQUIRE(s.Flush());
+        CHECK(s.Tell().value() == 15004);
+
+        CHECK(raw->Buffer()[15000] == std::byte{ 1 });
+        CHECK(raw->Buffer()[15003] == std::byte{ 4 });
+        CHECK(raw->Buffer()[15004] == data[15004]);
+    }
+}
+
+TEST_CASE("BufferedStream: reads on an IoWorkerPool worker do not prefetch onto the same pool") {
+    using Engine::IO::Async::IoWorkerPool;
+
+    const auto data = MakeBytes(256 * 1024 + 7);
+    // worker 1 本：worker 上で自分の後ろに積まれた裏読みを待つと詰まる
+    auto pool = std::make_shared<IoWorkerPool>(1);
+    AsyncStreamAdapter::Options aopt;
+    aopt.pool = pool;
+
+    ProbeStats stats;
+    BufferedStream s(std::make_unique<AsyncStreamAdapter>(std::make_unique<ProbeStream>(data, stats), aopt),
+                     SmallOptions());
+
+    std::promise<std::vector<std::byte>> done;
+    auto fut = done.get_future();
+    pool->Submit([&] { done.set_value(ReadInChunks(s, 1000)); });
+    REQUIRE(fut.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    CHECK(fut.get() == data);
+}
+
+TEST_CASE("BufferedStream: a worker waiting on a queued prefetch runs it itself") {
+    using Engine::IO::Async::IoWorkerPool;
+
+    const auto data = MakeBytes(256 * 1024 + 7);
+    auto pool = std::make_shared<IoWorkerPool>(1);
+    AsyncStreamAdapter::Options aopt;
+    aopt.pool = pool;
+
+    ProbeStats stats;
+    BufferedStream s(std::make_unique<AsyncStreamAdapter>(std::make_unique<ProbeStream>(data, stats), aopt),
+                     SmallOptions());
+
+    // worker を塞いでおき、その間に呼び出し側で 3 回 refill させて裏読みを pool（worker の後ろ）に積む
+    std::promise<void> issued;
+    auto issuedF = issued.get_future();
+    std::promise<std::vector<std::byte>> done;
+    auto fut = done.get_future();
+    pool->Submit([&] {
+        issuedF.wait();
+        done.set_value(ReadInChunks(s, 1000));
+    });
+
+    std::vector<std::byte> head(12 * 1024);
+    REQUIRE(s.Read(head.data(), 4 * 1024).value() == 4 * 1024);
+    REQUIRE(s.Read(head.data() + 4 * 1024, 4 * 1024).value() == 4 * 1024);
+    REQUIRE(s.Read(head.data() + 8 * 1024, 4 * 1024).value() == 4 * 1024);
+    issued.set_value();
+
+    REQUIRE(fut.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    auto tail = fut.get();
+    head.insert(head.end(), tail.begin(), tail.end());
+    CHECK(head == data);
+}
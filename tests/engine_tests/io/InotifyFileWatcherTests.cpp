@@ -0,0 +1,178 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "engine/io/fs/InotifyFileWatcher.hpp"
+#include "engine/io/path/Uri.hpp"
+
+namespace fs = std::filesystem;
+using Engine::IO::FS::InotifyFileWatcher;
+using Engine::IO::FS::FileChangeEvent;
+using Engine::IO::FS::FileChangeKind;
+using Engine::IO::FS::WatchOptions;
+using Engine::IO::Path::ParseUriLoose;
+using Engine::IO::Path::Uri;
+
+static void WriteFile(const fs::path& p, const std::string& s) {
+    fs::create_directories(p.parent_path());
+    std::ofstream ofs(p.string(), std::ios::binary);
+    ofs << s;
+}
+
+static fs::path MakeTmp(const char* name) {
+    fs::path tmp = fs::temp_directory_path() / name;
+    fs::remove_all(tmp);
+    fs::create_directories(tmp);
+    return tmp;
+}
+
+// OS の絶対パスをそのまま持つ scheme 無し Uri（ParseUriLoose は先頭の '/' を落とすので使わない）
+static Uri NativeUri(const std::string& path) {
+    Uri u;
+    u.path = Engine::IO::Path::Path::FromNormalized(path);
+    return u;
+}
+
+static bool Has(const std::vector<FileChangeEvent>& evs, FileChangeKind kind, const std::string& path) {
+    return std::any_of(evs.begin(), evs.end(), [&](const FileChangeEvent& e) {
+        return e.kind == kind && e.path.path.Str() == path;
+    });
+}
+
+TEST_CASE("InotifyFileWatcher: file watch shares the parent directory watch") {
+    auto w = InotifyFileWatcher::TryCreate();
+    if (!w) return; // inotify が使えない環境
+
+    const fs::path tmp = MakeTmp("inotify_watch_files");
+    const std::string a = (tmp / "a.txt").string();
+    const std::string b = (tmp / "b.txt").string();
+    WriteFile(a, "1");
+
+    auto ida = w->AddWatch(NativeUri(a));
+    auto idb = w->AddWatch(NativeUri(b)); // まだ無いファイル
+    REQUIRE(ida);
+    REQUIRE(idb);
+    CHECK(w->DirectoryWatchCount() == 1);
+
+    std::vector<FileChangeEvent> evs;
+    CHECK(w->Poll(evs).value() == 0);
+
+    WriteFile(a, "22");
+    WriteFile(b, "x");             // Created + Modified は Created 1 つにまとまる
+    WriteFile(tmp / "c.txt", "c"); // 監視外
+    REQUIRE(w->Poll(evs));
+    CHECK(evs.size() == 2);
+    CHECK(Has(evs, FileChangeKind::Modified, a));
+    CHECK(Has(evs, FileChangeKind::Created, b));
+
+    // 別名で書いて rename（エディタの保存）は名前側の Created として届く
+    evs.clear();
+    WriteFile(tmp / "a.txt.tmp", "333");
+    fs::rename(tmp / "a.txt.tmp", a);
+    fs::remove(b);
+    REQUIRE(w->Poll(evs));
+    CHECK(evs.size() == 2);
+    CHECK(Has(evs, FileChangeKind::Created, a));
+    CHECK(Has(evs, FileChangeKind::Removed, b));
+
+    REQUIRE(w->RemoveWatch(ida.value()));
+    CHECK(w->DirectoryWatchCount() == 1);
+    REQUIRE(w->RemoveWatch(idb.value()));
+    CHECK(w->DirectoryWatchCount() == 0);
+    CHECK(!w->RemoveWatch(idb.value()));
+}
+
+TEST_CASE("InotifyFileWatcher: recursive directory watch follows new directories") {
+    auto w = InotifyFileWatcher::TryCreate(MakeTmp("inotify_watch_tree").string());
+    if (!w) return;
+
+    const fs::path tmp = fs::temp_directory_path() / "inotify_watch_tree";
+    WriteFile(tmp / "assets/textures/a.png", "1");
+
+    WatchOptions opt;
+    opt.recursive = true;
+    REQUIRE(w->AddWatch(ParseUriLoose("assets"), opt));
+    CHECK(w->DirectoryWatchCount() == 2);
+
+    std::vector<FileChangeEvent> evs;
+    WriteFile(tmp / "assets/textures/a.png", "2");
+    WriteFile(tmp / "assets/meshes/lod/m.bin", "m"); // 新しいディレクトリの中身も拾う
+    REQUIRE(w->Poll(evs));
+    CHECK(Has(evs, FileChangeKind::Modified, "assets/textures/a.png"));
+    CHECK(Has(evs, FileChangeKind::Created, "assets/meshes"));
+    CHECK(Has(evs, FileChangeKind::Created, "assets/meshes/lod/m.bin"));
+    CHECK(w->DirectoryWatchCount() == 4);
+
+    // 監視内の rename は Renamed 1 つ
+    evs.clear();
+    fs::rename(tmp / "assets/textures/a.png", tmp / "assets/textures/b.png");
+    REQUIRE(w->Poll(evs));
+    REQUIRE(evs.size() == 1);
+    CHECK(evs[0].kind == FileChangeKind::Renamed);
+    CHECK(evs[0].path.path.Str() == "assets/textures/b.png");
+    REQUIRE(evs[0].hasOldPath);
+    CHECK(evs[0].oldPath.path.Str() == "assets/textures/a.png");
+
+    // maxEvents を超えた分は次の Poll で返る
+    evs.clear();
+    fs::remove(tmp / "assets/textures/b.png");
+    fs::remove(tmp / "assets/meshes/lod/m.bin");
+    CHECK(w->Poll(evs, 1).value() == 1);
+    CHECK(w->Poll(evs, 1).value() == 1);
+    CHECK(w->Poll(evs, 1).value() == 0);
+    CHECK(Has(evs, FileChangeKind::Removed, "assets/textures/b.png"));
+    CHECK(Has(evs, FileChangeKind::Removed, "assets/meshes/lod/m.bin"));
+}
+
+TEST_CASE("InotifyFileWatcher: removed parent directory reports Unknown") {
+    auto w = InotifyFileWatcher::TryCreate();
+    if (!w) return;
+
+    const fs::path tmp = MakeTmp("inotify_watch_gone");
+    const std::string f = (tmp / "sub/a.txt").string();
+    WriteFile(f, "1");
+
+    REQUIRE(w->AddWatch(NativeUri(f)));
+    CHECK(!w->AddWatch(NativeUri((tmp / "missing/x.txt").string()))); // 親が無いと張れない
+
+    fs::remove_all(tmp / "sub");
+    std::vector<FileChangeEvent> evs;
+    REQUIRE(w->Poll(evs));
+    CHECK(Has(evs, FileChangeKind::Removed, f));
+    CHECK(Has(evs, FileChangeKind::Unknown, f));
+    CHECK(w->DirectoryWatchCount() == 0);
+}
+
+TEST_CASE("InotifyFileWatcher: watch limit fails the whole tree instead of dropping subtrees") {
+    auto w = InotifyFileWatcher::TryCreate(MakeTmp("inotify_watch_limit").string());
+    if (!w) return;
+
+    const fs::path tmp = fs::temp_directory_path() / "inotify_watch_limit";
+    WriteFile(tmp / "assets/a/x.bin", "1");
+    WriteFile(tmp / "assets/b/y.bin", "2");
+
+    WatchOptions opt;
+    opt.recursive = true;
+
+    // 3 ディレクトリ中 2 つしか張れない（ENOSPC 相当）：一部だけの監視は返さず、張った分も外す
+    w->SetWatchLimit(2);
+    auto failed = w->AddWatch(ParseUriLoose("assets"), opt);
+    REQUIRE(!failed);
+    CHECK(w->DirectoryWatchCount() == 0);
+
+    // 張れた後に出来たディレクトリに張れなければ Unknown（呼び出し側で取り直す）
+    w->SetWatchLimit(3);
+    REQUIRE(w->AddWatch(ParseUriLoose("assets"), opt));
+    CHECK(w->DirectoryWatchCount() == 3);
+
+    std::vector<FileChangeEvent> evs;
+    WriteFile(tmp / "assets/c/z.bin", "3");
+    REQUIRE(w->Poll(evs));
+    CHECK(Has(evs, FileChangeKind::Unknown, "assets"));
+    CHECK(!Has(evs, FileChangeKind::Created, "assets/c/z.bin"));
+    CHECK(w->DirectoryWatchCount() == 3);
+}
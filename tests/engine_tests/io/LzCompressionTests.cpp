@@ -0,0 +1,165 @@
+#include "doctest/doctest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/io/compression/LzBlock.hpp"
+#include "engine/io/compression/LzDecodeStream.hpp"
+#include "engine/io/compression/LzFrame.hpp"
+
+using Engine::Base::SharedBuffer;
+using Engine::IO::Compression::LzCompressBlock;
+using Engine::IO::Compression::LzCompressBound;
+using Engine::IO::Compression::LzDecodeStream;
+using Engine::IO::Compression::LzDecompressBlock;
+using Engine::IO::Compression::LzFrame;
+using Engine::IO::Stream::SeekWhence;
+
+namespace {
+
+    // テキスト風（繰り返しが多い）+ ノイズを混ぜたデータ
+    std::vector<std::byte> MakeData(std::size_t size, std::uint32_t seed, int noisePercent) {
+        static const char* kWords[] = { "texture ", "mesh ", "shader ", "material ", "{\"id\":", "0.5, ", "\n" };
+        std::vector<std::byte> out;
+        out.reserve(size);
+        std::uint32_t x = seed | 1u;
+        auto next = [&] { x ^= x << 13; x ^= x >> 17; x ^= x << 5; return x; };
+        while (out.size() < size) {
+            if (static_cast<int>(next() % 100) < noisePercent) {
+                out.push_back(static_cast<std::byte>(next()));
+            } else {
+                const char* w = kWords[next() % 7];
+                for (const char* c = w; *c && out.size() < size; ++c) out.push_back(static_cast<std::byte>(*c));
+            }
+        }
+        return out;
+    }
+
+    std::vector<std::byte> RoundTripBlock(const std::vector<std::byte>& src) {
+        std::vector<std::byte> comp(LzCompressBound(src.size()));
+        const std::size_t c = LzCompressBlock(src.data(), src.size(), comp.data(), comp.size());
+        REQUIRE(c != 0);
+
+        std::vector<std::byte> back(src.size());
+        REQUIRE(LzDecompressBlock(comp.data(), c, back.data(), back.size()));
+        return back;
+    }
+
+} // namespace
+
+TEST_CASE("LzBlock: round trip of various inputs") {
+    CHECK(RoundTripBlock({}).empty());
+
+    std::vector<std::byte> tiny{ std::byte{ 1 }, std::byte{ 2 }, std::byte{ 3 } };
+    CHECK(RoundTripBlock(tiny) == tiny);
+
+    std::vector<std::byte> zeros(100000, std::byte{ 0 });
+    CHECK(RoundTripBlock(zeros) == zeros);
+
+    const auto text = MakeData(200000, 7, 2);
+    CHECK(RoundTripBlock(text) == text);
+
+    const auto noise = MakeData(50000, 9, 100);
+    CHECK(RoundTripBlock(noise) == noise);
+}
+
+TEST_CASE("LzBlock: compresses repetitive data and rejects corrupt input") {
+    const auto text = MakeData(128 * 1024, 3, 1);
+    std::vector<std::byte> comp(LzCompressBound(text.size()));
+    const std::size_t c = LzCompressBlock(text.data(), text.size(), comp.data(), comp.size());
+    REQUIRE(c != 0);
+    CHECK(c < text.size() / 2);
+
+    std::vector<std::byte> back(text.size());
+    // 出力サイズが合わない
+    CHECK_FALSE(LzDecompressBlock(comp.data(), c, back.data(), back.size() - 1));
+    // 途中で切れている
+    CHECK_FALSE(LzDecompressBlock(comp.data(), c / 2, back.data(), back.size()));
+
+    // 容量不足の出力先には書かない
+    std::vector<std::byte> small(16);
+    CHECK(LzCompressBlock(text.data(), text.size(), small.data(), small.size()) == 0);
+}
+
+TEST_CASE("LzFrame: multi-block encode and parallel decode") {
+    const auto data = MakeData(1000000, 11, 5);
+
+    LzFrame::Options opt;
+    opt.blockSize = 64 * 1024;
+    auto encoded = LzFrame::Encode({ data.data(), data.size() }, opt);
+    CHECK(encoded.size() < data.size());
+
+    auto fr = LzFrame::Parse(SharedBuffer::FromVector(std::move(encoded)));
+    REQUIRE(fr);
+    const LzFrame& f = fr.value();
+    CHECK(f.OriginalSize() == data.size());
+    CHECK(f.BlockCount() == (data.size() + opt.blockSize - 1) / opt.blockSize);
+    CHECK(f.BlockOriginalSize(f.BlockCount() - 1) == data.size() % opt.blockSize);
+
+    for (std::size_t workers : { std::size_t{ 1 }, std::size_t{ 4 } }) {
+        auto all = f.DecodeAll(workers);
+        REQUIRE(all);
+        REQUIRE(all.value().size() == data.size());
+        CHECK(std::memcmp(all.value().data(), data.data(), data.size()) == 0);
+    }
+
+    // 縮まないブロックは raw で持つ
+    const auto noise = MakeData(100000, 5, 100);
+    auto raw = LzFrame::Encode({ noise.data(), noise.size() });
+    CHECK(raw.size() <= noise.size() + 64);
+    auto rf = LzFrame::Parse(SharedBuffer::FromVector(std::move(raw)));
+    REQUIRE(rf);
+    auto rb = rf.value().DecodeAll();
+    REQUIRE(rb);
+    CHECK(std::memcmp(rb.value().data(), noise.data(), noise.size()) == 0);
+
+    // 壊れたフレーム
+    auto bad = LzFrame::Encode({ data.data(), data.size() }, opt);
+    bad.resize(bad.size() - 10);
+    CHECK_FALSE(LzFrame::Parse(SharedBuffer::FromVector(std::move(bad))));
+}
+
+TEST_CASE("LzDecodeStream: sequential and random reads, sync and parallel") {
+    const auto data = MakeData(700000, 21, 3);
+    LzFrame::Options fo;
+    fo.blockSize = 64 * 1024;
+    auto encoded = SharedBuffer::FromVector(LzFrame::Encode({ data.data(), data.size() }, fo));
+
+    for (std::size_t workers : { std::size_t{ 0 }, std::size_t{ 3 } }) {
+        CAPTURE(workers);
+        LzDecodeStream::Options so;
+        so.workers = workers;
+        so.readAheadBlocks = 3;
+        LzDecodeStream s(LzFrame::Parse(encoded).value(), so);
+
+        CHECK(s.Size().value() == data.size());
+
+        // ブロック境界をまたぐ半端なサイズで最後まで読む
+        std::vector<std::byte> got;
+        std::vector<std::byte> buf(10007);
+        for (;;) {
+            auto r = s.Read(buf.data(), buf.size());
+            REQUIRE(r);
+            if (r.value() == 0) break;
+            got.insert(got.end(), buf.begin(), buf.begin() + static_cast<std::ptrdiff_t>(r.value()));
+        }
+        CHECK(s.IsEof());
+        CHECK(got == data);
+
+        // 後ろへ戻る / 先へ飛ぶ
+        for (std::uint64_t at : { std::uint64_t{ 5 }, std::uint64_t{ 400000 }, std::uint64_t{ 65530 }, std::uint64_t{ 699990 } }) {
+            REQUIRE(s.Seek(static_cast<std::int64_t>(at), SeekWhence::Begin));
+            std::byte b[16];
+            const std::size_t n = s.Read(b, sizeof(b)).value();
+            CHECK(n == (std::min<std::size_t>)(16, data.size() - at));
+            CHECK(std::memcmp(b, data.data() + at, n) == 0);
+        }
+
+        CHECK_FALSE(s.Write(buf.data(), 1));
+        CHECK(s.Close());
+        CHECK_FALSE(s.IsOpen());
+    }
+}
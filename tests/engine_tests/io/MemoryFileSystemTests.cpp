@@ -0,0 +1,261 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/asset/loading/MemoryAssetSource.hpp"
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/io/fs/MemoryFileSystem.hpp"
+#include "engine/io/fs/Vfs.hpp"
+#include "engine/io/helpers/WriteAllBytes.hpp"
+#include "engine/io/path/Uri.hpp"
+
+using Engine::Base::SharedBuffer;
+using Engine::IO::IoErrorCode;
+using Engine::IO::FS::DirectoryEntry;
+using Engine::IO::FS::FileChangeEvent;
+using Engine::IO::FS::FileChangeKind;
+using Engine::IO::FS::ListOptions;
+using Engine::IO::FS::MemoryFileSystem;
+using Engine::IO::FS::MountPoint;
+using Engine::IO::FS::RemoveOptions;
+using Engine::IO::FS::Vfs;
+using Engine::IO::FS::WatchOptions;
+using Engine::IO::Path::ParseUri;
+using Engine::IO::Path::ParseUriLoose;
+
+namespace {
+
+    SharedBuffer Bytes(const std::string& s) {
+        return SharedBuffer::Copy({ reinterpret_cast<const std::byte*>(s.data()), s.size() });
+    }
+
+    std::vector<std::string> Names(const std::vector<DirectoryEntry>& es) {
+        std::vector<std::string> out;
+        for (const auto& e : es) out.push_back(e.name);
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    std::string ReadText(Engine::IO::Stream::IStream& s) {
+        std::string out(static_cast<std::size_t>(s.Size().value()), '\0');
+        std::size_t done = 0;
+        while (done < out.size()) {
+            auto r = s.Read(out.data() + done, out.size() - done);
+            REQUIRE(r);
+            if (r.value() == 0) break;
+            done += r.value();
+        }
+        out.resize(done);
+        return out;
+    }
+
+} // namespace
+
+TEST_CASE("MemoryFileSystem: put, stat, list and zero-copy open") {
+    MemoryFileSystem fs;
+    const SharedBuffer blob = Bytes("PNGDATA");
+    REQUIRE(fs.Put("textures/a.png", blob));
+    REQUIRE(fs.Put("/textures/ui\\b.png", Bytes("B")));
+    REQUIRE(fs.Put("readme.txt", Bytes("R")));
+    REQUIRE(fs.Put(".hidden", Bytes("H")));
+
+    CHECK(fs.FileCount() == 4);
+    CHECK(fs.Stat(ParseUriLoose("textures")).value().IsDirectory());
+    CHECK(fs.Stat(ParseUriLoose("textures/ui/b.png")).value().sizeBytes == 1);
+    CHECK(fs.Exists(ParseUri("memory://textures/a.png").value()).value());
+    CHECK_FALSE(fs.Exists(ParseUriLoose("missing.txt")).value());
+
+    // 親がファイルなら置けない / ".." は拒否
+    CHECK(fs.Put("readme.txt/x", Bytes("x")).error().code == IoErrorCode::AlreadyExists);
+    CHECK(fs.Put("../escape", Bytes("x")).error().code == IoErrorCode::InvalidPath);
+
+    // 読み取りは blob をそのまま共有する
+    auto rs = fs.ReadShared(ParseUriLoose("textures/a.png"));
+    REQUIRE(rs);
+    CHECK(rs.value().data() == blob.data());
+
+    auto os = fs.Open(ParseUriLoose("textures/a.png"), Engine::IO::Stream::OpenReadBinary());
+    REQUIRE(os);
+    CHECK(ReadText(*os.value()) == "PNGDATA");
+
+    auto root = fs.List(ParseUriLoose(""));
+    REQUIRE(root);
+    CHECK(Names(root.value()) == std::vector<std::string>{ "readme.txt", "textures" });
+
+    ListOptions all;
+    all.recursive = true;
+    all.includeHidden = true;
+    auto rec = fs.List(ParseUriLoose(""), all);
+    REQUIRE(rec);
+    CHECK(Names(rec.value()) == std::vector<std::string>{ ".hidden", "a.png", "b.png", "readme.txt", "textures", "ui" });
+}
+
+TEST_CASE("MemoryFileSystem: write streams replace blobs without touching open readers") {
+    MemoryFileSystem fs;
+    REQUIRE(fs.Put("cfg/game.ini", Bytes("old")));
+
+    auto reader = fs.Open(ParseUriLoose("cfg/game.ini"), Engine::IO::Stream::OpenReadBinary());
+    REQUIRE(reader);
+
+    {
+        auto w = fs.Open(ParseUriLoose("cfg/game.ini"), Engine::IO::Stream::OpenWriteBinaryTruncate(false));
+        REQUIRE(w);
+        const std::string text = "new contents";
+        REQUIRE(w.value()->Write(text.data(), text.size()));
+        // Close 前は古い blob のまま
+        CHECK(fs.ReadShared(ParseUriLoose("cfg/game.ini")).value().AsStringView() == "old");
+    } // 破棄で確定
+
+    CHECK(fs.ReadShared(ParseUriLoose("cfg/game.ini")).value().AsStringView() == "new contents");
+    CHECK(ReadText(*reader.value()) == "old");
+
+    // append / 新規作成（親ディレクトリが要る）
+    {
+        auto a = fs.Open(ParseUriLoose("cfg/game.ini"), Engine::IO::Stream::OpenWriteBinaryAppend(false));
+        REQUIRE(a);
+        REQUIRE(a.value()->Write("!", 1));
+        REQUIRE(a.value()->Close());
+    }
+    CHECK(fs.ReadShared(ParseUriLoose("cfg/game.ini")).value().AsStringView() == "new contents!");
+
+    // truncate で開いて何も書かずに閉じても空になる（WriteAllBytes(fs, uri, {}) と同じ）
+    {
+        auto t = fs.Open(ParseUriLoose("cfg/game.ini"), Engine::IO::Stream::OpenWriteBinaryTruncate(false));
+        REQUIRE(t);
+        REQUIRE(t.value()->Close());
+    }
+    CHECK(fs.ReadShared(ParseUriLoose("cfg/game.ini")).value().empty());
+    REQUIRE(fs.Put("cfg/game.ini", Bytes("old")));
+    REQUIRE(Engine::IO::Helpers::WriteAllBytes(fs, ParseUriLoose("cfg/game.ini"), {}));
+    CHECK(fs.ReadShared(ParseUriLoose("cfg/game.ini")).value().empty());
+
+    auto noParent = fs.Open(ParseUriLoose("nodir/x.bin"), Engine::IO::Stream::OpenWriteBinaryTruncate(true));
+    REQUIRE_FALSE(noParent);
+    CHECK(noParent.error().code == IoErrorCode::NotFound);
+
+    auto created = fs.Open(ParseUriLoose("cfg/new.bin"), Engine::IO::Stream::OpenWriteBinaryTruncate(true));
+    REQUIRE(created);
+    CHECK(fs.Exists(ParseUriLoose("cfg/new.bin")).value());
+}
+
+TEST_CASE("MemoryFileSystem: copy shares blobs, move and remove handle subtrees") {
+    MemoryFileSystem fs;
+    REQUIRE(fs.Put("a/x.txt", Bytes("X")));
+    REQUIRE(fs.Put("a/sub/y.txt", Bytes("Y")));
+
+    REQUIRE(fs.Copy(ParseUriLoose("a/x.txt"), ParseUriLoose("x_copy.txt")));
+    CHECK(fs.ReadShared(ParseUriLoose("x_copy.txt")).value().data()
+          == fs.ReadShared(ParseUriLoose("a/x.txt")).value().data());
+
+    REQUIRE(fs.Move(ParseUriLoose("a"), ParseUriLoose("b")));
+    CHECK_FALSE(fs.Exists(ParseUriLoose("a/sub/y.txt")).value());
+    CHECK(fs.ReadShared(ParseUriLoose("b/sub/y.txt")).value().AsStringView() == "Y");
+    CHECK_FALSE(fs.Move(ParseUriLoose("b"), ParseUriLoose("b/sub/inner")));
+
+    auto nonEmpty = fs.Remove(ParseUriLoose("b"));
+    REQUIRE_FALSE(nonEmpty);
+    RemoveOptions rec;
+    rec.recursive = true;
+    REQUIRE(fs.Remove(ParseUriLoose("b"), rec));
+    CHECK(fs.FileCount() == 1);
+}
+
+TEST_CASE("MemoryFileSystem: subtrees are found past siblings that sort before '/'") {
+    // "sprites" < "sprites-old" < "sprites.json" < "sprites/a.png" の順に並ぶ
+    MemoryFileSystem fs;
+    REQUIRE(fs.Put("sprites/a.png", Bytes("A")));
+    REQUIRE(fs.Put("sprites/sub/b.png", Bytes("B")));
+    REQUIRE(fs.Put("sprites.json", Bytes("J")));
+    REQUIRE(fs.Put("sprites-old/c.png", Bytes("C")));
+
+    auto ls = fs.List(ParseUriLoose("sprites"));
+    REQUIRE(ls);
+    CHECK(Names(ls.value()) == std::vector<std::string>{ "a.png", "sub" });
+
+    ListOptions deep;
+    deep.recursive = true;
+    CHECK(fs.List(ParseUriLoose("sprites"), deep).value().size() == 3);
+
+    // 中身があるので再帰無しの Remove は失敗する
+    CHECK_FALSE(fs.Remove(ParseUriLoose("sprites")));
+    CHECK(fs.Exists(ParseUriLoose("sprites/a.png")).value());
+
+    REQUIRE(fs.Move(ParseUriLoose("sprites"), ParseUriLoose("moved")));
+    CHECK_FALSE(fs.Exists(ParseUriLoose("sprites/sub/b.png")).value());
+    CHECK(fs.ReadShared(ParseUriLoose("moved/sub/b.png")).value().AsStringView() == "B");
+    CHECK(fs.ReadShared(ParseUriLoose("sprites.json")).value().AsStringView() == "J");
+
+    RemoveOptions rec;
+    rec.recursive = true;
+    REQUIRE(fs.Remove(ParseUriLoose("moved"), rec));
+    CHECK_FALSE(fs.Exists(ParseUriLoose("moved/a.png")).value());
+    CHECK(fs.Exists(ParseUriLoose("sprites-old/c.png")).value());
+    CHECK(fs.FileCount() == 2);
+}
+
+TEST_CASE("MemoryFileSystem: watcher receives change events directly") {
+    MemoryFileSystem fs;
+    REQUIRE(fs.CreateDirectories(ParseUriLoose("assets/textures")));
+
+    auto wr = fs.CreateWatcher();
+    REQUIRE(wr);
+    auto& watcher = *wr.value();
+
+    WatchOptions opt;
+    opt.recursive = true;
+    REQUIRE(watcher.AddWatch(ParseUriLoose("assets"), opt));
+
+    REQUIRE(fs.Put("assets/textures/a.png", Bytes("1")));
+    REQUIRE(fs.Put("assets/textures/a.png", Bytes("2")));
+    REQUIRE(fs.Put("assets/textures/a.png", Bytes("3"))); // 連続した Modified はまとまる
+    REQUIRE(fs.Put("other/z.txt", Bytes("z")));             // 監視外
+    REQUIRE(fs.Move(ParseUriLoose("assets/textures/a.png"), ParseUriLoose("assets/textures/b.png")));
+    REQUIRE(fs.Remove(ParseUriLoose("assets/textures/b.png")));
+
+    std::vector<FileChangeEvent> evs;
+    REQUIRE(watcher.Poll(evs));
+    REQUIRE(evs.size() == 4);
+    CHECK(evs[0].kind == FileChangeKind::Created);
+    CHECK(evs[0].path.path.Str() == "assets/textures/a.png");
+    CHECK(evs[1].kind == FileChangeKind::Modified);
+    CHECK(evs[2].kind == FileChangeKind::Renamed);
+    CHECK(evs[2].hasOldPath);
+    CHECK(evs[2].oldPath.path.Str() == "assets/textures/a.png");
+    CHECK(evs[3].kind == FileChangeKind::Removed);
+
+    evs.clear();
+    CHECK(watcher.Poll(evs).value() == 0);
+}
+
+TEST_CASE("MemoryFileSystem: mounted in Vfs and read through MemoryAssetSource") {
+    auto mem = std::make_shared<MemoryFileSystem>();
+    REQUIRE(mem->Put("assets/textures/a.png", Bytes("AAA")));
+    REQUIRE(mem->Put("assets/readme.txt", Bytes("R")));
+
+    Vfs vfs;
+    MountPoint mp;
+    mp.name = "ram";
+    mp.mountUri = ParseUri("assets://").value();
+    mp.rootUri = ParseUri("memory://assets").value();
+    mp.fs = mem;
+    REQUIRE(vfs.Mount(std::move(mp)));
+
+    auto os = vfs.Open(ParseUri("assets://textures/a.png").value(), Engine::IO::Stream::OpenReadBinary());
+    REQUIRE(os);
+    CHECK(ReadText(*os.value()) == "AAA");
+    CHECK(vfs.Stat(ParseUri("assets://textures").value()).value().IsDirectory());
+
+    auto lr = vfs.List(ParseUri("assets://").value());
+    REQUIRE(lr);
+    CHECK(Names(lr.value()) == std::vector<std::string>{ "readme.txt", "textures" });
+
+    Engine::Asset::Loading::MemoryAssetSource src(mem);
+    auto r = src.ReadAll("assets/textures/a.png");
+    REQUIRE(r);
+    CHECK(r.value().data() == mem->ReadShared(ParseUriLoose("assets/textures/a.png")).value().data());
+    CHECK_FALSE(src.Exists("assets/none.png"));
+    CHECK(src.ReadAll("assets/none.png").error().code == Engine::Asset::AssetErrorCode::SourceNotFound);
+}
@@ -0,0 +1,244 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "engine/io/fs/NativeFileSystem.hpp"
+#include "engine/io/path/Uri.hpp"
+
+namespace fs = std::filesystem;
+using Engine::IO::FS::NativeFileSystem;
+using Engine::IO::FS::NativeFileStream;
+using Engine::IO::FS::DirectoryEntry;
+using Engine::IO::FS::FileChangeEvent;
+using Engine::IO::FS::FileChangeKind;
+using Engine::IO::FS::ListOptions;
+using Engine::IO::IoErrorCode;
+using Engine::IO::Path::ParseUriLoose;
+using Engine::IO::Stream::SeekWhence;
+
+static void WriteFile(const fs::path& p, const std::string& s) {
+    fs::create_directories(p.parent_path());
+    std::ofstream ofs(p.string(), std::ios::binary);
+    ofs << s;
+}
+
+static fs::path MakeTmp(const char* name) {
+    fs::path tmp = fs::temp_directory_path() / name;
+    fs::remove_all(tmp);
+    fs::create_directories(tmp);
+    return tmp;
+}
+
+TEST_CASE("NativeFileSystem: open/read/seek/size") {
+    const fs::path tmp = MakeTmp("native_fs_read");
+    WriteFile(tmp / "a.bin", "0123456789");
+
+    NativeFileSystem::Options opt;
+    opt.rootDirectory = tmp.string();
+    NativeFileSystem nfs(opt);
+
+    auto sr = nfs.OpenFile(ParseUriLoose("a.bin"), Engine::IO::Stream::OpenReadBinary());
+    REQUIRE(sr);
+    auto& s = *sr.value();
+
+    CHECK(s.Size().value() == 10);
+
+    char buf[4] = {};
+    CHECK(s.Read(buf, 4).value() == 4);
+    CHECK(std::string(buf, 4) == "0123");
+    CHECK(s.Tell().value() == 4);
+
+    // ReadAt は位置を動かさない
+    CHECK(s.ReadAt(8, buf, 4).value() == 2);
+    CHECK(std::string(buf, 2) == "89");
+    CHECK(s.Tell().value() == 4);
+
+    CHECK(s.Seek(-3, SeekWhence::End).value() == 7);
+    CHECK(s.Read(buf, 4).value() == 3);
+    CHECK(s.IsEof());
+
+    CHECK(s.Close());
+    CHECK(!s.IsOpen());
+
+    // 存在しない / root 脱出
+    auto nf = nfs.Open(ParseUriLoose("none.bin"), Engine::IO::Stream::OpenReadBinary());
+    REQUIRE(!nf);
+    CHECK(nf.error().code == IoErrorCode::NotFound);
+
+    auto esc = nfs.Open(ParseUriLoose("../x"), Engine::IO::Stream::OpenReadBinary());
+    REQUIRE(!esc);
+    CHECK(esc.error().code == IoErrorCode::PathEscapesRoot);
+
+    // file:// は絶対パス
+    auto abs = nfs.Stat(ParseUriLoose("file://" + (tmp / "a.bin").string()));
+    REQUIRE(abs);
+    CHECK(abs.value().IsFile());
+    CHECK(abs.value().sizeBytes == 10);
+}
+
+TEST_CASE("NativeFileSystem: ReadAtAsync completes on the worker pool without moving the position") {
+    const fs::path tmp = MakeTmp("native_fs_async");
+    std::string data(300000, '\0');
+    for (std::size_t i = 0; i < data.size(); ++i) data[i] = static_cast<char>('a' + i % 26);
+    WriteFile(tmp / "big.bin", data);
+
+    auto sr = NativeFileStream::Open((tmp / "big.bin").string(), Engine::IO::Stream::OpenReadBinary());
+    REQUIRE(sr);
+    auto& s = *sr.value();
+    CHECK(s.Caps().asyncRead);
+
+    char head[3] = {};
+    CHECK(s.Read(head, 3).value() == 3);
+
+    // 複数要求を同時に出す（最後は末尾を跨ぐ）
+    std::vector<std::vector<std::byte>> bufs(8, std::vector<std::byte>(40000));
+    std::vector<std::promise<Engine::Base::Result<std::size_t, Engine::IO::FS::IoError>>> done(bufs.size());
+    for (std::size_t i = 0; i < bufs.size(); ++i) {
+        s.ReadAtAsync(i * 37000, bufs[i], [&done, i](auto r) { done[i].set_value(std::move(r)); });
+    }
+    for (std::size_t i = 0; i < bufs.size(); ++i) {
+        auto r = done[i].get_future().get();
+        REQUIRE(r);
+        const std::size_t expect = std::min<std::size_t>(40000, data.size() - i * 37000);
+        CHECK(r.value() == expect);
+        CHECK(std::memcmp(bufs[i].data(), data.data() + i * 37000, expect) == 0);
+    }
+    CHECK(s.Tell().value() == 3);
+
+    // Close は実行中の要求を待ってから fd を閉じる
+    std::vector<std::byte> late(1000);
+    std::promise<bool> lateDone;
+    s.ReadAtAsync(0, late, [&](auto r) { lateDone.set_value(static_cast<bool>(r)); });
+    CHECK(s.Close());
+    CHECK(lateDone.get_future().get());
+}
+
+TEST_CASE("NativeFileSystem: write/append/copy/move/remove") {
+    const fs::path tmp = MakeTmp("native_fs_write");
+
+    NativeFileSystem::Options opt;
+    opt.rootDirectory = tmp.string();
+    NativeFileSystem nfs(opt);
+
+    REQUIRE(nfs.CreateDirectories(ParseUriLoose("d1/d2")));
+    CHECK(fs::is_directory(tmp / "d1/d2"));
+
+    {
+        auto w = nfs.Open(ParseUriLoose("d1/d2/f.txt"), Engine::IO::Stream::OpenWriteBinaryTruncate());
+        REQUIRE(w);
+        CHECK(w.value()->Write("abc", 3).value() == 3);
+    }
+    {
+        auto w = nfs.Open(ParseUriLoose("d1/d2/f.txt"), Engine::IO::Stream::OpenWriteBinaryAppend());
+        REQUIRE(w);
+        CHECK(w.value()->Tell().value() == 3);
+        CHECK(w.value()->Write("de", 2).value() == 2);
+        CHECK(w.value()->Tell().value() == 5);
+    }
+    CHECK(fs::file_size(tmp / "d1/d2/f.txt") == 5);
+
+    REQUIRE(nfs.Copy(ParseUriLoose("d1/d2/f.txt"), ParseUriLoose("g.txt")));
+    CHECK(fs::file_size(tmp / "g.txt") == 5);
+    CHECK(!fs::exists(tmp / "g.txt.tmp~"));
+
+    // 失敗した Copy は既存の to を壊さない。成功すれば置き換わる
+    WriteFile(tmp / "keep.txt", "old");
+    CHECK(!nfs.Copy(ParseUriLoose("none.txt"), ParseUriLoose("keep.txt")));
+    CHECK(!nfs.Copy(ParseUriLoose("d1"), ParseUriLoose("keep.txt")));
+    CHECK(fs::file_size(tmp / "keep.txt") == 3);
+    REQUIRE(nfs.Copy(ParseUriLoose("d1/d2/f.txt"), ParseUriLoose("keep.txt")));
+    CHECK(fs::file_size(tmp / "keep.txt") == 5);
+    CHECK(!fs::exists(tmp / "keep.txt.tmp~"));
+
+    REQUIRE(nfs.Move(ParseUriLoose("g.txt"), ParseUriLoose("h.txt")));
+    CHECK(!nfs.Exists(ParseUriLoose("g.txt")).value());
+    CHECK(nfs.Exists(ParseUriLoose("h.txt")).value());
+
+    // 非再帰でディレクトリは消せない
+    CHECK(!nfs.Remove(ParseUriLoose("d1")));
+    Engine::IO::FS::RemoveOptions ro;
+    ro.recursive = true;
+    REQUIRE(nfs.Remove(ParseUriLoose("d1"), ro));
+    CHECK(!fs::exists(tmp / "d1"));
+}
+
+TEST_CASE("NativeFileSystem: list / iterate") {
+    const fs::path tmp = MakeTmp("native_fs_list");
+    WriteFile(tmp / "a.txt", "a");
+    WriteFile(tmp / "sub/b.txt", "bb");
+    WriteFile(tmp / "sub/deep/c.txt", "ccc");
+    WriteFile(tmp / ".hidden", "h");
+
+    NativeFileSystem::Options opt;
+    opt.rootDirectory = tmp.string();
+    NativeFileSystem nfs(opt);
+
+    ListOptions lo;
+    auto flat = nfs.List(ParseUriLoose(""), lo);
+    REQUIRE(flat);
+    CHECK(flat.value().size() == 2); // a.txt, sub（.hidden は除外）
+
+    lo.recursive = true;
+    lo.includeDirectories = false;
+    lo.includeInfo = true;
+    auto rec = nfs.List(ParseUriLoose(""), lo);
+    REQUIRE(rec);
+
+    std::vector<std::string> paths;
+    for (const DirectoryEntry& e : rec.value()) {
+        CHECK(e.IsFile());
+        CHECK(e.hasInfo);
+        paths.push_back(e.path);
+        if (e.name == "c.txt") CHECK(e.info.sizeBytes == 3);
+    }
+    std::sort(paths.begin(), paths.end());
+    REQUIRE(paths.size() == 3);
+    CHECK(paths[0] == "a.txt");
+    CHECK(paths[1] == "sub/b.txt");
+    CHECK(paths[2] == "sub/deep/c.txt");
+
+    // Reset で先頭から
+    auto it = nfs.Iterate(ParseUriLoose("sub"), ListOptions{});
+    REQUIRE(it);
+    DirectoryEntry e;
+    int n1 = 0, n2 = 0;
+    while (it.value()->Next(e).value()) ++n1;
+    REQUIRE(it.value()->Reset());
+    while (it.value()->Next(e).value()) ++n2;
+    CHECK(n1 == 2);
+    CHECK(n2 == 2);
+}
+
+TEST_CASE("NativeFileSystem: polling watcher") {
+    const fs::path tmp = MakeTmp("native_fs_watch");
+
+    NativeFileSystem::Options opt;
+    opt.rootDirectory = tmp.string();
+    NativeFileSystem nfs(opt);
+
+    auto wr = nfs.CreateWatcher();
+    REQUIRE(wr);
+    auto& w = *wr.value();
+    REQUIRE(w.AddWatch(ParseUriLoose("x.txt")));
+
+    std::vector<FileChangeEvent> ev;
+    CHECK(w.Poll(ev).value() == 0);
+
+    WriteFile(tmp / "x.txt", "1");
+    CHECK(w.Poll(ev).value() == 1);
+    CHECK(ev.back().kind == FileChangeKind::Created);
+
+    WriteFile(tmp / "x.txt", "22"); // size が変わるので mtime 粒度に依存しない
+    CHECK(w.Poll(ev).value() == 1);
+    CHECK(ev.back().kind == FileChangeKind::Modified);
+
+    fs::remove(tmp / "x.txt");
+    CHECK(w.Poll(ev).value() == 1);
+    CHECK(ev.back().kind == FileChangeKind::Removed);
+}
@@ -0,0 +1,205 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/io/fs/Vfs.hpp"
+#include "engine/io/pak/PakArchive.hpp"
+#include "engine/io/pak/PakFileSystem.hpp"
+#include "engine/io/pak/PakWriter.hpp"
+#include "engine/io/path/Uri.hpp"
+#include "engine/io/stream/MemoryStream.hpp"
+
+using Engine::Base::SharedBuffer;
+using Engine::IO::IoErrorCode;
+using Engine::IO::FS::DirectoryEntry;
+using Engine::IO::FS::ListOptions;
+using Engine::IO::FS::MountPoint;
+using Engine::IO::FS::Vfs;
+using Engine::IO::Pak::PakArchive;
+using Engine::IO::Pak::PakFileSystem;
+using Engine::IO::Pak::PakWriter;
+using Engine::IO::Path::ParseUri;
+using Engine::IO::Path::ParseUriLoose;
+
+static SharedBuffer Bytes(const std::string& s) {
+    return SharedBuffer::Copy({ reinterpret_cast<const std::byte*>(s.data()), s.size() });
+}
+
+static std::shared_ptr<const PakArchive> BuildPak(PakWriter& w) {
+    Engine::IO::Stream::MemoryStream ms;
+    REQUIRE(w.WriteTo(ms));
+    auto ar = PakArchive::FromBuffer(SharedBuffer::FromVector(ms.Buffer()));
+    REQUIRE(ar);
+    return ar.value();
+}
+
+static std::vector<std::string> Names(const std::vector<DirectoryEntry>& es) {
+    std::vector<std::string> out;
+    for (const auto& e : es) out.push_back(e.name);
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+TEST_CASE("Pak: write, find and read zero-copy") {
+    PakWriter::Options wo;
+    wo.alignment = 64;
+    PakWriter w(wo);
+    REQUIRE(w.AddBuffer("assets/a.txt", Bytes("hello")));
+    REQUIRE(w.AddBuffer("./assets\\tex/b.png", Bytes("PNGDATA")));
+    REQUIRE(w.AddBuffer("assets/empty.bin", SharedBuffer{}));
+
+    // 正規化後に同じパスは拒否
+    auto dup = w.AddBuffer("/assets/a.txt", Bytes("x"));
+    REQUIRE_FALSE(dup);
+    CHECK(dup.error().code == IoErrorCode::AlreadyExists);
+
+    auto pak = BuildPak(w);
+    CHECK(pak->Count() == 3);
+
+    auto e = pak->Find("assets/tex/b.png");
+    REQUIRE(e.has_value());
+    CHECK(e->dataOffset % 64 == 0);
+    CHECK(e->originalSize == 7);
+
+    auto rb = pak->Read(*e);
+    REQUIRE(rb);
+    CHECK(rb.value().AsStringView() == "PNGDATA");
+    // pak イメージの一部を指している（コピーしていない）
+    CHECK(rb.value().data() == pak->Image().data() + e->dataOffset);
+
+    CHECK(pak->ReadFile("assets/a.txt").value().AsStringView() == "hello");
+    CHECK(pak->ReadFile("assets/empty.bin").value().empty());
+    CHECK_FALSE(pak->Find("assets/missing.txt").has_value());
+    CHECK(pak->ReadFile("assets/missing.txt").error().code == IoErrorCode::NotFound);
+
+    CHECK(pak->HasDirectory("assets"));
+    CHECK(pak->HasDirectory("assets/tex"));
+    CHECK_FALSE(pak->HasDirectory("asset"));
+}
+
+TEST_CASE("Pak: rejects broken images") {
+    CHECK_FALSE(PakArchive::FromBuffer(Bytes("GPAK")));
+    CHECK_FALSE(PakArchive::FromBuffer(Bytes(std::string(64, 'x'))));
+
+    PakWriter w;
+    REQUIRE(w.AddBuffer("a", Bytes("1")));
+    Engine::IO::Stream::MemoryStream ms;
+    REQUIRE(w.WriteTo(ms));
+
+    // TOC の途中で切れている
+    std::vector<std::byte> cut = ms.Buffer();
+    cut.resize(cut.size() - 8);
+    CHECK_FALSE(PakArchive::FromBuffer(SharedBuffer::FromVector(std::move(cut))));
+}
+
+TEST_CASE("PakFileSystem: stat, list and open") {
+    PakWriter w;
+    REQUIRE(w.AddBuffer("assets/a.txt", Bytes("hello")));
+    REQUIRE(w.AddBuffer("assets/tex/b.png", Bytes("PNG")));
+    REQUIRE(w.AddBuffer("assets/tex/sub/c.png", Bytes("C")));
+    REQUIRE(w.AddBuffer("assets/.hidden", Bytes("h")));
+    REQUIRE(w.AddBuffer("other/d.txt", Bytes("D")));
+
+    PakFileSystem::Options po;
+    po.rootPrefix = "assets";
+    PakFileSystem pfs(BuildPak(w), po);
+
+    auto st = pfs.Stat(ParseUriLoose("a.txt"));
+    REQUIRE(st);
+    CHECK(st.value().IsFile());
+    CHECK(st.value().sizeBytes == 5);
+    CHECK(pfs.Stat(ParseUriLoose("tex")).value().IsDirectory());
+    CHECK(pfs.Stat(ParseUriLoose("")).value().IsDirectory());
+    CHECK(pfs.Stat(ParseUriLoose("d.txt")).error().code == IoErrorCode::NotFound);
+
+    auto lr = pfs.List(ParseUriLoose(""));
+    REQUIRE(lr);
+    CHECK(Names(lr.value()) == std::vector<std::string>{ "a.txt", "tex" });
+
+    ListOptions rec;
+    rec.recursive = true;
+    rec.includeHidden = true;
+    auto rr = pfs.List(ParseUriLoose(""), rec);
+    REQUIRE(rr);
+    CHECK(Names(rr.value()) == std::vector<std::string>{ ".hidden", "a.txt", "b.png", "c.png", "sub", "tex" });
+
+    auto os = pfs.Open(ParseUriLoose("tex/b.png"), Engine::IO::Stream::OpenReadBinary());
+    REQUIRE(os);
+    char buf[8] = {};
+    CHECK(os.value()->Read(buf, sizeof(buf)).value() == 3);
+    CHECK(std::string(buf, 3) == "PNG");
+
+    auto wr = pfs.Open(ParseUriLoose("a.txt"), Engine::IO::Stream::OpenWriteBinaryTruncate(true));
+    REQUIRE_FALSE(wr);
+    CHECK(wr.error().code == IoErrorCode::PermissionDenied);
+    CHECK_FALSE(pfs.Remove(ParseUriLoose("a.txt")));
+}
+
+TEST_CASE("PakFileSystem: mounted in Vfs with pak://archive#prefix root") {
+    PakWriter w;
+    REQUIRE(w.AddBuffer("assets/textures/a.png", Bytes("AAA")));
+    REQUIRE(w.AddBuffer("assets/readme.txt", Bytes("R")));
+
+    Vfs vfs;
+    MountPoint mp;
+    mp.name = "base_pak";
+    mp.readOnly = true;
+    mp.mountUri = ParseUri("assets://").value();
+    mp.rootUri = ParseUri("pak://base.pak#assets").value();
+    mp.fs = std::make_shared<PakFileSystem>(BuildPak(w));
+    REQUIRE(vfs.Mount(std::move(mp)));
+
+    auto os = vfs.Open(ParseUri("assets://textures/a.png").value(), Engine::IO::Stream::OpenReadBinary());
+    REQUIRE(os);
+    CHECK(os.value()->Size().value() == 3);
+
+    CHECK(vfs.Exists(ParseUri("assets://readme.txt").value()).value());
+    CHECK_FALSE(vfs.Exists(ParseUri("assets://missing.txt").value()).value());
+    CHECK(vfs.Stat(ParseUri("assets://textures").value()).value().IsDirectory());
+
+    auto lr = vfs.List(ParseUri("assets://").value());
+    REQUIRE(lr);
+    CHECK(Names(lr.value()) == std::vector<std::string>{ "readme.txt", "textures" });
+}
+
+TEST_CASE("Pak: Lz payloads read back through Read and Open") {
+    std::string text;
+    for (int i = 0; i < 20000; ++i) text += "material shader texture " + std::to_string(i % 17) + "\n";
+
+    PakWriter::Options wo;
+    wo.lzBlockSize = 64 * 1024;
+    PakWriter w(wo);
+    REQUIRE(w.AddBuffer("big.txt", Bytes(text), Engine::IO::Pak::PakCompression::Lz));
+    // 縮まないものは None で格納される
+    REQUIRE(w.AddBuffer("tiny.bin", Bytes("xyz"), Engine::IO::Pak::PakCompression::Lz));
+
+    auto pak = BuildPak(w);
+    auto e = pak->Find("big.txt");
+    REQUIRE(e.has_value());
+    CHECK(e->compression == Engine::IO::Pak::PakCompression::Lz);
+    CHECK(e->storedSize < e->originalSize);
+    CHECK(pak->Find("tiny.bin")->compression == Engine::IO::Pak::PakCompression::None);
+
+    auto rb = pak->Read(*e);
+    REQUIRE(rb);
+    CHECK(rb.value().AsStringView() == text);
+
+    PakFileSystem pfs(pak);
+    CHECK(pfs.Stat(ParseUriLoose("big.txt")).value().sizeBytes == text.size());
+
+    auto os = pfs.Open(ParseUriLoose("big.txt"), Engine::IO::Stream::OpenReadBinary());
+    REQUIRE(os);
+    std::string got(text.size(), '\0');
+    std::size_t done = 0;
+    while (done < got.size()) {
+        auto r = os.value()->Read(got.data() + done, got.size() - done);
+        REQUIRE(r);
+        if (r.value() == 0) break;
+        done += r.value();
+    }
+    CHECK(got == text);
+}
@@ -0,0 +1,98 @@
+#include "doctest/doctest.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "engine/io/path/PathUtils.hpp"
+
+namespace Path = Engine::IO::Path;
+
+namespace {
+
+    struct Reference final {
+        std::string out;
+        bool escaped = false;
+    };
+
+    // AssetPathResolver が以前やっていた手順そのまま
+    Reference OldJoin(std::string_view root, std::string_view rel, bool sep, bool squash) {
+        const std::string p = Path::NormalizeSlashes(rel, sep, squash);
+        std::string joined = Path::JoinRootAndRelative(root, p);
+        joined = Path::NormalizeSlashes(joined, sep, squash);
+        Reference r;
+        r.out = Path::RemoveDotSegments(joined, r.escaped);
+        return r;
+    }
+
+    Reference OldNormalize(std::string_view path, bool sep, bool squash) {
+        Reference r;
+        r.out = Path::RemoveDotSegments(Path::NormalizeSlashes(path, sep, squash), r.escaped);
+        return r;
+    }
+
+    // 区切り / ドット / drive が混ざりやすい文字だけで作る
+    std::string RandomPath(std::uint64_t& state, std::size_t maxLen) {
+        static constexpr std::string_view kAlphabet = "ab./\\:C..//";
+        auto next = [&]() {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            return static_cast<std::uint32_t>(state >> 33);
+        };
+        const std::size_t len = next() % (maxLen + 1);
+        std::string s;
+        for (std::size_t i = 0; i < len; ++i) s.push_back(kAlphabet[next() % kAlphabet.size()]);
+        return s;
+    }
+
+} // namespace
+
+TEST_CASE("PathUtils: fused normalize matches the NormalizeSlashes/Join/RemoveDotSegments chain") {
+    static constexpr std::string_view kRoots[] = {
+        "", "assets", "assets/", "game\\data", "C:", "C:\\game\\assets", "/abs/root", "//server/share", "\\\\srv\\x", "a/../b",
+    };
+
+    std::uint64_t state = 42;
+    std::string out;
+    for (int iter = 0; iter < 4000; ++iter) {
+        // 短いものは端の形、長いものは 16 byte 単位の走査を通す
+        const std::string rel = RandomPath(state, (iter % 4 == 0) ? 48 : 8);
+        for (int flags = 0; flags < 4; ++flags) {
+            const bool sep = (flags & 1) != 0;
+            const bool squash = (flags & 2) != 0;
+
+            CHECK(Path::IsAbsolutePathLikeRaw(rel, sep) ==
+                  Path::IsAbsolutePathLike(Path::NormalizeSlashes(rel, sep, squash)));
+
+            const Reference a = OldNormalize(rel, sep, squash);
+            const bool aEscaped = Path::NormalizeInto(out, rel, sep, squash);
+            CHECK_MESSAGE(out == a.out, rel);
+            CHECK(aEscaped == a.escaped);
+
+            for (std::string_view root : kRoots) {
+                const Reference j = OldJoin(root, rel, sep, squash);
+                const bool jEscaped = Path::NormalizeJoinInto(out, root, rel, sep, squash);
+                CHECK_MESSAGE(out == j.out, std::string(root) + " + " + rel);
+                CHECK(jEscaped == j.escaped);
+            }
+        }
+    }
+}
+
+TEST_CASE("PathUtils: fused normalize resolves long paths and detects escape") {
+    std::string out;
+    const std::string deep = "textures/characters/hero/../villain/./diffuse_albedo_4k.png";
+    CHECK_FALSE(Path::NormalizeJoinInto(out, "assets", deep));
+    CHECK(out == "assets/textures/characters/villain/diffuse_albedo_4k.png");
+
+    CHECK_FALSE(Path::NormalizeJoinInto(out, "assets", "textures\\\\ui//icons\\a.png"));
+    CHECK(out == "assets/textures/ui/icons/a.png");
+
+    // root 自体まで戻るのは外に出たとは見なさない（RemoveDotSegments と同じ）
+    CHECK_FALSE(Path::NormalizeJoinInto(out, "assets", "../x.png"));
+    CHECK(out == "x.png");
+    CHECK(Path::NormalizeJoinInto(out, "assets", "../../x.png"));
+    CHECK(out == "x.png");
+
+    CHECK_FALSE(Path::NormalizeInto(out, "C:\\game\\..\\assets\\a.png"));
+    CHECK(out == "C:/assets/a.png");
+}
@@ -0,0 +1,195 @@
+#include "doctest/doctest.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "engine/io/helpers/ReadAllBytes.hpp"
+#include "engine/io/helpers/ReadAllText.hpp"
+#include "engine/io/fs/MemoryFileSystem.hpp"
+#include "engine/io/path/Uri.hpp"
+#include "engine/io/stream/MemoryStream.hpp"
+#include "engine/io/stream/ReadToEnd.hpp"
+#include "engine/io/stream/StreamReader.hpp"
+
+using Engine::IO::IoErrorCode;
+using Engine::IO::Stream::IoResult;
+using Engine::IO::Stream::IoResultVoid;
+using Engine::IO::Stream::IStream;
+using Engine::IO::Stream::MemoryStream;
+using Engine::IO::Stream::ReadToEnd;
+using Engine::IO::Stream::ReadToEndOptions;
+using Engine::IO::Stream::SeekWhence;
+using Engine::IO::Stream::StreamCaps;
+using Engine::IO::Stream::StreamReader;
+
+namespace {
+
+    std::vector<std::byte> MakeBytes(std::size_t size) {
+        std::vector<std::byte> v(size);
+        std::uint32_t x = 4242;
+        for (auto& b : v) {
+            x = x * 1103515245u + 12345u;
+            b = static_cast<std::byte>(x >> 16);
+        }
+        return v;
+    }
+
+    // Size() を返さず、Read 毎に読み先のアドレスを覚える（pipe / network 相当）
+    class UnsizedStream final : public IStream {
+    public:
+        explicit UnsizedStream(std::vector<std::byte> data, std::size_t maxPerRead = 1u << 20)
+            : inner_(std::move(data), MemoryStream::Options{}), maxPerRead_(maxPerRead) {}
+
+        StreamCaps Caps() const noexcept override {
+            StreamCaps c = inner_.Caps();
+            c.seekable = false;
+            return c;
+        }
+        bool IsOpen() const noexcept override { return inner_.IsOpen(); }
+        bool IsEof() const noexcept override { return inner_.IsEof(); }
+
+        IoResult<std::size_t> Read(void* dst, std::size_t bytes) override {
+            ++reads;
+            targets.push_back(dst);
+            return inner_.Read(dst, bytes < maxPerRead_ ? bytes : maxPerRead_);
+        }
+        IoResult<std::size_t> Write(const void* src, std::size_t bytes) override { return inner_.Write(src, bytes); }
+
+        IoResult<std::uint64_t> Tell() const override { return inner_.Tell(); }
+        IoResult<std::uint64_t> Seek(std::int64_t offset, SeekWhence whence) override {
+            return inner_.Seek(offset, whence);
+        }
+        IoResult<std::uint64_t> Size() const override {
+            return IoResult<std::uint64_t>::Err(
+                Engine::IO::Stream::IoError::Make(IoErrorCode::NotSupported, "UnsizedStream: Size"));
+        }
+        IoResultVoid Flush() override { return inner_.Flush(); }
+        IoResultVoid Close() override { return inner_.Close(); }
+
+        std::size_t reads = 0;
+        std::vector<void*> targets;
+
+    private:
+        MemoryStream inner_;
+        std::size_t maxPerRead_;
+    };
+
+} // namespace
+
+TEST_CASE("ReadToEnd: known size reads straight into the destination") {
+    const auto src = MakeBytes(300000);
+    MemoryStream ms(src, MemoryStream::Options{});
+
+    // 先頭を少し読んでおく（残りだけ読む）
+    std::byte head[100];
+    REQUIRE(ms.Read(head, sizeof(head)));
+
+    std::vector<std::byte> out;
+    REQUIRE(ReadToEnd(ms, out));
+    REQUIRE(out.size() == src.size() - 100);
+    CHECK(std::memcmp(out.data(), src.data() + 100, out.size()) == 0);
+    // 確保は 1 回（残りぴったり）
+    CHECK(out.capacity() == src.size() - 100);
+}
+
+TEST_CASE("ReadToEnd: unknown size grows geometrically and reads in place") {
+    const auto src = MakeBytes(1000000);
+    UnsizedStream us(src);
+
+    ReadToEndOptions opt{};
+    opt.chunkBytes = 4096;
+    std::string out;
+    REQUIRE(ReadToEnd(us, out, opt));
+    REQUIRE(out.size() == src.size());
+    CHECK(std::memcmp(out.data(), src.data(), src.size()) == 0);
+
+    // 4KB から倍々：1MB まで 10 回前後（chunk 毎に伸ばすと 245 回）
+    CHECK(us.reads < 24);
+}
+
+TEST_CASE("ReadToEnd: maxBytes is enforced with and without size hint") {
+    const auto src = MakeBytes(5000);
+
+    ReadToEndOptions opt{};
+    opt.maxBytes = 4999;
+    {
+        MemoryStream ms(src, MemoryStream::Options{});
+        std::vector<std::byte> out;
+        auto r = ReadToEnd(ms, out, opt);
+        REQUIRE_FALSE(r);
+        CHECK(r.error().code == IoErrorCode::ReadFailed);
+    }
+    {
+        UnsizedStream us(src, 700);
+        std::vector<std::byte> out;
+        opt.chunkBytes = 1024;
+        auto r = ReadToEnd(us, out, opt);
+        REQUIRE_FALSE(r);
+        CHECK(r.error().code == IoErrorCode::ReadFailed);
+        CHECK(out.empty());
+    }
+    {
+        // ちょうど上限なら通る
+        UnsizedStream us(src, 700);
+        std::vector<std::byte> out;
+        opt.maxBytes = 5000;
+        REQUIRE(ReadToEnd(us, out, opt));
+        CHECK(out.size() == 5000);
+    }
+}
+
+TEST_CASE("ReadAll helpers: text is read into the string and chunks can be visited") {
+    Engine::IO::FS::MemoryFileSystem fs;
+    auto uri = Engine::IO::Path::ParseUri("memory://docs/big.txt");
+    REQUIRE(uri);
+
+    std::string text = "\xEF\xBB\xBFhello";
+    text.append(200000, 'x');
+    std::vector<std::byte> blob(text.size());
+    std::memcpy(blob.data(), text.data(), text.size());
+    REQUIRE(fs.Put("docs/big.txt", std::move(blob)));
+
+    auto tr = Engine::IO::Helpers::ReadAllTextUtf8(fs, uri.value());
+    REQUIRE(tr);
+    CHECK(tr.value().size() == text.size() - 3);
+    CHECK(tr.value().compare(0, 5, "hello") == 0);
+
+    Engine::IO::Helpers::ReadAllOptions opt{};
+    opt.chunkBytes = 4096;
+    std::size_t calls = 0;
+    std::size_t xs = 0;
+    auto cr = Engine::IO::Helpers::ReadAllChunks(fs, uri.value(), [&](Engine::Base::ConstSpan<std::byte> chunk) {
+        ++calls;
+        CHECK(chunk.size() <= 4096);
+        for (std::byte b : chunk) xs += (b == std::byte{'x'}) ? 1 : 0;
+        return true;
+    }, opt);
+    REQUIRE(cr);
+    CHECK(cr.value() == text.size());
+    CHECK(xs == 200000);
+    CHECK(calls == (text.size() + 4095) / 4096);
+
+    // false で打ち切り
+    calls = 0;
+    auto stop = Engine::IO::Helpers::ReadAllChunks(fs, uri.value(), [&](Engine::Base::ConstSpan<std::byte>) {
+        return ++calls < 3;
+    }, opt);
+    REQUIRE(stop);
+    CHECK(calls == 3);
+    CHECK(stop.value() == 3u * 4096u);
+}
+
+TEST_CASE("StreamReader: ReadAllText normalizes newlines in place") {
+    const std::string text = "\xEF\xBB\xBF" "a\r\nb\rc\n";
+    std::vector<std::byte> bytes(text.size());
+    std::memcpy(bytes.data(), text.data(), text.size());
+    MemoryStream ms(std::move(bytes), MemoryStream::Options{});
+
+    StreamReader r(ms);
+    Engine::IO::Stream::TextReadOptions opt{};
+    opt.normalizeNewlines = true;
+    auto tr = r.ReadAllText(opt);
+    REQUIRE(tr);
+    CHECK(tr.value() == "a\nb\nc\n");
+}
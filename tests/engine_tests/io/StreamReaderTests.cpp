@@ -0,0 +1,204 @@
+#include "doctest/doctest.h"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "engine/io/stream/ByteOrder.hpp"
+#include "engine/io/stream/MemoryStream.hpp"
+#include "engine/io/stream/StreamReader.hpp"
+
+using Engine::IO::IoErrorCode;
+using Engine::IO::Stream::ByteSwap;
+using Engine::IO::Stream::ByteSwapInPlace;
+using Engine::IO::Stream::IoResult;
+using Engine::IO::Stream::IoResultVoid;
+using Engine::IO::Stream::IStream;
+using Engine::IO::Stream::MemoryStream;
+using Engine::IO::Stream::SeekWhence;
+using Engine::IO::Stream::StreamCaps;
+using Engine::IO::Stream::StreamReader;
+
+namespace {
+
+    struct Record final {
+        std::uint32_t id;
+        std::uint16_t kind;
+        std::uint8_t flags;
+        std::uint8_t pad;
+        std::uint64_t offset;
+    };
+
+} // namespace
+
+template<>
+struct Engine::IO::Stream::StructLayout<Record> {
+    static constexpr std::array<std::uint8_t, 5> kFieldBytes{ 4, 2, 1, 1, 8 };
+};
+
+namespace {
+
+    // Read の回数を数える
+    class CountingStream final : public IStream {
+    public:
+        explicit CountingStream(std::vector<std::byte> data) : inner_(std::move(data), MemoryStream::Options{}) {}
+
+        StreamCaps Caps() const noexcept override { return inner_.Caps(); }
+        bool IsOpen() const noexcept override { return inner_.IsOpen(); }
+        bool IsEof() const noexcept override { return inner_.IsEof(); }
+        IoResult<std::size_t> Read(void* dst, std::size_t bytes) override {
+            ++reads;
+            return inner_.Read(dst, bytes);
+        }
+        IoResult<std::size_t> Write(const void* src, std::size_t bytes) override { return inner_.Write(src, bytes); }
+        IoResult<std::uint64_t> Tell() const override { return inner_.Tell(); }
+        IoResult<std::uint64_t> Seek(std::int64_t offset, SeekWhence whence) override {
+            return inner_.Seek(offset, whence);
+        }
+        IoResult<std::uint64_t> Size() const override { return inner_.Size(); }
+        IoResultVoid Flush() override { return inner_.Flush(); }
+        IoResultVoid Close() override { return inner_.Close(); }
+
+        std::size_t reads = 0;
+
+    private:
+        MemoryStream inner_;
+    };
+
+    void PutLE(std::vector<std::byte>& out, std::uint64_t v, int bytes) {
+        for (int i = 0; i < bytes; ++i) out.push_back(static_cast<std::byte>(v >> (8 * i)));
+    }
+    void PutBE(std::vector<std::byte>& out, std::uint64_t v, int bytes) {
+        for (int i = bytes - 1; i >= 0; --i) out.push_back(static_cast<std::byte>(v >> (8 * i)));
+    }
+
+} // namespace
+
+TEST_CASE("StreamReader: scalar fields decode from the internal buffer") {
+    std::vector<std::byte> bytes;
+    for (std::uint32_t i = 0; i < 10000; ++i) {
+        PutLE(bytes, i, 4);
+        PutBE(bytes, i * 3u, 2);
+    }
+    CountingStream cs(bytes);
+    StreamReader r(cs);
+
+    bool ok = true;
+    for (std::uint32_t i = 0; i < 10000; ++i) {
+        auto a = r.ReadU32LE();
+        auto b = r.ReadU16BE();
+        ok = ok && a && b && a.value() == i && b.value() == static_cast<std::uint16_t>(i * 3u);
+    }
+    CHECK(ok);
+    // 60000 byte / 4096 byte バッファ：フィールド毎には読まない
+    CHECK(cs.reads < 20);
+
+    auto eof = r.ReadU8();
+    REQUIRE_FALSE(eof);
+    CHECK(eof.error().code == IoErrorCode::EndOfStream);
+}
+
+TEST_CASE("StreamReader: array reads convert byte order in bulk") {
+    std::vector<std::byte> bytes;
+    for (std::uint32_t i = 0; i < 1001; ++i) PutLE(bytes, 0x01020304u + i, 4);
+    for (std::uint64_t i = 0; i < 37; ++i) PutBE(bytes, 0x0102030405060708ull * (i + 1), 8);
+    for (std::uint16_t i = 0; i < 19; ++i) PutBE(bytes, static_cast<std::uint16_t>(0xA1B2u + i), 2);
+
+    CountingStream cs(bytes);
+    StreamReader r(cs);
+
+    std::vector<std::uint32_t> a(1001);
+    std::vector<std::uint64_t> b(37);
+    std::vector<std::uint16_t> c(19);
+    REQUIRE(r.ReadArrayLE(Engine::Base::Span<std::uint32_t>(a)));
+    REQUIRE(r.ReadArrayBE(Engine::Base::Span<std::uint64_t>(b)));
+    REQUIRE(r.ReadArrayBE(Engine::Base::Span<std::uint16_t>(c)));
+
+    bool ok = true;
+    for (std::uint32_t i = 0; i < a.size(); ++i) ok = ok && a[i] == 0x01020304u + i;
+    for (std::uint64_t i = 0; i < b.size(); ++i) ok = ok && b[i] == 0x0102030405060708ull * (i + 1);
+    for (std::uint16_t i = 0; i < c.size(); ++i) ok = ok && c[i] == static_cast<std::uint16_t>(0xA1B2u + i);
+    CHECK(ok);
+    // 4004 byte の配列は 1 回で読む
+    CHECK(cs.reads <= 4);
+}
+
+TEST_CASE("ByteOrder: bulk swap matches scalar swap for every tail length") {
+    for (std::size_t n = 0; n < 40; ++n) {
+        std::vector<std::uint16_t> s16(n);
+        std::vector<std::uint32_t> s32(n);
+        std::vector<std::uint64_t> s64(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            s16[i] = static_cast<std::uint16_t>(0x1234u + i * 257u);
+            s32[i] = 0x89ABCDEFu ^ static_cast<std::uint32_t>(i * 0x01010101u);
+            s64[i] = 0x0123456789ABCDEFull + i * 0x0101010101010101ull;
+        }
+        auto e16 = s16;
+        auto e32 = s32;
+        auto e64 = s64;
+        for (auto& v : e16) v = ByteSwap(v);
+        for (auto& v : e32) v = ByteSwap(v);
+        for (auto& v : e64) v = ByteSwap(v);
+
+        ByteSwapInPlace(s16.data(), n, 2);
+        ByteSwapInPlace(s32.data(), n, 4);
+        ByteSwapInPlace(s64.data(), n, 8);
+        CHECK(s16 == e16);
+        CHECK(s32 == e32);
+        CHECK(s64 == e64);
+    }
+    CHECK(ByteSwap(std::uint32_t{ 0x11223344u }) == 0x44332211u);
+}
+
+TEST_CASE("StreamReader: ReadStructs swaps fields by declared layout") {
+    std::vector<std::byte> bytes;
+    for (std::uint32_t i = 0; i < 3; ++i) {
+        PutBE(bytes, 100 + i, 4);
+        PutBE(bytes, 7, 2);
+        PutBE(bytes, 0x80 | i, 1);
+        PutBE(bytes, 0, 1);
+        PutBE(bytes, 0x1000ull << i, 8);
+    }
+    MemoryStream ms(bytes, MemoryStream::Options{});
+    StreamReader r(ms);
+
+    std::array<Record, 3> recs{};
+    REQUIRE(r.ReadStructs(Engine::Base::Span<Record>(recs.data(), recs.size()), std::endian::big));
+    for (std::uint32_t i = 0; i < 3; ++i) {
+        CHECK(recs[i].id == 100 + i);
+        CHECK(recs[i].kind == 7);
+        CHECK(recs[i].flags == (0x80 | i));
+        CHECK(recs[i].offset == (0x1000ull << i));
+    }
+}
+
+TEST_CASE("StreamReader: ReadLine and binary reads share the buffer") {
+    std::string text = "magic\n";
+    std::vector<std::byte> bytes(text.size());
+    std::memcpy(bytes.data(), text.data(), text.size());
+    PutLE(bytes, 0xCAFEBABEu, 4);
+    for (int i = 0; i < 9000; ++i) bytes.push_back(static_cast<std::byte>(i));
+
+    MemoryStream ms(bytes, MemoryStream::Options{});
+    StreamReader r(ms);
+
+    std::string line;
+    REQUIRE(r.ReadLine(line));
+    CHECK(line == "magic");
+    auto v = r.ReadU32LE();
+    REQUIRE(v);
+    CHECK(v.value() == 0xCAFEBABEu);
+
+    // バッファより大きい読みは残りを直接
+    std::vector<std::byte> big(8000);
+    REQUIRE(r.ReadExactly(big.data(), big.size()));
+    CHECK(big[4999] == static_cast<std::byte>(4999 & 0xFF));
+
+    auto rest = r.ReadAllBytes();
+    REQUIRE(rest);
+    REQUIRE(rest.value().size() == 1000);
+    CHECK(rest.value()[0] == static_cast<std::byte>(8000 & 0xFF));
+}
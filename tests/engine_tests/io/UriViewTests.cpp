@@ -0,0 +1,85 @@
+#include "doctest/doctest.h"
+
+#include <string>
+
+#include "engine/io/fs/MemoryFileSystem.hpp"
+#include "engine/io/fs/Vfs.hpp"
+#include "engine/io/path/Uri.hpp"
+#include "engine/io/path/UriView.hpp"
+
+using Engine::IO::IoErrorCode;
+using Engine::IO::Path::ParseUri;
+using Engine::IO::Path::ParseUriView;
+using Engine::IO::Path::ParseUriViewLoose;
+using Engine::IO::Path::Uri;
+using Engine::IO::Path::UriScheme;
+using Engine::IO::Path::UriView;
+
+TEST_CASE("UriView: strict parse splits like ParseUri without copying") {
+    const std::string text = "assets://textures/ui/a.png?lod=1#frag";
+    auto r = ParseUriView(text);
+    REQUIRE(r);
+    const UriView v = r.value();
+
+    CHECK(v.scheme == UriScheme::Unknown);
+    CHECK(v.SchemeName() == "assets");
+    CHECK(v.authority == "textures");
+    CHECK(v.path == "ui/a.png");
+    CHECK(v.query == "lod=1");
+    CHECK(v.fragment == "frag");
+    // 元の文字列を指している
+    CHECK(v.path.data() == text.data() + text.find("ui/"));
+
+    // ParseUri と同じ形に戻る
+    const Uri owned = ParseUri(text).value();
+    CHECK(v.ToString() == owned.ToString());
+    CHECK(v.ToUri().ToString() == owned.ToString());
+    CHECK(UriView(owned).ToString() == owned.ToString());
+
+    // 既知 scheme は大文字小文字を区別しない
+    auto f = ParseUriView("FILE:///C:/work/a.txt");
+    REQUIRE(f);
+    CHECK(f.value().scheme == UriScheme::File);
+    CHECK(f.value().SchemeName() == "file");
+    CHECK(f.value().path == "C:/work/a.txt");
+
+    auto plain = ParseUriView("textures/a.png");
+    REQUIRE(plain);
+    CHECK_FALSE(plain.value().HasScheme());
+    CHECK(plain.value().path == "textures/a.png");
+}
+
+TEST_CASE("UriView: strict parse rejects paths that ParseUri would rewrite or refuse") {
+    CHECK(ParseUriView("").error().code == IoErrorCode::InvalidPath);
+    CHECK_FALSE(ParseUriView("assets://a/../b"));
+    CHECK_FALSE(ParseUriView("assets://a//b"));
+    CHECK_FALSE(ParseUriView("assets://a/./b"));
+    CHECK_FALSE(ParseUriView("assets://a/b/"));
+    CHECK_FALSE(ParseUriView("assets://a/b\\c"));
+    CHECK_FALSE(ParseUriView("/etc/passwd"));
+    CHECK_FALSE(ParseUriView(std::string("a/b\0c", 5)));
+}
+
+TEST_CASE("UriView: loose parse keeps unknown scheme names and routes through Vfs") {
+    const UriView v = ParseUriViewLoose("assets:///textures/a.png");
+    CHECK(v.SchemeName() == "assets");
+    CHECK(v.authority.empty());
+    CHECK(v.path == "textures/a.png");
+    CHECK(ParseUriViewLoose("textures/a.png").path == "textures/a.png");
+
+    auto mem = std::make_shared<Engine::IO::FS::MemoryFileSystem>();
+    REQUIRE(mem->Put("root/textures/a.png", std::vector<std::byte>(3)));
+
+    Engine::IO::FS::Vfs vfs;
+    Engine::IO::FS::MountPoint mp;
+    mp.name = "ram";
+    mp.mountUri = ParseUri("assets://").value();
+    mp.rootUri = ParseUri("memory://root").value();
+    mp.fs = mem;
+    REQUIRE(vfs.Mount(std::move(mp)));
+
+    CHECK(vfs.Stat(v).value().sizeBytes == 3);
+    CHECK(vfs.Stat(ParseUriView("assets://textures/a.png").value()).value().sizeBytes == 3);
+    CHECK(vfs.Open(v, Engine::IO::Stream::OpenReadBinary()));
+    CHECK_FALSE(vfs.Exists(ParseUriViewLoose("other://textures/a.png")).value());
+}
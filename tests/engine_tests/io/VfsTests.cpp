@@ -0,0 +1,334 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/io/fs/MemoryFileSystem.hpp"
+#include "engine/io/fs/Vfs.hpp"
+#include "engine/io/path/Uri.hpp"
+
+using Engine::Base::SharedBuffer;
+using Engine::IO::IoErrorCode;
+using Engine::IO::FS::DirectoryEntry;
+using Engine::IO::FS::DirectoryIterator;
+using Engine::IO::FS::FileChangeEvent;
+using Engine::IO::FS::FileChangeKind;
+using Engine::IO::FS::FileInfo;
+using Engine::IO::FS::FileSystemCapabilities;
+using Engine::IO::FS::IFileSystem;
+using Engine::IO::FS::IFileWatcher;
+using Engine::IO::FS::IoResult;
+using Engine::IO::FS::IoResultVoid;
+using Engine::IO::FS::ListOptions;
+using Engine::IO::FS::MemoryFileSystem;
+using Engine::IO::FS::MountPoint;
+using Engine::IO::FS::RemoveOptions;
+using Engine::IO::FS::Vfs;
+using Engine::IO::Path::ParseUri;
+using Engine::IO::Path::Uri;
+using Engine::IO::Stream::FileOpenMode;
+using Engine::IO::Stream::IStream;
+
+namespace {
+
+    SharedBuffer Bytes(const std::string& s) {
+        return SharedBuffer::Copy({ reinterpret_cast<const std::byte*>(s.data()), s.size() });
+    }
+
+    // 下位 FS への問い合わせ回数を数える（中身は MemoryFileSystem）
+    class CountingFs final : public IFileSystem {
+    public:
+        MemoryFileSystem mem;
+        int calls = 0;
+
+        const char* Name() const noexcept override { return "CountingFS"; }
+
+        IoResult<std::unique_ptr<IStream>> Open(const Uri& uri, FileOpenMode mode) override { ++calls; return mem.Open(uri, mode); }
+        IoResult<bool> Exists(const Uri& uri) override { ++calls; return mem.Exists(uri); }
+        IoResult<FileInfo> Stat(const Uri& uri) override { ++calls; return mem.Stat(uri); }
+
+        IoResultVoid CreateDirectories(const Uri& uri) override { return mem.CreateDirectories(uri); }
+        IoResultVoid Remove(const Uri& uri, const RemoveOptions& opt = {}) override { return mem.Remove(uri, opt); }
+        IoResultVoid Move(const Uri& from, const Uri& to) override { return mem.Move(from, to); }
+        IoResultVoid Copy(const Uri& from, const Uri& to) override { return mem.Copy(from, to); }
+        IoResult<std::vector<DirectoryEntry>> List(const Uri& uri, const ListOptions& opt = {}) override { return mem.List(uri, opt); }
+        IoResult<std::string> ToNativePathString(const Uri& uri) override { return mem.ToNativePathString(uri); }
+        FileSystemCapabilities Capabilities() const noexcept override { return mem.Capabilities(); }
+        IoResult<std::unique_ptr<DirectoryIterator>> Iterate(const Uri& uri, const ListOptions& opt = {}) override { return mem.Iterate(uri, opt); }
+        IoResult<std::unique_ptr<IFileWatcher>> CreateWatcher() override { return mem.CreateWatcher(); }
+    };
+
+    struct Overlay {
+        Vfs vfs;
+        std::vector<std::shared_ptr<CountingFs>> layers; // [0] が最優先
+
+        explicit Overlay(int n) {
+            for (int i = 0; i < n; ++i) {
+                auto fs = std::make_shared<CountingFs>();
+                MountPoint mp;
+                mp.name = "layer" + std::to_string(i);
+                mp.priority = n - i;
+                mp.mountUri = ParseUri("assets://").value();
+                mp.rootUri = ParseUri("memory://root").value();
+                mp.fs = fs;
+                REQUIRE(vfs.Mount(std::move(mp)));
+                layers.push_back(std::move(fs));
+            }
+        }
+
+        int Calls() const {
+            int c = 0;
+            for (const auto& l : layers) c += l->calls;
+            return c;
+        }
+    };
+
+} // namespace
+
+TEST_CASE("Vfs: lookup cache resolves repeated opens to the winning mount") {
+    Overlay o(10);
+    REQUIRE(o.layers[9]->mem.Put("root/base.txt", Bytes("base")));
+
+    const Uri uri = ParseUri("assets://base.txt").value();
+
+    // 初回は 10 mount を上から試す
+    REQUIRE(o.vfs.Open(uri, Engine::IO::Stream::OpenReadBinary()));
+    CHECK(o.Calls() == 10);
+
+    // 2 回目以降は勝った mount だけ
+    REQUIRE(o.vfs.Open(uri, Engine::IO::Stream::OpenReadBinary()));
+    CHECK(o.Calls() == 11);
+    CHECK(o.vfs.Stat(uri).value().sizeBytes == 4);
+    CHECK(o.Calls() == 12);
+    CHECK(o.vfs.Exists(uri).value());
+    CHECK(o.Calls() == 12);
+
+    // negative entry
+    const Uri missing = ParseUri("assets://missing.txt").value();
+    CHECK_FALSE(o.vfs.Exists(missing).value());
+    const int afterMiss = o.Calls();
+    CHECK(o.vfs.Open(missing, Engine::IO::Stream::OpenReadBinary()).error().code == IoErrorCode::NotFound);
+    CHECK_FALSE(o.vfs.Stat(missing));
+    CHECK(o.Calls() == afterMiss);
+
+    const auto stats = o.vfs.LookupCache().GetStats();
+    CHECK(stats.hits == 3);
+    CHECK(stats.negativeHits == 2);
+}
+
+TEST_CASE("Vfs: lookup cache is invalidated by mount changes, writes and watcher events") {
+    Overlay o(3);
+    REQUIRE(o.layers[2]->mem.Put("root/a.txt", Bytes("low")));
+    const Uri uri = ParseUri("assets://a.txt").value();
+    REQUIRE(o.vfs.Stat(uri));
+
+    // Vfs を通さずに上位 layer へ置いた → watcher のイベントで知らせる
+    REQUIRE(o.layers[0]->mem.Put("root/a.txt", Bytes("high!")));
+    CHECK(o.vfs.Stat(uri).value().sizeBytes == 3); // まだ古い解決
+    FileChangeEvent ev;
+    ev.kind = FileChangeKind::Created;
+    o.vfs.ApplyChanges({ ev });
+    CHECK(o.vfs.Stat(uri).value().sizeBytes == 5);
+
+    // 消えていたら全候補を見直す
+    REQUIRE(o.layers[0]->mem.Remove(ParseUri("memory://root/a.txt").value()));
+    CHECK(o.vfs.Stat(uri).value().sizeBytes == 3);
+
+    // negative entry は Vfs 経由の書き込みで消える
+    const Uri fresh = ParseUri("assets://fresh.txt").value();
+    CHECK_FALSE(o.vfs.Exists(fresh).value());
+    {
+        auto w = o.vfs.Open(fresh, Engine::IO::Stream::OpenWriteBinaryTruncate(true));
+        REQUIRE(w);
+    }
+    CHECK(o.vfs.Exists(fresh).value());
+
+    // mount の追加で丸ごと捨てる
+    CHECK(o.vfs.LookupCache().Size() > 0);
+    REQUIRE(o.vfs.Unmount("layer0"));
+    CHECK(o.vfs.Stat(uri).value().sizeBytes == 3);
+    CHECK(o.vfs.LookupCache().GetStats().invalidations >= 2);
+}
+
+TEST_CASE("MountTable: scheme index keeps priority order and renders native URIs") {
+    using Engine::IO::FS::MountTable;
+    using Engine::IO::Path::ParseUriLoose;
+
+    auto fs = std::make_shared<CountingFs>();
+    auto mount = [&](const char* name, int prio, const char* at, const char* root) {
+        MountPoint mp;
+        mp.name = name;
+        mp.priority = prio;
+        mp.mountUri = ParseUri(at).value();
+        mp.rootUri = ParseUri(root).value();
+        mp.fs = fs;
+        return mp;
+    };
+
+    MountTable t;
+    REQUIRE(t.Mount(mount("base", 0, "assets://", "memory://base")));
+    REQUIRE(t.Mount(mount("user", 0, "user://", "memory://save/")));
+    REQUIRE(t.Mount(mount("mod", 10, "assets://", "file://mods")));
+    REQUIRE(t.Mount(mount("plain", 5, "asset://", "memory://plain")));
+
+    const Uri tex = ParseUri("assets://textures/a.png").value();
+    const auto& c = t.Candidates(tex);
+    REQUIRE(c.size() == 2);
+    CHECK(c[0]->name == "mod");
+    CHECK(c[1]->name == "base");
+    CHECK(&t.Candidates(tex) == &c); // 毎回同じ索引を返す
+
+    CHECK(t.Candidates(ParseUri("user://slot1.sav").value()).size() == 1);
+    CHECK(t.Candidates(ParseUri("asset://x").value()).front()->name == "plain");
+    CHECK(t.Candidates(ParseUri("other://x").value()).empty());
+    CHECK(t.Candidates(ParseUriLoose("textures/a.png")).empty());
+
+    CHECK(t.Resolve(*c[1], tex).value().nativeUri.path.Str() == "base/textures/a.png");
+    CHECK(t.Resolve(*t.Candidates(ParseUri("user://slot1.sav").value()).front(),
+                    ParseUri("user://slot1.sav").value()).value().nativeUri.path.Str() == "save/slot1.sav");
+
+    // コピーは自分の mounts を指す索引を持つ
+    MountTable copy = t;
+    REQUIRE(t.Unmount("mod"));
+    CHECK(t.Candidates(tex).size() == 1);
+    const auto& cc = copy.Candidates(tex);
+    REQUIRE(cc.size() == 2);
+    CHECK(cc[0] == &copy.All()[0]);
+    CHECK(copy.Resolve(*cc[0], tex).value().nativeUri.path.Str() == "mods/textures/a.png");
+}
+
+TEST_CASE("Vfs: directory index merges overlays and follows mounts and watcher events") {
+    using Engine::IO::FS::WatchOptions;
+    using Engine::IO::Path::ParseUriLoose;
+
+    Overlay o(2);
+    REQUIRE(o.layers[1]->mem.Put("root/textures/a.png", Bytes("base-a")));
+    REQUIRE(o.layers[1]->mem.Put("root/textures/b.png", Bytes("base-b")));
+    REQUIRE(o.layers[1]->mem.Put("root/readme.txt", Bytes("R")));
+    REQUIRE(o.layers[0]->mem.Put("root/textures/a.png", Bytes("mod-a!")));
+    REQUIRE(o.layers[0]->mem.Put("root/mod/extra.bin", Bytes("X")));
+
+    REQUIRE(o.vfs.EnableDirectoryIndex());
+    const auto& index = o.vfs.DirectoryIndex();
+
+    auto rec = index.Find(ParseUri("assets://textures/a.png").value());
+    REQUIRE(rec);
+    CHECK(rec->mount == "layer0");
+    CHECK(rec->sizeBytes == 6);
+    CHECK(index.Find(ParseUri("assets://textures/b.png").value())->mount == "layer1");
+    CHECK(index.GetStats().files == 4);
+    CHECK(index.GetStats().directories == 2);
+
+    // List / Exists は下位 FS に触らない
+    const int before = o.Calls();
+    ListOptions all;
+    all.recursive = true;
+    all.includeInfo = true;
+    auto lr = o.vfs.List(ParseUri("assets://").value(), all);
+    REQUIRE(lr);
+    std::vector<std::string> paths;
+    for (const auto& e : lr.value()) paths.push_back(e.path);
+    CHECK(paths == std::vector<std::string>{ "assets://mod", "assets://mod/extra.bin", "assets://readme.txt",
+                                             "assets://textures", "assets://textures/a.png", "assets://textures/b.png" });
+    CHECK(o.vfs.Exists(ParseUri("assets://mod/extra.bin").value()).value());
+    CHECK_FALSE(o.vfs.Exists(ParseUri("assets://mod/none.bin").value()).value());
+    CHECK(o.Calls() == before);
+
+    auto sub = o.vfs.List(ParseUri("assets://textures").value());
+    REQUIRE(sub);
+    CHECK(sub.value().size() == 2);
+    CHECK(o.vfs.List(ParseUri("assets://readme.txt").value()).error().code == IoErrorCode::NotFound);
+
+    // 上位 layer の変更を watcher で拾う
+    auto wr = o.layers[0]->mem.CreateWatcher();
+    REQUIRE(wr);
+    WatchOptions wopt;
+    wopt.recursive = true;
+    REQUIRE(wr.value()->AddWatch(ParseUriLoose("root"), wopt));
+
+    REQUIRE(o.layers[0]->mem.Put("root/textures/c.png", Bytes("new")));
+    REQUIRE(o.layers[0]->mem.Remove(ParseUriLoose("root/textures/a.png")));
+    std::vector<FileChangeEvent> evs;
+    REQUIRE(wr.value()->Poll(evs));
+    o.vfs.ApplyChanges(evs);
+
+    CHECK(index.Find(ParseUri("assets://textures/c.png").value())->mount == "layer0");
+    rec = index.Find(ParseUri("assets://textures/a.png").value());
+    REQUIRE(rec);
+    CHECK(rec->mount == "layer1"); // 下の layer が見えるようになる
+    CHECK(rec->sizeBytes == 6);
+
+    // mount の追加はその mount だけを列挙してマージ
+    auto top = std::make_shared<CountingFs>();
+    REQUIRE(top->mem.Put("patch/readme.txt", Bytes("patched")));
+    REQUIRE(top->mem.Put("patch/mod", Bytes("file shadows dir")));
+    MountPoint mp;
+    mp.name = "patch";
+    mp.priority = 100;
+    mp.mountUri = ParseUri("assets://").value();
+    mp.rootUri = ParseUri("memory://patch").value();
+    mp.fs = top;
+    REQUIRE(o.vfs.Mount(std::move(mp)));
+    CHECK(index.Find(ParseUri("assets://readme.txt").value())->mount == "patch");
+    CHECK(index.Find(ParseUri("assets://mod").value())->type == Engine::IO::FS::FileType::Regular);
+    CHECK_FALSE(o.vfs.Exists(ParseUri("assets://mod/extra.bin").value()).value());
+
+    REQUIRE(o.vfs.Unmount("patch"));
+    CHECK(index.Find(ParseUri("assets://readme.txt").value())->mount == "layer1");
+    CHECK(o.vfs.Exists(ParseUri("assets://mod/extra.bin").value()).value());
+
+    // Vfs 経由の書き込み
+    {
+        auto w = o.vfs.Open(ParseUri("assets://saved.dat").value(), Engine::IO::Stream::OpenWriteBinaryTruncate(true));
+        REQUIRE(w);
+    }
+    CHECK(index.Find(ParseUri("assets://saved.dat").value())->mount == "layer0");
+
+    // 木は Close の時点で取り直す（open 時点の size 0 を覚えない）
+    auto w = o.vfs.Open(ParseUri("assets://saved.dat").value(), Engine::IO::Stream::OpenWriteBinaryTruncate(true));
+    REQUIRE(w);
+    REQUIRE(w.value()->Write("hello", 5));
+    REQUIRE(w.value()->Close());
+    rec = index.Find(ParseUri("assets://saved.dat").value());
+    REQUIRE(rec);
+    CHECK(rec->sizeBytes == 5);
+}
+
+TEST_CASE("Vfs: List returns the same VFS paths with and without the directory index") {
+    Overlay o(2);
+    REQUIRE(o.layers[1]->mem.Put("root/textures/a.png", Bytes("base-a")));
+    REQUIRE(o.layers[1]->mem.Put("root/textures/b.png", Bytes("base-b")));
+    REQUIRE(o.layers[1]->mem.Put("root/readme.txt", Bytes("R")));
+    REQUIRE(o.layers[0]->mem.Put("root/textures/a.png", Bytes("mod-a!")));
+    REQUIRE(o.layers[0]->mem.Put("root/mod/a.png", Bytes("X"))); // 別ディレクトリの同名は別エントリ
+
+    auto collect = [&](const char* uri, bool recursive) {
+        ListOptions opt;
+        opt.recursive = recursive;
+        opt.includeInfo = true;
+        auto lr = o.vfs.List(ParseUri(uri).value(), opt);
+        REQUIRE(lr);
+        std::vector<std::pair<std::string, std::uint64_t>> out;
+        for (const auto& e : lr.value()) out.emplace_back(e.path, e.IsFile() ? e.info.sizeBytes : 0);
+        std::sort(out.begin(), out.end());
+        return out;
+    };
+
+    const auto rootAll = collect("assets://", true);
+    const auto rootTop = collect("assets://", false);
+    const auto textures = collect("assets://textures", false);
+    CHECK(rootAll.size() == 6);
+    CHECK(rootAll.front().first == "assets://mod");
+    CHECK(textures == std::vector<std::pair<std::string, std::uint64_t>>{
+                          { "assets://textures/a.png", 6 }, { "assets://textures/b.png", 6 } });
+
+    REQUIRE(o.vfs.EnableDirectoryIndex());
+    CHECK(collect("assets://", true) == rootAll);
+    CHECK(collect("assets://", false) == rootTop);
+    CHECK(collect("assets://textures", false) == textures);
+}
@@ -0,0 +1,101 @@
+// asset_packer：ディレクトリ以下を 1 つの pak にまとめるツール
+//
+//   asset_packer <inputDir> <out.pak> [--align N] [--compress] [--block N]
+//
+// - pak 内パスは inputDir からの相対パス（"/" 区切り）
+// - 入力ファイルは mmap して 1 件ずつ書き出す（全体をメモリに載せない）
+// - --compress で Lz ブロック圧縮（縮まないファイルはそのまま格納される）
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "engine/base/SharedBuffer.hpp"
+#include "engine/io/fs/MappedFile.hpp"
+#include "engine/io/fs/NativeFileStream.hpp"
+#include "engine/io/pak/PakWriter.hpp"
+#include "engine/io/stream/FileOpenMode.hpp"
+
+namespace {
+
+    namespace fs = std::filesystem;
+    using namespace Engine;
+
+    int Usage() {
+        std::fprintf(stderr, "usage: asset_packer <inputDir> <out.pak> [--align N] [--compress] [--block N]\n");
+        return 2;
+    }
+
+    template<class E>
+    int Fail(const char* what, const E& err) {
+        std::fprintf(stderr, "asset_packer: %s: %s (%s)\n", what, err.message.c_str(), err.detail.c_str());
+        return 1;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) return Usage();
+
+    const fs::path inputDir = argv[1];
+    const std::string outPath = argv[2];
+
+    IO::Pak::PakWriter::Options wopt;
+    IO::Pak::PakCompression compression = IO::Pak::PakCompression::None;
+    for (int i = 3; i < argc; ++i) {
+        const std::string_view a = argv[i];
+        if (a == "--align" && i + 1 < argc) {
+            wopt.alignment = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (a == "--compress") {
+            compression = IO::Pak::PakCompression::Lz;
+        } else if (a == "--block" && i + 1 < argc) {
+            wopt.lzBlockSize = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            return Usage();
+        }
+    }
+
+    std::error_code ec;
+    if (!fs::is_directory(inputDir, ec)) {
+        std::fprintf(stderr, "asset_packer: not a directory: %s\n", inputDir.string().c_str());
+        return 1;
+    }
+
+    // 出力を再現可能にするため、パス順に並べてから追加する
+    std::vector<fs::path> files;
+    for (auto it = fs::recursive_directory_iterator(inputDir, ec); !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+        if (it->is_regular_file(ec)) files.push_back(it->path());
+    }
+    if (ec) {
+        std::fprintf(stderr, "asset_packer: walk failed: %s\n", ec.message().c_str());
+        return 1;
+    }
+    std::sort(files.begin(), files.end());
+
+    IO::Pak::PakWriter writer(wopt);
+    for (const auto& f : files) {
+        const std::string rel = f.lexically_relative(inputDir).generic_string();
+        const std::string native = f.string();
+
+        auto ar = writer.Add(rel, [native]() -> IO::Pak::IoResult<Base::SharedBuffer> {
+            auto mf = IO::FS::MappedFile::Open(native);
+            if (!mf) return IO::Pak::IoResult<Base::SharedBuffer>::Err(std::move(mf.error()));
+            const auto bytes = mf.value()->Bytes();
+            return IO::Pak::IoResult<Base::SharedBuffer>::Ok(Base::SharedBuffer(std::move(mf.value()), bytes));
+        }, compression);
+        if (!ar) return Fail("add failed", ar.error());
+    }
+
+    auto out = IO::FS::NativeFileStream::Open(outPath, IO::Stream::OpenWriteBinaryTruncate(true), IO::FS::AccessHint::Sequential);
+    if (!out) return Fail("open output failed", out.error());
+
+    if (auto wr = writer.WriteTo(*out.value()); !wr) return Fail("write failed", wr.error());
+    if (auto cr = out.value()->Close(); !cr) return Fail("close failed", cr.error());
+
+    std::printf("asset_packer: %zu files -> %s\n", writer.Count(), outPath.c_str());
+    return 0;
+}